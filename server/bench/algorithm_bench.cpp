@@ -0,0 +1,246 @@
+#include "../model/container/container.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+/*
+ * @brief  #### 算法基准测试
+
+ *   - 排序：`standard_con::algorithm::sort`（pdqsort）与 `radix_sort` 对比 `std::sort`，
+ *     输入分随机、已有序、逆序、少量重复键（16 种取值）与管风琴（先升后降）五种分布，另测 16 字符随机字符串
+
+ *   - 查找：`find` / `count` 对比 `std::find` / `std::count`，1、4、8 字节整数，目标放在末尾以扫描整个区间
+
+ *   - 二分：无分支 `lower_bound` 对比 `std::lower_bound`，有序 `uint64_t` 数组上随机探测
+
+ *   - 每项输出 ns/element（排序、查找、计数为总时间 / 元素个数，二分为总时间 / 探测次数）
+
+ * 用法:
+
+ * * - `algorithm_bench [最大元素个数]`，默认依次测 1000、100000、1000000 个元素，传入参数时只测不超过该值的规模
+
+ * 注意事项:
+
+ * * - 每个排序结果都与 `std::sort` 的结果逐元素比较，查找与二分的结果与标准库逐次比较，不一致时打印并以非零状态退出
+ *
+ * * - 小规模重复多轮以摊平计时误差，排序每轮从同一份输入副本开始，拷贝不计入时间
+ *
+ * * - SIMD 宽度取决于编译选项：默认 SSE2，开启 `-mavx2` 后使用 AVX2
+*/
+namespace algorithm_bench
+{
+  inline volatile uint64_t sink = 0; // 防止结果被优化掉
+  inline bool mismatch = false;
+
+  // 每种工作负载合计处理约 400 万个元素，小规模多跑几轮
+  [[nodiscard]] inline uint64_t round_count(const uint64_t element_count) noexcept
+  {
+    const uint64_t rounds = 4000000 / element_count;
+    return rounds == 0 ? 1 : rounds;
+  }
+
+  void report(const char *algorithm_name, const char *workload_name, const uint64_t element_count, const double nanoseconds, const uint64_t operation_count)
+  {
+    std::printf("%-28s %-10s %8llu %12.3f\n", algorithm_name, workload_name,
+                static_cast<unsigned long long>(element_count), nanoseconds / static_cast<double>(operation_count));
+  }
+  void fail(const char *algorithm_name, const char *workload_name, const uint64_t element_count)
+  {
+    std::printf("MISMATCH %s %s %llu\n", algorithm_name, workload_name, static_cast<unsigned long long>(element_count));
+    mismatch = true;
+  }
+
+  /*
+   * @brief  #### `run_sort` 函数模板
+
+   *   - 对 `input` 的副本重复排序 `round_count` 轮，只计排序本身的时间，最后一轮结果与 `expected` 比较
+  */
+  template <typename value_type, typename sort_type>
+  void run_sort(const char *algorithm_name, const char *workload_name, const std::vector<value_type> &input,
+                const std::vector<value_type> &expected, sort_type &&sort_function)
+  {
+    const uint64_t rounds = round_count(input.size());
+    std::vector<value_type> working;
+    double elapsed = 0;
+    for (uint64_t round_index = 0; round_index < rounds; ++round_index)
+    {
+      working = input;
+      const auto start_time = std::chrono::steady_clock::now();
+      sort_function(working);
+      const auto stop_time = std::chrono::steady_clock::now();
+      elapsed += static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(stop_time - start_time).count());
+    }
+    if (working != expected)
+    {
+      fail(algorithm_name, workload_name, input.size());
+    }
+    report(algorithm_name, workload_name, input.size(), elapsed, rounds * input.size());
+  }
+  template <typename value_type>
+  void run_sort_trio(const char *workload_name, const std::vector<value_type> &input)
+  {
+    std::vector<value_type> expected = input;
+    std::sort(expected.begin(), expected.end());
+    run_sort("std::sort", workload_name, input, expected, [](std::vector<value_type> &working)
+             { std::sort(working.begin(), working.end()); });
+    run_sort("standard_con::sort", workload_name, input, expected, [](std::vector<value_type> &working)
+             { standard_con::algorithm::sort(working.data(), working.data() + working.size()); });
+    run_sort("standard_con::radix_sort", workload_name, input, expected, [](std::vector<value_type> &working)
+             { standard_con::algorithm::radix_sort(working.data(), working.data() + working.size()); });
+  }
+  void run_sort_suite(const uint64_t element_count, std::mt19937_64 &random_engine)
+  {
+    std::vector<uint64_t> input(element_count);
+    for (uint64_t &value_data : input)
+    {
+      value_data = random_engine();
+    }
+    run_sort_trio("random", input);
+    std::sort(input.begin(), input.end());
+    run_sort_trio("sorted", input);
+    std::reverse(input.begin(), input.end());
+    run_sort_trio("reversed", input);
+    for (uint64_t &value_data : input)
+    {
+      value_data = random_engine() % 16;
+    }
+    run_sort_trio("few_keys", input);
+    for (uint64_t value_index = 0; value_index < element_count; ++value_index)
+    {
+      input[value_index] = value_index < element_count / 2 ? value_index : element_count - value_index;
+    }
+    run_sort_trio("organ_pipe", input);
+
+    std::vector<std::string> text_input(element_count);
+    for (std::string &text : text_input)
+    {
+      text.resize(16);
+      for (char &character : text)
+      {
+        character = static_cast<char>('a' + random_engine() % 26);
+      }
+    }
+    run_sort_trio("string", text_input);
+  }
+
+  /*
+   * @brief  #### `run_scan` 函数模板
+
+   *   - 目标值只出现在末尾一次，`find` 与 `count` 都要扫描整个区间
+  */
+  template <typename element_type>
+  void run_scan(const char *width_name, const uint64_t element_count)
+  {
+    std::vector<element_type> data(element_count);
+    for (uint64_t element_index = 0; element_index < element_count; ++element_index)
+    {
+      data[element_index] = static_cast<element_type>(element_index % 100);
+    }
+    const element_type target = 101;
+    data.back() = target;
+    const element_type *begin = data.data();
+    const element_type *end = data.data() + data.size();
+    const uint64_t rounds = round_count(element_count);
+
+    auto time_scan = [&](const char *algorithm_name, auto &&scan_function, const uint64_t expected)
+    {
+      uint64_t result = 0;
+      const auto start_time = std::chrono::steady_clock::now();
+      for (uint64_t round_index = 0; round_index < rounds; ++round_index)
+      {
+        result = scan_function();
+        sink = sink + result;
+      }
+      const auto stop_time = std::chrono::steady_clock::now();
+      if (result != expected)
+      {
+        fail(algorithm_name, width_name, element_count);
+      }
+      report(algorithm_name, width_name, element_count,
+             static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(stop_time - start_time).count()), rounds * element_count);
+    };
+    time_scan("std::find", [&]
+              { return static_cast<uint64_t>(std::find(begin, end, target) - begin); }, element_count - 1);
+    time_scan("standard_con::find", [&]
+              { return static_cast<uint64_t>(standard_con::algorithm::find(begin, end, target) - begin); }, element_count - 1);
+    time_scan("std::count", [&]
+              { return static_cast<uint64_t>(std::count(begin, end, target)); }, 1);
+    time_scan("standard_con::count", [&]
+              { return standard_con::algorithm::count(begin, end, target); }, 1);
+  }
+
+  /*
+   * @brief  #### `run_lower_bound` 函数
+
+   *   - 有序数组存放偶数，探测值一半命中、一半落在两个元素之间
+  */
+  void run_lower_bound(const uint64_t element_count, std::mt19937_64 &random_engine)
+  {
+    std::vector<uint64_t> data(element_count);
+    for (uint64_t element_index = 0; element_index < element_count; ++element_index)
+    {
+      data[element_index] = element_index * 2;
+    }
+    constexpr uint64_t probe_count = 1000000;
+    std::vector<uint64_t> probes(probe_count);
+    for (uint64_t &probe : probes)
+    {
+      probe = random_engine() % (element_count * 2);
+    }
+    const uint64_t *begin = data.data();
+    const uint64_t *end = data.data() + data.size();
+
+    auto time_search = [&](const char *algorithm_name, auto &&search_function)
+    {
+      uint64_t total = 0;
+      const auto start_time = std::chrono::steady_clock::now();
+      for (const uint64_t probe : probes)
+      {
+        total += static_cast<uint64_t>(search_function(probe) - begin);
+      }
+      const auto stop_time = std::chrono::steady_clock::now();
+      sink = sink + total;
+      report(algorithm_name, "uint64", element_count,
+             static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(stop_time - start_time).count()), probe_count);
+      return total;
+    };
+    const uint64_t std_total = time_search("std::lower_bound", [&](const uint64_t probe)
+                                           { return std::lower_bound(begin, end, probe); });
+    const uint64_t scl_total = time_search("standard_con::lower_bound", [&](const uint64_t probe)
+                                           { return standard_con::algorithm::lower_bound(begin, end, probe); });
+    if (std_total != scl_total)
+    {
+      fail("standard_con::lower_bound", "uint64", element_count);
+    }
+  }
+}
+
+int main(int argc, char *argv[])
+{
+  uint64_t max_count = ~uint64_t{0};
+  if (argc > 1)
+  {
+    max_count = std::strtoull(argv[1], nullptr, 10);
+  }
+  std::mt19937_64 random_engine(20250101);
+  std::printf("%-28s %-10s %8s %12s\n", "algorithm", "workload", "count", "ns/element");
+  for (const uint64_t element_count : {uint64_t{1000}, uint64_t{100000}, uint64_t{1000000}})
+  {
+    if (element_count > max_count)
+    {
+      continue;
+    }
+    algorithm_bench::run_sort_suite(element_count, random_engine);
+    algorithm_bench::run_scan<uint8_t>("uint8", element_count);
+    algorithm_bench::run_scan<uint32_t>("uint32", element_count);
+    algorithm_bench::run_scan<uint64_t>("uint64", element_count);
+    algorithm_bench::run_lower_bound(element_count, random_engine);
+  }
+  return algorithm_bench::mismatch ? 1 : 0;
+}
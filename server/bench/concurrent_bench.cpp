@@ -0,0 +1,757 @@
+#include "../model/concurrent/container.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <functional>
+#include <latch>
+#include <set>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/*
+ * @brief  #### 并发容器基准测试与线性一致性检查
+
+ *   - 吞吐：同一组标准工作负载在 1~64 个线程下运行，输出 ns/op（墙钟时间 / 总操作数）与 Mops/s
+
+ *   - 队列与栈：`producer` 一半线程生产、一半线程消费；`mixed` 每个线程交替入队与出队
+
+ *   - 映射与集合：`read` 90% 查找；`write` 90% 插入 / 删除；`mixed` 50% 查找、25% 插入、25% 删除
+
+ *   - 松弛优先级队列：不同松弛因子 c 下的吞吐与单线程出队时的排名误差，对照 `concurrent_priority_queue` 的 `mixed` 行
+
+ *   - 线性一致性：多个线程并发执行随机操作并记录调用 / 返回时刻，再搜索是否存在与顺序模型一致、
+ *     且不违背实时先后顺序的线性化顺序；找不到时打印历史并以非零状态退出
+
+ * 用法:
+
+ * * - `concurrent_bench [最大线程数] [每组总操作数] [线性一致性轮数]`，默认 64、524288、2000
+
+ * 注意事项:
+
+ * * - 线程数超过硬件线程数时测到的是过载下的表现，锁的公平性与调度抖动都会计入
+
+ * * - 无锁栈 / 队列紧跟在对应的加锁实现之后输出，便于对照 2~64 线程下的竞争开销
+
+ * * - 线性一致性检查只覆盖单元素操作（入队、出队、插入、删除、查找），不检查快照与批量接口
+*/
+namespace concurrent_bench
+{
+  inline std::atomic<uint64_t> sink{0}; // 防止结果被优化掉
+
+  // 线程本地 xorshift 随机数，工作负载内不共享状态
+  struct random_source
+  {
+    uint64_t state;
+    explicit random_source(const uint64_t seed) noexcept : state(seed * 0x9e3779b97f4a7c15ULL | 1) {}
+    uint64_t next() noexcept
+    {
+      state ^= state << 13;
+      state ^= state >> 7;
+      state ^= state << 17;
+      return state;
+    }
+  };
+
+  /*
+   * @brief  #### `run_threads` 函数
+
+   *   - 启动 `thread_count` 个线程，全部就绪后同时放行，返回从放行到全部结束的纳秒数
+  */
+  template <typename body_type>
+  double run_threads(const uint64_t thread_count, body_type &&body)
+  {
+    std::latch ready(static_cast<std::ptrdiff_t>(thread_count) + 1);
+    std::latch release(1);
+    std::vector<std::thread> threads;
+    threads.reserve(thread_count);
+    for (uint64_t thread_index = 0; thread_index < thread_count; ++thread_index)
+    {
+      threads.emplace_back([&, thread_index]
+                           {
+                             ready.count_down();
+                             release.wait();
+                             body(thread_index); });
+    }
+    ready.arrive_and_wait();
+    const auto start_time = std::chrono::steady_clock::now();
+    release.count_down();
+    for (std::thread &thread_data : threads)
+    {
+      thread_data.join();
+    }
+    const auto stop_time = std::chrono::steady_clock::now();
+    return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(stop_time - start_time).count());
+  }
+
+  void report(const char *container_name, const char *workload_name, const uint64_t thread_count,
+              const uint64_t operation_count, const double elapsed)
+  {
+    const double operations = static_cast<double>(operation_count == 0 ? 1 : operation_count);
+    std::printf("%-40s %-9s %7llu %10.2f %10.2f\n", container_name, workload_name,
+                static_cast<unsigned long long>(thread_count), elapsed / operations, operations * 1000.0 / elapsed);
+  }
+
+  /*
+   * @brief  #### 容器适配
+
+   *   - 把各容器不同的入队 / 出队、插入 / 删除接口统一成同一组静态函数，工作负载与检查器只写一份
+  */
+  struct push_pop_adapter
+  {
+    template <typename container_type>
+    static void push(container_type &container_data, const uint64_t value_data)
+    {
+      container_data.push(value_data);
+    }
+    template <typename container_type>
+    [[nodiscard]] static bool try_pop(container_type &container_data, uint64_t &out)
+    {
+      return container_data.try_pop(out);
+    }
+  };
+  struct deque_adapter
+  {
+    template <typename container_type>
+    static void push(container_type &container_data, const uint64_t value_data)
+    {
+      container_data.push_back(value_data);
+    }
+    template <typename container_type>
+    [[nodiscard]] static bool try_pop(container_type &container_data, uint64_t &out)
+    {
+      return container_data.try_pop_front(out);
+    }
+  };
+  struct annular_adapter
+  {
+    // 有界环形队列写满时让出时间片重试，消费者会腾出空位
+    template <typename container_type>
+    static void push(container_type &container_data, const uint64_t value_data)
+    {
+      while (!container_data.try_push_back(value_data))
+      {
+        std::this_thread::yield();
+      }
+    }
+    template <typename container_type>
+    [[nodiscard]] static bool try_pop(container_type &container_data, uint64_t &out)
+    {
+      return container_data.try_pop_front(out);
+    }
+  };
+  struct map_adapter
+  {
+    template <typename map_type>
+    [[nodiscard]] static bool insert(map_type &map_data, const uint64_t key_data)
+    {
+      return map_data.insert({key_data, key_data}).second;
+    }
+    template <typename map_type>
+    [[nodiscard]] static bool erase(map_type &map_data, const uint64_t key_data)
+    {
+      return map_data.erase(key_data) != 0;
+    }
+    template <typename map_type>
+    [[nodiscard]] static bool contains(const map_type &map_data, const uint64_t key_data)
+    {
+      return map_data.contains(key_data);
+    }
+  };
+  struct set_adapter
+  {
+    template <typename set_type>
+    [[nodiscard]] static bool insert(set_type &set_data, const uint64_t key_data)
+    {
+      return set_data.insert(key_data).second;
+    }
+    template <typename set_type>
+    [[nodiscard]] static bool erase(set_type &set_data, const uint64_t key_data)
+    {
+      return set_data.erase(key_data) != 0;
+    }
+    template <typename set_type>
+    [[nodiscard]] static bool contains(const set_type &set_data, const uint64_t key_data)
+    {
+      return set_data.contains(key_data);
+    }
+  };
+
+  /*
+   * @brief  #### 队列与栈工作负载
+
+   *   - `producer`：前一半线程各生产 `operation_count / 2 / 生产者数` 个元素，其余线程出队直到取完全部元素
+   *   - `mixed`：每个线程交替入队、出队，出队失败也计为一次操作
+  */
+  template <typename container_type, typename adapter_type, typename... argument_types>
+  void run_queue(const char *container_name, const std::vector<uint64_t> &thread_counts, const uint64_t operation_count,
+                 argument_types... arguments)
+  {
+    for (const uint64_t thread_count : thread_counts)
+    {
+      if (thread_count >= 2)
+      {
+        container_type container_data(arguments...);
+        const uint64_t producer_count = thread_count / 2;
+        const uint64_t per_producer = operation_count / 2 / producer_count;
+        const uint64_t item_count = per_producer * producer_count;
+        std::atomic<uint64_t> consumed{0};
+        const double elapsed = run_threads(thread_count, [&](const uint64_t thread_index)
+                                           {
+                                             if (thread_index < producer_count)
+                                             {
+                                               for (uint64_t item_index = 0; item_index < per_producer; ++item_index)
+                                               {
+                                                 adapter_type::push(container_data, thread_index * per_producer + item_index);
+                                               }
+                                               return;
+                                             }
+                                             uint64_t total = 0;
+                                             uint64_t value_data = 0;
+                                             while (consumed.load(std::memory_order_relaxed) < item_count)
+                                             {
+                                               if (adapter_type::try_pop(container_data, value_data))
+                                               {
+                                                 total += value_data;
+                                                 consumed.fetch_add(1, std::memory_order_relaxed);
+                                               }
+                                             }
+                                             sink.fetch_add(total, std::memory_order_relaxed); });
+        report(container_name, "producer", thread_count, item_count * 2, elapsed);
+      }
+      {
+        container_type container_data(arguments...);
+        const uint64_t per_thread = operation_count / thread_count / 2;
+        const double elapsed = run_threads(thread_count, [&](const uint64_t thread_index)
+                                           {
+                                             uint64_t total = 0;
+                                             uint64_t value_data = 0;
+                                             for (uint64_t item_index = 0; item_index < per_thread; ++item_index)
+                                             {
+                                               adapter_type::push(container_data, thread_index * per_thread + item_index);
+                                               if (adapter_type::try_pop(container_data, value_data))
+                                               {
+                                                 total += value_data;
+                                               }
+                                             }
+                                             sink.fetch_add(total, std::memory_order_relaxed); });
+        report(container_name, "mixed", thread_count, per_thread * thread_count * 2, elapsed);
+      }
+    }
+  }
+
+  /*
+   * @brief  #### 映射与集合工作负载
+
+   *   - 键取自 `[0, key_range)`，开始前插入一半的键；每个线程按给定的查找比例执行，其余操作插入、删除各半
+  */
+  template <typename map_type, typename adapter_type>
+  void run_map(const char *container_name, const std::vector<uint64_t> &thread_counts, const uint64_t operation_count)
+  {
+    constexpr uint64_t key_range = 1 << 16;
+    struct workload
+    {
+      const char *name;
+      uint64_t lookup_percent;
+    };
+    for (const workload workload_data : {workload{"read", 90}, workload{"write", 10}, workload{"mixed", 50}})
+    {
+      for (const uint64_t thread_count : thread_counts)
+      {
+        map_type map_data;
+        for (uint64_t key_data = 0; key_data < key_range; key_data += 2)
+        {
+          (void)adapter_type::insert(map_data, key_data);
+        }
+        const uint64_t per_thread = operation_count / thread_count;
+        const double elapsed = run_threads(thread_count, [&](const uint64_t thread_index)
+                                           {
+                                             random_source random_engine(thread_index + 1);
+                                             uint64_t hits = 0;
+                                             for (uint64_t operation_index = 0; operation_index < per_thread; ++operation_index)
+                                             {
+                                               const uint64_t random_value = random_engine.next();
+                                               const uint64_t key_data = random_value % key_range;
+                                               const uint64_t choice = (random_value >> 32) % 100;
+                                               if (choice < workload_data.lookup_percent)
+                                               {
+                                                 hits += adapter_type::contains(map_data, key_data);
+                                               }
+                                               else if ((choice & 1) == 0)
+                                               {
+                                                 hits += adapter_type::insert(map_data, key_data);
+                                               }
+                                               else
+                                               {
+                                                 hits += adapter_type::erase(map_data, key_data);
+                                               }
+                                             }
+                                             sink.fetch_add(hits, std::memory_order_relaxed); });
+        report(container_name, workload_data.name, thread_count, per_thread * thread_count, elapsed);
+      }
+    }
+  }
+  /*
+   * @brief  #### 松弛优先级队列：排名误差与吞吐
+
+   *   - 吞吐：与 `mixed` 相同，每个线程交替入队、出队，内部堆数量取 c·P（P 为本行线程数）
+   *   - 排名误差：把 `0 ~ drain_count-1` 打乱后全部入队，再单线程逐个出队；每次出队时队列中仍比它大的元素个数即为该次的排名误差，
+   *     用树状数组维护剩余元素，输出平均值与最大值（严格优先级队列两者都为 0）
+  */
+  void run_relaxed(const std::vector<uint64_t> &thread_counts, const uint64_t operation_count)
+  {
+    constexpr uint64_t drain_count = 1 << 16;
+    std::printf("%-40s %-9s %7s %10s %10s %10s %10s\n", "container", "c", "threads", "ns/op", "Mops/s", "mean rank", "max rank");
+    for (const uint64_t relaxation_factor : {1, 2, 4, 8})
+    {
+      for (const uint64_t thread_count : thread_counts)
+      {
+        double elapsed = 0;
+        const uint64_t per_thread = operation_count / thread_count / 2;
+        {
+          multi_concurrent::relaxed_priority_queue<uint64_t> queue_data(relaxation_factor, thread_count);
+          elapsed = run_threads(thread_count, [&](const uint64_t thread_index)
+                                {
+                                  random_source random_engine(thread_index + 1);
+                                  uint64_t total = 0;
+                                  uint64_t value_data = 0;
+                                  for (uint64_t item_index = 0; item_index < per_thread; ++item_index)
+                                  {
+                                    queue_data.push(random_engine.next());
+                                    if (queue_data.try_pop(value_data))
+                                    {
+                                      total += value_data;
+                                    }
+                                  }
+                                  sink.fetch_add(total, std::memory_order_relaxed); });
+        }
+
+        multi_concurrent::relaxed_priority_queue<uint64_t> queue_data(relaxation_factor, thread_count);
+        std::vector<uint64_t> values(drain_count);
+        for (uint64_t value_index = 0; value_index < drain_count; ++value_index)
+        {
+          values[value_index] = value_index;
+        }
+        random_source random_engine(relaxation_factor * 1000 + thread_count);
+        for (uint64_t value_index = drain_count - 1; value_index > 0; --value_index)
+        {
+          std::swap(values[value_index], values[random_engine.next() % (value_index + 1)]);
+        }
+        for (const uint64_t value_data : values)
+        {
+          queue_data.push(value_data);
+        }
+        // 树状数组，fenwick[i] 覆盖 (i - lowbit(i), i] 区间内尚未出队的元素个数
+        std::vector<uint64_t> fenwick(drain_count + 1, 0);
+        for (uint64_t position = 1; position <= drain_count; ++position)
+        {
+          fenwick[position] += 1;
+          const uint64_t parent = position + (position & (~position + 1));
+          if (parent <= drain_count)
+          {
+            fenwick[parent] += fenwick[position];
+          }
+        }
+        uint64_t remaining = drain_count;
+        uint64_t rank_total = 0;
+        uint64_t rank_max = 0;
+        uint64_t value_data = 0;
+        while (queue_data.try_pop(value_data))
+        {
+          uint64_t not_greater = 0;
+          for (uint64_t position = value_data + 1; position > 0; position &= position - 1)
+          {
+            not_greater += fenwick[position];
+          }
+          const uint64_t rank_error = remaining - not_greater;
+          rank_total += rank_error;
+          rank_max = std::max(rank_max, rank_error);
+          for (uint64_t position = value_data + 1; position <= drain_count; position += position & (~position + 1))
+          {
+            fenwick[position] -= 1;
+          }
+          --remaining;
+        }
+        const double operations = static_cast<double>(per_thread * thread_count * 2);
+        std::printf("%-40s %-9llu %7llu %10.2f %10.2f %10.2f %10llu\n", "relaxed_priority_queue",
+                    static_cast<unsigned long long>(relaxation_factor), static_cast<unsigned long long>(thread_count),
+                    elapsed / operations, operations * 1000.0 / elapsed,
+                    static_cast<double>(rank_total) / static_cast<double>(drain_count), static_cast<unsigned long long>(rank_max));
+      }
+    }
+  }
+}
+
+
+namespace linearizability
+{
+  /*
+   * @brief  #### 历史记录
+
+   *   - 调用与返回时刻取自同一个全局原子计数器，计数器的先后与真实时间的先后一致
+  */
+  enum class operation_kind : uint8_t
+  {
+    push,
+    pop,
+    insert,
+    erase,
+    contains
+  };
+  struct event
+  {
+    operation_kind kind;
+    uint64_t argument;
+    uint64_t result;
+    bool success;
+    uint64_t invoke;
+    uint64_t response;
+  };
+  inline std::atomic<uint64_t> logical_clock{0};
+
+  /*
+   * @brief  #### 顺序模型
+
+   *   - `apply` 在模型上执行一次操作，返回值与历史中记录的结果一致时返回 `true` 并修改状态
+   *   - `key` 把状态编码成字符串，供搜索时记忆已失败的（剩余操作集合，状态）组合
+  */
+  struct fifo_model
+  {
+    std::deque<uint64_t> items;
+    bool apply(const event &event_data)
+    {
+      if (event_data.kind == operation_kind::push)
+      {
+        items.push_back(event_data.argument);
+        return true;
+      }
+      if (items.empty())
+      {
+        return !event_data.success;
+      }
+      if (!event_data.success || items.front() != event_data.result)
+      {
+        return false;
+      }
+      items.pop_front();
+      return true;
+    }
+    std::string key() const
+    {
+      std::string encoded;
+      for (const uint64_t item : items)
+      {
+        encoded.append(reinterpret_cast<const char *>(&item), sizeof(item));
+      }
+      return encoded;
+    }
+  };
+  struct lifo_model
+  {
+    std::vector<uint64_t> items;
+    bool apply(const event &event_data)
+    {
+      if (event_data.kind == operation_kind::push)
+      {
+        items.push_back(event_data.argument);
+        return true;
+      }
+      if (items.empty())
+      {
+        return !event_data.success;
+      }
+      if (!event_data.success || items.back() != event_data.result)
+      {
+        return false;
+      }
+      items.pop_back();
+      return true;
+    }
+    std::string key() const
+    {
+      return std::string(reinterpret_cast<const char *>(items.data()), items.size() * sizeof(uint64_t));
+    }
+  };
+  struct max_model
+  {
+    std::multiset<uint64_t> items;
+    bool apply(const event &event_data)
+    {
+      if (event_data.kind == operation_kind::push)
+      {
+        items.insert(event_data.argument);
+        return true;
+      }
+      if (items.empty())
+      {
+        return !event_data.success;
+      }
+      if (!event_data.success || *items.rbegin() != event_data.result)
+      {
+        return false;
+      }
+      items.erase(std::prev(items.end()));
+      return true;
+    }
+    std::string key() const
+    {
+      std::string encoded;
+      for (const uint64_t item : items)
+      {
+        encoded.append(reinterpret_cast<const char *>(&item), sizeof(item));
+      }
+      return encoded;
+    }
+  };
+  struct set_model
+  {
+    uint64_t present = 0; // 键取自 [0, 64)，用位图表示
+    bool apply(const event &event_data)
+    {
+      const uint64_t bit = uint64_t{1} << event_data.argument;
+      const bool found = (present & bit) != 0;
+      switch (event_data.kind)
+      {
+      case operation_kind::insert:
+        if (event_data.success == found)
+        {
+          return false;
+        }
+        present |= bit;
+        return true;
+      case operation_kind::erase:
+        if (event_data.success != found)
+        {
+          return false;
+        }
+        present &= ~bit;
+        return true;
+      default:
+        return event_data.success == found;
+      }
+    }
+    std::string key() const
+    {
+      return std::to_string(present);
+    }
+  };
+
+  /*
+   * @brief  #### `check` 函数模板
+
+   *   - Wing & Gong 式回溯：每一步只能选择"没有其他剩余操作在它调用之前就已返回"的操作作为下一个线性化点
+  */
+  template <typename model_type>
+  bool check(const std::vector<event> &history, const uint32_t remaining, const model_type &model_data,
+             std::set<std::pair<uint32_t, std::string>> &failed)
+  {
+    if (remaining == 0)
+    {
+      return true;
+    }
+    if (failed.contains({remaining, model_data.key()}))
+    {
+      return false;
+    }
+    uint64_t earliest_response = ~uint64_t{0};
+    for (uint32_t event_index = 0; event_index < history.size(); ++event_index)
+    {
+      if ((remaining >> event_index & 1) != 0)
+      {
+        earliest_response = std::min(earliest_response, history[event_index].response);
+      }
+    }
+    for (uint32_t event_index = 0; event_index < history.size(); ++event_index)
+    {
+      if ((remaining >> event_index & 1) == 0 || history[event_index].invoke > earliest_response)
+      {
+        continue;
+      }
+      model_type next_model = model_data;
+      if (next_model.apply(history[event_index]) &&
+          check(history, remaining & ~(uint32_t{1} << event_index), next_model, failed))
+      {
+        return true;
+      }
+    }
+    failed.insert({remaining, model_data.key()});
+    return false;
+  }
+
+  void print_history(const char *container_name, const std::vector<event> &history)
+  {
+    static constexpr const char *kind_names[] = {"push", "pop", "insert", "erase", "contains"};
+    std::printf("linearizability violation: %s\n", container_name);
+    for (const event &event_data : history)
+    {
+      std::printf("  [%6llu, %6llu] %-8s arg=%llu success=%d result=%llu\n",
+                  static_cast<unsigned long long>(event_data.invoke), static_cast<unsigned long long>(event_data.response),
+                  kind_names[static_cast<uint8_t>(event_data.kind)], static_cast<unsigned long long>(event_data.argument),
+                  event_data.success ? 1 : 0, static_cast<unsigned long long>(event_data.result));
+    }
+  }
+
+  /*
+   * @brief  #### `verify_queue` / `verify_map` 函数模板
+
+   *   - 每轮新建容器，3 个线程各执行 5 次随机操作后检查整段历史，返回是否全部轮次都可线性化
+  */
+  constexpr uint64_t round_threads = 3;
+  constexpr uint64_t round_operations = 5;
+
+  // 放行后再自旋对齐一次，让各线程的操作在时间上真正交错，而不是被线程唤醒的先后拉开
+  inline void spin_barrier(std::atomic<uint64_t> &arrived) noexcept
+  {
+    arrived.fetch_add(1);
+    while (arrived.load() < round_threads)
+    {
+    }
+  }
+
+  template <typename container_type, typename adapter_type, typename model_type, typename... argument_types>
+  bool verify_queue(const char *container_name, const uint64_t round_count, argument_types... arguments)
+  {
+    for (uint64_t round_index = 0; round_index < round_count; ++round_index)
+    {
+      container_type container_data(arguments...);
+      std::vector<event> history(round_threads * round_operations);
+      std::atomic<uint64_t> arrived{0};
+      concurrent_bench::run_threads(round_threads, [&](const uint64_t thread_index)
+                                    {
+                                      spin_barrier(arrived);
+                                      concurrent_bench::random_source random_engine(round_index * round_threads + thread_index + 1);
+                                      for (uint64_t operation_index = 0; operation_index < round_operations; ++operation_index)
+                                      {
+                                        event &event_data = history[thread_index * round_operations + operation_index];
+                                        event_data.invoke = logical_clock.fetch_add(1);
+                                        if (random_engine.next() % 2 == 0)
+                                        {
+                                          event_data.kind = operation_kind::push;
+                                          event_data.argument = thread_index * 100 + operation_index + 1;
+                                          adapter_type::push(container_data, event_data.argument);
+                                          event_data.success = true;
+                                        }
+                                        else
+                                        {
+                                          event_data.kind = operation_kind::pop;
+                                          event_data.success = adapter_type::try_pop(container_data, event_data.result);
+                                        }
+                                        event_data.response = logical_clock.fetch_add(1);
+                                      } });
+      std::set<std::pair<uint32_t, std::string>> failed;
+      if (!check(history, (uint32_t{1} << history.size()) - 1, model_type(), failed))
+      {
+        print_history(container_name, history);
+        return false;
+      }
+    }
+    std::printf("%-40s linearizable (%llu rounds)\n", container_name, static_cast<unsigned long long>(round_count));
+    return true;
+  }
+
+  template <typename map_type, typename adapter_type>
+  bool verify_map(const char *container_name, const uint64_t round_count)
+  {
+    for (uint64_t round_index = 0; round_index < round_count; ++round_index)
+    {
+      map_type map_data;
+      std::vector<event> history(round_threads * round_operations);
+      std::atomic<uint64_t> arrived{0};
+      concurrent_bench::run_threads(round_threads, [&](const uint64_t thread_index)
+                                    {
+                                      spin_barrier(arrived);
+                                      concurrent_bench::random_source random_engine(round_index * round_threads + thread_index + 1);
+                                      for (uint64_t operation_index = 0; operation_index < round_operations; ++operation_index)
+                                      {
+                                        event &event_data = history[thread_index * round_operations + operation_index];
+                                        const uint64_t random_value = random_engine.next();
+                                        event_data.argument = random_value % 3; // 键很少，操作之间冲突频繁
+                                        event_data.invoke = logical_clock.fetch_add(1);
+                                        switch (random_value >> 32 & 3)
+                                        {
+                                        case 0:
+                                          event_data.kind = operation_kind::contains;
+                                          event_data.success = adapter_type::contains(map_data, event_data.argument);
+                                          break;
+                                        case 1:
+                                          event_data.kind = operation_kind::erase;
+                                          event_data.success = adapter_type::erase(map_data, event_data.argument);
+                                          break;
+                                        default:
+                                          event_data.kind = operation_kind::insert;
+                                          event_data.success = adapter_type::insert(map_data, event_data.argument);
+                                          break;
+                                        }
+                                        event_data.response = logical_clock.fetch_add(1);
+                                      } });
+      std::set<std::pair<uint32_t, std::string>> failed;
+      if (!check(history, (uint32_t{1} << history.size()) - 1, set_model(), failed))
+      {
+        print_history(container_name, history);
+        return false;
+      }
+    }
+    std::printf("%-40s linearizable (%llu rounds)\n", container_name, static_cast<unsigned long long>(round_count));
+    return true;
+  }
+}
+
+int main(int argc, char *argv[])
+{
+  namespace mco = multi_concurrent;
+  using namespace concurrent_bench;
+  uint64_t max_threads = 64;
+  uint64_t operation_count = uint64_t{1} << 19;
+  uint64_t round_count = 2000;
+  if (argc > 1)
+  {
+    max_threads = std::strtoull(argv[1], nullptr, 10);
+  }
+  if (argc > 2)
+  {
+    operation_count = std::strtoull(argv[2], nullptr, 10);
+  }
+  if (argc > 3)
+  {
+    round_count = std::strtoull(argv[3], nullptr, 10);
+  }
+  std::vector<uint64_t> thread_counts;
+  for (uint64_t thread_count = 1; thread_count <= max_threads; thread_count *= 2)
+  {
+    thread_counts.push_back(thread_count);
+  }
+
+  bool linearizable = true;
+  linearizable &= linearizability::verify_queue<mco::concurrent_queue<uint64_t>, push_pop_adapter, linearizability::fifo_model>("concurrent_queue", round_count);
+  linearizable &= linearizability::verify_queue<mco::concurrent_deque<uint64_t>, deque_adapter, linearizability::fifo_model>("concurrent_deque", round_count);
+  linearizable &= linearizability::verify_queue<mco::concurrent_annular_queue<uint64_t>, annular_adapter, linearizability::fifo_model>("concurrent_annular_queue", round_count, std::size_t{64});
+  linearizable &= linearizability::verify_queue<mco::lock_free_queue<uint64_t>, push_pop_adapter, linearizability::fifo_model>("lock_free_queue", round_count);
+  linearizable &= linearizability::verify_queue<mco::concurrent_stack<uint64_t>, push_pop_adapter, linearizability::lifo_model>("concurrent_stack", round_count);
+  linearizable &= linearizability::verify_queue<mco::lock_free_stack<uint64_t>, push_pop_adapter, linearizability::lifo_model>("lock_free_stack", round_count);
+  linearizable &= linearizability::verify_queue<mco::concurrent_priority_queue<uint64_t>, push_pop_adapter, linearizability::max_model>("concurrent_priority_queue", round_count);
+  linearizable &= linearizability::verify_map<mco::concurrent_map<uint64_t, uint64_t>, map_adapter>("concurrent_map", round_count);
+  linearizable &= linearizability::verify_map<mco::concurrent_unordered_map<uint64_t, uint64_t>, map_adapter>("concurrent_unordered_map", round_count);
+  linearizable &= linearizability::verify_map<mco::concurrent_set<uint64_t>, set_adapter>("concurrent_set", round_count);
+  linearizable &= linearizability::verify_map<mco::concurrent_unordered_set<uint64_t>, set_adapter>("concurrent_unordered_set", round_count);
+
+  std::printf("%-40s %-9s %7s %10s %10s\n", "container", "workload", "threads", "ns/op", "Mops/s");
+  run_queue<mco::concurrent_queue<uint64_t>, push_pop_adapter>("concurrent_queue", thread_counts, operation_count);
+  run_queue<mco::lock_free_queue<uint64_t>, push_pop_adapter>("lock_free_queue", thread_counts, operation_count);
+  run_queue<mco::concurrent_deque<uint64_t>, deque_adapter>("concurrent_deque", thread_counts, operation_count);
+  run_queue<mco::concurrent_annular_queue<uint64_t>, annular_adapter>("concurrent_annular_queue", thread_counts, operation_count, std::size_t{1024});
+  run_queue<mco::concurrent_stack<uint64_t>, push_pop_adapter>("concurrent_stack", thread_counts, operation_count);
+  run_queue<mco::lock_free_stack<uint64_t>, push_pop_adapter>("lock_free_stack", thread_counts, operation_count);
+  run_queue<mco::concurrent_priority_queue<uint64_t>, push_pop_adapter>("concurrent_priority_queue", thread_counts, operation_count);
+  run_map<mco::concurrent_map<uint64_t, uint64_t>, map_adapter>("concurrent_map", thread_counts, operation_count);
+  run_map<mco::concurrent_unordered_map<uint64_t, uint64_t>, map_adapter>("concurrent_unordered_map", thread_counts, operation_count);
+  run_map<mco::concurrent_set<uint64_t>, set_adapter>("concurrent_set", thread_counts, operation_count);
+  run_map<mco::concurrent_unordered_set<uint64_t>, set_adapter>("concurrent_unordered_set", thread_counts, operation_count);
+  run_relaxed(thread_counts, operation_count);
+  return linearizable ? 0 : 1;
+}
@@ -0,0 +1,993 @@
+#include "../model/container/container.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <filesystem>
+#include <fstream>
+#include <list>
+#include <map>
+#include <memory>
+#include <new>
+#include <optional>
+#include <queue>
+#include <random>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+/*
+ * @brief  #### 容器基准测试
+
+ *   - `standard_con` 容器与对应 `std` 容器在同一组工作负载下对比：插入、查找、删除、遍历、拷贝、析构
+
+ *   - 字符串：短字符串（内联）与长字符串的构造、`std::string_view` 互转与追加
+
+ *   - 哈希：会话 id、URL、场景 id 三类键分布下的哈希吞吐与分桶碰撞率
+
+ *   - 共享指针：`make_shared` 创建、拷贝与析构，对比 `std::shared_ptr`
+
+ *   - 堆：二叉堆与 4 叉、8 叉堆的入堆/出堆，对比 `std::priority_queue`；索引堆按句柄改写优先级
+
+ *   - 每项输出 ns/op、allocs/op 与峰值内存（工作负载期间相对起点新增的最大存活字节数）
+
+ * 用法:
+
+ * * - `container_bench [最大元素个数]`，默认依次测 1000、100000 个元素，传入参数时只测不超过该值的规模
+ *
+ * * - 有序映射查找另按 1 千 ~ 1 千万个键分档，同样受最大元素个数限制
+ *
+ * * - `flat_map` 与 `tree_map`、`hash_map` 的交叉点另按 16 ~ 16384 个键分档，同样受最大元素个数限制
+ *
+ * * - 二进制镜像加载与文本重建另按 1 千 ~ 100 万个键分档，临时文件写在系统临时目录，结束后删除
+ *
+ * * - 元素宽度分 8 字节与 64 字节两档，映射容器的键固定为 `uint64_t`，宽度指值的大小；`<text>` 行的元素为 32 字符的堆字符串，size 列为对象大小
+
+ * 注意事项:
+
+ * * - 分配统计通过替换全局 `operator new` / `operator delete`（含过对齐版本）实现，不统计直接调用 `malloc` 的分配
+ *
+ * * - 计时包含容器自身的全部开销（分配、重哈希、平衡），不扣除循环本身的开销
+*/
+namespace bench_memory
+{
+  inline uint64_t allocation_count = 0;
+  inline uint64_t live_bytes = 0;
+  inline uint64_t peak_bytes = 0;
+
+  // 返回地址之前 16 字节记录请求大小与 malloc 原始地址，普通与过对齐分配共用，任何形式的 delete 都能找回原始块
+  inline void *tracked_allocate(const std::size_t size, std::size_t alignment)
+  {
+    alignment = alignment < 16 ? 16 : alignment;
+    unsigned char *raw_block = static_cast<unsigned char *>(std::malloc(size + alignment + 16));
+    if (raw_block == nullptr)
+    {
+      throw std::bad_alloc();
+    }
+    const uintptr_t user_address = (reinterpret_cast<uintptr_t>(raw_block) + 16 + alignment - 1) / alignment * alignment;
+    unsigned char *user_block = raw_block + (user_address - reinterpret_cast<uintptr_t>(raw_block));
+    std::memcpy(user_block - 16, &size, sizeof(size));
+    std::memcpy(user_block - 8, &raw_block, sizeof(raw_block));
+    ++allocation_count;
+    live_bytes += size;
+    if (live_bytes > peak_bytes)
+    {
+      peak_bytes = live_bytes;
+    }
+    return user_block;
+  }
+  inline void tracked_release(void *pointer) noexcept
+  {
+    if (pointer == nullptr)
+    {
+      return;
+    }
+    unsigned char *user_block = static_cast<unsigned char *>(pointer);
+    std::size_t size;
+    unsigned char *raw_block;
+    std::memcpy(&size, user_block - 16, sizeof(size));
+    std::memcpy(&raw_block, user_block - 8, sizeof(raw_block));
+    live_bytes -= size;
+    std::free(raw_block);
+  }
+}
+
+void *operator new(std::size_t size)
+{
+  return bench_memory::tracked_allocate(size, alignof(std::max_align_t));
+}
+void *operator new[](std::size_t size)
+{
+  return bench_memory::tracked_allocate(size, alignof(std::max_align_t));
+}
+void *operator new(std::size_t size, std::align_val_t alignment)
+{
+  return bench_memory::tracked_allocate(size, static_cast<std::size_t>(alignment));
+}
+void *operator new[](std::size_t size, std::align_val_t alignment)
+{
+  return bench_memory::tracked_allocate(size, static_cast<std::size_t>(alignment));
+}
+void operator delete(void *pointer) noexcept
+{
+  bench_memory::tracked_release(pointer);
+}
+void operator delete[](void *pointer) noexcept
+{
+  bench_memory::tracked_release(pointer);
+}
+void operator delete(void *pointer, std::size_t) noexcept
+{
+  bench_memory::tracked_release(pointer);
+}
+void operator delete[](void *pointer, std::size_t) noexcept
+{
+  bench_memory::tracked_release(pointer);
+}
+void operator delete(void *pointer, std::align_val_t) noexcept
+{
+  bench_memory::tracked_release(pointer);
+}
+void operator delete[](void *pointer, std::align_val_t) noexcept
+{
+  bench_memory::tracked_release(pointer);
+}
+void operator delete(void *pointer, std::size_t, std::align_val_t) noexcept
+{
+  bench_memory::tracked_release(pointer);
+}
+void operator delete[](void *pointer, std::size_t, std::align_val_t) noexcept
+{
+  bench_memory::tracked_release(pointer);
+}
+
+namespace container_bench
+{
+  template <uint64_t payload_size>
+  struct payload
+  {
+    uint64_t words[payload_size / sizeof(uint64_t)]{};
+    payload() = default;
+    explicit payload(const uint64_t seed) noexcept
+    {
+      for (uint64_t &word : words)
+      {
+        word = seed;
+      }
+    }
+  };
+  template <uint64_t payload_size>
+  [[nodiscard]] uint64_t checksum(const payload<payload_size> &payload_data) noexcept
+  {
+    return payload_data.words[0];
+  }
+  // 非平凡元素：超出短字符串容量的堆字符串，拷贝需分配、移动需改写指针，不能 memcpy 迁移
+  struct text_payload
+  {
+    std::string text;
+    text_payload() = default;
+    explicit text_payload(const uint64_t seed) : text(32, static_cast<char>('a' + seed % 26)) {}
+  };
+  [[nodiscard]] inline uint64_t checksum(const text_payload &payload_data) noexcept
+  {
+    return static_cast<uint64_t>(static_cast<unsigned char>(payload_data.text[0]));
+  }
+  template <typename element_type>
+  [[nodiscard]] uint64_t checksum(const element_type &element_data) noexcept
+  {
+    return static_cast<uint64_t>(element_data);
+  }
+
+  inline volatile uint64_t sink = 0; // 防止结果被优化掉
+
+  /*
+   * @brief  #### `measure` 函数模板
+
+   *   - 执行一次工作负载并打印一行结果，`operation_count` 为工作负载内的操作次数
+  */
+  template <typename workload_type>
+  void measure(const char *container_name, const char *workload_name, const uint64_t element_size,
+               const uint64_t element_count, const uint64_t operation_count, workload_type &&workload)
+  {
+    const uint64_t start_allocations = bench_memory::allocation_count;
+    const uint64_t start_live = bench_memory::live_bytes;
+    bench_memory::peak_bytes = start_live;
+    const auto start_time = std::chrono::steady_clock::now();
+    workload();
+    const auto stop_time = std::chrono::steady_clock::now();
+    const double elapsed = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(stop_time - start_time).count());
+    const double operations = static_cast<double>(operation_count == 0 ? 1 : operation_count);
+    std::printf("%-28s %-8s %4llu %8llu %12.2f %10.3f %12llu\n", container_name, workload_name,
+                static_cast<unsigned long long>(element_size), static_cast<unsigned long long>(element_count),
+                elapsed / operations, static_cast<double>(bench_memory::allocation_count - start_allocations) / operations,
+                static_cast<unsigned long long>(bench_memory::peak_bytes - start_live));
+  }
+
+  /*
+   * @brief  #### 容器适配
+
+   *   - 把 `std` 与 `standard_con` 不同的插入 / 查找 / 删除接口统一成同一组静态函数，工作负载只写一份
+  */
+  struct std_map_adapter
+  {
+    template <typename map_type, typename value_type>
+    static void insert(map_type &map_data, const uint64_t key_data, const value_type &value_data)
+    {
+      map_data.emplace(key_data, value_data);
+    }
+    template <typename map_type>
+    [[nodiscard]] static bool contains(map_type &map_data, const uint64_t key_data)
+    {
+      return map_data.find(key_data) != map_data.end();
+    }
+    template <typename map_type>
+    static void erase(map_type &map_data, const uint64_t key_data)
+    {
+      map_data.erase(key_data);
+    }
+  };
+  struct scl_map_adapter
+  {
+    // standard_con 的映射容器以键值对作为查找 / 删除参数，只比较其中的键
+    template <typename map_type, typename value_type>
+    static void insert(map_type &map_data, const uint64_t key_data, const value_type &value_data)
+    {
+      map_data.push(standard_con::pair<uint64_t, value_type>(key_data, value_data));
+    }
+    template <typename map_type>
+    [[nodiscard]] static bool contains(map_type &map_data, const uint64_t key_data)
+    {
+      using value_type = std::remove_cvref_t<decltype(map_data.begin()->second)>;
+      return map_data.find(standard_con::pair<uint64_t, value_type>(key_data, value_type())) != map_data.end();
+    }
+    template <typename map_type>
+    static void erase(map_type &map_data, const uint64_t key_data)
+    {
+      using value_type = std::remove_cvref_t<decltype(map_data.begin()->second)>;
+      map_data.pop(standard_con::pair<uint64_t, value_type>(key_data, value_type()));
+    }
+  };
+
+  struct avl_tree_adapter
+  {
+    // balance_tree 按键查找 / 删除，查找返回节点指针
+    template <typename map_type, typename value_type>
+    static void insert(map_type &map_data, const uint64_t key_data, const value_type &value_data)
+    {
+      map_data.push(key_data, value_data);
+    }
+    template <typename map_type>
+    [[nodiscard]] static bool contains(map_type &map_data, const uint64_t key_data)
+    {
+      return map_data.find(key_data) != nullptr;
+    }
+    template <typename map_type>
+    static void erase(map_type &map_data, const uint64_t key_data)
+    {
+      map_data.pop(key_data);
+    }
+  };
+
+  template <typename map_type, typename adapter_type, typename value_type>
+  void run_map(const char *container_name, const std::vector<uint64_t> &keys, const std::vector<uint64_t> &probes)
+  {
+    const uint64_t element_count = keys.size();
+    std::optional<map_type> map_data;
+    map_data.emplace();
+    measure(container_name, "insert", sizeof(value_type), element_count, element_count, [&]
+            {
+              for (const uint64_t key_data : keys)
+              {
+                adapter_type::insert(*map_data, key_data, value_type(key_data));
+              } });
+    measure(container_name, "lookup", sizeof(value_type), element_count, probes.size(), [&]
+            {
+              uint64_t hits = 0;
+              for (const uint64_t key_data : probes)
+              {
+                hits += adapter_type::contains(*map_data, key_data);
+              }
+              sink = sink + hits; });
+    measure(container_name, "iterate", sizeof(value_type), element_count, element_count, [&]
+            {
+              uint64_t total = 0;
+              for (auto &entry_data : *map_data)
+              {
+                total += checksum(entry_data.second);
+              }
+              sink = sink + total; });
+    std::optional<map_type> copy_data;
+    measure(container_name, "copy", sizeof(value_type), element_count, element_count, [&]
+            { copy_data.emplace(*map_data); });
+    measure(container_name, "erase", sizeof(value_type), element_count, element_count, [&]
+            {
+              for (const uint64_t key_data : keys)
+              {
+                adapter_type::erase(*map_data, key_data);
+              } });
+    measure(container_name, "destroy", sizeof(value_type), element_count, element_count, [&]
+            { copy_data.reset(); });
+  }
+
+  template <typename sequence_type, typename value_type, bool random_access>
+  void run_sequence(const char *container_name, const std::vector<uint64_t> &probes, const uint64_t element_count)
+  {
+    std::optional<sequence_type> sequence_data;
+    sequence_data.emplace();
+    measure(container_name, "insert", sizeof(value_type), element_count, element_count, [&]
+            {
+              for (uint64_t element_index = 0; element_index < element_count; ++element_index)
+              {
+                sequence_data->push_back(value_type(element_index));
+              } });
+    if constexpr (random_access)
+    {
+      measure(container_name, "lookup", sizeof(value_type), element_count, probes.size(), [&]
+              {
+                uint64_t total = 0;
+                for (const uint64_t probe_index : probes)
+                {
+                  total += checksum((*sequence_data)[probe_index % element_count]);
+                }
+                sink = sink + total; });
+    }
+    measure(container_name, "iterate", sizeof(value_type), element_count, element_count, [&]
+            {
+              uint64_t total = 0;
+              for (auto &element_data : *sequence_data)
+              {
+                total += checksum(element_data);
+              }
+              sink = sink + total; });
+    std::optional<sequence_type> copy_data;
+    measure(container_name, "copy", sizeof(value_type), element_count, element_count, [&]
+            { copy_data.emplace(*sequence_data); });
+    measure(container_name, "erase", sizeof(value_type), element_count, element_count, [&]
+            {
+              for (uint64_t element_index = 0; element_index < element_count; ++element_index)
+              {
+                sequence_data->pop_back();
+              } });
+    measure(container_name, "destroy", sizeof(value_type), element_count, element_count, [&]
+            { copy_data.reset(); });
+  }
+
+  /*
+   * @brief  #### `run_queue` 函数模板
+
+   *   - `fill`：连续入队 `element_count` 个元素；`drain`：逐个取队首并出队直到为空
+   *   - `steady`：队列保持 64 个元素，每次入队一个、出队一个，模拟工作队列的稳态
+  */
+  template <typename queue_type, typename value_type>
+  void run_queue(const char *container_name, const uint64_t element_count)
+  {
+    queue_type queue_data;
+    measure(container_name, "fill", sizeof(value_type), element_count, element_count, [&]
+            {
+              for (uint64_t element_index = 0; element_index < element_count; ++element_index)
+              {
+                queue_data.push(value_type(element_index));
+              } });
+    measure(container_name, "drain", sizeof(value_type), element_count, element_count, [&]
+            {
+              uint64_t total = 0;
+              while (!queue_data.empty())
+              {
+                total += checksum(queue_data.front());
+                queue_data.pop();
+              }
+              sink = sink + total; });
+    for (uint64_t element_index = 0; element_index < 64; ++element_index)
+    {
+      queue_data.push(value_type(element_index));
+    }
+    measure(container_name, "steady", sizeof(value_type), element_count, element_count, [&]
+            {
+              uint64_t total = 0;
+              for (uint64_t element_index = 0; element_index < element_count; ++element_index)
+              {
+                queue_data.push(value_type(element_index));
+                total += checksum(queue_data.front());
+                queue_data.pop();
+              }
+              sink = sink + total; });
+  }
+
+  /*
+   * @brief  #### `run_heap` 函数模板
+
+   *   - `push`：乱序键逐个入堆；`pop`：逐个取堆顶并出堆直到为空
+   *   - 用于比较二叉堆与 d 叉堆：d 越大树越矮、上浮越快，但每层下沉要比较 d 个孩子
+  */
+  template <typename heap_type>
+  void run_heap(const char *container_name, const std::vector<uint64_t> &keys)
+  {
+    heap_type heap_data;
+    measure(container_name, "push", sizeof(uint64_t), keys.size(), keys.size(), [&]
+            {
+              for (const uint64_t key : keys)
+              {
+                heap_data.push(key);
+              } });
+    measure(container_name, "pop", sizeof(uint64_t), keys.size(), keys.size(), [&]
+            {
+              uint64_t total = 0;
+              while (!heap_data.empty())
+              {
+                total += heap_data.top();
+                heap_data.pop();
+              }
+              sink = sink + total; });
+  }
+
+  /*
+   * @brief  #### `run_indexed_heap` 函数模板
+
+   *   - `update`：堆中保持全部元素，按句柄随机改写优先级并就地上浮或下沉，模拟定时器重置
+  */
+  template <typename heap_type>
+  void run_indexed_heap(const char *container_name, const std::vector<uint64_t> &keys, std::mt19937_64 &random_engine)
+  {
+    heap_type heap_data;
+    std::vector<uint64_t> handles;
+    handles.reserve(keys.size());
+    for (const uint64_t key : keys)
+    {
+      handles.push_back(heap_data.push(key));
+    }
+    std::vector<std::pair<uint64_t, uint64_t>> updates(keys.size());
+    for (auto &update_data : updates)
+    {
+      update_data = {handles[random_engine() % handles.size()], random_engine()};
+    }
+    measure(container_name, "update", sizeof(uint64_t), keys.size(), keys.size(), [&]
+            {
+              for (const auto &[handle, value_data] : updates)
+              {
+                heap_data.update(handle, value_data);
+              }
+              sink = sink + heap_data.top(); });
+  }
+  void run_heap_suite(const uint64_t element_count, std::mt19937_64 &random_engine)
+  {
+    std::vector<uint64_t> keys(element_count);
+    for (uint64_t &key : keys)
+    {
+      key = random_engine();
+    }
+    run_heap<std::priority_queue<uint64_t>>("std::priority_queue", keys);
+    run_heap<standard_con::priority_queue<uint64_t, standard_con::less<uint64_t>, standard_con::vector<uint64_t>, 2>>("standard_con::pq<2>", keys);
+    run_heap<standard_con::priority_queue<uint64_t, standard_con::less<uint64_t>, standard_con::vector<uint64_t>, 4>>("standard_con::pq<4>", keys);
+    run_heap<standard_con::priority_queue<uint64_t, standard_con::less<uint64_t>, standard_con::vector<uint64_t>, 8>>("standard_con::pq<8>", keys);
+    run_indexed_heap<standard_con::indexed_priority_queue<uint64_t, standard_con::less<uint64_t>, 2>>("standard_con::indexed_pq<2>", keys, random_engine);
+    run_indexed_heap<standard_con::indexed_priority_queue<uint64_t, standard_con::less<uint64_t>, 4>>("standard_con::indexed_pq<4>", keys, random_engine);
+    run_indexed_heap<standard_con::indexed_priority_queue<uint64_t, standard_con::less<uint64_t>, 8>>("standard_con::indexed_pq<8>", keys, random_engine);
+  }
+
+  template <typename string_type>
+  void run_string(const char *container_name, const uint64_t element_count)
+  {
+    std::optional<string_type> string_data;
+    string_data.emplace();
+    measure(container_name, "insert", 1, element_count, element_count, [&]
+            {
+              for (uint64_t element_index = 0; element_index < element_count; ++element_index)
+              {
+                string_data->push_back(static_cast<char>('a' + element_index % 26));
+              } });
+    // 查找一个不存在的子串，每次都扫描整个字符串
+    measure(container_name, "lookup", 1, element_count, element_count, [&]
+            { sink = sink + string_data->find(std::string_view("zyxw")); });
+    std::optional<string_type> copy_data;
+    measure(container_name, "copy", 1, element_count, element_count, [&]
+            { copy_data.emplace(*string_data); });
+    measure(container_name, "destroy", 1, element_count, element_count, [&]
+            { copy_data.reset(); });
+  }
+
+  /*
+   * @brief  #### `run_short_string` 函数模板
+
+   *   - `sso` / `heap`：从 `std::string_view` 构造 `element_count` 个 16 字符（可内联）或 40 字符（需堆分配）的字符串
+   *   - `view`：把每个字符串零拷贝转换为 `std::string_view` 后与目标比较
+   *   - `append`：逐段追加 `std::string_view`，拼出 `element_count` 个 8 字符片段
+  */
+  template <typename string_type>
+  void run_short_string(const char *container_name, const uint64_t element_count)
+  {
+    constexpr std::string_view source("0123456789abcdefghijklmnopqrstuvwxyz0123456789");
+    for (const uint64_t text_length : {uint64_t{16}, uint64_t{40}})
+    {
+      std::vector<string_type> strings;
+      strings.reserve(element_count);
+      measure(container_name, text_length <= 16 ? "sso" : "heap", text_length, element_count, element_count, [&]
+              {
+                for (uint64_t element_index = 0; element_index < element_count; ++element_index)
+                {
+                  strings.emplace_back(source.substr(element_index % 6, text_length));
+                } });
+      measure(container_name, "view", text_length, element_count, element_count, [&]
+              {
+                const std::string_view target = source.substr(3, text_length);
+                uint64_t hits = 0;
+                for (const string_type &string_data : strings)
+                {
+                  hits += std::string_view(string_data) == target;
+                }
+                sink = sink + hits; });
+      measure(container_name, "destroy", text_length, element_count, element_count, [&]
+              { strings.clear(); });
+    }
+    string_type string_data;
+    measure(container_name, "append", 8, element_count, element_count, [&]
+            {
+              for (uint64_t element_index = 0; element_index < element_count; ++element_index)
+              {
+                string_data.append(source.substr(element_index % 32, 8));
+              } });
+    sink = sink + std::string_view(string_data).size();
+  }
+
+  /*
+   * @brief  #### `run_shared_pointer` 函数模板
+
+   *   - `make`：逐个创建共享指针；`copy`：每个指针拷贝一份（仅增加引用计数）；
+   *     `destroy`：销毁拷贝（仅减少引用计数）；`release`：销毁原指针（释放对象与控制块）
+  */
+  template <typename pointer_type, typename make_type>
+  void run_shared_pointer(const char *container_name, const uint64_t element_count, make_type &&make_pointer)
+  {
+    std::vector<pointer_type> owners;
+    std::vector<pointer_type> copies;
+    owners.reserve(element_count);
+    copies.reserve(element_count);
+    measure(container_name, "make", sizeof(uint64_t), element_count, element_count, [&]
+            {
+              for (uint64_t element_index = 0; element_index < element_count; ++element_index)
+              {
+                owners.push_back(make_pointer(element_index));
+              } });
+    measure(container_name, "copy", sizeof(uint64_t), element_count, element_count, [&]
+            {
+              for (const pointer_type &owner : owners)
+              {
+                copies.push_back(owner);
+              } });
+    measure(container_name, "destroy", sizeof(uint64_t), element_count, element_count, [&]
+            { copies.clear(); });
+    measure(container_name, "release", sizeof(uint64_t), element_count, element_count, [&]
+            { owners.clear(); });
+  }
+
+  void run_text_sequence(const uint64_t element_count, std::mt19937_64 &random_engine)
+  {
+    std::vector<uint64_t> probes(element_count);
+    for (uint64_t &probe_index : probes)
+    {
+      probe_index = random_engine();
+    }
+    run_sequence<std::vector<text_payload>, text_payload, true>("std::vector<text>", probes, element_count);
+    run_sequence<standard_con::vector<text_payload>, text_payload, true>("standard_con::vector<text>", probes, element_count);
+  }
+
+  /*
+   * @brief  #### `run_hash_quality` 函数
+
+   *   - 三类服务端键：`session` 32 位十六进制会话 id；`url` 共享长前缀、只在数字段不同的静态资源路径；
+   *     `scene` 高位递增、低 3 位为分区号的整数场景 id
+   *   - ns/hash 为逐个哈希全部键的平均耗时；`collide` 为按哈希低位落入 2 的幂个桶后，实际碰撞对数与均匀分布期望值之比（1.0 为理想），
+   *     `max` 为最满桶的键数
+  */
+  template <typename key_type, typename hasher_type>
+  void hash_quality(const char *hasher_name, const char *key_name, const std::vector<key_type> &keys, hasher_type hasher)
+  {
+    const uint64_t key_count = keys.size();
+    uint64_t bucket_count = 1;
+    while (bucket_count < key_count)
+    {
+      bucket_count <<= 1;
+    }
+    std::vector<uint64_t> hashes(key_count);
+    for (uint64_t key_index = 0; key_index < key_count; ++key_index)
+    {
+      hashes[key_index] = hasher(keys[key_index]); // 预热，键与结果数组都进入缓存后再计时
+    }
+    const auto start_time = std::chrono::steady_clock::now();
+    for (uint64_t key_index = 0; key_index < key_count; ++key_index)
+    {
+      hashes[key_index] = hasher(keys[key_index]);
+    }
+    const auto stop_time = std::chrono::steady_clock::now();
+    std::vector<uint64_t> buckets(bucket_count, 0);
+    for (const uint64_t hash_value : hashes)
+    {
+      ++buckets[hash_value & (bucket_count - 1)];
+    }
+    double collisions = 0;
+    uint64_t max_load = 0;
+    for (const uint64_t load : buckets)
+    {
+      collisions += static_cast<double>(load) * static_cast<double>(load - (load != 0)) / 2;
+      max_load = std::max(max_load, load);
+    }
+    const double expected = static_cast<double>(key_count) * static_cast<double>(key_count - 1) / 2 / static_cast<double>(bucket_count);
+    const double elapsed = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(stop_time - start_time).count());
+    std::printf("%-28s %-8s %8llu %12.2f %10.3f %10llu\n", hasher_name, key_name, static_cast<unsigned long long>(key_count),
+                elapsed / static_cast<double>(key_count), collisions / expected, static_cast<unsigned long long>(max_load));
+  }
+  void run_hash_quality(const uint64_t element_count, std::mt19937_64 &random_engine)
+  {
+    std::vector<std::string> sessions(element_count);
+    std::vector<std::string> urls(element_count);
+    std::vector<uint64_t> scenes(element_count);
+    for (uint64_t key_index = 0; key_index < element_count; ++key_index)
+    {
+      char buffer[96];
+      std::snprintf(buffer, sizeof(buffer), "%016llx%016llx", static_cast<unsigned long long>(random_engine()),
+                    static_cast<unsigned long long>(random_engine()));
+      sessions[key_index] = buffer;
+      std::snprintf(buffer, sizeof(buffer), "/static/assets/images/gallery/%llu/thumbnail_%llu.webp",
+                    static_cast<unsigned long long>(key_index % 512), static_cast<unsigned long long>(key_index));
+      urls[key_index] = buffer;
+      scenes[key_index] = (key_index / 8) << 12 | (key_index % 8);
+    }
+    std::printf("%-28s %-8s %8s %12s %10s %10s\n", "hasher", "keys", "count", "ns/hash", "collide", "max");
+    const standard_con::seeded_hash_functions seeded_hasher;
+    for (const auto *key_set : {&sessions, &urls})
+    {
+      const char *key_name = key_set == &sessions ? "session" : "url";
+      hash_quality("std::hash", key_name, *key_set, [](const std::string &key_data)
+                   { return static_cast<uint64_t>(std::hash<std::string_view>()(key_data)); });
+      hash_quality("hash_imitation_functions", key_name, *key_set, [](const std::string &key_data)
+                   { return standard_con::hash_imitation_functions()(std::string_view(key_data)); });
+      hash_quality("seeded_hash_functions", key_name, *key_set, [&](const std::string &key_data)
+                   { return seeded_hasher(std::string_view(key_data)); });
+    }
+    hash_quality("std::hash", "scene", scenes, [](const uint64_t key_data)
+                 { return static_cast<uint64_t>(std::hash<uint64_t>()(key_data)); });
+    hash_quality("hash_imitation_functions", "scene", scenes, [](const uint64_t key_data)
+                 { return standard_con::hash_imitation_functions()(key_data); });
+    hash_quality("seeded_hash_functions", "scene", scenes, [&](const uint64_t key_data)
+                 { return seeded_hasher(key_data); });
+  }
+
+  /*
+   * @brief  #### `run_ordered_lookup` 函数
+
+   *   - 有序映射在 1 千 ~ 1 千万个键下的点查与 `lower_bound`，键为偶数 `int64_t`（B+ 树对有符号 64 位键走 SIMD 节点内查找）
+   *   - 按键升序构建，只计时查找；每个规模探测 100 万次，奇数探测值必然未命中，约一半命中
+  */
+  template <typename map_type, typename insert_type, typename find_type, typename lower_type>
+  void run_scaled_lookup(const char *container_name, const uint64_t element_count, const std::vector<int64_t> &probes,
+                         insert_type &&insert, find_type &&find, lower_type &&lower)
+  {
+    std::optional<map_type> map_data;
+    map_data.emplace();
+    for (uint64_t key_index = 0; key_index < element_count; ++key_index)
+    {
+      insert(*map_data, static_cast<int64_t>(key_index * 2));
+    }
+    measure(container_name, "lookup", sizeof(int64_t), element_count, probes.size(), [&]
+            {
+              uint64_t hits = 0;
+              for (const int64_t key_data : probes)
+              {
+                hits += find(*map_data, key_data);
+              }
+              sink = sink + hits; });
+    if constexpr (!std::is_same_v<std::remove_cvref_t<lower_type>, std::nullptr_t>)
+    {
+      measure(container_name, "lower", sizeof(int64_t), element_count, probes.size(), [&]
+              {
+                uint64_t total = 0;
+                for (const int64_t key_data : probes)
+                {
+                  total += lower(*map_data, key_data);
+                }
+                sink = sink + total; });
+    }
+  }
+  void run_ordered_lookup(const uint64_t max_count, std::mt19937_64 &random_engine)
+  {
+    using key_value = standard_con::pair<int64_t, int64_t>;
+    constexpr uint64_t probe_count = 1000000;
+    for (const uint64_t element_count : {uint64_t{1000}, uint64_t{10000}, uint64_t{100000}, uint64_t{1000000}, uint64_t{10000000}})
+    {
+      if (element_count > max_count)
+      {
+        continue;
+      }
+      std::vector<int64_t> probes(probe_count);
+      for (int64_t &key_data : probes)
+      {
+        key_data = static_cast<int64_t>(random_engine() % (element_count * 2));
+      }
+      run_scaled_lookup<std::map<int64_t, int64_t>>(
+          "std::map", element_count, probes,
+          [](auto &map_data, const int64_t key_data)
+          { map_data.emplace_hint(map_data.end(), key_data, key_data); },
+          [](auto &map_data, const int64_t key_data)
+          { return map_data.find(key_data) != map_data.end(); },
+          [](auto &map_data, const int64_t key_data)
+          {
+            const auto position = map_data.lower_bound(key_data);
+            return position == map_data.end() ? uint64_t{0} : static_cast<uint64_t>(position->second);
+          });
+      run_scaled_lookup<standard_con::tree_map<int64_t, int64_t>>(
+          "standard_con::tree_map", element_count, probes,
+          [](auto &map_data, const int64_t key_data)
+          { map_data.push(key_value(key_data, key_data)); },
+          [](auto &map_data, const int64_t key_data)
+          { return map_data.find(key_value(key_data, 0)) != map_data.end(); },
+          nullptr);
+      run_scaled_lookup<standard_con::btree_map<int64_t, int64_t>>(
+          "standard_con::btree_map", element_count, probes,
+          [](auto &map_data, const int64_t key_data)
+          { map_data.push(key_value(key_data, key_data)); },
+          [](auto &map_data, const int64_t key_data)
+          { return map_data.find(key_value(key_data, 0)) != map_data.end(); },
+          [](auto &map_data, const int64_t key_data)
+          {
+            auto position = map_data.lower_bound(key_data);
+            return position == map_data.end() ? uint64_t{0} : static_cast<uint64_t>(position->second);
+          });
+    }
+  }
+
+  /*
+   * @brief  #### `run_flat_crossover` 函数
+
+   *   - 小映射规模从 16 到 16384，比较 `flat_map`、`tree_map`、`hash_map` 的逐个插入、点查与遍历，找出 `flat_map` 不再占优的规模
+   *   - `flat_map` 另测 `push_bulk` 批量构建；每个规模探测 10 万次，约一半命中
+  */
+  template <typename map_type>
+  void run_crossover(const char *container_name, const std::vector<uint64_t> &keys, const std::vector<uint64_t> &probes)
+  {
+    map_type map_data;
+    measure(container_name, "insert", sizeof(uint64_t), keys.size(), keys.size(), [&]
+            {
+              for (const uint64_t key_data : keys)
+              {
+                scl_map_adapter::insert(map_data, key_data, key_data);
+              } });
+    measure(container_name, "find", sizeof(uint64_t), keys.size(), probes.size(), [&]
+            {
+              uint64_t hits = 0;
+              for (const uint64_t key_data : probes)
+              {
+                hits += scl_map_adapter::contains(map_data, key_data);
+              }
+              sink = sink + hits; });
+    measure(container_name, "iterate", sizeof(uint64_t), keys.size(), keys.size(), [&]
+            {
+              uint64_t total = 0;
+              for (auto position = map_data.begin(); position != map_data.end(); ++position)
+              {
+                total += position->second;
+              }
+              sink = sink + total; });
+  }
+  void run_flat_crossover(const uint64_t max_count, std::mt19937_64 &random_engine)
+  {
+    using key_value = standard_con::pair<uint64_t, uint64_t>;
+    constexpr uint64_t probe_count = 100000;
+    for (const uint64_t element_count : {uint64_t{16}, uint64_t{64}, uint64_t{256}, uint64_t{1024}, uint64_t{4096}, uint64_t{16384}})
+    {
+      if (element_count > max_count)
+      {
+        continue;
+      }
+      std::vector<uint64_t> keys(element_count);
+      for (uint64_t &key_data : keys)
+      {
+        key_data = random_engine();
+      }
+      std::vector<uint64_t> probes(probe_count);
+      for (uint64_t probe_index = 0; probe_index < probe_count; ++probe_index)
+      {
+        probes[probe_index] = probe_index % 2 == 0 ? keys[random_engine() % element_count] : random_engine();
+      }
+      std::vector<key_value> batch;
+      batch.reserve(element_count);
+      for (const uint64_t key_data : keys)
+      {
+        batch.push_back(key_value(key_data, key_data));
+      }
+      // 批量构建单次耗时短，重复多轮摊平计时误差
+      const uint64_t bulk_rounds = std::max<uint64_t>(1, probe_count / element_count);
+      measure("standard_con::flat_map", "bulk", sizeof(uint64_t), element_count, bulk_rounds * element_count, [&]
+              {
+                for (uint64_t round_index = 0; round_index < bulk_rounds; ++round_index)
+                {
+                  standard_con::flat_map<uint64_t, uint64_t> map_data;
+                  map_data.push_bulk(batch.begin(), batch.end());
+                  sink = sink + map_data.size();
+                } });
+      run_crossover<standard_con::flat_map<uint64_t, uint64_t>>("standard_con::flat_map", keys, probes);
+      run_crossover<standard_con::tree_map<uint64_t, uint64_t>>("standard_con::tree_map", keys, probes);
+      run_crossover<standard_con::hash_map<uint64_t, uint64_t>>("standard_con::hash_map", keys, probes);
+    }
+  }
+
+  /*
+   * @brief  #### `run_image_load` 函数
+
+   *   - URL 键到 `uint64_t` 的映射在 1 千 ~ 100 万个键下的两种启动方式：
+   *     `mmap` 打开二进制镜像（含头部与字符串引用校验）后原地查询，对比读入文本文件（每行 `键\t值`）逐个插入重建容器
+   *   - `load` / `rebuild` 计入打开或重建的全部时间，`find` 随后按乱序查询全部键一次（镜像的缺页也计在这里）
+  */
+  template <typename image_type, typename map_type>
+  void run_image_pair(const char *image_name, const char *map_name, const std::string &image_path, const std::string &text_path,
+                      const std::vector<std::string> &probes)
+  {
+    const uint64_t element_count = probes.size();
+    {
+      std::optional<standard_con::mapped_image> mapped_data;
+      std::optional<image_type> image_data;
+      measure(image_name, "load", 0, element_count, element_count, [&]
+              {
+                mapped_data.emplace(image_path);
+                image_data.emplace(*mapped_data);
+                sink = sink + image_data->size(); });
+      measure(image_name, "find", 0, element_count, element_count, [&]
+              {
+                uint64_t total = 0;
+                for (const std::string &key_data : probes)
+                {
+                  total += image_data->at(key_data);
+                }
+                sink = sink + total; });
+    }
+    map_type map_data;
+    measure(map_name, "rebuild", 0, element_count, element_count, [&]
+            {
+              std::ifstream text_file(text_path, std::ios::binary);
+              std::string line;
+              while (std::getline(text_file, line))
+              {
+                const uint64_t tab_position = line.find('\t');
+                map_data.push(standard_con::pair<std::string, uint64_t>(line.substr(0, tab_position),
+                                                                        std::strtoull(line.c_str() + tab_position + 1, nullptr, 10)));
+              }
+              sink = sink + map_data.size(); });
+    // 容器按键值对查找，探测用的键值对提前构造，不把键的拷贝计入查找
+    std::vector<standard_con::pair<std::string, uint64_t>> probe_entries;
+    probe_entries.reserve(element_count);
+    for (const std::string &key_data : probes)
+    {
+      probe_entries.push_back(standard_con::pair<std::string, uint64_t>(key_data, 0));
+    }
+    measure(map_name, "find", 0, element_count, element_count, [&]
+            {
+              uint64_t total = 0;
+              for (const auto &probe_entry : probe_entries)
+              {
+                total += map_data.find(probe_entry)->second;
+              }
+              sink = sink + total; });
+  }
+  void run_image_load(const uint64_t max_count, std::mt19937_64 &random_engine)
+  {
+    const std::string directory = std::filesystem::temp_directory_path().string();
+    const std::string hash_path = directory + "/container_bench_hash.img";
+    const std::string tree_path = directory + "/container_bench_tree.img";
+    const std::string text_path = directory + "/container_bench_map.txt";
+    for (const uint64_t element_count : {uint64_t{1000}, uint64_t{100000}, uint64_t{1000000}})
+    {
+      if (element_count > max_count)
+      {
+        continue;
+      }
+      std::vector<std::pair<std::string, uint64_t>> entries(element_count);
+      {
+        std::ofstream text_file(text_path, std::ios::binary | std::ios::trunc);
+        for (uint64_t key_index = 0; key_index < element_count; ++key_index)
+        {
+          char buffer[96];
+          std::snprintf(buffer, sizeof(buffer), "/static/assets/images/gallery/%llu/thumbnail_%llu.webp",
+                        static_cast<unsigned long long>(key_index % 512), static_cast<unsigned long long>(key_index));
+          entries[key_index] = {buffer, random_engine()};
+          text_file << entries[key_index].first << '\t' << entries[key_index].second << '\n';
+        }
+      }
+      standard_con::save_image(hash_path, standard_con::build_hash_map_image(entries));
+      standard_con::save_image(tree_path, standard_con::build_tree_map_image(entries));
+      std::vector<std::string> probes(element_count);
+      for (uint64_t key_index = 0; key_index < element_count; ++key_index)
+      {
+        probes[key_index] = entries[key_index].first;
+      }
+      std::shuffle(probes.begin(), probes.end(), random_engine);
+      run_image_pair<standard_con::hash_map_image<std::string, uint64_t>, standard_con::hash_map<std::string, uint64_t>>(
+          "standard_con::hash_map_image", "standard_con::hash_map", hash_path, text_path, probes);
+      run_image_pair<standard_con::tree_map_image<std::string, uint64_t>, standard_con::tree_map<std::string, uint64_t>>(
+          "standard_con::tree_map_image", "standard_con::tree_map", tree_path, text_path, probes);
+    }
+    std::filesystem::remove(hash_path);
+    std::filesystem::remove(tree_path);
+    std::filesystem::remove(text_path);
+  }
+
+  template <uint64_t payload_size>
+  void run_suite(const uint64_t element_count, std::mt19937_64 &random_engine)
+  {
+    using value_type = payload<payload_size>;
+    std::vector<uint64_t> keys(element_count);
+    for (uint64_t key_index = 0; key_index < element_count; ++key_index)
+    {
+      keys[key_index] = key_index * 0x9e3779b97f4a7c15ULL; // 键分散在整个 64 位空间
+    }
+    std::shuffle(keys.begin(), keys.end(), random_engine);
+    // 一半命中、一半未命中
+    std::vector<uint64_t> probes(element_count);
+    for (uint64_t probe_index = 0; probe_index < element_count; ++probe_index)
+    {
+      probes[probe_index] = probe_index % 2 == 0 ? keys[random_engine() % element_count] : random_engine() | 1;
+    }
+
+    run_sequence<std::vector<value_type>, value_type, true>("std::vector", probes, element_count);
+    run_sequence<standard_con::vector<value_type>, value_type, true>("standard_con::vector", probes, element_count);
+    run_sequence<standard_con::small_vector<value_type>, value_type, true>("standard_con::small_vector", probes, element_count);
+    run_sequence<std::deque<value_type>, value_type, true>("std::deque", probes, element_count);
+    run_sequence<standard_con::deque<value_type>, value_type, true>("standard_con::deque", probes, element_count);
+    run_sequence<std::list<value_type>, value_type, false>("std::list", probes, element_count);
+    run_sequence<standard_con::list<value_type>, value_type, false>("standard_con::list", probes, element_count);
+
+    run_queue<std::queue<value_type>, value_type>("std::queue", element_count);
+    run_queue<standard_con::queue<value_type>, value_type>("standard_con::queue", element_count);
+    run_queue<standard_con::queue<value_type, standard_con::list<value_type>>, value_type>("standard_con::queue<list>", element_count);
+
+    run_map<std::map<uint64_t, value_type>, std_map_adapter, value_type>("std::map", keys, probes);
+    run_map<standard_con::tree_map<uint64_t, value_type>, scl_map_adapter, value_type>("standard_con::tree_map", keys, probes);
+    run_map<standard_con::balance_tree<uint64_t, value_type>, avl_tree_adapter, value_type>("standard_con::balance_tree", keys, probes);
+    run_map<standard_con::btree_map<uint64_t, value_type>, scl_map_adapter, value_type>("standard_con::btree_map", keys, probes);
+    run_map<std::unordered_map<uint64_t, value_type>, std_map_adapter, value_type>("std::unordered_map", keys, probes);
+    run_map<standard_con::hash_map<uint64_t, value_type>, scl_map_adapter, value_type>("standard_con::hash_map", keys, probes);
+    run_map<standard_con::hash_map<uint64_t, value_type, standard_con::hash_imitation_functions, standard_con::hash_imitation_functions, true>, scl_map_adapter, value_type>("standard_con::ordered_hash", keys, probes);
+    if (element_count <= 10000)
+    {
+      // flat_map 单点插入为 O(n)，只在小规模下参与对比
+      run_map<standard_con::flat_map<uint64_t, value_type>, scl_map_adapter, value_type>("standard_con::flat_map", keys, probes);
+    }
+  }
+}
+
+int main(int argc, char *argv[])
+{
+  uint64_t max_count = ~uint64_t{0};
+  if (argc > 1)
+  {
+    max_count = std::strtoull(argv[1], nullptr, 10);
+  }
+  std::mt19937_64 random_engine(20250101);
+  std::printf("%-28s %-8s %4s %8s %12s %10s %12s\n", "container", "workload", "size", "count", "ns/op", "allocs/op", "peak_bytes");
+  for (const uint64_t element_count : {uint64_t{1000}, uint64_t{100000}})
+  {
+    if (element_count > max_count)
+    {
+      continue;
+    }
+    container_bench::run_suite<8>(element_count, random_engine);
+    container_bench::run_suite<64>(element_count, random_engine);
+    container_bench::run_text_sequence(element_count, random_engine);
+    container_bench::run_heap_suite(element_count, random_engine);
+    container_bench::run_string<std::string>("std::string", element_count);
+    container_bench::run_string<standard_con::string>("standard_con::string", element_count);
+    container_bench::run_short_string<std::string>("std::string", element_count);
+    container_bench::run_short_string<standard_con::string>("standard_con::string", element_count);
+    container_bench::run_shared_pointer<std::shared_ptr<uint64_t>>("std::shared_ptr", element_count, [](const uint64_t value_data)
+                                                                   { return std::make_shared<uint64_t>(value_data); });
+    container_bench::run_shared_pointer<standard_con::pointer::shared_ptr<uint64_t>>("standard_con::shared_ptr", element_count, [](const uint64_t value_data)
+                                                                                     { return standard_con::pointer::make_shared<uint64_t>(value_data); });
+  }
+  container_bench::run_ordered_lookup(max_count, random_engine);
+  container_bench::run_flat_crossover(max_count, random_engine);
+  container_bench::run_image_load(max_count, random_engine);
+  container_bench::run_hash_quality(std::min<uint64_t>(max_count, 100000), random_engine);
+  return 0;
+}
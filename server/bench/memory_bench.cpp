@@ -0,0 +1,286 @@
+#include "../model/container/container.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string_view>
+
+/*
+ * @brief  #### 内存资源基准测试与分配器语义检查
+
+ *   - 语义检查：两个相互独立的资源（各自为 `counting_resource` 包装的 `pool_resource`）下，
+ *     `vector`、`string`、`list` 的同资源 / 异资源移动赋值、拷贝构造与拷贝赋值、移动构造、交换，
+ *     检查内容、所用资源与分配次数，最后确认每块内存都归还到了申请它的资源；任一项不符时打印并以非零状态退出
+
+ *   - 分配统计：模拟一次请求的临时数据（16 个头部值、32 个链表节点、32 项有序映射），
+ *     分别使用 `new_delete_resource`、`monotonic_arena`（每轮复位）与 `pool_resource`，
+ *     输出 ns/op、容器向资源发出的分配次数与落到全局堆的分配次数
+
+ * 用法:
+
+ * * - `memory_bench [轮数]`，默认 100000 轮
+
+ * 注意事项:
+
+ * * - 全局堆分配次数通过资源的上游 `counting_resource` 统计，只包含经由资源的申请
+*/
+namespace memory_bench
+{
+  inline volatile uint64_t sink = 0; // 防止结果被优化掉
+  inline uint64_t failure_count = 0;
+
+  void check(const bool condition, const char *description)
+  {
+    if (!condition)
+    {
+      std::printf("FAIL %s\n", description);
+      ++failure_count;
+    }
+  }
+
+  template <typename value_type>
+  using allocator = standard_con::polymorphic_allocator<value_type>;
+  using text_type = standard_con::basic_string<allocator<char>>;
+  using number_vector = standard_con::vector<uint64_t, allocator<uint64_t>>;
+  using number_list = standard_con::list<uint64_t, allocator<uint64_t>>;
+
+  // 超过内联容量，保证字符串走堆分配
+  inline constexpr std::string_view long_text = "polymorphic allocator check payload text";
+
+  struct resource_pair
+  {
+    standard_con::pool_resource first_pool{standard_con::new_delete_resource()};
+    standard_con::pool_resource second_pool{standard_con::new_delete_resource()};
+    standard_con::counting_resource first{&first_pool};
+    standard_con::counting_resource second{&second_pool};
+  };
+
+  template <typename list_type>
+  [[nodiscard]] uint64_t list_sum(const list_type &list_data)
+  {
+    uint64_t total = 0;
+    for (auto position = list_data.cbegin(); position != list_data.cend(); ++position)
+    {
+      total += *position;
+    }
+    return total;
+  }
+
+  void check_vector(resource_pair &resources)
+  {
+    const allocator<uint64_t> first_allocator(&resources.first);
+    const allocator<uint64_t> second_allocator(&resources.second);
+    number_vector source(first_allocator);
+    for (uint64_t value_data = 0; value_data < 100; ++value_data)
+    {
+      source.push_back(value_data);
+    }
+
+    // 同资源移动赋值：直接接管缓冲区，不再分配
+    number_vector same_target(first_allocator);
+    uint64_t allocations = resources.first.allocation_count();
+    same_target = std::move(source);
+    check(resources.first.allocation_count() == allocations, "vector same-resource move assignment allocates");
+    check(same_target.size() == 100 && same_target[99] == 99 && source.empty(), "vector same-resource move assignment contents");
+
+    // 异资源移动赋值：分配器不传播，元素逐个移入目标资源，源缓冲区归还源资源
+    number_vector other_target(second_allocator);
+    allocations = resources.second.allocation_count();
+    other_target = std::move(same_target);
+    check(other_target.get_allocator().resource() == &resources.second, "vector cross-resource move assignment keeps target resource");
+    check(resources.second.allocation_count() == allocations + 1, "vector cross-resource move assignment allocates from target");
+    check(resources.first.statistics().bytes_in_use == 0, "vector cross-resource move assignment returns source buffer");
+    check(other_target.size() == 100 && other_target[42] == 42, "vector cross-resource move assignment contents");
+
+    // 拷贝构造取默认资源，拷贝赋值沿用目标自己的资源
+    number_vector copy_constructed(other_target);
+    check(copy_constructed.get_allocator().resource() == standard_con::default_resource(), "vector copy construction uses default resource");
+    check(copy_constructed.size() == 100 && copy_constructed[7] == 7, "vector copy construction contents");
+    number_vector copy_assigned(first_allocator);
+    copy_assigned = other_target;
+    check(copy_assigned.get_allocator().resource() == &resources.first, "vector copy assignment keeps target resource");
+    check(copy_assigned.size() == 100 && copy_assigned[63] == 63, "vector copy assignment contents");
+
+    // 移动构造连同分配器一起转移
+    allocations = resources.second.allocation_count();
+    number_vector move_constructed(std::move(other_target));
+    check(move_constructed.get_allocator().resource() == &resources.second, "vector move construction carries resource");
+    check(resources.second.allocation_count() == allocations, "vector move construction allocates");
+
+    // 同资源交换只交换指针
+    number_vector swap_target(second_allocator);
+    swap_target.push_back(1000);
+    allocations = resources.second.allocation_count();
+    swap_target.swap(move_constructed);
+    check(resources.second.allocation_count() == allocations, "vector same-resource swap allocates");
+    check(swap_target.size() == 100 && move_constructed.size() == 1 && move_constructed[0] == 1000, "vector same-resource swap contents");
+  }
+
+  void check_string(resource_pair &resources)
+  {
+    const allocator<char> first_allocator(&resources.first);
+    const allocator<char> second_allocator(&resources.second);
+    text_type source(long_text, first_allocator);
+
+    text_type same_target(first_allocator);
+    uint64_t allocations = resources.first.allocation_count();
+    same_target = std::move(source);
+    check(resources.first.allocation_count() == allocations, "string same-resource move assignment allocates");
+    check(same_target == text_type(long_text) && source.empty(), "string same-resource move assignment contents");
+
+    text_type other_target(second_allocator);
+    other_target = std::move(same_target);
+    check(other_target.get_allocator().resource() == &resources.second, "string cross-resource move assignment keeps target resource");
+    check(other_target == text_type(long_text), "string cross-resource move assignment contents");
+
+    text_type copy_constructed(other_target);
+    check(copy_constructed.get_allocator().resource() == standard_con::default_resource(), "string copy construction uses default resource");
+    text_type copy_assigned(first_allocator);
+    copy_assigned = other_target;
+    check(copy_assigned.get_allocator().resource() == &resources.first, "string copy assignment keeps target resource");
+    check(copy_assigned == other_target, "string copy assignment contents");
+
+    allocations = resources.second.allocation_count();
+    text_type move_constructed(std::move(other_target));
+    check(move_constructed.get_allocator().resource() == &resources.second, "string move construction carries resource");
+    check(resources.second.allocation_count() == allocations && other_target.empty(), "string move construction allocates");
+
+    text_type swap_target(std::string_view("short"), second_allocator);
+    allocations = resources.second.allocation_count();
+    std::swap(swap_target, move_constructed);
+    check(resources.second.allocation_count() == allocations, "string same-resource swap allocates");
+    check(swap_target == text_type(long_text) && move_constructed == text_type("short"), "string same-resource swap contents");
+  }
+
+  void check_list(resource_pair &resources)
+  {
+    const allocator<uint64_t> first_allocator(&resources.first);
+    number_list first_list(first_allocator);
+    number_list second_list(first_allocator);
+    for (uint64_t value_data = 1; value_data <= 50; ++value_data)
+    {
+      first_list.push_back(value_data);
+      second_list.push_back(value_data * 100);
+    }
+
+    // 多态分配器不随交换传播：同资源交换只交换节点池，不重新分配
+    const uint64_t swap_allocations = resources.first.allocation_count();
+    first_list.swap(second_list);
+    check(resources.first.allocation_count() == swap_allocations, "list same-resource swap allocates");
+    check(first_list.get_allocator().resource() == &resources.first && second_list.get_allocator().resource() == &resources.first,
+          "list same-resource swap keeps resources");
+    check(list_sum(first_list) == 127500 && list_sum(second_list) == 1275, "list same-resource swap contents");
+
+    number_list copy_constructed(first_list);
+    check(copy_constructed.get_allocator().resource() == standard_con::default_resource(), "list copy construction uses default resource");
+    check(list_sum(copy_constructed) == 127500, "list copy construction contents");
+    number_list copy_assigned(first_allocator);
+    copy_assigned = first_list;
+    check(copy_assigned.get_allocator().resource() == &resources.first, "list copy assignment keeps target resource");
+    check(list_sum(copy_assigned) == 127500, "list copy assignment contents");
+
+    const uint64_t allocations = resources.first.allocation_count();
+    number_list move_constructed(std::move(second_list));
+    check(move_constructed.get_allocator().resource() == &resources.first, "list move construction carries resource");
+    check(resources.first.allocation_count() <= allocations + 1, "list move construction allocates nodes");
+    check(list_sum(move_constructed) == 1275 && list_sum(second_list) == 0, "list move construction contents");
+  }
+
+  void run_checks()
+  {
+    resource_pair resources;
+    check_vector(resources);
+    check_string(resources);
+    check_list(resources);
+    // 全部容器已析构：每个资源申请的内存都应已由同一资源归还
+    const auto first_statistics = resources.first.statistics();
+    const auto second_statistics = resources.second.statistics();
+    check(first_statistics.bytes_in_use == 0 && first_statistics.allocation_count == first_statistics.deallocation_count,
+          "first resource balanced");
+    check(second_statistics.bytes_in_use == 0 && second_statistics.allocation_count == second_statistics.deallocation_count,
+          "second resource balanced");
+    std::printf("allocator checks: %s\n", failure_count == 0 ? "ok" : "FAILED");
+  }
+
+  /*
+   * @brief  #### `request_workload` 函数
+
+   *   - 一次请求的临时数据：16 个 40 字节的头部值、32 个链表节点、32 项有序映射，构造后遍历并析构
+  */
+  void request_workload(standard_con::memory_resource *resource_data)
+  {
+    using text_vector = standard_con::vector<text_type, allocator<text_type>>;
+    using number_map = standard_con::tree_map<uint64_t, uint64_t, standard_con::less<uint64_t>, allocator<standard_con::pair<uint64_t, uint64_t>>>;
+    text_vector headers{allocator<text_type>(resource_data)};
+    number_list pending{allocator<uint64_t>(resource_data)};
+    number_map counters{allocator<standard_con::pair<uint64_t, uint64_t>>(resource_data)};
+    for (uint64_t header_index = 0; header_index < 16; ++header_index)
+    {
+      headers.push_back(text_type(long_text, allocator<char>(resource_data)));
+    }
+    for (uint64_t value_data = 0; value_data < 32; ++value_data)
+    {
+      pending.push_back(value_data);
+      counters.push(standard_con::pair<uint64_t, uint64_t>(value_data * 7919 % 32, value_data));
+    }
+    sink = sink + headers.size() + list_sum(pending) + counters.size();
+  }
+
+  template <typename reset_type>
+  void measure(const char *resource_name, standard_con::memory_resource *resource_data, standard_con::counting_resource &requests,
+               standard_con::counting_resource &upstream, const uint64_t round_count, reset_type &&reset_resource)
+  {
+    // 热身一轮，让池与竞技场先备好块
+    request_workload(resource_data);
+    reset_resource();
+    requests.reset_statistics();
+    upstream.reset_statistics();
+    const auto start_time = std::chrono::steady_clock::now();
+    for (uint64_t round_index = 0; round_index < round_count; ++round_index)
+    {
+      request_workload(resource_data);
+      reset_resource();
+    }
+    const auto stop_time = std::chrono::steady_clock::now();
+    const double elapsed = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(stop_time - start_time).count());
+    const double rounds = static_cast<double>(round_count);
+    std::printf("%-24s %-8s %12.1f %12.2f %12.3f\n", resource_name, "request", elapsed / rounds,
+                static_cast<double>(requests.allocation_count()) / rounds, static_cast<double>(upstream.allocation_count()) / rounds);
+  }
+
+  void run_allocation_bench(const uint64_t round_count)
+  {
+    std::printf("%-24s %-8s %12s %12s %12s\n", "resource", "workload", "ns/op", "allocs/op", "heap/op");
+    {
+      standard_con::counting_resource upstream(standard_con::new_delete_resource());
+      standard_con::counting_resource requests(&upstream);
+      measure("new_delete_resource", &requests, requests, upstream, round_count, [] {});
+    }
+    {
+      standard_con::counting_resource upstream(standard_con::new_delete_resource());
+      standard_con::monotonic_arena arena(&upstream);
+      standard_con::counting_resource requests(&arena);
+      measure("monotonic_arena", &requests, requests, upstream, round_count, [&arena]
+              { arena.reset(); });
+    }
+    {
+      standard_con::counting_resource upstream(standard_con::new_delete_resource());
+      standard_con::pool_resource pool(&upstream);
+      standard_con::counting_resource requests(&pool);
+      measure("pool_resource", &requests, requests, upstream, round_count, [] {});
+    }
+  }
+}
+
+int main(int argc, char *argv[])
+{
+  uint64_t round_count = 100000;
+  if (argc > 1)
+  {
+    round_count = std::strtoull(argv[1], nullptr, 10);
+  }
+  memory_bench::run_checks();
+  memory_bench::run_allocation_bench(round_count);
+  return memory_bench::failure_count == 0 ? 0 : 1;
+}
@@ -0,0 +1,213 @@
+/**
+ * @file Concurrent_lock_free_queue.hpp
+ * @brief 无锁无界 FIFO 队列（Michael–Scott 队列，多生产者多消费者）
+ * @author wang
+ * @version 1.0
+ * @date 2025-08-15
+ *
+ * 与 `concurrent_queue` 并列提供，适用于高竞争、不需要阻塞等待的场景：
+ *   - 头尾指针分离在不同缓存行，生产者与消费者互不争用；
+ *   - 队首始终为哑节点，出队后原哑节点交由 `epoch_domain` 延迟回收；
+ *   - 节点内存来自线程本地 `node_pool`；
+ *   - 空队列时 `try_pop` 立即返回 `false`，不提供阻塞 pop。
+ */
+
+#pragma once
+#include "concurrent_reclamation.hpp"
+#include <atomic>
+#include <memory>
+#include <utility>
+#include <cstddef>
+
+namespace multi_concurrent
+{
+  /**
+   * @class lock_free_queue
+   * @brief 无锁先进先出队列
+   * @tparam value 元素类型，需可移动赋值
+   */
+  template <typename value>
+  class lock_free_queue
+  {
+    // 元素存放在未初始化存储中：哑节点不持有元素，出队时由胜出的消费者析构
+    struct queue_node
+    {
+      std::atomic<queue_node *> _next{nullptr};
+      alignas(value) unsigned char _storage[sizeof(value)];
+      value *data() noexcept
+      {
+        return std::launder(reinterpret_cast<value *>(_storage));
+      }
+    };
+    using pool = node_pool<queue_node>;
+
+  private:
+    alignas(64) std::atomic<queue_node *> _head;
+    alignas(64) std::atomic<queue_node *> _tail;
+    alignas(64) std::atomic<std::size_t> _size{0};
+
+    static queue_node *create_node()
+    {
+      return ::new (pool::acquire()) queue_node;
+    }
+    static void destroy_node(queue_node *node) noexcept
+    {
+      node->~queue_node();
+      pool::release(node);
+    }
+
+    template <typename... Args>
+    void enqueue(Args &&...args)
+    {
+      queue_node *node = create_node();
+      try
+      {
+        ::new (static_cast<void *>(node->_storage)) value(std::forward<Args>(args)...);
+      }
+      catch (...)
+      {
+        destroy_node(node);
+        throw;
+      }
+      _size.fetch_add(1, std::memory_order_relaxed);
+      epoch_guard guard;
+      while (true)
+      {
+        queue_node *tail = _tail.load(std::memory_order_acquire);
+        queue_node *next = tail->_next.load(std::memory_order_acquire);
+        if (tail != _tail.load(std::memory_order_acquire))
+          continue;
+        if (next == nullptr)
+        {
+          if (tail->_next.compare_exchange_weak(next, node, std::memory_order_release, std::memory_order_relaxed))
+          {
+            _tail.compare_exchange_strong(tail, node, std::memory_order_release, std::memory_order_relaxed);
+            return;
+          }
+        }
+        else
+        {
+          // 尾指针落后，帮助推进
+          _tail.compare_exchange_weak(tail, next, std::memory_order_release, std::memory_order_relaxed);
+        }
+      }
+    }
+
+    // 出队并把元素交给 consumer，原哑节点退休，新队首成为哑节点
+    template <typename consumer>
+    bool dequeue(consumer &&handle)
+    {
+      epoch_guard guard;
+      while (true)
+      {
+        queue_node *head = _head.load(std::memory_order_acquire);
+        queue_node *tail = _tail.load(std::memory_order_acquire);
+        queue_node *next = head->_next.load(std::memory_order_acquire);
+        if (head != _head.load(std::memory_order_acquire))
+          continue;
+        if (next == nullptr)
+          return false;
+        if (head == tail)
+        {
+          _tail.compare_exchange_weak(tail, next, std::memory_order_release, std::memory_order_relaxed);
+          continue;
+        }
+        if (_head.compare_exchange_weak(head, next, std::memory_order_acquire, std::memory_order_relaxed))
+        {
+          value *slot = next->data();
+          handle(std::move(*slot));
+          std::destroy_at(slot);
+          _size.fetch_sub(1, std::memory_order_relaxed);
+          epoch_domain::instance().retire(head);
+          return true;
+        }
+      }
+    }
+
+  public:
+    lock_free_queue()
+    {
+      queue_node *dummy = create_node();
+      _head.store(dummy, std::memory_order_relaxed);
+      _tail.store(dummy, std::memory_order_relaxed);
+    }
+
+    /** 禁止拷贝与移动：头尾指针可能正被其它线程引用 */
+    lock_free_queue(const lock_free_queue &) = delete;
+    lock_free_queue &operator=(const lock_free_queue &) = delete;
+
+    /** @note 析构时不得再有其它线程访问本队列 */
+    ~lock_free_queue()
+    {
+      queue_node *node = _head.load(std::memory_order_acquire);
+      queue_node *next = node->_next.load(std::memory_order_relaxed);
+      destroy_node(node); // 哑节点不持有元素
+      while (next != nullptr)
+      {
+        node = next;
+        next = node->_next.load(std::memory_order_relaxed);
+        std::destroy_at(node->data());
+        destroy_node(node);
+      }
+    }
+
+    /**
+     * @brief #### 获取队列当前元素个数
+     * @return 近似值，并发修改期间可能与实际数量存在瞬时偏差
+     */
+    std::size_t size() const noexcept
+    {
+      return _size.load(std::memory_order_relaxed);
+    }
+
+    /** @brief #### 判断队列是否为空 */
+    bool empty() const noexcept
+    {
+      epoch_guard guard;
+      return _head.load(std::memory_order_acquire)->_next.load(std::memory_order_acquire) == nullptr;
+    }
+
+    /**
+     * @brief #### 入队（拷贝）
+     * @param item 待入队元素
+     */
+    void push(const value &item)
+    {
+      enqueue(item);
+    }
+
+    /** @brief #### 入队（移动） */
+    void push(value &&item)
+    {
+      enqueue(std::move(item));
+    }
+
+    /**
+     * @brief #### 就地构造入队
+     * @param args 构造元素所需参数
+     */
+    template <typename... Args>
+    void emplace(Args &&...args)
+    {
+      enqueue(std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief #### 尝试出队（非阻塞）
+     * @param out 接收出队元素的引用
+     * @return `true` 成功出队；`false` 队列空
+     */
+    bool try_pop(value &out)
+    {
+      return dequeue([&out](value &&data) { out = std::move(data); });
+    }
+
+    /** @brief #### 清空队列（逐个出队并丢弃元素） */
+    void clear()
+    {
+      while (dequeue([](value &&) {}))
+      {
+      }
+    }
+  };
+}
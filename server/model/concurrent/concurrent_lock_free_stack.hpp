@@ -0,0 +1,174 @@
+/**
+ * @file Concurrent_lock_free_stack.hpp
+ * @brief 无锁 LIFO 栈（Treiber 栈，多生产者多消费者）
+ * @author wang
+ * @version 1.0
+ * @date 2025-08-15
+ *
+ * 与 `concurrent_stack` 并列提供，适用于高竞争、不需要阻塞等待的场景：
+ *   - 栈顶为单个原子指针，push / pop 通过 CAS 完成，无互斥锁；
+ *   - 弹出的节点交由 `epoch_domain` 延迟回收，杜绝悬空访问与 ABA；
+ *   - 节点内存来自线程本地 `node_pool`，稳态下不触碰全局分配器；
+ *   - 不支持容量上限与阻塞 pop，空栈时 `try_pop` 立即返回 `false`。
+ */
+
+#pragma once
+#include "concurrent_reclamation.hpp"
+#include <atomic>
+#include <utility>
+#include <cstddef>
+
+namespace multi_concurrent
+{
+  /**
+   * @class lock_free_stack
+   * @brief 无锁后进先出栈
+   * @tparam value 元素类型，需可移动赋值
+   */
+  template <typename value>
+  class lock_free_stack
+  {
+    struct stack_node
+    {
+      value _data;
+      stack_node *_next;
+      template <typename... Args>
+      explicit stack_node(Args &&...args)
+        : _data(std::forward<Args>(args)...), _next(nullptr) {}
+    };
+    using pool = node_pool<stack_node>;
+
+  private:
+    alignas(64) std::atomic<stack_node *> _head{nullptr};
+    alignas(64) std::atomic<std::size_t> _size{0};
+
+    template <typename... Args>
+    static stack_node *create_node(Args &&...args)
+    {
+      void *block = pool::acquire();
+      try
+      {
+        return ::new (block) stack_node(std::forward<Args>(args)...);
+      }
+      catch (...)
+      {
+        pool::release(block);
+        throw;
+      }
+    }
+
+    void link(stack_node *node) noexcept
+    {
+      _size.fetch_add(1, std::memory_order_relaxed);
+      node->_next = _head.load(std::memory_order_relaxed);
+      while (!_head.compare_exchange_weak(node->_next, node, std::memory_order_release, std::memory_order_relaxed))
+      {
+      }
+    }
+
+    // 摘下栈顶节点并交给 consumer 处理其元素，节点随后退休
+    template <typename consumer>
+    bool unlink(consumer &&handle)
+    {
+      epoch_guard guard;
+      stack_node *top = _head.load(std::memory_order_acquire);
+      while (top != nullptr &&
+             !_head.compare_exchange_weak(top, top->_next, std::memory_order_acquire, std::memory_order_acquire))
+      {
+      }
+      if (top == nullptr)
+        return false;
+      _size.fetch_sub(1, std::memory_order_relaxed);
+      handle(std::move(top->_data));
+      epoch_domain::instance().retire(top);
+      return true;
+    }
+
+  public:
+    lock_free_stack() = default;
+
+    /** 禁止拷贝与移动：原子栈顶可能正被其它线程引用 */
+    lock_free_stack(const lock_free_stack &) = delete;
+    lock_free_stack &operator=(const lock_free_stack &) = delete;
+
+    /** @note 析构时不得再有其它线程访问本栈 */
+    ~lock_free_stack()
+    {
+      stack_node *top = _head.exchange(nullptr, std::memory_order_acquire);
+      while (top != nullptr)
+      {
+        stack_node *next = top->_next;
+        top->~stack_node();
+        pool::release(top);
+        top = next;
+      }
+    }
+
+    /**
+     * @brief #### 获取当前元素个数
+     * @return 近似值，并发修改期间可能与实际数量存在瞬时偏差
+     */
+    std::size_t size() const noexcept
+    {
+      return _size.load(std::memory_order_relaxed);
+    }
+
+    /** @brief #### 判断栈是否为空 */
+    bool empty() const noexcept
+    {
+      return _head.load(std::memory_order_acquire) == nullptr;
+    }
+
+    /**
+     * @brief #### 入栈（拷贝）
+     * @param value_data 待入栈元素
+     */
+    void push(const value &value_data)
+    {
+      link(create_node(value_data));
+    }
+
+    /** @brief #### 入栈（移动） */
+    void push(value &&value_data)
+    {
+      link(create_node(std::move(value_data)));
+    }
+
+    /**
+     * @brief #### 就地构造入栈
+     * @param args 构造元素所需参数
+     */
+    template <typename... Args>
+    void emplace(Args &&...args)
+    {
+      link(create_node(std::forward<Args>(args)...));
+    }
+
+    /**
+     * @brief #### 尝试出栈（非阻塞）
+     * @param out 接收栈顶元素的引用
+     * @return `true` 成功出栈；`false` 栈为空
+     */
+    bool try_pop(value &out)
+    {
+      return unlink([&out](value &&data) { out = std::move(data); });
+    }
+
+    /**
+     * @brief #### 清空栈
+     * @note  一次性摘下整条链，之后逐个退休节点
+     */
+    void clear()
+    {
+      epoch_guard guard;
+      stack_node *top = _head.exchange(nullptr, std::memory_order_acquire);
+      while (top != nullptr)
+      {
+        stack_node *next = top->_next;
+        _size.fetch_sub(1, std::memory_order_relaxed);
+        epoch_domain::instance().retire(top);
+        top = next;
+      }
+    }
+  };
+}
@@ -0,0 +1,321 @@
+/**
+ * @file Concurrent_reclamation.hpp
+ * @brief 无锁容器的安全内存回收（纪元回收）与线程本地节点池
+ * @author wang
+ * @version 1.0
+ * @date 2025-08-15
+ *
+ * 无锁容器摘下节点后，其它线程可能仍持有该节点指针，不能立即释放：
+ *   - `epoch_domain`：全局纪元 + 线程记录，节点退休时打上当前纪元，
+ *     全局纪元前进两次后，所有可能看到该节点的线程均已离开临界区，方可回收；
+ *   - `epoch_guard`：RAII 进入/离开临界区，支持嵌套；
+ *   - `node_pool`：按节点类型划分的线程本地空闲链表，回收的节点优先复用，
+ *     避免每次入队/入栈都走全局分配器。
+ */
+
+#pragma once
+#include <atomic>
+#include <mutex>
+#include <vector>
+#include <new>
+#include <cstddef>
+#include <cstdint>
+
+namespace multi_concurrent
+{
+  /**
+   * @class node_pool
+   * @brief 线程本地节点池
+   * @tparam node 节点类型，大小不得小于一个指针
+   * @note  每个线程缓存至多 `max_cached` 块空闲内存，超出部分直接归还全局分配器；
+   *        线程退出时缓存整体释放。
+   */
+  template <typename node>
+  class node_pool
+  {
+    static_assert(sizeof(node) >= sizeof(void *), "node_pool 要求节点至少能容纳一个指针");
+
+    struct free_block
+    {
+      free_block *_next;
+    };
+    struct thread_cache
+    {
+      free_block *_head = nullptr;
+      std::size_t _count = 0;
+      ~thread_cache()
+      {
+        while (_head != nullptr)
+        {
+          free_block *next = _head->_next;
+          node_pool::deallocate(_head);
+          _head = next;
+        }
+        _destroyed = true; // 线程退出阶段仍可能有节点被回收，此后直接释放
+      }
+    };
+    static inline thread_local bool _destroyed = false;
+
+    static thread_cache &cache() noexcept
+    {
+      static thread_local thread_cache instance;
+      return instance;
+    }
+    static void deallocate(void *block) noexcept
+    {
+      ::operator delete(block, std::align_val_t{alignof(node)});
+    }
+
+  public:
+    static constexpr std::size_t max_cached = 256;
+
+    /**
+     * @brief #### 取出一块可容纳 `node` 的未初始化内存
+     * @return 内存地址，调用方负责 placement new
+     * @throw std::bad_alloc 缓存为空且分配失败
+     */
+    static void *acquire()
+    {
+      if (!_destroyed)
+      {
+        thread_cache &local = cache();
+        if (local._head != nullptr)
+        {
+          free_block *block = local._head;
+          local._head = block->_next;
+          --local._count;
+          return block;
+        }
+      }
+      return ::operator new(sizeof(node), std::align_val_t{alignof(node)});
+    }
+
+    /**
+     * @brief #### 归还一块已析构的节点内存
+     * @param block `acquire` 取得的地址
+     */
+    static void release(void *block) noexcept
+    {
+      if (!_destroyed)
+      {
+        thread_cache &local = cache();
+        if (local._count < max_cached)
+        {
+          auto *cached = static_cast<free_block *>(block);
+          cached->_next = local._head;
+          local._head = cached;
+          ++local._count;
+          return;
+        }
+      }
+      deallocate(block);
+    }
+  };
+
+  /**
+   * @class epoch_domain
+   * @brief 基于纪元的安全内存回收域（进程级单例）
+   * @note  线程首次进入临界区时注册线程记录，退出时记录归还复用；
+   *        退出线程尚未回收的节点转入孤儿列表，由其它线程后续代为回收。
+   */
+  class epoch_domain
+  {
+  public:
+    using reclaim_function = void (*)(void *) noexcept;
+
+  private:
+    static constexpr std::size_t _collect_threshold = 64; // 每退休多少节点尝试推进一次纪元
+
+    struct retired_entry
+    {
+      void *_pointer;
+      reclaim_function _reclaim;
+      std::uint64_t _epoch;
+    };
+    struct thread_record
+    {
+      // 0 表示不在临界区；否则为 (纪元 << 1) | 1
+      std::atomic<std::uint64_t> _state{0};
+      std::atomic<bool> _occupied{true};
+      thread_record *_next = nullptr;
+      std::size_t _nesting = 0;
+      std::size_t _retire_counter = 0;
+      std::vector<retired_entry> _retired;
+    };
+    struct record_holder
+    {
+      thread_record *_record;
+      record_holder() : _record(epoch_domain::instance().acquire_record()) {}
+      ~record_holder() { epoch_domain::instance().release_record(_record); }
+    };
+
+    alignas(64) std::atomic<std::uint64_t> _global_epoch{0};
+    alignas(64) std::atomic<thread_record *> _records{nullptr};
+    std::mutex _orphan_mutex;
+    std::vector<retired_entry> _orphans;
+
+    epoch_domain() = default;
+
+    thread_record *acquire_record()
+    {
+      for (thread_record *record = _records.load(std::memory_order_acquire); record != nullptr; record = record->_next)
+      {
+        bool expected = false;
+        if (!record->_occupied.load(std::memory_order_relaxed) &&
+            record->_occupied.compare_exchange_strong(expected, true, std::memory_order_acquire))
+        {
+          return record;
+        }
+      }
+      auto *record = new thread_record;
+      record->_next = _records.load(std::memory_order_relaxed);
+      while (!_records.compare_exchange_weak(record->_next, record, std::memory_order_release, std::memory_order_relaxed))
+      {
+      }
+      return record;
+    }
+    void release_record(thread_record *record) noexcept
+    {
+      try_advance();
+      collect(record->_retired);
+      if (!record->_retired.empty())
+      {
+        std::lock_guard<std::mutex> lock(_orphan_mutex);
+        _orphans.insert(_orphans.end(), record->_retired.begin(), record->_retired.end());
+        record->_retired.clear();
+      }
+      record->_nesting = 0;
+      record->_retire_counter = 0;
+      record->_state.store(0, std::memory_order_release);
+      record->_occupied.store(false, std::memory_order_release);
+    }
+    static thread_record *local_record()
+    {
+      static thread_local record_holder holder;
+      return holder._record;
+    }
+
+    // 所有处于临界区的线程都已观察到当前纪元时推进全局纪元
+    std::uint64_t try_advance() noexcept
+    {
+      std::uint64_t epoch = _global_epoch.load(std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+      for (thread_record *record = _records.load(std::memory_order_acquire); record != nullptr; record = record->_next)
+      {
+        const std::uint64_t state = record->_state.load(std::memory_order_acquire);
+        if ((state & 1) != 0 && (state >> 1) != epoch)
+        {
+          return epoch;
+        }
+      }
+      if (_global_epoch.compare_exchange_strong(epoch, epoch + 1, std::memory_order_release, std::memory_order_relaxed))
+      {
+        return epoch + 1;
+      }
+      return epoch; // 失败时 epoch 已被更新为最新值
+    }
+    // 回收退休时间早于当前纪元两代的节点
+    void collect(std::vector<retired_entry> &retired) noexcept
+    {
+      const std::uint64_t epoch = _global_epoch.load(std::memory_order_acquire);
+      std::size_t kept = 0;
+      for (std::size_t index = 0; index < retired.size(); ++index)
+      {
+        if (retired[index]._epoch + 2 <= epoch)
+        {
+          retired[index]._reclaim(retired[index]._pointer);
+        }
+        else
+        {
+          retired[kept++] = retired[index];
+        }
+      }
+      retired.resize(kept);
+    }
+
+  public:
+    epoch_domain(const epoch_domain &) = delete;
+    epoch_domain &operator=(const epoch_domain &) = delete;
+
+    /**
+     * @brief #### 获取进程级回收域
+     * @note  刻意不析构：线程退出时仍会访问域，静态析构顺序无法保证
+     */
+    static epoch_domain &instance()
+    {
+      static epoch_domain *domain = new epoch_domain;
+      return *domain;
+    }
+
+    /** @brief #### 进入临界区（可嵌套），之后读到的共享节点在离开前不会被回收 */
+    void pin()
+    {
+      thread_record *record = local_record();
+      if (record->_nesting++ == 0)
+      {
+        const std::uint64_t epoch = _global_epoch.load(std::memory_order_relaxed);
+        record->_state.store((epoch << 1) | 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+      }
+    }
+
+    /** @brief #### 离开临界区 */
+    void unpin() noexcept
+    {
+      thread_record *record = local_record();
+      if (--record->_nesting == 0)
+      {
+        record->_state.store(0, std::memory_order_release);
+      }
+    }
+
+    /**
+     * @brief #### 退休一个已从共享结构中摘除的节点
+     * @param pointer 节点地址
+     * @param reclaim 安全后调用的回收函数
+     */
+    void retire(void *pointer, reclaim_function reclaim)
+    {
+      thread_record *record = local_record();
+      record->_retired.push_back({pointer, reclaim, _global_epoch.load(std::memory_order_seq_cst)});
+      if (++record->_retire_counter < _collect_threshold)
+      {
+        return;
+      }
+      record->_retire_counter = 0;
+      try_advance();
+      collect(record->_retired);
+      std::unique_lock<std::mutex> lock(_orphan_mutex, std::try_to_lock);
+      if (lock.owns_lock() && !_orphans.empty())
+      {
+        collect(_orphans);
+      }
+    }
+
+    /**
+     * @brief #### 退休节点，回收时析构并归还到线程本地节点池
+     * @tparam node 节点类型
+     */
+    template <typename node>
+    void retire(node *pointer)
+    {
+      retire(pointer, [](void *target) noexcept
+             {
+               static_cast<node *>(target)->~node();
+               node_pool<node>::release(target); });
+    }
+  };
+
+  /**
+   * @class epoch_guard
+   * @brief 临界区守卫，构造时 `pin`，析构时 `unpin`
+   */
+  class epoch_guard
+  {
+  public:
+    epoch_guard() { epoch_domain::instance().pin(); }
+    ~epoch_guard() { epoch_domain::instance().unpin(); }
+    epoch_guard(const epoch_guard &) = delete;
+    epoch_guard &operator=(const epoch_guard &) = delete;
+  };
+}
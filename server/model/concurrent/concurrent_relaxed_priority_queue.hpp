@@ -0,0 +1,234 @@
+/**
+ * @file Concurrent_relaxed_priority_queue.hpp
+ * @brief 松弛并发优先级队列（MultiQueue，多生产者多消费者）
+ * @author wang
+ * @version 1.0
+ * @date 2025-08-15
+ *
+ * 与 `concurrent_priority_queue` 并列提供，适用于可容忍近似顺序的任务分发：
+ *   - 内部持有 c·P 个带独立互斥锁的二叉堆（P 为并发线程数，c 为松弛因子）；
+ *   - push：随机选一个堆插入，`try_lock` 失败则换一个堆重试；
+ *   - try_pop：随机选两个堆，比较堆顶后弹出较优者；
+ *   - 出队顺序不再严格，c 越大竞争越小、排名误差越大；
+ *   - 不提供阻塞 pop，空队列时 `try_pop` 返回 `false`。
+ */
+
+#pragma once
+#include <mutex>
+#include <atomic>
+#include <vector>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <algorithm>
+#include <functional>
+#include <cstddef>
+#include <cstdint>
+
+namespace multi_concurrent
+{
+  /**
+   * @class relaxed_priority_queue
+   * @brief 松弛优先级队列
+   * @tparam value       元素类型，需可移动
+   * @tparam comparator  元素比较器，默认 `std::less<value>`（优先弹出较大元素）
+   */
+  template <typename value, typename comparator = std::less<value>>
+  class relaxed_priority_queue
+  {
+    // 每个内部堆独占缓存行，避免相邻堆的锁互相伪共享
+    struct alignas(64) shard
+    {
+      std::mutex _mutex;
+      std::vector<value> _heap;
+      std::atomic<std::size_t> _count{0}; // 无锁读取，用于跳过空堆
+    };
+
+  private:
+    std::unique_ptr<shard[]> _shards;
+    std::size_t _shard_count;
+    std::size_t _relaxation;
+    comparator _compare;
+    alignas(64) std::atomic<std::size_t> _size{0};
+
+    // 线程本地 xorshift 随机数，选堆无需共享状态
+    static std::uint64_t next_random() noexcept
+    {
+      static std::atomic<std::uint64_t> seed_source{0x9E3779B97F4A7C15ull};
+      static thread_local std::uint64_t state = seed_source.fetch_add(0x9E3779B97F4A7C15ull, std::memory_order_relaxed) | 1;
+      state ^= state << 13;
+      state ^= state >> 7;
+      state ^= state << 17;
+      return state;
+    }
+    std::size_t random_shard() const noexcept
+    {
+      return static_cast<std::size_t>(next_random() % _shard_count);
+    }
+
+    template <typename... Args>
+    void insert(Args &&...args)
+    {
+      while (true)
+      {
+        shard &target = _shards[random_shard()];
+        std::unique_lock<std::mutex> lock(target._mutex, std::try_to_lock);
+        if (!lock.owns_lock())
+          continue;
+        target._heap.emplace_back(std::forward<Args>(args)...);
+        std::push_heap(target._heap.begin(), target._heap.end(), _compare);
+        target._count.store(target._heap.size(), std::memory_order_relaxed);
+        _size.fetch_add(1, std::memory_order_release);
+        return;
+      }
+    }
+
+    // 调用方已持有 target 的锁且其非空
+    void take_top(shard &target, value &out)
+    {
+      std::pop_heap(target._heap.begin(), target._heap.end(), _compare);
+      out = std::move(target._heap.back());
+      target._heap.pop_back();
+      target._count.store(target._heap.size(), std::memory_order_relaxed);
+      _size.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    // 随机尝试多次仍未取到元素时，逐个加锁扫描所有堆，保证非空时必能出队
+    bool sweep_pop(value &out)
+    {
+      const std::size_t start = random_shard();
+      for (std::size_t offset = 0; offset < _shard_count; ++offset)
+      {
+        shard &target = _shards[(start + offset) % _shard_count];
+        std::lock_guard<std::mutex> lock(target._mutex);
+        if (!target._heap.empty())
+        {
+          take_top(target, out);
+          return true;
+        }
+      }
+      return false;
+    }
+
+  public:
+    /**
+     * @brief 构造松弛优先级队列
+     * @param relaxation_factor 松弛因子 c，内部堆数量为 c·P，最小为 1
+     * @param thread_count      并发线程数 P，0 表示取 `std::thread::hardware_concurrency()`
+     * @param compare           元素比较器
+     * @note  内部堆数量至少为 2，以保证“二选一”有意义
+     */
+    explicit relaxed_priority_queue(std::size_t relaxation_factor = 2, std::size_t thread_count = 0, const comparator &compare = comparator())
+        : _relaxation(relaxation_factor == 0 ? 1 : relaxation_factor), _compare(compare)
+    {
+      if (thread_count == 0)
+        thread_count = std::max<std::size_t>(1, std::thread::hardware_concurrency());
+      _shard_count = std::max<std::size_t>(2, _relaxation * thread_count);
+      _shards = std::make_unique<shard[]>(_shard_count);
+    }
+    relaxed_priority_queue(const relaxed_priority_queue &) = delete;
+    relaxed_priority_queue &operator=(const relaxed_priority_queue &) = delete;
+
+    /**
+     * @brief #### 获取当前元素个数
+     * @return 近似值，并发修改期间可能与实际数量存在瞬时偏差
+     */
+    std::size_t size() const noexcept
+    {
+      return _size.load(std::memory_order_relaxed);
+    }
+
+    /** @brief #### 判断队列是否为空（近似） */
+    bool empty() const noexcept
+    {
+      return _size.load(std::memory_order_acquire) == 0;
+    }
+
+    /** @brief #### 获取松弛因子 c */
+    std::size_t relaxation_factor() const noexcept
+    {
+      return _relaxation;
+    }
+
+    /** @brief #### 获取内部堆数量 c·P */
+    std::size_t heap_count() const noexcept
+    {
+      return _shard_count;
+    }
+
+    /**
+     * @brief #### 入队（拷贝）
+     * @param value_data 待入队元素
+     */
+    void push(const value &value_data)
+    {
+      insert(value_data);
+    }
+
+    /** @brief #### 入队（移动） */
+    void push(value &&value_data)
+    {
+      insert(std::move(value_data));
+    }
+
+    /**
+     * @brief #### 就地构造入队
+     * @param args 构造元素所需参数
+     */
+    template <typename... Args>
+    void emplace(Args &&...args)
+    {
+      insert(std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief #### 尝试出队（非阻塞）
+     * @param out 接收近似最高优先级元素的引用
+     * @return `true` 成功出队；`false` 所有内部堆均为空
+     * @note  随机选取两个堆，弹出堆顶较优者；多次失败后退化为全量扫描
+     */
+    bool try_pop(value &out)
+    {
+      for (std::size_t attempt = 0; attempt < _shard_count; ++attempt)
+      {
+        if (_size.load(std::memory_order_acquire) == 0)
+          return false;
+        std::size_t first = random_shard();
+        std::size_t second = random_shard();
+        if (first == second)
+          second = (second + 1) % _shard_count;
+        shard *lhs = &_shards[first];
+        shard *rhs = &_shards[second];
+        if (lhs->_count.load(std::memory_order_relaxed) == 0 && rhs->_count.load(std::memory_order_relaxed) == 0)
+          continue;
+        std::unique_lock<std::mutex> lhs_lock(lhs->_mutex, std::try_to_lock);
+        if (!lhs_lock.owns_lock())
+          continue;
+        std::unique_lock<std::mutex> rhs_lock(rhs->_mutex, std::try_to_lock);
+        if (!rhs_lock.owns_lock())
+          continue;
+        if (lhs->_heap.empty() && rhs->_heap.empty())
+          continue;
+        shard *best = lhs;
+        if (lhs->_heap.empty() || (!rhs->_heap.empty() && _compare(lhs->_heap.front(), rhs->_heap.front())))
+          best = rhs;
+        take_top(*best, out);
+        return true;
+      }
+      return sweep_pop(out);
+    }
+
+    /** @brief #### 清空所有内部堆 */
+    void clear()
+    {
+      for (std::size_t index = 0; index < _shard_count; ++index)
+      {
+        shard &target = _shards[index];
+        std::lock_guard<std::mutex> lock(target._mutex);
+        _size.fetch_sub(target._heap.size(), std::memory_order_relaxed);
+        target._heap.clear();
+        target._count.store(0, std::memory_order_relaxed);
+      }
+    }
+  };
+}
@@ -18,6 +18,9 @@
 #include "concurrent_priority_queue.hpp"
 #include "concurrent_unordered_multimap.hpp"
 #include "concurrent_unordered_multiset.hpp"
+#include "concurrent_lock_free_stack.hpp"
+#include "concurrent_lock_free_queue.hpp"
+#include "concurrent_relaxed_priority_queue.hpp"
 
 
 namespace wan
@@ -41,6 +44,10 @@ namespace wan
  * 
  *   - 特殊容器：`concurrent_bitset`、`concurrent_string`
  * 
+ *   - 无锁容器：`lock_free_stack`、`lock_free_queue`（纪元回收 + 线程本地节点池，与加锁版本并列提供）
+ * 
+ *   - 松弛容器：`relaxed_priority_queue`（c·P 个内部堆，随机插入、二选一出队，以近似顺序换取吞吐）
+ * 
  * @warning 大部分容器都会自动扩容，因此需要合理设置容器初始大小以避免频繁扩容带来的性能开销
  * 
  * @note 容器迭代器均为只读迭代器（`const_iterator`），避免外部修改破坏内部一致性；
@@ -14,6 +14,14 @@
 #include "simulate_tree.hpp"
 #include "simulate_vector.hpp"
 #include "simulate_hash.hpp"
+#include "simulate_swiss.hpp"
+#include "simulate_pool.hpp"
+#include "simulate_btree.hpp"
+#include "simulate_deque.hpp"
+#include "simulate_memory.hpp"
+#include "simulate_flat.hpp"
+#include "simulate_perfect.hpp"
+#include "simulate_image.hpp"
 
 namespace wan
 {
@@ -1,4 +1,19 @@
 #pragma once
+#include <bit>
+#include <memory>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <concepts>
+#include <type_traits>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define ALGORITHM_AVX2 1
+#define ALGORITHM_SSE2 1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define ALGORITHM_SSE2 1
+#endif
 #include "simulate_exception.hpp"
 #include "simulate_imitate.hpp"
 namespace standard_con
@@ -6,18 +21,658 @@ namespace standard_con
   /*
   * @brief  #### `algorithm` 算法命名空间
 
-  *   - `copy`: 拷贝函数，将源序列拷贝到目标序列
+  *   - `copy`: 拷贝函数，将源序列拷贝到目标序列，可平凡复制的连续序列走 `memmove`
 
-  *   - `find`: 查找函数，在源序列中查找目标值
+  *   - `find` / `count`: 查找与计数，整数连续序列走 SIMD 批量比较
 
   *   - `swap`: 交换函数，交换两个变量的值
 
+  *   - `sort`: 模式消除快速排序（pdqsort），最坏 O(n log n)
+
+  *   - `radix_sort`: 整数键 LSD 基数排序与字符串键 MSD 基数排序
+
+  *   - `lower_bound` / `upper_bound`: 无分支二分查找
+
   *   - `hash_algorithm`: 哈希算法命名空间，提供多种哈希算法实现
   */
   namespace algorithm {}
 }
 namespace standard_con::algorithm
 {
+  /*
+   * @brief  #### `kernel` 算法内部实现
+
+   *   - SIMD 查找 / 计数、pdqsort 各阶段、基数排序的辅助函数，供本命名空间的公开算法调用
+  */
+  namespace kernel
+  {
+    // 连续的整数序列且查找值可无损表示为元素类型时，才能按位批量比较
+    template <typename iterator_type, typename value_type>
+    inline constexpr bool simd_comparable = []
+    {
+      if constexpr (std::is_pointer_v<iterator_type>)
+      {
+        using element_type = std::remove_cv_t<std::remove_pointer_t<iterator_type>>;
+        return std::is_integral_v<element_type> && !std::is_same_v<element_type, bool> &&
+               std::is_integral_v<value_type> && !std::is_same_v<value_type, bool> &&
+               (sizeof(element_type) == 1 || sizeof(element_type) == 2 || sizeof(element_type) == 4 || sizeof(element_type) == 8);
+      }
+      else
+      {
+        return false;
+      }
+    }();
+
+    // 查找值转换为元素类型后值与符号均不变，否则序列中不可能存在相等元素
+    template <typename element_type, typename value_type>
+    [[nodiscard]] constexpr bool representable(const value_type value) noexcept
+    {
+      const auto narrowed = static_cast<element_type>(value);
+      if (static_cast<value_type>(narrowed) != value)
+      {
+        return false;
+      }
+      if constexpr (std::is_signed_v<element_type> != std::is_signed_v<value_type>)
+      {
+        return (narrowed < element_type{}) == (value < value_type{});
+      }
+      return true;
+    }
+#if defined(ALGORITHM_AVX2)
+    template <typename element_type>
+    [[nodiscard]] inline __m256i equal_lanes(const element_type *position, const __m256i needle) noexcept
+    {
+      // 相等的通道置为全 1
+      const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(position));
+      if constexpr (sizeof(element_type) == 1)
+        return _mm256_cmpeq_epi8(block, needle);
+      else if constexpr (sizeof(element_type) == 2)
+        return _mm256_cmpeq_epi16(block, needle);
+      else if constexpr (sizeof(element_type) == 4)
+        return _mm256_cmpeq_epi32(block, needle);
+      else
+        return _mm256_cmpeq_epi64(block, needle);
+    }
+    template <typename element_type>
+    [[nodiscard]] inline uint32_t equal_mask(const element_type *position, const __m256i needle) noexcept
+    {
+      // 每个相等元素在掩码中占 sizeof(element_type) 个连续位
+      return static_cast<uint32_t>(_mm256_movemask_epi8(equal_lanes(position, needle)));
+    }
+    template <typename element_type>
+    [[nodiscard]] inline __m256i subtract_lanes(const __m256i counter, const __m256i equal) noexcept
+    {
+      if constexpr (sizeof(element_type) == 1)
+        return _mm256_sub_epi8(counter, equal);
+      else if constexpr (sizeof(element_type) == 2)
+        return _mm256_sub_epi16(counter, equal);
+      else if constexpr (sizeof(element_type) == 4)
+        return _mm256_sub_epi32(counter, equal);
+      else
+        return _mm256_sub_epi64(counter, equal);
+    }
+    [[nodiscard]] inline __m256i zero_lanes() noexcept
+    {
+      return _mm256_setzero_si256();
+    }
+    inline void store_lanes(void *target, const __m256i lanes) noexcept
+    {
+      _mm256_storeu_si256(static_cast<__m256i *>(target), lanes);
+    }
+    template <typename element_type>
+    [[nodiscard]] inline __m256i broadcast(const element_type value) noexcept
+    {
+      if constexpr (sizeof(element_type) == 1)
+        return _mm256_set1_epi8(static_cast<char>(value));
+      else if constexpr (sizeof(element_type) == 2)
+        return _mm256_set1_epi16(static_cast<short>(value));
+      else if constexpr (sizeof(element_type) == 4)
+        return _mm256_set1_epi32(static_cast<int>(value));
+      else
+        return _mm256_set1_epi64x(static_cast<long long>(value));
+    }
+    inline constexpr uint64_t simd_bytes = 32;
+#elif defined(ALGORITHM_SSE2)
+    template <typename element_type>
+    [[nodiscard]] inline __m128i equal_lanes(const element_type *position, const __m128i needle) noexcept
+    {
+      const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(position));
+      if constexpr (sizeof(element_type) == 1)
+        return _mm_cmpeq_epi8(block, needle);
+      else if constexpr (sizeof(element_type) == 2)
+        return _mm_cmpeq_epi16(block, needle);
+      else if constexpr (sizeof(element_type) == 4)
+        return _mm_cmpeq_epi32(block, needle);
+      else
+      {
+        // SSE2 没有 64 位相等比较：32 位相等后与交换高低半字的结果相与
+        const __m128i half_equal = _mm_cmpeq_epi32(block, needle);
+        return _mm_and_si128(half_equal, _mm_shuffle_epi32(half_equal, 0xB1));
+      }
+    }
+    template <typename element_type>
+    [[nodiscard]] inline uint32_t equal_mask(const element_type *position, const __m128i needle) noexcept
+    {
+      return static_cast<uint32_t>(_mm_movemask_epi8(equal_lanes(position, needle)));
+    }
+    template <typename element_type>
+    [[nodiscard]] inline __m128i subtract_lanes(const __m128i counter, const __m128i equal) noexcept
+    {
+      if constexpr (sizeof(element_type) == 1)
+        return _mm_sub_epi8(counter, equal);
+      else if constexpr (sizeof(element_type) == 2)
+        return _mm_sub_epi16(counter, equal);
+      else if constexpr (sizeof(element_type) == 4)
+        return _mm_sub_epi32(counter, equal);
+      else
+        return _mm_sub_epi64(counter, equal);
+    }
+    [[nodiscard]] inline __m128i zero_lanes() noexcept
+    {
+      return _mm_setzero_si128();
+    }
+    inline void store_lanes(void *target, const __m128i lanes) noexcept
+    {
+      _mm_storeu_si128(static_cast<__m128i *>(target), lanes);
+    }
+    template <typename element_type>
+    [[nodiscard]] inline __m128i broadcast(const element_type value) noexcept
+    {
+      if constexpr (sizeof(element_type) == 1)
+        return _mm_set1_epi8(static_cast<char>(value));
+      else if constexpr (sizeof(element_type) == 2)
+        return _mm_set1_epi16(static_cast<short>(value));
+      else if constexpr (sizeof(element_type) == 4)
+        return _mm_set1_epi32(static_cast<int>(value));
+      else
+        return _mm_set1_epi64x(static_cast<long long>(value));
+    }
+    inline constexpr uint64_t simd_bytes = 16;
+#endif
+
+    template <typename element_type>
+    [[nodiscard]] inline const element_type *simd_find(const element_type *begin, const element_type *end, const element_type value) noexcept
+    {
+#if defined(ALGORITHM_SSE2)
+      constexpr uint64_t lane_count = simd_bytes / sizeof(element_type);
+      const auto needle = broadcast(value);
+      // 每轮比较两个寄存器宽度，合并掩码后只判断一次，减少循环与分支开销
+      for (; static_cast<uint64_t>(end - begin) >= 2 * lane_count; begin += 2 * lane_count)
+      {
+        const uint64_t mask = equal_mask(begin, needle) | (static_cast<uint64_t>(equal_mask(begin + lane_count, needle)) << simd_bytes);
+        if (mask != 0)
+        {
+          return begin + std::countr_zero(mask) / sizeof(element_type);
+        }
+      }
+      for (; static_cast<uint64_t>(end - begin) >= lane_count; begin += lane_count)
+      {
+        const uint32_t mask = equal_mask(begin, needle);
+        if (mask != 0)
+        {
+          return begin + std::countr_zero(mask) / sizeof(element_type);
+        }
+      }
+#endif
+      for (; begin != end; ++begin)
+      {
+        if (*begin == value)
+        {
+          return begin;
+        }
+      }
+      return end;
+    }
+    template <typename element_type>
+    [[nodiscard]] inline uint64_t simd_count(const element_type *begin, const element_type *end, const element_type value) noexcept
+    {
+      uint64_t result = 0;
+#if defined(ALGORITHM_SSE2)
+      // 相等的通道为全 1（即 -1），减去它就在各通道内计数；通道计数器溢出之前汇总一次，避免逐块求掩码位数
+      using lane_type = std::make_unsigned_t<element_type>;
+      constexpr uint64_t lane_count = simd_bytes / sizeof(element_type);
+      constexpr uint64_t flush_blocks = sizeof(element_type) >= 4 ? (uint64_t{1} << 31) : (uint64_t{1} << (8 * sizeof(element_type))) - 1;
+      const auto needle = broadcast(value);
+      while (static_cast<uint64_t>(end - begin) >= lane_count)
+      {
+        auto counter = zero_lanes();
+        for (uint64_t block_index = 0; block_index < flush_blocks && static_cast<uint64_t>(end - begin) >= lane_count; ++block_index, begin += lane_count)
+        {
+          counter = subtract_lanes<element_type>(counter, equal_lanes(begin, needle));
+        }
+        lane_type lanes[lane_count];
+        store_lanes(lanes, counter);
+        for (const lane_type lane : lanes)
+        {
+          result += lane;
+        }
+      }
+#endif
+      for (; begin != end; ++begin)
+      {
+        result += static_cast<uint64_t>(*begin == value);
+      }
+      return result;
+    }
+
+    template <typename iterator_type>
+    inline void iterator_swap(iterator_type left, iterator_type right)
+    {
+      using std::swap;
+      swap(*left, *right);
+    }
+    inline constexpr int64_t insertion_sort_threshold = 24;
+    inline constexpr int64_t ninther_threshold = 128;
+    inline constexpr int64_t partial_insertion_sort_limit = 8;
+
+    template <typename iterator_type, typename comparator_type>
+    void insertion_sort(iterator_type begin, iterator_type end, comparator_type &comparator)
+    {
+      if (begin == end)
+      {
+        return;
+      }
+      for (iterator_type current = begin + 1; current != end; ++current)
+      {
+        iterator_type sift = current;
+        iterator_type sift_previous = current - 1;
+        if (comparator(*sift, *sift_previous))
+        {
+          auto hole_value = std::move(*sift);
+          do
+          {
+            *sift-- = std::move(*sift_previous);
+          } while (sift != begin && comparator(hole_value, *--sift_previous));
+          *sift = std::move(hole_value);
+        }
+      }
+    }
+    // 左侧必有不大于所有元素的哨兵（上一轮的枢轴），省去边界检查
+    template <typename iterator_type, typename comparator_type>
+    void unguarded_insertion_sort(iterator_type begin, iterator_type end, comparator_type &comparator)
+    {
+      if (begin == end)
+      {
+        return;
+      }
+      for (iterator_type current = begin + 1; current != end; ++current)
+      {
+        iterator_type sift = current;
+        iterator_type sift_previous = current - 1;
+        if (comparator(*sift, *sift_previous))
+        {
+          auto hole_value = std::move(*sift);
+          do
+          {
+            *sift-- = std::move(*sift_previous);
+          } while (comparator(hole_value, *--sift_previous));
+          *sift = std::move(hole_value);
+        }
+      }
+    }
+    // 移动次数超过上限即放弃，返回是否已排好
+    template <typename iterator_type, typename comparator_type>
+    bool partial_insertion_sort(iterator_type begin, iterator_type end, comparator_type &comparator)
+    {
+      if (begin == end)
+      {
+        return true;
+      }
+      int64_t moved_count = 0;
+      for (iterator_type current = begin + 1; current != end; ++current)
+      {
+        if (moved_count > partial_insertion_sort_limit)
+        {
+          return false;
+        }
+        iterator_type sift = current;
+        iterator_type sift_previous = current - 1;
+        if (comparator(*sift, *sift_previous))
+        {
+          auto hole_value = std::move(*sift);
+          do
+          {
+            *sift-- = std::move(*sift_previous);
+          } while (sift != begin && comparator(hole_value, *--sift_previous));
+          *sift = std::move(hole_value);
+          moved_count += current - sift;
+        }
+      }
+      return true;
+    }
+    template <typename iterator_type, typename comparator_type>
+    void sort_two(iterator_type first, iterator_type second, comparator_type &comparator)
+    {
+      if (comparator(*second, *first))
+      {
+        iterator_swap(first, second);
+      }
+    }
+    template <typename iterator_type, typename comparator_type>
+    void sort_three(iterator_type first, iterator_type second, iterator_type third, comparator_type &comparator)
+    {
+      sort_two(first, second, comparator);
+      sort_two(second, third, comparator);
+      sort_two(first, second, comparator);
+    }
+    // 以 *begin 为枢轴划分，小于枢轴的放左侧；返回枢轴最终位置及划分前是否已有序
+    template <typename iterator_type, typename comparator_type>
+    std::pair<iterator_type, bool> partition_right(iterator_type begin, iterator_type end, comparator_type &comparator)
+    {
+      auto pivot = std::move(*begin);
+      iterator_type first = begin;
+      iterator_type last = end;
+      while (comparator(*++first, pivot))
+        ;
+      if (first - 1 == begin)
+      {
+        while (first < last && !comparator(*--last, pivot))
+          ;
+      }
+      else
+      {
+        while (!comparator(*--last, pivot))
+          ;
+      }
+      const bool already_partitioned = !(first < last);
+      while (first < last)
+      {
+        iterator_swap(first, last);
+        while (comparator(*++first, pivot))
+          ;
+        while (!comparator(*--last, pivot))
+          ;
+      }
+      iterator_type pivot_position = first - 1;
+      *begin = std::move(*pivot_position);
+      *pivot_position = std::move(pivot);
+      return std::pair<iterator_type, bool>(pivot_position, already_partitioned);
+    }
+    // 与枢轴相等的元素放左侧，用于大量重复键：重复元素一次划分后不再参与递归
+    template <typename iterator_type, typename comparator_type>
+    iterator_type partition_left(iterator_type begin, iterator_type end, comparator_type &comparator)
+    {
+      auto pivot = std::move(*begin);
+      iterator_type first = begin;
+      iterator_type last = end;
+      while (comparator(pivot, *--last))
+        ;
+      if (last + 1 == end)
+      {
+        while (first < last && !comparator(pivot, *++first))
+          ;
+      }
+      else
+      {
+        while (!comparator(pivot, *++first))
+          ;
+      }
+      while (first < last)
+      {
+        iterator_swap(first, last);
+        while (comparator(pivot, *--last))
+          ;
+        while (!comparator(pivot, *++first))
+          ;
+      }
+      iterator_type pivot_position = last;
+      *begin = std::move(*pivot_position);
+      *pivot_position = std::move(pivot);
+      return pivot_position;
+    }
+    template <typename iterator_type, typename comparator_type>
+    void heap_sift_down(iterator_type begin, int64_t parent_index, const int64_t element_count, comparator_type &comparator)
+    {
+      auto hole_value = std::move(begin[parent_index]);
+      while (true)
+      {
+        int64_t child_index = parent_index * 2 + 1;
+        if (child_index >= element_count)
+        {
+          break;
+        }
+        if (child_index + 1 < element_count && comparator(begin[child_index], begin[child_index + 1]))
+        {
+          ++child_index;
+        }
+        if (!comparator(hole_value, begin[child_index]))
+        {
+          break;
+        }
+        begin[parent_index] = std::move(begin[child_index]);
+        parent_index = child_index;
+      }
+      begin[parent_index] = std::move(hole_value);
+    }
+    // 划分连续失衡时退化为堆排序，保证最坏 O(n log n)
+    template <typename iterator_type, typename comparator_type>
+    void heap_sort(iterator_type begin, iterator_type end, comparator_type &comparator)
+    {
+      const int64_t element_count = end - begin;
+      for (int64_t parent_index = element_count / 2 - 1; parent_index >= 0; --parent_index)
+      {
+        heap_sift_down(begin, parent_index, element_count, comparator);
+      }
+      for (int64_t heap_size = element_count - 1; heap_size > 0; --heap_size)
+      {
+        iterator_swap(begin, begin + heap_size);
+        heap_sift_down(begin, 0, heap_size, comparator);
+      }
+    }
+    template <typename iterator_type, typename comparator_type>
+    void pdqsort_loop(iterator_type begin, iterator_type end, comparator_type &comparator, int bad_allowed, bool leftmost = true)
+    {
+      while (true)
+      {
+        const int64_t element_count = end - begin;
+        if (element_count < insertion_sort_threshold)
+        {
+          if (leftmost)
+          {
+            insertion_sort(begin, end, comparator);
+          }
+          else
+          {
+            unguarded_insertion_sort(begin, end, comparator);
+          }
+          return;
+        }
+        // 选枢轴：大区间用九数取中（ninther），小区间用三数取中，枢轴放到 begin
+        const int64_t half_count = element_count / 2;
+        if (element_count > ninther_threshold)
+        {
+          sort_three(begin, begin + half_count, end - 1, comparator);
+          sort_three(begin + 1, begin + (half_count - 1), end - 2, comparator);
+          sort_three(begin + 2, begin + (half_count + 1), end - 3, comparator);
+          sort_three(begin + (half_count - 1), begin + half_count, begin + (half_count + 1), comparator);
+          iterator_swap(begin, begin + half_count);
+        }
+        else
+        {
+          sort_three(begin + half_count, begin, end - 1, comparator);
+        }
+        // 枢轴与左侧哨兵相等说明大量重复，把相等元素一次性放到左侧
+        if (!leftmost && !comparator(*(begin - 1), *begin))
+        {
+          begin = partition_left(begin, end, comparator) + 1;
+          continue;
+        }
+        const auto [pivot_position, already_partitioned] = partition_right(begin, end, comparator);
+        const int64_t left_count = pivot_position - begin;
+        const int64_t right_count = end - (pivot_position + 1);
+        const bool highly_unbalanced = left_count < element_count / 8 || right_count < element_count / 8;
+        if (highly_unbalanced)
+        {
+          if (--bad_allowed == 0)
+          {
+            heap_sort(begin, end, comparator);
+            return;
+          }
+          // 打乱两侧若干元素，破坏导致失衡的输入模式
+          if (left_count >= insertion_sort_threshold)
+          {
+            iterator_swap(begin, begin + left_count / 4);
+            iterator_swap(pivot_position - 1, pivot_position - left_count / 4);
+            if (left_count > ninther_threshold)
+            {
+              iterator_swap(begin + 1, begin + (left_count / 4 + 1));
+              iterator_swap(begin + 2, begin + (left_count / 4 + 2));
+              iterator_swap(pivot_position - 2, pivot_position - (left_count / 4 + 1));
+              iterator_swap(pivot_position - 3, pivot_position - (left_count / 4 + 2));
+            }
+          }
+          if (right_count >= insertion_sort_threshold)
+          {
+            iterator_swap(pivot_position + 1, pivot_position + (1 + right_count / 4));
+            iterator_swap(end - 1, end - right_count / 4);
+            if (right_count > ninther_threshold)
+            {
+              iterator_swap(pivot_position + 2, pivot_position + (2 + right_count / 4));
+              iterator_swap(pivot_position + 3, pivot_position + (3 + right_count / 4));
+              iterator_swap(end - 2, end - (1 + right_count / 4));
+              iterator_swap(end - 3, end - (2 + right_count / 4));
+            }
+          }
+        }
+        else if (already_partitioned && partial_insertion_sort(begin, pivot_position, comparator) &&
+                 partial_insertion_sort(pivot_position + 1, end, comparator))
+        {
+          // 划分时未发生交换且两侧插入排序很快完成：输入基本有序
+          return;
+        }
+        // 递归处理左侧，右侧循环处理
+        pdqsort_loop(begin, pivot_position, comparator, bad_allowed, leftmost);
+        begin = pivot_position + 1;
+        leftmost = false;
+      }
+    }
+
+    template <typename value_type>
+    inline constexpr bool string_like = requires(const value_type &value_data) {
+      { value_data.size() } -> std::convertible_to<uint64_t>;
+      { value_data[0] } -> std::convertible_to<char>;
+    };
+    // 整数映射为保序的无符号键：有符号数翻转符号位
+    template <typename value_type>
+    [[nodiscard]] inline std::make_unsigned_t<value_type> radix_key(const value_type value) noexcept
+    {
+      using unsigned_type = std::make_unsigned_t<value_type>;
+      if constexpr (std::is_signed_v<value_type>)
+      {
+        return static_cast<unsigned_type>(static_cast<unsigned_type>(value) ^ (unsigned_type{1} << (sizeof(value_type) * 8 - 1)));
+      }
+      else
+      {
+        return static_cast<unsigned_type>(value);
+      }
+    }
+    // LSD：每轮按一个字节稳定分配，所有字节的直方图一次扫描得到；某字节全部相同则跳过该轮
+    template <typename value_type, typename key_function_type>
+    void lsd_radix_sort(value_type *source, value_type *buffer, const uint64_t element_count, key_function_type &key_function)
+    {
+      using key_type = std::remove_cvref_t<decltype(key_function(*source))>;
+      constexpr uint64_t pass_count = sizeof(key_type);
+      auto histogram = std::make_unique<uint64_t[]>(pass_count * 256);
+      for (uint64_t element_index = 0; element_index < element_count; ++element_index)
+      {
+        const key_type key_value = key_function(source[element_index]);
+        for (uint64_t pass_index = 0; pass_index < pass_count; ++pass_index)
+        {
+          ++histogram[pass_index * 256 + ((key_value >> (pass_index * 8)) & 0xff)];
+        }
+      }
+      value_type *from = source;
+      value_type *to = buffer;
+      for (uint64_t pass_index = 0; pass_index < pass_count; ++pass_index)
+      {
+        uint64_t *counts = histogram.get() + pass_index * 256;
+        if (counts[(key_function(from[0]) >> (pass_index * 8)) & 0xff] == element_count)
+        {
+          continue;
+        }
+        uint64_t running_offset = 0;
+        for (uint64_t digit = 0; digit < 256; ++digit)
+        {
+          const uint64_t digit_count = counts[digit];
+          counts[digit] = running_offset;
+          running_offset += digit_count;
+        }
+        for (uint64_t element_index = 0; element_index < element_count; ++element_index)
+        {
+          const uint64_t digit = (key_function(from[element_index]) >> (pass_index * 8)) & 0xff;
+          to[counts[digit]++] = std::move(from[element_index]);
+        }
+        std::swap(from, to);
+      }
+      if (from != source)
+      {
+        for (uint64_t element_index = 0; element_index < element_count; ++element_index)
+        {
+          source[element_index] = std::move(from[element_index]);
+        }
+      }
+    }
+    inline constexpr uint64_t string_radix_threshold = 32;
+    template <typename value_type>
+    [[nodiscard]] inline int32_t character_at(const value_type &value_data, const uint64_t depth) noexcept
+    {
+      // 已结束的字符串记为 -1，排在所有字符之前
+      return depth < static_cast<uint64_t>(value_data.size()) ? static_cast<int32_t>(static_cast<unsigned char>(value_data[depth])) : -1;
+    }
+    // MSD：按第 depth 个字符分成 257 个桶（含“已结束”桶），逐桶递归；小桶改用比较排序
+    template <typename value_type>
+    void msd_radix_sort(value_type *source, value_type *buffer, const uint64_t element_count, const uint64_t depth)
+    {
+      if (element_count < string_radix_threshold)
+      {
+        auto suffix_less = [depth](const value_type &left_value, const value_type &right_value)
+        {
+          const uint64_t left_size = static_cast<uint64_t>(left_value.size());
+          const uint64_t right_size = static_cast<uint64_t>(right_value.size());
+          for (uint64_t character_index = depth; character_index < left_size && character_index < right_size; ++character_index)
+          {
+            const auto left_character = static_cast<unsigned char>(left_value[character_index]);
+            const auto right_character = static_cast<unsigned char>(right_value[character_index]);
+            if (left_character != right_character)
+            {
+              return left_character < right_character;
+            }
+          }
+          return left_size < right_size;
+        };
+        insertion_sort(source, source + element_count, suffix_less);
+        return;
+      }
+      uint64_t bucket_offset[258] = {};
+      for (uint64_t element_index = 0; element_index < element_count; ++element_index)
+      {
+        ++bucket_offset[character_at(source[element_index], depth) + 2];
+      }
+      for (uint64_t bucket_index = 1; bucket_index < 258; ++bucket_index)
+      {
+        bucket_offset[bucket_index] += bucket_offset[bucket_index - 1];
+      }
+      uint64_t bucket_cursor[257];
+      std::memcpy(bucket_cursor, bucket_offset, sizeof(bucket_cursor));
+      for (uint64_t element_index = 0; element_index < element_count; ++element_index)
+      {
+        buffer[bucket_cursor[character_at(source[element_index], depth) + 1]++] = std::move(source[element_index]);
+      }
+      for (uint64_t element_index = 0; element_index < element_count; ++element_index)
+      {
+        source[element_index] = std::move(buffer[element_index]);
+      }
+      // 桶 0 为在 depth 处结束的字符串，彼此相等无需再排
+      for (uint64_t bucket_index = 1; bucket_index < 257; ++bucket_index)
+      {
+        const uint64_t bucket_size = bucket_offset[bucket_index + 1] - bucket_offset[bucket_index];
+        if (bucket_size > 1)
+        {
+          msd_radix_sort(source + bucket_offset[bucket_index], buffer, bucket_size, depth + 1);
+        }
+      }
+    }
+  }
   /*
    * @brief  #### `copy` 函数模板
 
@@ -40,7 +695,7 @@ namespace standard_con::algorithm
 
    * 返回值:
 
-   * * - 返回目标序列中最后一个被复制元素的下一个位置的指针（即 `&first + (end - begin)`）
+   * * - 返回目标序列中最后一个被复制元素的下一个位置（即 `first + (end - begin)`）
 
    * 特性:
    * * - `constexpr`: 支持编译期计算（如果参数是编译期常量）
@@ -50,10 +705,12 @@ namespace standard_con::algorithm
    * * - 要求: 目标序列必须有足够空间容纳源序列的所有元素
    *
    * * - 复杂度: 线性时间，O(n)，其中 n = end - begin
+   *
+   * * - 源与目标均为指针、元素类型相同且可平凡复制时，整段调用 `memmove`
 
    * 注意事项:
 
-   * * - 源序列和目标序列不能重叠
+   * * - 源序列和目标序列不能重叠（指针且元素可平凡复制时走 `memmove`，此时允许重叠）
    *
    * * - 目标序列必须有足够的容量，否则会导致未定义行为
    *
@@ -64,16 +721,33 @@ namespace standard_con::algorithm
    * 详细请参考 https://github.com/Hatedatastructures/Custom-libraries/blob/main/template_container.md
   */
   template <typename source_sequence_copy, typename target_sequence_copy>
-  constexpr target_sequence_copy *copy(source_sequence_copy begin, source_sequence_copy end, target_sequence_copy first) noexcept
+  constexpr target_sequence_copy copy(source_sequence_copy begin, source_sequence_copy end, target_sequence_copy first) noexcept
   {
-    target_sequence_copy *return_first = &first;
+    if constexpr (std::is_pointer_v<source_sequence_copy> && std::is_pointer_v<target_sequence_copy>)
+    {
+      using source_value = std::remove_const_t<std::remove_pointer_t<source_sequence_copy>>;
+      using target_value = std::remove_pointer_t<target_sequence_copy>;
+      if constexpr (std::is_same_v<source_value, target_value> && std::is_trivially_copyable_v<target_value>)
+      {
+        if (!std::is_constant_evaluated())
+        {
+          // 可平凡复制的连续序列整块搬运，memmove 同时容忍重叠
+          const auto element_count = static_cast<uint64_t>(end - begin);
+          if (element_count != 0)
+          {
+            std::memmove(static_cast<void *>(first), static_cast<const void *>(begin), element_count * sizeof(target_value));
+          }
+          return first + element_count;
+        }
+      }
+    }
     while (begin != end)
     {
       *first = *begin;
       ++begin;
       ++first;
     }
-    return return_first;
+    return first;
   }
   /*
    * @brief  #### `find` 函数模板
@@ -107,6 +781,8 @@ namespace standard_con::algorithm
    * * - `noexcept`: 保证不抛出异常
    *
    * * - 复杂度: 线性时间，O(n)，其中 n = end - begin
+   *
+   * * - 指针区间且元素为 1/2/4/8 字节整数时，按 SIMD 寄存器宽度批量比较，命中位置由掩码的最低置位得到
 
    * 注意事项:
 
@@ -124,15 +800,39 @@ namespace standard_con::algorithm
   template <typename source_sequence_find, typename target_sequence_find>
   constexpr source_sequence_find find(source_sequence_find begin, source_sequence_find end, const target_sequence_find &value) noexcept
   {
-    while (begin != end)
+    if constexpr (kernel::simd_comparable<source_sequence_find, target_sequence_find>)
     {
-      if (*begin == value)
+      using element_type = std::remove_cv_t<std::remove_pointer_t<source_sequence_find>>;
+      if (!kernel::representable<element_type>(value))
       {
-        return begin;
+        return end;
       }
-      ++begin;
+      const auto element_value = static_cast<element_type>(value);
+      if (!std::is_constant_evaluated())
+      {
+        return const_cast<source_sequence_find>(kernel::simd_find<element_type>(begin, end, element_value));
+      }
+      for (; begin != end; ++begin)
+      {
+        if (*begin == element_value)
+        {
+          return begin;
+        }
+      }
+      return end;
+    }
+    else
+    {
+      while (begin != end)
+      {
+        if (*begin == value)
+        {
+          return begin;
+        }
+        ++begin;
+      }
+      return end;
     }
-    return end;
   }
   /*
 
@@ -160,13 +860,11 @@ namespace standard_con::algorithm
 
       * * - 复杂度: 常数时间 `O(1)`
 
-      * * - 操作: 通过临时变量中转，完成 `a` 和 `b` 的值交换
+      * * - 操作: 通过临时变量移动中转，完成 `a` 和 `b` 的值交换
 
       * 注意事项:
 
-      * * - 依赖类型 `swap_data_type` 支持拷贝构造（`swap_data_type temp = a`）和赋值操作（`a = b`、`b = temp`）
-
-      * * - 对于大型对象，此实现可能因拷贝操作导致性能损耗（可考虑为特定类型提供重载版本优化）
+      * * - 依赖类型 `swap_data_type` 支持移动构造和移动赋值（不支持移动的类型退化为拷贝）
 
       * * - 交换后，`a` 持有原 `b` 的值，`b` 持有原 `a` 的值
 
@@ -177,8 +875,275 @@ namespace standard_con::algorithm
   template <typename swap_data_type>
   constexpr void swap(swap_data_type &a, swap_data_type &b) noexcept
   {
-    swap_data_type temp = a;
-    a = b;
-    b = temp;
+    swap_data_type temp = std::move(a);
+    a = std::move(b);
+    b = std::move(temp);
+  }
+  /*
+   * @brief  #### `count` 函数模板
+
+   *   - 统计指定范围内等于给定值的元素个数
+
+   * 参数:
+
+   * * - `begin` / `end`: 统计范围（左闭右开）
+   *
+   * * - `value`: 需要统计的值
+
+   * 返回值:
+
+   * * - 等于 `value` 的元素个数
+
+   * 特性:
+
+   * * - 复杂度: 线性时间，O(n)
+   *
+   * * - 指针区间且元素为 1/2/4/8 字节整数时，一次比较一个 SIMD 寄存器宽度的元素，相等结果在各通道内累加
+
+   * 注意事项:
+
+   * * - `value` 无法用元素类型精确表示时（如在 `uint8_t` 序列中统计 300）直接返回 0
+  */
+  template <typename source_sequence_count, typename target_sequence_count>
+  constexpr uint64_t count(source_sequence_count begin, source_sequence_count end, const target_sequence_count &value) noexcept
+  {
+    if constexpr (kernel::simd_comparable<source_sequence_count, target_sequence_count>)
+    {
+      using element_type = std::remove_cv_t<std::remove_pointer_t<source_sequence_count>>;
+      if (!kernel::representable<element_type>(value))
+      {
+        return 0;
+      }
+      const auto element_value = static_cast<element_type>(value);
+      if (!std::is_constant_evaluated())
+      {
+        return kernel::simd_count<element_type>(begin, end, element_value);
+      }
+      uint64_t result = 0;
+      for (; begin != end; ++begin)
+      {
+        result += static_cast<uint64_t>(*begin == element_value);
+      }
+      return result;
+    }
+    else
+    {
+      uint64_t result = 0;
+      for (; begin != end; ++begin)
+      {
+        if (*begin == value)
+        {
+          ++result;
+        }
+      }
+      return result;
+    }
+  }
+  /*
+   * @brief  #### `lower_bound` / `upper_bound` 函数模板
+
+   *   - 在有序区间中二分查找第一个不小于（`lower_bound`）/ 大于（`upper_bound`）`value` 的位置
+
+   * 参数:
+
+   * * - `begin` / `end`: 已按 `comparator` 升序排列的区间，迭代器需支持随机访问
+   *
+   * * - `value`: 查找值
+   *
+   * * - `comparator`: 比较仿函数，默认 `standard_con::less`
+
+   * 实现说明:
+
+   * * - 每轮只根据比较结果移动基准位置，区间长度按固定的 n - n/2 缩小，循环次数只取决于 n
+   *
+   * * - 比较结果编译为条件传送而不是跳转，查找路径不可预测时避免分支预测失败
+
+   * 返回值:
+
+   * * - 满足条件的位置，不存在时返回 `end`
+  */
+  template <typename iterator_type, typename value_type, typename comparator_type = standard_con::less<std::remove_cvref_t<decltype(*std::declval<iterator_type>())>>>
+  constexpr iterator_type lower_bound(iterator_type begin, iterator_type end, const value_type &value, comparator_type comparator = comparator_type())
+  {
+    int64_t element_count = end - begin;
+    if (element_count == 0)
+    {
+      return end;
+    }
+    while (element_count > 1)
+    {
+      const int64_t half_count = element_count / 2;
+      begin = comparator(begin[half_count - 1], value) ? begin + half_count : begin;
+      element_count -= half_count;
+    }
+    return comparator(*begin, value) ? begin + 1 : begin;
+  }
+  template <typename iterator_type, typename value_type, typename comparator_type = standard_con::less<std::remove_cvref_t<decltype(*std::declval<iterator_type>())>>>
+  constexpr iterator_type upper_bound(iterator_type begin, iterator_type end, const value_type &value, comparator_type comparator = comparator_type())
+  {
+    int64_t element_count = end - begin;
+    if (element_count == 0)
+    {
+      return end;
+    }
+    while (element_count > 1)
+    {
+      const int64_t half_count = element_count / 2;
+      begin = comparator(value, begin[half_count - 1]) ? begin : begin + half_count;
+      element_count -= half_count;
+    }
+    return comparator(value, *begin) ? begin : begin + 1;
+  }
+  /*
+   * @brief  #### `sort` 函数模板
+
+   *   - 模式消除快速排序（pattern-defeating quicksort），不稳定
+
+   * 参数:
+
+   * * - `begin` / `end`: 待排序区间，迭代器需支持随机访问（指针、`vector`、`deque` 迭代器）
+   *
+   * * - `comparator`: 比较仿函数，默认 `standard_con::less`
+
+   * 实现说明:
+
+   * * - 少于 24 个元素用插入排序；枢轴大区间取九数中位数，小区间取三数中位数
+   *
+   * * - 划分时没有发生交换则尝试有限次数的插入排序，已有序 / 近乎有序的输入接近线性时间
+   *
+   * * - 枢轴与左侧相邻元素相等时把相等元素集中到左侧，大量重复键不会退化
+   *
+   * * - 划分严重失衡时交换若干元素打破输入模式；失衡次数超过 log2(n) 改用堆排序，最坏 O(n log n)
+
+   * 注意事项:
+
+   * * - 迭代器只用到 `+`、`-`、`++`、`--`、`==`、`!=`、`<` 与解引用
+  */
+  template <typename iterator_type, typename comparator_type>
+  void sort(iterator_type begin, iterator_type end, comparator_type comparator)
+  {
+    if (begin == end)
+    {
+      return;
+    }
+    const auto element_count = static_cast<uint64_t>(end - begin);
+    kernel::pdqsort_loop(begin, end, comparator, std::bit_width(element_count));
+  }
+  template <typename iterator_type>
+  void sort(iterator_type begin, iterator_type end)
+  {
+    algorithm::sort(begin, end, standard_con::less<std::remove_cvref_t<decltype(*begin)>>());
+  }
+  /*
+   * @brief  #### `radix_sort` 函数模板
+
+   *   - 非比较排序，整数键走 LSD（低位优先），字符串键走 MSD（高位优先）
+
+   * 重载:
+
+   * * - `radix_sort(begin, end)`: 元素为整数时按值排序；元素具有 `size()` 与 `operator[]` 返回字符时按字典序排序
+   *
+   * * - `radix_sort(begin, end, key_function)`: 以 `key_function(element)` 返回的整数为键稳定排序
+
+   * 实现说明:
+
+   * * - LSD 每轮处理 8 位，所有轮次的直方图一次扫描得到；某一字节在所有键上相同则跳过该轮
+   *
+   * * - 有符号整数翻转符号位后按无符号处理，负数排在正数之前
+   *
+   * * - 字符串长度不定，LSD 需要补齐到最长键，故改用 MSD：按当前字符分桶后逐桶递归，小桶（少于 32 个）改用比较排序
+   *
+   * * - 元素少于 64 个时改用比较排序：无键函数时调用 `sort`，有键函数时按键插入排序以保持稳定
+
+   * 注意事项:
+
+   * * - 需要与区间等长的临时缓冲区，元素需可默认构造和移动赋值
+   *
+   * * - 区间先移动到连续缓冲区排序再移回，因此同样适用于 `deque` 等非连续容器
+  */
+  template <typename iterator_type, typename key_function_type>
+  void radix_sort(iterator_type begin, iterator_type end, key_function_type key_function)
+  {
+    using value_type = std::remove_cvref_t<decltype(*begin)>;
+    using key_type = std::remove_cvref_t<decltype(key_function(*begin))>;
+    static_assert(std::is_integral_v<key_type>, "radix_sort 的键必须是整数类型");
+    const auto element_count = static_cast<uint64_t>(end - begin);
+    if (element_count < 2)
+    {
+      return;
+    }
+    auto ordered_key = [&key_function](const value_type &value_data)
+    {
+      return kernel::radix_key(static_cast<key_type>(key_function(value_data)));
+    };
+    if (element_count < 64)
+    {
+      // 直方图与缓冲区的固定开销在小区间上占主导，改用同样稳定的插入排序
+      auto key_less = [&ordered_key](const value_type &left_value, const value_type &right_value)
+      {
+        return ordered_key(left_value) < ordered_key(right_value);
+      };
+      kernel::insertion_sort(begin, end, key_less);
+      return;
+    }
+    auto buffer = std::make_unique<value_type[]>(element_count);
+    if constexpr (std::is_pointer_v<iterator_type>)
+    {
+      kernel::lsd_radix_sort(&*begin, buffer.get(), element_count, ordered_key);
+    }
+    else
+    {
+      auto staging = std::make_unique<value_type[]>(element_count);
+      iterator_type current = begin;
+      for (uint64_t element_index = 0; element_index < element_count; ++element_index, ++current)
+      {
+        staging[element_index] = std::move(*current);
+      }
+      kernel::lsd_radix_sort(staging.get(), buffer.get(), element_count, ordered_key);
+      current = begin;
+      for (uint64_t element_index = 0; element_index < element_count; ++element_index, ++current)
+      {
+        *current = std::move(staging[element_index]);
+      }
+    }
+  }
+  template <typename iterator_type>
+  void radix_sort(iterator_type begin, iterator_type end)
+  {
+    using value_type = std::remove_cvref_t<decltype(*begin)>;
+    const auto element_count = static_cast<uint64_t>(end - begin);
+    if (element_count < 64)
+    {
+      algorithm::sort(begin, end);
+      return;
+    }
+    if constexpr (std::is_integral_v<value_type> && !std::is_same_v<value_type, bool>)
+    {
+      algorithm::radix_sort(begin, end, [](const value_type value_data) noexcept { return value_data; });
+    }
+    else
+    {
+      static_assert(kernel::string_like<value_type>, "radix_sort 仅支持整数或字符串类元素，其他类型请提供键函数");
+      auto buffer = std::make_unique<value_type[]>(element_count);
+      if constexpr (std::is_pointer_v<iterator_type>)
+      {
+        kernel::msd_radix_sort(&*begin, buffer.get(), element_count, 0);
+      }
+      else
+      {
+        auto staging = std::make_unique<value_type[]>(element_count);
+        iterator_type current = begin;
+        for (uint64_t element_index = 0; element_index < element_count; ++element_index, ++current)
+        {
+          staging[element_index] = std::move(*current);
+        }
+        kernel::msd_radix_sort(staging.get(), buffer.get(), element_count, 0);
+        current = begin;
+        for (uint64_t element_index = 0; element_index < element_count; ++element_index, ++current)
+        {
+          *current = std::move(staging[element_index]);
+        }
+      }
+    }
   }
-}
\ No newline at end of file
+}
@@ -1,4 +1,10 @@
 #pragma once
+#include <bit>
+#include <type_traits>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define BIT_SET_AVX2 1
+#endif
 #include "simulate_stack.hpp"
 #include "simulate_vector.hpp"
 #include "simulate_algorithm.hpp"
@@ -6,6 +12,7 @@
 #include "simulate_exception.hpp"
 #include "simulate_imitate.hpp"
 #include "simulate_hash.hpp"
+#include "simulate_pool.hpp"
 namespace base_container
 {
   /*
@@ -27,6 +34,12 @@ namespace base_container
       *
       * * - `container_imitate_function`: 比较器类型，默认为 `standard_con::imitation_functions::less<rb_tree_type_key>`
       *    定义键的大小关系，返回 `true` 表示左操作数小于右操作数
+      *
+      * * - `rb_tree_allocator`: 分配器类型，默认为 `std::allocator<rb_tree_type_value>`，重绑定到节点类型后为节点池提供块内存
+      *
+      * * - `rb_tree_interval_visit`: 区间访问器类型，默认为 `void`（不维护区间信息）
+      *    非 `void` 时须从值中取出 `.first` / `.second` 为左右端点的区间，且树按键的顺序与区间左端点的顺序一致（键为左端点或 (左端点, 右端点)）
+      *    端点类型需支持 `<` 比较，每个节点额外维护子树内最大右端点
 
 
       * 迭代器相关方法:
@@ -55,7 +68,7 @@ namespace base_container
 
       * 析构函数:
 
-      * * - 调用 `clear(_root)` 释放所有节点资源
+      * * - 调用 `clear(_root)` 析构所有节点，节点池内存整块归还
 
       * 主要操作方法:
 
@@ -76,6 +89,16 @@ namespace base_container
       *
       * * - `empty()`: 判断树是否为空（根节点为 `nullptr` 则返回 `true`）
       *
+      * * - `clear()`: 清空所有节点
+      *
+      * * - `select(index)`: 返回中序第 `index` 个（从 0 开始）节点的迭代器，越界返回 `end()`，O(log n)
+      *
+      * * - `rank(key)`: 返回键小于 `key` 的节点个数，O(log n)；`select(rank(key))` 即第一个不小于 `key` 的节点
+      *
+      * * - `overlap_find(low, high)`: 返回任意一个与闭区间 [low, high] 相交的节点，没有则返回 `end()`，O(log n)（仅区间树）
+      *
+      * * - `overlap_visit(low, high, callback)`: 按中序对所有与 [low, high] 相交的节点调用 `callback(value)`，O(log n + k)（仅区间树）
+      *
       *
       *   - `middle_order_traversal()`: 中序遍历，打印节点数据（结果为有序序列）
       *
@@ -98,6 +121,10 @@ namespace base_container
       * * - 迭代器有效性: 插入和删除操作可能改变结构，但迭代器仍能正确遍历
       *
       * * - 支持移动语义: 减少不必要的拷贝，提高插入和赋值效率
+      *
+      * * - 节点池分配: 节点来自本树独占的 `node_pool`，按块连续分配，删除的节点优先复用，移动/交换时随树转移
+      *
+      * * - 节点增强: 每个节点记录子树节点数（区间树另记子树最大右端点），插入删除时沿路径向上更新，旋转时只重算被旋转的两个节点，`size()` 为 O(1)
 
       * 注意事项:
 
@@ -111,11 +138,34 @@ namespace base_container
 
       * 详细请参考 https://github.com/Hatedatastructures/Custom-libraries/blob/main/template_container.md
   */
+  struct rb_tree_no_endpoint
+  {
+  };
+  template <typename rb_tree_interval_visit, typename rb_tree_type_value>
+  struct rb_tree_endpoint
+  {
+    using visit_type = rb_tree_no_endpoint;
+    using endpoint_type = rb_tree_no_endpoint;
+    static constexpr bool enabled = false;
+  };
+  template <typename rb_tree_interval_visit, typename rb_tree_type_value>
+    requires(!std::is_void_v<rb_tree_interval_visit>)
+  struct rb_tree_endpoint<rb_tree_interval_visit, rb_tree_type_value>
+  {
+    using visit_type = rb_tree_interval_visit;
+    using endpoint_type = std::remove_cvref_t<decltype(std::declval<rb_tree_interval_visit &>()(std::declval<const rb_tree_type_value &>()).second)>;
+    static constexpr bool enabled = true;
+  };
   template <typename rb_tree_type_key, typename rb_tree_type_value, typename container_imitate_function_visit,
-            typename container_imitate_function = standard_con::less<rb_tree_type_key>>
+            typename container_imitate_function = standard_con::less<rb_tree_type_key>,
+            typename rb_tree_allocator = std::allocator<rb_tree_type_value>,
+            typename rb_tree_interval_visit = void>
   class red_black_tree
   {
   private:
+    using endpoint_traits = rb_tree_endpoint<rb_tree_interval_visit, rb_tree_type_value>;
+    using endpoint_type = typename endpoint_traits::endpoint_type;
+    static constexpr bool interval_enabled = endpoint_traits::enabled;
     enum class rb_tree_color
     {
       red,
@@ -129,13 +179,17 @@ namespace base_container
       rb_tree_node *_right;
       rb_tree_node *_parent;
       rb_tree_color _color;
+      uint64_t _subtree_size;                                 // 以本节点为根的子树节点数
+      [[no_unique_address]] endpoint_type _max_endpoint; // 子树内最大右端点，非区间树不占空间
       explicit rb_tree_node(const rb_tree_type_value &val_data = rb_tree_type_value())
-          : _data(val_data), _left(nullptr), _right(nullptr), _parent(nullptr), _color(rb_tree_color::red)
+          : _data(val_data), _left(nullptr), _right(nullptr), _parent(nullptr), _color(rb_tree_color::red),
+            _subtree_size(1), _max_endpoint()
       {
         ;
       }
       explicit rb_tree_node(rb_tree_type_value &&val_data) noexcept
-          : _data(std::move(val_data)), _left(nullptr), _right(nullptr), _parent(nullptr), _color(rb_tree_color::red)
+          : _data(std::move(val_data)), _left(nullptr), _right(nullptr), _parent(nullptr), _color(rb_tree_color::red),
+            _subtree_size(1), _max_endpoint()
       {
       }
     };
@@ -300,9 +354,88 @@ namespace base_container
       }
     };
     using container_node = rb_tree_node;
+    using pool_type = standard_con::node_pool<container_node, typename std::allocator_traits<rb_tree_allocator>::template rebind_alloc<container_node>>;
     container_node *_root;
-    container_imitate_function_visit element;
-    container_imitate_function function_policy;
+    mutable container_imitate_function_visit element;
+    mutable container_imitate_function function_policy;
+    [[no_unique_address]] mutable typename endpoint_traits::visit_type interval_element;
+    pool_type _pool; // 本树独占的节点池
+    [[nodiscard]] static uint64_t subtree_size(const container_node *subtree_node) noexcept
+    {
+      return subtree_node == nullptr ? 0 : subtree_node->_subtree_size;
+    }
+    void augment_update(container_node *subtree_node) const
+    {
+      // 由左右孩子重新计算本节点的增强字段，孩子的字段必须已经正确
+      subtree_node->_subtree_size = 1 + subtree_size(subtree_node->_left) + subtree_size(subtree_node->_right);
+      if constexpr (interval_enabled)
+      {
+        endpoint_type max_endpoint = interval_element(subtree_node->_data).second;
+        if (subtree_node->_left != nullptr && max_endpoint < subtree_node->_left->_max_endpoint)
+        {
+          max_endpoint = subtree_node->_left->_max_endpoint;
+        }
+        if (subtree_node->_right != nullptr && max_endpoint < subtree_node->_right->_max_endpoint)
+        {
+          max_endpoint = subtree_node->_right->_max_endpoint;
+        }
+        subtree_node->_max_endpoint = max_endpoint;
+      }
+    }
+    void augment_upward(container_node *subtree_node) const
+    {
+      // 结构变化后从变化点一直更新到根
+      for (; subtree_node != nullptr; subtree_node = subtree_node->_parent)
+      {
+        augment_update(subtree_node);
+      }
+    }
+    [[nodiscard]] container_node *locate_index(uint64_t element_index) const
+    {
+      // 按子树节点数逐层定位中序第 element_index 个节点
+      container_node *select_node = _root;
+      while (select_node != nullptr)
+      {
+        const uint64_t left_size = subtree_size(select_node->_left);
+        if (element_index < left_size)
+        {
+          select_node = select_node->_left;
+        }
+        else if (element_index == left_size)
+        {
+          return select_node;
+        }
+        else
+        {
+          element_index -= left_size + 1;
+          select_node = select_node->_right;
+        }
+      }
+      return nullptr;
+    }
+    [[nodiscard]] container_node *locate_overlap(const endpoint_type &low_endpoint, const endpoint_type &high_endpoint) const
+      requires interval_enabled
+    {
+      // 左子树最大右端点不小于 low 时，若左子树没有相交区间，右子树也不会有
+      container_node *overlap_node = _root;
+      while (overlap_node != nullptr)
+      {
+        const auto &interval_data = interval_element(overlap_node->_data);
+        if (!(interval_data.second < low_endpoint) && !(high_endpoint < interval_data.first))
+        {
+          return overlap_node;
+        }
+        if (overlap_node->_left != nullptr && !(overlap_node->_left->_max_endpoint < low_endpoint))
+        {
+          overlap_node = overlap_node->_left;
+        }
+        else
+        {
+          overlap_node = overlap_node->_right;
+        }
+      }
+      return nullptr;
+    }
     void left_revolve(container_node *subtree_node)
     {
       try
@@ -352,6 +485,9 @@ namespace base_container
         }
         sub_tree_right_node->_parent = parent_node;
       }
+      // 旋转只改变这两个节点的子树，先下后上
+      augment_update(subtree_node);
+      augment_update(sub_tree_right_node);
     }
     void right_revolve(container_node *subtree_node)
     {
@@ -397,13 +533,20 @@ namespace base_container
         }
         sub_tree_left_node->_parent = parent_node;
       }
+      augment_update(subtree_node);
+      augment_update(sub_tree_left_node);
     }
     void clear(container_node *clear_node_ptr) noexcept
     {
+      // 逐个析构节点后整块归还节点池内存，节点可平凡析构时跳过遍历
       if (clear_node_ptr == nullptr)
       {
         return;
       }
+      else if constexpr (pool_type::trivially_releasable)
+      {
+        _root = nullptr;
+      }
       else
       {
         standard_con::stack<container_node *> resource_cleanup_stack;
@@ -420,10 +563,11 @@ namespace base_container
           {
             resource_cleanup_stack.push(clear_node_ptr->_left);
           }
-          delete clear_node_ptr;
+          std::destroy_at(clear_node_ptr);
         }
         _root = nullptr;
       }
+      _pool.release();
     }
     void interior_middle_order_traversal(container_node *intermediate_traversal_node)
     {
@@ -489,30 +633,7 @@ namespace base_container
     }
     [[nodiscard]] uint64_t _size() const
     {
-      uint64_t size = 0;
-      if (_root == nullptr)
-      {
-        return size;
-      }
-      container_node *reference_node = _root;
-      standard_con::stack<container_node *> interior_stack;
-      interior_stack.push(reference_node);
-      while (!interior_stack.empty())
-      {
-        reference_node = interior_stack.top();
-        interior_stack.pop();
-
-        size++;
-        if (reference_node->_right != nullptr)
-        {
-          interior_stack.push(reference_node->_right);
-        }
-        if (reference_node->_left != nullptr)
-        {
-          interior_stack.push(reference_node->_left);
-        }
-      }
-      return size;
+      return subtree_size(_root);
     }
 
   public:
@@ -523,28 +644,41 @@ namespace base_container
     using const_reverse_iterator = rb_tree_reverse_iterator<const_iterator>;
 
     using return_pair_value = standard_con::pair<iterator, bool>;
+    using allocator_type = rb_tree_allocator;
+    [[nodiscard]] allocator_type get_allocator() const noexcept
+    {
+      return allocator_type(_pool.get_allocator());
+    }
     red_black_tree()
     {
       _root = nullptr;
     }
+    explicit red_black_tree(const rb_tree_allocator &allocator_data)
+        : _root(nullptr), _pool(typename pool_type::allocator_type(allocator_data)) {}
     explicit red_black_tree(const rb_tree_type_value &rb_tree_data)
     {
-      _root = new container_node(rb_tree_data);
+      _root = _pool.create(rb_tree_data);
       _root->_color = rb_tree_color::black;
+      augment_update(_root);
     }
     explicit red_black_tree(rb_tree_type_value &&rb_tree_data) noexcept
     {
-      _root = new container_node(std::forward<rb_tree_type_value>(rb_tree_data));
+      _root = _pool.create(std::forward<rb_tree_type_value>(rb_tree_data));
       _root->_color = rb_tree_color::black;
+      augment_update(_root);
     }
     red_black_tree(red_black_tree &&rb_tree_data) noexcept
-        : element(rb_tree_data.element), function_policy(rb_tree_data.function_policy)
+        : element(rb_tree_data.element), function_policy(rb_tree_data.function_policy), interval_element(rb_tree_data.interval_element),
+          _pool(std::move(rb_tree_data._pool))
     {
       _root = std::move(rb_tree_data._root);
       rb_tree_data._root = nullptr;
     }
     red_black_tree(const red_black_tree &rb_tree_data)
-        : _root(nullptr), element(rb_tree_data.element), function_policy(rb_tree_data.function_policy)
+        : red_black_tree(rb_tree_data, std::allocator_traits<rb_tree_allocator>::select_on_container_copy_construction(rb_tree_data.get_allocator())) {}
+    red_black_tree(const red_black_tree &rb_tree_data, const rb_tree_allocator &allocator_data)
+        : _root(nullptr), element(rb_tree_data.element), function_policy(rb_tree_data.function_policy),
+          interval_element(rb_tree_data.interval_element), _pool(typename pool_type::allocator_type(allocator_data))
     {
       if (rb_tree_data._root == nullptr)
       {
@@ -556,8 +690,10 @@ namespace base_container
         standard_con::stack<standard_con::pair<container_node *, container_node *>> stack;
 
         // 创建根节点
-        _root = new container_node(rb_tree_data._root->_data);
+        _root = _pool.create(rb_tree_data._root->_data);
         _root->_color = rb_tree_data._root->_color;
+        _root->_subtree_size = rb_tree_data._root->_subtree_size;
+        _root->_max_endpoint = rb_tree_data._root->_max_endpoint;
         _root->_parent = nullptr; // 根节点的父节点为nullptr
 
         // 初始化栈，将根节点的子节点压入（注意：这里父节点是 _ROOT，一级指针）
@@ -577,8 +713,10 @@ namespace base_container
           stack.pop();
 
           // 创建新节点并复制数据
-          auto *new_structure_node = new container_node(first_node->_data);
+          auto *new_structure_node = _pool.create(first_node->_data);
           new_structure_node->_color = first_node->_color;
+          new_structure_node->_subtree_size = first_node->_subtree_size;
+          new_structure_node->_max_endpoint = first_node->_max_endpoint;
 
           // 设置父节点关系（注意：parent_node 是一级指针）
           new_structure_node->_parent = parent_node;
@@ -612,18 +750,21 @@ namespace base_container
         }
       }
     }
-    red_black_tree &operator=(const red_black_tree rb_tree_data)
+    red_black_tree &operator=(const red_black_tree &rb_tree_source)
     {
-      if (this == &rb_tree_data)
+      if (this == &rb_tree_source)
       {
         return *this;
       }
       else
       {
+        red_black_tree rb_tree_data(rb_tree_source, get_allocator()); // 副本沿用本树的分配器
         clear(_root);
         standard_con::algorithm::swap(rb_tree_data._root, _root);
+        _pool.swap(rb_tree_data._pool);
         standard_con::algorithm::swap(rb_tree_data.element, element);
         standard_con::algorithm::swap(rb_tree_data.function_policy, function_policy);
+        standard_con::algorithm::swap(rb_tree_data.interval_element, interval_element);
         return *this;
       }
     }
@@ -631,11 +772,13 @@ namespace base_container
     {
       if (this != &rb_tree_data)
       {
-        clear();
+        clear(_root);
         function_policy = std::move(rb_tree_data.function_policy);
         element = std::move(rb_tree_data.element);
+        interval_element = std::move(rb_tree_data.interval_element);
         _root = std::move(rb_tree_data._root);
         rb_tree_data._root = nullptr;
+        _pool = std::move(rb_tree_data._pool);
       }
       return *this;
     }
@@ -647,8 +790,9 @@ namespace base_container
     {
       if (_root == nullptr)
       {
-        _root = new container_node(value_data);
+        _root = _pool.create(value_data);
         _root->_color = rb_tree_color::black;
+        augment_update(_root);
         return return_pair_value(iterator(_root), true);
       }
       else
@@ -674,7 +818,7 @@ namespace base_container
           }
         }
         // 找到插入位置
-        reference_node = new container_node(value_data);
+        reference_node = _pool.create(value_data);
         if (function_policy(element(parent_node->_data), element(reference_node->_data)))
         {
           parent_node->_right = reference_node;
@@ -685,6 +829,7 @@ namespace base_container
         }
         reference_node->_color = rb_tree_color::red;
         reference_node->_parent = parent_node;
+        augment_upward(reference_node); // 先补齐路径上的增强字段，随后的旋转在此基础上局部维护
         container_node *return_push_node = reference_node;
         // 保存节点
         // 开始调整，向上调整颜色节点
@@ -763,8 +908,9 @@ namespace base_container
     {
       if (_root == nullptr)
       {
-        _root = new container_node(std::forward<rb_tree_type_value>(value_data));
+        _root = _pool.create(std::forward<rb_tree_type_value>(value_data));
         _root->_color = rb_tree_color::black;
+        augment_update(_root);
         return return_pair_value(iterator(_root), true);
       }
       else
@@ -790,7 +936,7 @@ namespace base_container
           }
         }
         // 找到插入位置
-        reference_node = new container_node(std::forward<rb_tree_type_value>(value_data));
+        reference_node = _pool.create(std::forward<rb_tree_type_value>(value_data));
         if (function_policy(element(parent_node->_data), element(reference_node->_data)))
         {
           parent_node->_right = reference_node;
@@ -801,6 +947,7 @@ namespace base_container
         }
         reference_node->_color = rb_tree_color::red;
         reference_node->_parent = parent_node;
+        augment_upward(reference_node); // 先补齐路径上的增强字段，随后的旋转在此基础上局部维护
         container_node *return_push_node = reference_node;
         // 保存节点
         // 开始调整，向上调整颜色节点
@@ -900,17 +1047,14 @@ namespace base_container
     */
     void delete_adjust(container_node *current_node, container_node *parent)
     {
-      // cur为被删节点的替代节点
+      // cur为被删节点的替代节点，可能为空；被删节点为黑时它所在的一侧少一个黑节点
+      // 红黑树中少一个黑节点的一侧，其兄弟子树黑高至少为 1，兄弟必然存在
       if (current_node == nullptr && parent == nullptr)
       {
         return;
       }
-      while (current_node != _root && (current_node == nullptr || black_get(current_node)))
+      while (current_node != _root && black_get(current_node))
       {
-        if (current_node == _root)
-        {
-          break;
-        }
         if (parent->_left == current_node)
         {
           container_node *brother = parent->_right;
@@ -921,42 +1065,32 @@ namespace base_container
             parent->_color = rb_tree_color::red;
             left_revolve(parent);
             // 调整后，兄弟节点为黑
-            // 继续向下调整
             brother = parent->_right;
           }
-          if ((brother != nullptr && black_get(brother)) && (brother->_left == nullptr || (brother->_left)) &&
-              (brother->_right == nullptr || black_get(brother->_right)))
+          if (black_get(brother->_left) && black_get(brother->_right))
           {
-            // 情况2：兄弟节点为黑，且兄弟节点两个子节点都为黑
+            // 情况2：兄弟节点为黑，且兄弟节点两个子节点都为黑，缺少的黑节点上移到父节点
             brother->_color = rb_tree_color::red;
             current_node = parent;
             parent = current_node->_parent;
-            if (current_node->_color == rb_tree_color::red)
-            {
-              current_node->_color = rb_tree_color::black;
-              break;
-            }
-          }
-          else if ((brother != nullptr && black_get(brother)) && (brother->_right == nullptr || black_get(brother->_right)) &&
-                   (brother->_left != nullptr && red_get(brother->_left)))
-          {
-            // 情况3：兄弟节点为黑，兄弟节点左节点为红，右节点为黑
-            brother->_left->_color = rb_tree_color::black;
-            brother->_color = rb_tree_color::red;
-            right_revolve(brother);
-            // 调整后，兄弟节点为黑，兄弟节点右节点为红
-            // 继续向下调整
-            brother = parent->_right;
           }
-          else if ((brother != nullptr || black_get(brother)) && (brother->_right != nullptr && red_get(brother->_right)))
+          else
           {
+            if (black_get(brother->_right))
+            {
+              // 情况3：兄弟节点为黑，兄弟节点左节点为红，右节点为黑，转为情况4
+              brother->_left->_color = rb_tree_color::black;
+              brother->_color = rb_tree_color::red;
+              right_revolve(brother);
+              brother = parent->_right;
+            }
             // 情况4：兄弟节点为黑，兄弟节点右节点为红
             brother->_color = parent->_color;
             parent->_color = rb_tree_color::black;
             brother->_right->_color = rb_tree_color::black;
             left_revolve(parent);
             current_node = _root;
-            parent = current_node->_parent;
+            break;
           }
         }
         else
@@ -968,42 +1102,32 @@ namespace base_container
             brother->_color = rb_tree_color::black;
             parent->_color = rb_tree_color::red;
             right_revolve(parent);
-            // 调整后，兄弟节点为黑
             brother = parent->_left;
           }
-          if (brother != nullptr && black_get(brother) && (brother->_left == nullptr || black_get(brother->_left)) &&
-              (brother->_right == nullptr || black_get(brother->_right)))
+          if (black_get(brother->_left) && black_get(brother->_right))
           {
             // 情况2：兄弟节点为黑，且兄弟节点两个子节点都为黑
             brother->_color = rb_tree_color::red;
             current_node = parent;
             parent = current_node->_parent;
-            if (current_node->_color == rb_tree_color::red)
-            {
-              current_node->_color = rb_tree_color::black;
-              break;
-            }
-          }
-          else if (brother != nullptr && black_get(brother) && (brother->_right != nullptr && red_get(brother->_right)) &&
-                   (brother->_left == nullptr || black_get(brother->_left)))
-          {
-            // 情况3：兄弟节点为黑，兄弟节点左节点为红，右节点为黑
-            brother->_right->_color = rb_tree_color::black;
-            brother->_color = rb_tree_color::red;
-            left_revolve(brother);
-            // 调整后，兄弟节点为黑，兄弟节点右节点为红
-            // 继续向下调整
-            brother = parent->_left;
           }
-          else if (brother != nullptr && black_get(brother) && brother->_left != nullptr && red_get(brother->_left))
+          else
           {
-            // 情况4：兄弟节点为黑，兄弟节点右节点为红
+            if (black_get(brother->_left))
+            {
+              // 情况3：兄弟节点为黑，兄弟节点右节点为红，左节点为黑，转为情况4
+              brother->_right->_color = rb_tree_color::black;
+              brother->_color = rb_tree_color::red;
+              left_revolve(brother);
+              brother = parent->_left;
+            }
+            // 情况4：兄弟节点为黑，兄弟节点左节点为红
             brother->_color = parent->_color;
             parent->_color = rb_tree_color::black;
             brother->_left->_color = rb_tree_color::black;
             right_revolve(parent);
             current_node = _root;
-            parent = current_node->_parent;
+            break;
           }
         }
       }
@@ -1073,7 +1197,7 @@ namespace base_container
           }
           adjust_node = reference_node->_right;
           adjust_parent_node = parent_node;
-          delete reference_node;
+          _pool.destroy(reference_node);
           reference_node = nullptr;
         }
         else if (reference_node->_right == nullptr)
@@ -1101,7 +1225,7 @@ namespace base_container
           }
           adjust_node = reference_node->_left;
           adjust_parent_node = parent_node;
-          delete reference_node;
+          _pool.destroy(reference_node);
           reference_node = nullptr;
         }
         else if (reference_node->_right != nullptr && reference_node->_left != nullptr)
@@ -1115,9 +1239,8 @@ namespace base_container
           }
           delete_color = right_subtree_smallest_node->_color;
 
-          // 交换数据 AND 交换颜色
+          // 只交换数据，颜色留在原位置；实际摘除的是后继节点，按后继的颜色调整
           standard_con::algorithm::swap(right_subtree_smallest_node->_data, reference_node->_data);
-          standard_con::algorithm::swap(right_subtree_smallest_node->_color, reference_node->_color);
 
           // 然后正确地把后继节点的位置接到它父节点上：
           if (smallest_parent_node->_left == right_subtree_smallest_node)
@@ -1136,9 +1259,11 @@ namespace base_container
           adjust_parent_node = smallest_parent_node;
 
           // 最后再 delete 那个后继节点
-          delete right_subtree_smallest_node;
+          _pool.destroy(right_subtree_smallest_node);
           right_subtree_smallest_node = nullptr;
         }
+        // 摘除点以上的子树节点数、最大右端点都可能变化，先整条路径更新再做旋转调整
+        augment_upward(adjust_parent_node);
         // 更新颜色
         if (delete_color == rb_tree_color::black)
         {
@@ -1149,7 +1274,7 @@ namespace base_container
         {
           _root->_color = rb_tree_color::black;
         }
-        return return_pair_value(iterator(nullptr), false);
+        return return_pair_value(iterator(nullptr), true);
       }
     }
     iterator find(const rb_tree_type_value &val_data)
@@ -1163,22 +1288,91 @@ namespace base_container
         container_node *root_find_node = _root;
         while (root_find_node != nullptr)
         {
-          if (!function_policy(element(root_find_node->_data), element(val_data)))
+          if (function_policy(element(root_find_node->_data), element(val_data)))
           {
-            return iterator(root_find_node);
+            root_find_node = root_find_node->_right;
           }
-          else if (function_policy(element(root_find_node->_data), element(val_data)))
+          else if (function_policy(element(val_data), element(root_find_node->_data)))
           {
-            root_find_node = root_find_node->_right;
+            root_find_node = root_find_node->_left;
           }
           else
           {
-            root_find_node = root_find_node->_left;
+            return iterator(root_find_node);
           }
         }
         return iterator(nullptr);
       }
     }
+    iterator select(uint64_t element_index)
+    {
+      return iterator(locate_index(element_index));
+    }
+    const_iterator select(uint64_t element_index) const
+    {
+      return const_iterator(locate_index(element_index));
+    }
+    [[nodiscard]] uint64_t rank(const rb_tree_type_key &key_data) const
+    {
+      // 每次向右走，左子树和当前节点都小于 key_data
+      uint64_t smaller_count = 0;
+      container_node *rank_node = _root;
+      while (rank_node != nullptr)
+      {
+        if (function_policy(element(rank_node->_data), key_data))
+        {
+          smaller_count += subtree_size(rank_node->_left) + 1;
+          rank_node = rank_node->_right;
+        }
+        else
+        {
+          rank_node = rank_node->_left;
+        }
+      }
+      return smaller_count;
+    }
+    iterator overlap_find(const endpoint_type &low_endpoint, const endpoint_type &high_endpoint)
+      requires interval_enabled
+    {
+      return iterator(locate_overlap(low_endpoint, high_endpoint));
+    }
+    const_iterator overlap_find(const endpoint_type &low_endpoint, const endpoint_type &high_endpoint) const
+      requires interval_enabled
+    {
+      return const_iterator(locate_overlap(low_endpoint, high_endpoint));
+    }
+    template <typename overlap_callback>
+    void overlap_visit(const endpoint_type &low_endpoint, const endpoint_type &high_endpoint, overlap_callback &&callback) const
+      requires interval_enabled
+    {
+      // 中序遍历，最大右端点小于 low 的子树整体跳过，左端点大于 high 后的节点全部跳过
+      standard_con::stack<container_node *> interior_stack;
+      container_node *visit_node = _root;
+      while (visit_node != nullptr || !interior_stack.empty())
+      {
+        while (visit_node != nullptr && !(visit_node->_max_endpoint < low_endpoint))
+        {
+          interior_stack.push(visit_node);
+          visit_node = visit_node->_left;
+        }
+        if (interior_stack.empty())
+        {
+          break;
+        }
+        visit_node = interior_stack.top();
+        interior_stack.pop();
+        const auto &interval_data = interval_element(visit_node->_data);
+        if (high_endpoint < interval_data.first)
+        {
+          break;
+        }
+        if (!(interval_data.second < low_endpoint))
+        {
+          callback(visit_node->_data);
+        }
+        visit_node = visit_node->_right;
+      }
+    }
     uint64_t size()
     {
       return _size();
@@ -1191,6 +1385,10 @@ namespace base_container
     {
       return _root == nullptr;
     }
+    void clear() noexcept
+    {
+      clear(_root);
+    }
     void middle_order_traversal()
     {
       interior_middle_order_traversal(_root);
@@ -1906,95 +2104,389 @@ namespace base_container
   /**
    * @brief 位集合（BitSet）类实现
    *
-   * 这是一个自定义的位集合类，使用`standard_con::vector<int>`存储位数据，
+   * 这是一个自定义的位集合类，使用`standard_con::vector<uint64_t>`按 64 位字存储位数据，
    *
-   * 每个int（通常32位）可以存储32个布尔值（0或1）。
+   * 每个字存储 64 个布尔值（0或1），单个位的读写只需一次移位和一次按位运算。
    *
    * 位集合可以高效地处理大量布尔值，常用于需要节省空间的场景，
    *
-   * 如数据过滤、标记、集合运算等。
+   * 如数据过滤、标记、集合运算、槽位分配等。
    *
    * 主要功能包括：
    *
-   * - 设置指定位置的位（set）
+   * - 设置 / 重置 / 翻转 / 测试指定位置的位（set / reset / flip / test），重复设置同一位不会影响计数
+   *
+   * - 统计置位个数（size / count），按字 popcount 计算，大位集合使用 AVX2 查表并行统计
+   *
+   * - 整体位运算（`&=`、`|=`、`^=`、`and_not`），大位集合使用 AVX2 每次处理 256 位
    *
-   * - 重置指定位置的位（reset）
+   * - 查找置位（find_first / find_next），跳过全零字后以 ctz 定位，找不到返回 `npos`
    *
-   * - 测试指定位置的位是否设置（test）
+   * - 调整大小（resize），保留新范围内已有的位
    *
-   * - 调整大小（resize）
+   * 注意事项：
    *
-   * - 拷贝构造和赋值操作
+   * - 合法位置为 [0, capacity())，越界 `set` / `reset` / `flip` 抛出异常，越界 `test` 返回 false
+   *
+   * - 两个大小不同的位集合做整体运算时，超出本集合容量的位被忽略，`&=` 时本集合多出的部分视为与 0 相与
    */
   class bit_set
   {
-    standard_con::vector<int> vector_bit_set;
-    uint64_t _size;
+    standard_con::vector<uint64_t> vector_bit_set;
+    uint64_t _capacity = 0;
+    uint64_t _word_count = 0;
+
+    static constexpr uint64_t word_bits = 64;
+    static constexpr uint64_t simd_threshold = 16; // 字数达到该值才走 AVX2 内核
+
+    [[nodiscard]] static uint64_t words_for(const uint64_t bit_count) noexcept
+    {
+      return (bit_count + word_bits - 1) / word_bits;
+    }
+    [[nodiscard]] uint64_t *word_data() noexcept
+    {
+      return vector_bit_set.begin();
+    }
+    [[nodiscard]] const uint64_t *word_data() const noexcept
+    {
+      return vector_bit_set.begin();
+    }
+    void clear_tail() noexcept
+    {
+      // 最后一个字中超出容量的位保持为 0，保证计数与查找不越界
+      if (_capacity % word_bits != 0)
+      {
+        word_data()[_word_count - 1] &= (uint64_t{1} << (_capacity % word_bits)) - 1;
+      }
+    }
+    void check_position(const uint64_t &value_data, const char *function_name) const
+    {
+      try
+      {
+        if (value_data >= _capacity)
+        {
+          throw custom_exception::fault("传入参数越界", function_name, __LINE__);
+        }
+      }
+      catch (const custom_exception::fault &process)
+      {
+        std::cerr << process.what() << " " << process.function_name_get() << " " << process.line_number_get() << std::endl;
+        throw;
+      }
+    }
+    template <typename word_operation>
+    void bulk_apply(const bit_set &bit_set_data, word_operation &&operation) noexcept
+    {
+      uint64_t *destination = word_data();
+      const uint64_t *source = bit_set_data.word_data();
+      const uint64_t common_words = _word_count < bit_set_data._word_count ? _word_count : bit_set_data._word_count;
+      uint64_t word_index = 0;
+#if defined(BIT_SET_AVX2)
+      if (common_words >= simd_threshold)
+      {
+        for (; word_index + 4 <= common_words; word_index += 4)
+        {
+          const __m256i destination_block = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(destination + word_index));
+          const __m256i source_block = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(source + word_index));
+          _mm256_storeu_si256(reinterpret_cast<__m256i *>(destination + word_index), operation(destination_block, source_block));
+        }
+      }
+#endif
+      for (; word_index < common_words; ++word_index)
+      {
+        destination[word_index] = operation(destination[word_index], source[word_index]);
+      }
+    }
+#if defined(BIT_SET_AVX2)
+    [[nodiscard]] static uint64_t simd_count(const uint64_t *words, const uint64_t word_count) noexcept
+    {
+      // 4 位查表 popcount：vpshufb 查每个半字节的置位数，vpsadbw 横向累加
+      const __m256i lookup_table = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                                                    0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+      const __m256i low_mask = _mm256_set1_epi8(0x0f);
+      __m256i total = _mm256_setzero_si256();
+      uint64_t word_index = 0;
+      for (; word_index + 4 <= word_count; word_index += 4)
+      {
+        const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(words + word_index));
+        const __m256i low_count = _mm256_shuffle_epi8(lookup_table, _mm256_and_si256(block, low_mask));
+        const __m256i high_count = _mm256_shuffle_epi8(lookup_table, _mm256_and_si256(_mm256_srli_epi16(block, 4), low_mask));
+        total = _mm256_add_epi64(total, _mm256_sad_epu8(_mm256_add_epi8(low_count, high_count), _mm256_setzero_si256()));
+      }
+      uint64_t result = static_cast<uint64_t>(_mm256_extract_epi64(total, 0)) + static_cast<uint64_t>(_mm256_extract_epi64(total, 1)) +
+                        static_cast<uint64_t>(_mm256_extract_epi64(total, 2)) + static_cast<uint64_t>(_mm256_extract_epi64(total, 3));
+      for (; word_index < word_count; ++word_index)
+      {
+        result += static_cast<uint64_t>(std::popcount(words[word_index]));
+      }
+      return result;
+    }
+#endif
 
   public:
-    bit_set() : _size(0) { ; }
+    static constexpr uint64_t npos = UINT64_MAX;
+
+    bit_set() = default;
     explicit bit_set(const uint64_t &new_capacity)
     {
-      _size = 0;
-      vector_bit_set.resize((new_capacity / 32) + 1, 0);
-      // 多开一个int的空间，防止不够
+      resize(new_capacity);
     }
     void resize(const uint64_t &new_capacity)
     {
-      _size = 0;
-      vector_bit_set.resize((new_capacity / 32) + 1, 0);
+      const uint64_t new_word_count = words_for(new_capacity);
+      if (new_word_count > vector_bit_set.size())
+      {
+        vector_bit_set.resize(new_word_count, 0);
+      }
+      // 缩小时把被截掉的字清零，之后再扩大不会读到旧数据
+      for (uint64_t word_index = new_word_count; word_index < _word_count; ++word_index)
+      {
+        word_data()[word_index] = 0;
+      }
+      _capacity = new_capacity;
+      _word_count = new_word_count;
+      if (_word_count != 0)
+      {
+        clear_tail();
+      }
     }
-    bit_set(const bit_set &bit_set_data)
+    bit_set(const bit_set &bit_set_data) = default;
+    bit_set(bit_set &&bit_set_data) noexcept
+        : vector_bit_set(std::move(bit_set_data.vector_bit_set)), _capacity(bit_set_data._capacity), _word_count(bit_set_data._word_count)
     {
-      vector_bit_set = bit_set_data.vector_bit_set;
-      _size = bit_set_data._size;
+      bit_set_data._capacity = 0;
+      bit_set_data._word_count = 0;
     }
     bit_set &operator=(const bit_set &bit_set_data)
     {
       if (this != &bit_set_data)
       {
         vector_bit_set = bit_set_data.vector_bit_set;
-        _size = bit_set_data._size;
+        _capacity = bit_set_data._capacity;
+        _word_count = bit_set_data._word_count;
+      }
+      return *this;
+    }
+    bit_set &operator=(bit_set &&bit_set_data) noexcept
+    {
+      if (this != &bit_set_data)
+      {
+        vector_bit_set = std::move(bit_set_data.vector_bit_set);
+        _capacity = bit_set_data._capacity;
+        _word_count = bit_set_data._word_count;
+        bit_set_data._capacity = 0;
+        bit_set_data._word_count = 0;
       }
       return *this;
     }
     void set(const uint64_t &value_data)
     {
-      // 把数映射到BitSet上的函数
-      uint64_t mapping_bit = value_data / 32; // 定位到BitSet的位置在哪个int上
-      uint64_t value_bit = value_data % 32;   // 定位到BitSet的位置在哪个int上的第几位
-      vector_bit_set[mapping_bit] = vector_bit_set[mapping_bit] | (1 << value_bit);
-      // 比较当前位置是否为1，若为1则不需要改变，若为0则需要改变，注意|只改变当前位不会改变其他位
-      //|是两个条件满足一个条件就行，&是两个条件都满足才行
-      // 其他位如果是1那么就还是1，如果是0那么就还是0，因为|是两个条件满足一个条件就行
-      _size++;
+      // 把数映射到BitSet上的函数：高位定位到哪个字，低 6 位定位到字内第几位
+      check_position(value_data, "bit_set::set");
+      word_data()[value_data / word_bits] |= uint64_t{1} << (value_data % word_bits);
     }
     void reset(const uint64_t &value_data)
     {
-      // 删除映射的位置的函数
-      uint64_t mapping_bit = value_data / 32;
-      uint64_t value_bit = value_data % 32;
-      vector_bit_set[mapping_bit] = vector_bit_set[mapping_bit] & (~(1 << value_bit));
-      //&是两个条件都满足，~是取反，^是两个条件不同时满足
-      // 1取反关键位是0其他位是1，这样就成功与掉，&要求是两个条件都需要满足
-      // 其他位如果是1那么就不会改变原来的，如果是0那么还是为0，因为与是两个条件都需要满足
-      _size--;
+      // 删除映射的位置的函数：与上只有目标位为 0 的掩码
+      check_position(value_data, "bit_set::reset");
+      word_data()[value_data / word_bits] &= ~(uint64_t{1} << (value_data % word_bits));
     }
-    [[nodiscard]] uint64_t size() const
+    void flip(const uint64_t &value_data)
     {
-      return _size;
+      check_position(value_data, "bit_set::flip");
+      word_data()[value_data / word_bits] ^= uint64_t{1} << (value_data % word_bits);
     }
-    bool test(const uint64_t &value_data)
+    [[nodiscard]] bool test(const uint64_t &value_data) const noexcept
     {
-      if (_size == 0)
+      if (value_data >= _capacity)
       {
         return false;
       }
-      uint64_t mapping_bit = value_data / 32;
-      uint64_t value_bit = value_data % 32;
-      bool return_bit_set = vector_bit_set[mapping_bit] & (1 << value_bit);
-      // 如果_BitSet[mapping_bit]里对应的位是1那么就返回true，否则返回false
-      return return_bit_set;
+      return (word_data()[value_data / word_bits] >> (value_data % word_bits)) & 1;
+    }
+    [[nodiscard]] uint64_t count() const noexcept
+    {
+#if defined(BIT_SET_AVX2)
+      if (_word_count >= simd_threshold)
+      {
+        return simd_count(word_data(), _word_count);
+      }
+#endif
+      uint64_t result = 0;
+      for (uint64_t word_index = 0; word_index < _word_count; ++word_index)
+      {
+        result += static_cast<uint64_t>(std::popcount(word_data()[word_index]));
+      }
+      return result;
+    }
+    [[nodiscard]] uint64_t size() const noexcept
+    {
+      // 置位个数
+      return count();
+    }
+    [[nodiscard]] uint64_t capacity() const noexcept
+    {
+      return _capacity;
+    }
+    [[nodiscard]] bool any() const noexcept
+    {
+      return find_first() != npos;
+    }
+    [[nodiscard]] bool none() const noexcept
+    {
+      return find_first() == npos;
+    }
+    void clear() noexcept
+    {
+      for (uint64_t word_index = 0; word_index < _word_count; ++word_index)
+      {
+        word_data()[word_index] = 0;
+      }
+    }
+    [[nodiscard]] uint64_t find_first() const noexcept
+    {
+      for (uint64_t word_index = 0; word_index < _word_count; ++word_index)
+      {
+        if (word_data()[word_index] != 0)
+        {
+          return word_index * word_bits + static_cast<uint64_t>(std::countr_zero(word_data()[word_index]));
+        }
+      }
+      return npos;
+    }
+    [[nodiscard]] uint64_t find_next(const uint64_t &value_data) const noexcept
+    {
+      // 查找严格位于 value_data 之后的第一个置位
+      const uint64_t start_position = value_data + 1;
+      if (value_data == npos || start_position >= _capacity)
+      {
+        return npos;
+      }
+      uint64_t word_index = start_position / word_bits;
+      const uint64_t first_word = word_data()[word_index] & (~uint64_t{0} << (start_position % word_bits));
+      if (first_word != 0)
+      {
+        return word_index * word_bits + static_cast<uint64_t>(std::countr_zero(first_word));
+      }
+      for (++word_index; word_index < _word_count; ++word_index)
+      {
+        if (word_data()[word_index] != 0)
+        {
+          return word_index * word_bits + static_cast<uint64_t>(std::countr_zero(word_data()[word_index]));
+        }
+      }
+      return npos;
+    }
+    bit_set &operator&=(const bit_set &bit_set_data) noexcept
+    {
+      bulk_apply(bit_set_data, [](const auto &left, const auto &right)
+                 {
+                   if constexpr (std::is_same_v<std::decay_t<decltype(left)>, uint64_t>)
+                   {
+                     return left & right;
+                   }
+#if defined(BIT_SET_AVX2)
+                   else
+                   {
+                     return _mm256_and_si256(left, right);
+                   }
+#endif
+                 });
+      for (uint64_t word_index = bit_set_data._word_count; word_index < _word_count; ++word_index)
+      {
+        word_data()[word_index] = 0;
+      }
+      return *this;
+    }
+    bit_set &operator|=(const bit_set &bit_set_data) noexcept
+    {
+      bulk_apply(bit_set_data, [](const auto &left, const auto &right)
+                 {
+                   if constexpr (std::is_same_v<std::decay_t<decltype(left)>, uint64_t>)
+                   {
+                     return left | right;
+                   }
+#if defined(BIT_SET_AVX2)
+                   else
+                   {
+                     return _mm256_or_si256(left, right);
+                   }
+#endif
+                 });
+      if (_word_count != 0)
+      {
+        clear_tail();
+      }
+      return *this;
+    }
+    bit_set &operator^=(const bit_set &bit_set_data) noexcept
+    {
+      bulk_apply(bit_set_data, [](const auto &left, const auto &right)
+                 {
+                   if constexpr (std::is_same_v<std::decay_t<decltype(left)>, uint64_t>)
+                   {
+                     return left ^ right;
+                   }
+#if defined(BIT_SET_AVX2)
+                   else
+                   {
+                     return _mm256_xor_si256(left, right);
+                   }
+#endif
+                 });
+      if (_word_count != 0)
+      {
+        clear_tail();
+      }
+      return *this;
+    }
+    bit_set &and_not(const bit_set &bit_set_data) noexcept
+    {
+      // 本集合减去 bit_set_data：this &= ~bit_set_data
+      bulk_apply(bit_set_data, [](const auto &left, const auto &right)
+                 {
+                   if constexpr (std::is_same_v<std::decay_t<decltype(left)>, uint64_t>)
+                   {
+                     return left & ~right;
+                   }
+#if defined(BIT_SET_AVX2)
+                   else
+                   {
+                     return _mm256_andnot_si256(right, left);
+                   }
+#endif
+                 });
+      return *this;
+    }
+    friend bit_set operator&(bit_set left_data, const bit_set &right_data)
+    {
+      left_data &= right_data;
+      return left_data;
+    }
+    friend bit_set operator|(bit_set left_data, const bit_set &right_data)
+    {
+      left_data |= right_data;
+      return left_data;
+    }
+    friend bit_set operator^(bit_set left_data, const bit_set &right_data)
+    {
+      left_data ^= right_data;
+      return left_data;
+    }
+    bool operator==(const bit_set &bit_set_data) const noexcept
+    {
+      if (_capacity != bit_set_data._capacity)
+      {
+        return false;
+      }
+      for (uint64_t word_index = 0; word_index < _word_count; ++word_index)
+      {
+        if (word_data()[word_index] != bit_set_data.word_data()[word_index])
+        {
+          return false;
+        }
+      }
+      return true;
     }
   };
 }
@@ -1,9 +1,119 @@
 #pragma once
+#include <cmath>
+#include <atomic>
+#include <memory>
+#include <cstdint>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define BLOOM_FILTER_AVX2 1
+#define BLOOM_FILTER_SSE2 1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define BLOOM_FILTER_SSE2 1
+#endif
 #include "simulate_algorithm.hpp"
 #include "simulate_base.hpp"
+#include "simulate_hash.hpp"
 #include "simulate_imitate.hpp"
 namespace bloom_filter_container
 {
+  /**
+   * @brief 布隆过滤器公共参数与哈希工具
+   *
+   * * - `optimal_bit_count()` / `optimal_hash_count()`: 由预计元素数 n 与目标误判率 p 推导位数 m 与探测次数 k
+   *
+   *   - m = -n·ln(p) / (ln2)²，k = (m / n)·ln2，结果向上取整且至少为 1
+   *
+   * * - `mix()`: murmur3 fmix64，让恒等哈希（整数键）的高低位充分扩散后再切分为多个探测
+   *
+   * * - `reduce()`: 乘法取高位把 64 位哈希映射到 [0, range)，代替每次探测的取模
+   */
+  struct bloom_parameter
+  {
+    static constexpr uint64_t block_bits = 512; // 分块过滤器每块一条缓存行
+    static constexpr uint64_t block_words = block_bits / 64;
+    static constexpr uint32_t max_block_hash_count = 16;
+
+    [[nodiscard]] static uint64_t optimal_bit_count(const uint64_t expected_elements, const double false_positive_rate) noexcept
+    {
+      const double element_count = expected_elements == 0 ? 1.0 : static_cast<double>(expected_elements);
+      const double probability = false_positive_rate <= 0.0 || false_positive_rate >= 1.0 ? 0.01 : false_positive_rate;
+      const double bit_count = std::ceil(-element_count * std::log(probability) / (std::log(2.0) * std::log(2.0)));
+      return bit_count < 64.0 ? 64 : static_cast<uint64_t>(bit_count);
+    }
+    [[nodiscard]] static uint32_t optimal_hash_count(const uint64_t expected_elements, const uint64_t bit_count) noexcept
+    {
+      const double element_count = expected_elements == 0 ? 1.0 : static_cast<double>(expected_elements);
+      const double hash_count = std::round(static_cast<double>(bit_count) / element_count * std::log(2.0));
+      return hash_count < 1.0 ? 1 : hash_count > 32.0 ? 32 : static_cast<uint32_t>(hash_count);
+    }
+    [[nodiscard]] static uint64_t mix(uint64_t hash_value) noexcept
+    {
+      hash_value ^= hash_value >> 33;
+      hash_value *= 0xff51afd7ed558ccdULL;
+      hash_value ^= hash_value >> 33;
+      hash_value *= 0xc4ceb9fe1a85ec53ULL;
+      hash_value ^= hash_value >> 33;
+      return hash_value;
+    }
+    [[nodiscard]] static uint64_t reduce(const uint64_t hash_value, const uint64_t range) noexcept
+    {
+#if defined(__SIZEOF_INT128__)
+      return static_cast<uint64_t>((static_cast<unsigned __int128>(hash_value) * range) >> 64);
+#else
+      return hash_value % range;
+#endif
+    }
+    // 双重哈希的步长：取哈希的另一半再散列，强制为奇数保证各探测互不相同
+    [[nodiscard]] static uint64_t step(const uint64_t hash_value) noexcept
+    {
+      return ((hash_value >> 32) | (hash_value << 32)) * 0x9e3779b97f4a7c15ULL | 1;
+    }
+    // 由一个哈希值生成块内 k 个探测位组成的 512 位掩码
+    static void block_mask(const uint64_t hash_value, const uint32_t hash_count, uint64_t (&mask)[block_words]) noexcept
+    {
+      for (uint64_t word_index = 0; word_index < block_words; ++word_index)
+      {
+        mask[word_index] = 0;
+      }
+      const uint64_t probe_hash = hash_value * 0x9e3779b97f4a7c15ULL;
+      uint32_t probe_position = static_cast<uint32_t>(probe_hash);
+      const uint32_t probe_step = static_cast<uint32_t>(probe_hash >> 32) | 1;
+      for (uint32_t probe_index = 0; probe_index < hash_count; ++probe_index)
+      {
+        const uint32_t bit_index = (probe_position >> 23) & (block_bits - 1); // 取高 9 位
+        mask[bit_index >> 6] |= uint64_t{1} << (bit_index & 63);
+        probe_position += probe_step;
+      }
+    }
+    [[nodiscard]] static bool block_contains(const uint64_t *block, const uint64_t (&mask)[block_words]) noexcept
+    {
+#if defined(BLOOM_FILTER_AVX2)
+      const __m256i low_block = _mm256_load_si256(reinterpret_cast<const __m256i *>(block));
+      const __m256i high_block = _mm256_load_si256(reinterpret_cast<const __m256i *>(block + 4));
+      const __m256i low_mask = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(mask));
+      const __m256i high_mask = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(mask + 4));
+      // testc: (~block & mask) 全零时返回 1
+      return _mm256_testc_si256(low_block, low_mask) & _mm256_testc_si256(high_block, high_mask);
+#elif defined(BLOOM_FILTER_SSE2)
+      __m128i missing_bits = _mm_setzero_si128();
+      for (uint64_t word_index = 0; word_index < block_words; word_index += 2)
+      {
+        const __m128i block_part = _mm_load_si128(reinterpret_cast<const __m128i *>(block + word_index));
+        const __m128i mask_part = _mm_loadu_si128(reinterpret_cast<const __m128i *>(mask + word_index));
+        missing_bits = _mm_or_si128(missing_bits, _mm_andnot_si128(block_part, mask_part));
+      }
+      return _mm_movemask_epi8(_mm_cmpeq_epi8(missing_bits, _mm_setzero_si128())) == 0xFFFF;
+#else
+      uint64_t missing_bits = 0;
+      for (uint64_t word_index = 0; word_index < block_words; ++word_index)
+      {
+        missing_bits |= mask[word_index] & ~block[word_index];
+      }
+      return missing_bits == 0;
+#endif
+    }
+  };
   /**
    * @brief 布隆过滤器（Bloom Filter）类实现
    *
@@ -13,7 +123,7 @@ namespace bloom_filter_container
    *
    * 不支持删除操作，仅支持插入和查询，适用于允许一定误判率的场景（如缓存过滤、垃圾邮件检测等）。
    *
-   * 工作原理：通过多个哈希函数将元素映射到一个位集合（bit_set）的多个位置，插入时将这些位置设为1；
+   * 工作原理：元素只计算一次哈希，再以双重哈希 h1 + i·h2 派生出 k 个位置映射到位集合（bit_set）；
    *
    * 查询时检查这些位置是否全为1，全为1则可能存在（假阳性可能），否则一定不存在。
    *
@@ -21,25 +131,32 @@ namespace bloom_filter_container
    *
    * * - `bloom_filter_type_value`: 布隆过滤器中存储的元素类型
    *
-   * * - `bloom_filter_hash_functor`: 哈希函数对象类型，默认为 `standard_con::algorithm::hash_algorithm::hash_function<bloom_filter_type_value>`
+   * * - `bloom_filter_hash_functor`: 哈希函数对象类型，默认为 `standard_con::hash_imitation_functions`
+   *
+   *   - 只需提供一个返回 `uint64_t` 的 `operator()`，结果经过混合后再切分为 k 个探测
+   *
+   * 构造方式:
+   *
+   * * - `bloom_filter()` / `bloom_filter(capacity)`: 指定位数，探测次数固定为 3（与旧版本行为一致）
    *
-   *   - 需提供三种哈希函数（`hash_sdmmhash`、`hash_djbhash`、`hash_pjwhash`），用于将元素映射到位集合的不同位置
+   * * - `bloom_filter(expected_elements, false_positive_rate)`: 由预计元素数与目标误判率推导位数和探测次数
    *
    * 注意事项:
    *
    * - 容量越大、哈希函数越多，假阳性率越低，但空间和时间开销越大
    *
-   * - 不支持删除操作（删除会影响其他元素的哈希映射位）
+   * - 不支持删除操作（删除会影响其他元素的哈希映射位），需要删除请使用 `counting_bloom_filter`
    *
-   * - 适用于对误判率不敏感，追求空间效率的场景
+   * - 对缓存更敏感的场景请使用 `blocked_bloom_filter`，多线程共享请使用 `atomic_bloom_filter`
    */
-  template <typename bloom_filter_type_value, typename bloom_filter_hash_functor = standard_con::hash_function<bloom_filter_type_value>>
+  template <typename bloom_filter_type_value, typename bloom_filter_hash_functor = standard_con::hash_imitation_functions>
   class bloom_filter
   {
     bloom_filter_hash_functor hash_functions_object;
     using bit_set = standard_con::bit_set;
     bit_set instance_bit_set;
     uint64_t _capacity;
+    uint32_t _hash_count = 3;
 
   public:
     bloom_filter()
@@ -49,7 +166,13 @@ namespace bloom_filter_container
     }
     explicit bloom_filter(const uint64_t &temp_capacity)
     {
-      _capacity = temp_capacity;
+      _capacity = temp_capacity == 0 ? 1 : temp_capacity;
+      instance_bit_set.resize(_capacity);
+    }
+    bloom_filter(const uint64_t expected_elements, const double false_positive_rate)
+    {
+      _capacity = bloom_parameter::optimal_bit_count(expected_elements, false_positive_rate);
+      _hash_count = bloom_parameter::optimal_hash_count(expected_elements, _capacity);
       instance_bit_set.resize(_capacity);
     }
     [[nodiscard]] uint64_t size() const
@@ -60,32 +183,384 @@ namespace bloom_filter_container
     {
       return _capacity;
     }
+    [[nodiscard]] uint32_t hash_count() const
+    {
+      return _hash_count;
+    }
     bool test(const bloom_filter_type_value &temp_bf_map_value)
     {
-      uint64_t primary_mapping_location = hash_functions_object.hash_sdmmhash(temp_bf_map_value) % _capacity;
-      uint64_t secondary_mapping_location = hash_functions_object.hash_djbhash(temp_bf_map_value) % _capacity;
-      uint64_t tertiary_mapping_location = hash_functions_object.hash_pjwhash(temp_bf_map_value) % _capacity;
-      if (instance_bit_set.test(primary_mapping_location) == true && instance_bit_set.test(secondary_mapping_location) == true &&
-          instance_bit_set.test(tertiary_mapping_location) == true)
+      const uint64_t hash_value = bloom_parameter::mix(static_cast<uint64_t>(hash_functions_object(temp_bf_map_value)));
+      const uint64_t hash_step = bloom_parameter::step(hash_value);
+      uint64_t probe_hash = hash_value;
+      for (uint32_t probe_index = 0; probe_index < _hash_count; ++probe_index)
       {
-        return true;
-        /* 有一个为0就返回false */
+        if (!instance_bit_set.test(bloom_parameter::reduce(probe_hash, _capacity)))
+        {
+          return false;
+          /* 有一个为0就返回false */
+        }
+        probe_hash += hash_step;
       }
-      return false;
+      return true;
     }
     void set(const bloom_filter_type_value &temp_bf_map_value)
     {
-      uint64_t primary_mapping_location = hash_functions_object.hash_sdmmhash(temp_bf_map_value) % _capacity;
-      uint64_t secondary_mapping_location = hash_functions_object.hash_djbhash(temp_bf_map_value) % _capacity;
-      uint64_t tertiary_mapping_location = hash_functions_object.hash_pjwhash(temp_bf_map_value) % _capacity;
-      instance_bit_set.set(primary_mapping_location);
-      instance_bit_set.set(secondary_mapping_location);
-      instance_bit_set.set(tertiary_mapping_location);
+      const uint64_t hash_value = bloom_parameter::mix(static_cast<uint64_t>(hash_functions_object(temp_bf_map_value)));
+      const uint64_t hash_step = bloom_parameter::step(hash_value);
+      uint64_t probe_hash = hash_value;
+      for (uint32_t probe_index = 0; probe_index < _hash_count; ++probe_index)
+      {
+        instance_bit_set.set(bloom_parameter::reduce(probe_hash, _capacity));
+        probe_hash += hash_step;
+      }
+    }
+    void clear()
+    {
+      instance_bit_set.clear();
     }
     // 布隆过滤器只支持插入和查找，不支持删除
   };
+  /**
+   * @brief 分块布隆过滤器（Blocked Bloom Filter）
+   *
+   * 位数组按 64 字节（一条缓存行，512 位）分块，元素先由哈希选定一块，k 个探测全部落在这一块内，
+   *
+   * 插入和查询都只访问一条缓存行；块内探测位先拼成 512 位掩码，查询时以 SIMD 一次比较整块。
+   *
+   * 模板参数:
+   *
+   * * - `bloom_filter_type_value`: 元素类型
+   *
+   * * - `bloom_filter_hash_functor`: 哈希函数对象类型，默认为 `standard_con::hash_imitation_functions`
+   *
+   * 构造方式:
+   *
+   * * - `blocked_bloom_filter(expected_elements, false_positive_rate)`: 按目标误判率推导总位数与探测次数（k 上限 16）
+   *
+   * 注意事项:
+   *
+   * - 探测集中在一块内，相同位数下实际误判率略高于普通布隆过滤器，换取每次操作只有一次缓存未命中
+   *
+   * - 不支持删除
+   */
+  template <typename bloom_filter_type_value, typename bloom_filter_hash_functor = standard_con::hash_imitation_functions>
+  class blocked_bloom_filter
+  {
+    struct alignas(64) bloom_block
+    {
+      uint64_t _words[bloom_parameter::block_words] = {};
+    };
+    mutable bloom_filter_hash_functor hash_functions_object;
+    std::unique_ptr<bloom_block[]> _blocks;
+    uint64_t _block_count;
+    uint32_t _hash_count;
+
+    [[nodiscard]] uint64_t hash_value(const bloom_filter_type_value &value_data) const
+    {
+      return bloom_parameter::mix(static_cast<uint64_t>(hash_functions_object(value_data)));
+    }
+
+  public:
+    explicit blocked_bloom_filter(const uint64_t expected_elements = 1000, const double false_positive_rate = 0.01)
+    {
+      const uint64_t bit_count = bloom_parameter::optimal_bit_count(expected_elements, false_positive_rate);
+      const uint32_t hash_count = bloom_parameter::optimal_hash_count(expected_elements, bit_count);
+      _block_count = (bit_count + bloom_parameter::block_bits - 1) / bloom_parameter::block_bits;
+      _hash_count = hash_count > bloom_parameter::max_block_hash_count ? bloom_parameter::max_block_hash_count : hash_count;
+      _blocks = std::make_unique<bloom_block[]>(_block_count);
+    }
+    blocked_bloom_filter(const blocked_bloom_filter &bloom_filter_data)
+        : hash_functions_object(bloom_filter_data.hash_functions_object),
+          _blocks(std::make_unique<bloom_block[]>(bloom_filter_data._block_count)),
+          _block_count(bloom_filter_data._block_count), _hash_count(bloom_filter_data._hash_count)
+    {
+      for (uint64_t block_index = 0; block_index < _block_count; ++block_index)
+      {
+        _blocks[block_index] = bloom_filter_data._blocks[block_index];
+      }
+    }
+    blocked_bloom_filter(blocked_bloom_filter &&bloom_filter_data) noexcept = default;
+    blocked_bloom_filter &operator=(const blocked_bloom_filter &bloom_filter_data)
+    {
+      if (this != &bloom_filter_data)
+      {
+        blocked_bloom_filter copy_filter(bloom_filter_data);
+        *this = std::move(copy_filter);
+      }
+      return *this;
+    }
+    blocked_bloom_filter &operator=(blocked_bloom_filter &&bloom_filter_data) noexcept = default;
+    [[nodiscard]] uint64_t capacity() const noexcept
+    {
+      return _block_count * bloom_parameter::block_bits;
+    }
+    [[nodiscard]] uint32_t hash_count() const noexcept
+    {
+      return _hash_count;
+    }
+    void set(const bloom_filter_type_value &value_data)
+    {
+      const uint64_t hash_data = hash_value(value_data);
+      uint64_t mask[bloom_parameter::block_words];
+      bloom_parameter::block_mask(hash_data, _hash_count, mask);
+      uint64_t *block = _blocks[bloom_parameter::reduce(hash_data, _block_count)]._words;
+      for (uint64_t word_index = 0; word_index < bloom_parameter::block_words; ++word_index)
+      {
+        block[word_index] |= mask[word_index];
+      }
+    }
+    [[nodiscard]] bool test(const bloom_filter_type_value &value_data) const
+    {
+      const uint64_t hash_data = hash_value(value_data);
+      uint64_t mask[bloom_parameter::block_words];
+      bloom_parameter::block_mask(hash_data, _hash_count, mask);
+      return bloom_parameter::block_contains(_blocks[bloom_parameter::reduce(hash_data, _block_count)]._words, mask);
+    }
+    void clear() noexcept
+    {
+      for (uint64_t block_index = 0; block_index < _block_count; ++block_index)
+      {
+        _blocks[block_index] = bloom_block();
+      }
+    }
+  };
+  /**
+   * @brief 计数布隆过滤器（Counting Bloom Filter）
+   *
+   * 每个位置用 8 位计数器代替单个比特，插入时 k 个计数器加一，删除时减一，因此支持 `pop()` 删除。
+   *
+   * 模板参数:
+   *
+   * * - `bloom_filter_type_value`: 元素类型
+   *
+   * * - `bloom_filter_hash_functor`: 哈希函数对象类型，默认为 `standard_con::hash_imitation_functions`
+   *
+   * 主要方法:
+   *
+   * * - `set()`: 插入元素
+   *
+   * * - `test()`: 查询元素是否可能存在
+   *
+   * * - `pop()`: 删除元素，元素一定不存在时返回 `false` 且不做修改
+   *
+   * * - `count()`: 元素插入次数的上界估计（k 个计数器中的最小值）
+   *
+   * 注意事项:
+   *
+   * - 计数器达到 255 后饱和，不再增减，避免回绕产生假阴性
+   *
+   * - 只能删除确实插入过的元素，删除未插入的元素会破坏其他元素的计数
+   *
+   * - 空间为同参数普通布隆过滤器的 8 倍
+   */
+  template <typename bloom_filter_type_value, typename bloom_filter_hash_functor = standard_con::hash_imitation_functions>
+  class counting_bloom_filter
+  {
+    static constexpr uint8_t saturated_count = 255;
+    mutable bloom_filter_hash_functor hash_functions_object;
+    standard_con::vector<uint8_t> _counters;
+    uint64_t _capacity;
+    uint32_t _hash_count;
+
+    template <typename probe_function>
+    void for_each_probe(const bloom_filter_type_value &value_data, probe_function &&probe) const
+    {
+      const uint64_t hash_value = bloom_parameter::mix(static_cast<uint64_t>(hash_functions_object(value_data)));
+      const uint64_t hash_step = bloom_parameter::step(hash_value);
+      uint64_t probe_hash = hash_value;
+      for (uint32_t probe_index = 0; probe_index < _hash_count; ++probe_index)
+      {
+        if (!probe(bloom_parameter::reduce(probe_hash, _capacity)))
+        {
+          return;
+        }
+        probe_hash += hash_step;
+      }
+    }
+
+  public:
+    explicit counting_bloom_filter(const uint64_t expected_elements = 1000, const double false_positive_rate = 0.01)
+    {
+      _capacity = bloom_parameter::optimal_bit_count(expected_elements, false_positive_rate);
+      _hash_count = bloom_parameter::optimal_hash_count(expected_elements, _capacity);
+      _counters.resize(_capacity, 0);
+    }
+    [[nodiscard]] uint64_t capacity() const noexcept
+    {
+      return _capacity;
+    }
+    [[nodiscard]] uint32_t hash_count() const noexcept
+    {
+      return _hash_count;
+    }
+    void set(const bloom_filter_type_value &value_data)
+    {
+      for_each_probe(value_data, [this](const uint64_t position)
+                     {
+                       if (_counters[position] != saturated_count)
+                       {
+                         ++_counters[position];
+                       }
+                       return true; });
+    }
+    [[nodiscard]] bool test(const bloom_filter_type_value &value_data) const
+    {
+      bool contains = true;
+      for_each_probe(value_data, [this, &contains](const uint64_t position)
+                     {
+                       contains = _counters[position] != 0;
+                       return contains; });
+      return contains;
+    }
+    [[nodiscard]] uint64_t count(const bloom_filter_type_value &value_data) const
+    {
+      uint64_t minimum_count = saturated_count;
+      for_each_probe(value_data, [this, &minimum_count](const uint64_t position)
+                     {
+                       minimum_count = _counters[position] < minimum_count ? _counters[position] : minimum_count;
+                       return minimum_count != 0; });
+      return minimum_count;
+    }
+    bool pop(const bloom_filter_type_value &value_data)
+    {
+      if (!test(value_data))
+      {
+        return false;
+      }
+      for_each_probe(value_data, [this](const uint64_t position)
+                     {
+                       // 饱和计数器无法得知真实次数，保持不变
+                       if (_counters[position] != saturated_count)
+                       {
+                         --_counters[position];
+                       }
+                       return true; });
+      return true;
+    }
+    void clear()
+    {
+      for (uint64_t position = 0; position < _capacity; ++position)
+      {
+        _counters[position] = 0;
+      }
+    }
+  };
+  /**
+   * @brief 线程安全的原子布隆过滤器
+   *
+   * 与 `blocked_bloom_filter` 相同的分块布局，每块由 8 个 `std::atomic<uint64_t>` 组成，
+   *
+   * 插入以 `fetch_or` 置位、查询以 `load` 读取，均为 relaxed 内存序，多个线程可同时插入和查询而无需加锁。
+   *
+   * 模板参数:
+   *
+   * * - `bloom_filter_type_value`: 元素类型
+   *
+   * * - `bloom_filter_hash_functor`: 哈希函数对象类型，需可在多线程中同时调用（无状态仿函数即可）
+   *
+   * 注意事项:
+   *
+   * - 一个线程的 `set()` 完成后，其他线程需经由其他同步手段（或随后的 acquire 操作）才保证能看到
+   *
+   * - `clear()` 不与并发的 `set()` 同步，只应在无其他线程访问时调用
+   *
+   * - 不可拷贝
+   */
+  template <typename bloom_filter_type_value, typename bloom_filter_hash_functor = standard_con::hash_imitation_functions>
+  class atomic_bloom_filter
+  {
+    struct alignas(64) atomic_block
+    {
+      std::atomic<uint64_t> _words[bloom_parameter::block_words] = {};
+    };
+    mutable bloom_filter_hash_functor hash_functions_object;
+    std::unique_ptr<atomic_block[]> _blocks;
+    uint64_t _block_count;
+    uint32_t _hash_count;
+
+    [[nodiscard]] uint64_t hash_value(const bloom_filter_type_value &value_data) const
+    {
+      return bloom_parameter::mix(static_cast<uint64_t>(hash_functions_object(value_data)));
+    }
+
+  public:
+    explicit atomic_bloom_filter(const uint64_t expected_elements = 1000, const double false_positive_rate = 0.01)
+    {
+      const uint64_t bit_count = bloom_parameter::optimal_bit_count(expected_elements, false_positive_rate);
+      const uint32_t hash_count = bloom_parameter::optimal_hash_count(expected_elements, bit_count);
+      _block_count = (bit_count + bloom_parameter::block_bits - 1) / bloom_parameter::block_bits;
+      _hash_count = hash_count > bloom_parameter::max_block_hash_count ? bloom_parameter::max_block_hash_count : hash_count;
+      _blocks = std::make_unique<atomic_block[]>(_block_count);
+    }
+    atomic_bloom_filter(const atomic_bloom_filter &) = delete;
+    atomic_bloom_filter &operator=(const atomic_bloom_filter &) = delete;
+    [[nodiscard]] uint64_t capacity() const noexcept
+    {
+      return _block_count * bloom_parameter::block_bits;
+    }
+    [[nodiscard]] uint32_t hash_count() const noexcept
+    {
+      return _hash_count;
+    }
+    /**
+     * @brief 插入元素
+     * @return 本次插入至少置位了一个原本为 0 的比特时返回 `true`（元素此前一定不存在）
+     */
+    bool set(const bloom_filter_type_value &value_data)
+    {
+      const uint64_t hash_data = hash_value(value_data);
+      uint64_t mask[bloom_parameter::block_words];
+      bloom_parameter::block_mask(hash_data, _hash_count, mask);
+      std::atomic<uint64_t> *block = _blocks[bloom_parameter::reduce(hash_data, _block_count)]._words;
+      bool newly_set = false;
+      for (uint64_t word_index = 0; word_index < bloom_parameter::block_words; ++word_index)
+      {
+        if (mask[word_index] == 0)
+        {
+          continue;
+        }
+        // 已全部置位时跳过写操作，避免热点缓存行在核间来回失效
+        if ((block[word_index].load(std::memory_order_relaxed) & mask[word_index]) == mask[word_index])
+        {
+          continue;
+        }
+        const uint64_t previous_word = block[word_index].fetch_or(mask[word_index], std::memory_order_relaxed);
+        newly_set |= (previous_word & mask[word_index]) != mask[word_index];
+      }
+      return newly_set;
+    }
+    [[nodiscard]] bool test(const bloom_filter_type_value &value_data) const
+    {
+      const uint64_t hash_data = hash_value(value_data);
+      uint64_t mask[bloom_parameter::block_words];
+      bloom_parameter::block_mask(hash_data, _hash_count, mask);
+      const std::atomic<uint64_t> *block = _blocks[bloom_parameter::reduce(hash_data, _block_count)]._words;
+      for (uint64_t word_index = 0; word_index < bloom_parameter::block_words; ++word_index)
+      {
+        if ((block[word_index].load(std::memory_order_relaxed) & mask[word_index]) != mask[word_index])
+        {
+          return false;
+        }
+      }
+      return true;
+    }
+    void clear() noexcept
+    {
+      for (uint64_t block_index = 0; block_index < _block_count; ++block_index)
+      {
+        for (auto &word : _blocks[block_index]._words)
+        {
+          word.store(0, std::memory_order_relaxed);
+        }
+      }
+    }
+  };
 }
 namespace standard_con
 {
+  using bloom_filter_container::atomic_bloom_filter;
+  using bloom_filter_container::blocked_bloom_filter;
   using bloom_filter_container::bloom_filter;
-}
\ No newline at end of file
+  using bloom_filter_container::bloom_parameter;
+  using bloom_filter_container::counting_bloom_filter;
+}
@@ -0,0 +1,972 @@
+#pragma once
+#include <bit>
+#include <memory>
+#include <cstdint>
+#include <utility>
+#include <iostream>
+#include <type_traits>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define B_PLUS_TREE_AVX2 1
+#elif defined(__SSE4_2__)
+#include <nmmintrin.h>
+#define B_PLUS_TREE_SSE42 1
+#define B_PLUS_TREE_SSE2 1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define B_PLUS_TREE_SSE2 1
+#endif
+#include "simulate_imitate.hpp"
+#include "simulate_utility.hpp"
+#include "simulate_pool.hpp"
+namespace btree_container
+{
+  /*
+      * @brief  #### `b_plus_tree` 类模板
+
+      *   - 宽节点 B+ 树，作为 `red_black_tree` 的缓存友好替代：一次查找只经过 log_B(n) 个节点，每个节点的键连续存放
+
+      *   - 所有元素存放在叶节点，叶节点以双向链表串联，范围遍历只需顺序走叶链表
+
+      *   - 键数组约占 4 条缓存行（256 字节），有符号 32/64 位整数键配合默认 `less` 比较器时以 SIMD 批量比较定位
+
+      * 模板参数:
+
+      * * - `btree_type_key`: 键的类型，用于排序（需可默认构造与赋值）
+      *
+      * * - `btree_type_value`: 叶节点存储的值类型（通常为键值对，需可默认构造与赋值）
+      *
+      * * - `container_imitate_function_visit`: 访问器类型，用于从值中提取键
+      *
+      * * - `container_imitate_function`: 比较器类型，默认为 `standard_con::less<btree_type_key>`
+      *
+      * * - `btree_allocator`: 分配器类型，默认为 `std::allocator<btree_type_value>`，分别重绑定到叶节点与内部节点后为两个节点池提供块内存
+
+      * 节点结构:
+
+      * * - 叶节点: `max_keys` 个键 + 对应的值 + 前后叶指针
+      *
+      * * - 内部节点: `max_keys` 个分隔键 + `max_keys + 1` 个子节点指针，子节点 i 中的键位于 [key[i-1], key[i])
+      *
+      * * - 除根外每个节点至少保留 `max_keys / 2` 个键，删除时先向兄弟借键，借不到再合并
+      *
+      * * - 叶节点与内部节点分别来自本树独占的 `node_pool`
+
+      * 主要操作方法:
+
+      * * - `push()`: 插入值（支持拷贝和移动语义），键已存在时返回已有位置和 `false`
+      *
+      * * - `pop()`: 删除指定值对应的键，返回 `pair<iterator, bool>`，迭代器为 `end()`
+      *
+      * * - `find()`: 查找指定值对应的键，未找到返回 `end()`
+      *
+      * * - `lower_bound()` / `upper_bound()`: 按键定位第一个不小于 / 大于给定键的元素，配合迭代器完成范围查询
+      *
+      * * - `size()`: O(1) 返回元素个数
+      *
+      * * - `clear()`: 析构所有节点并整块归还节点池
+
+      * 注意事项:
+
+      * * - 插入与删除会在节点内移动元素，修改操作后之前取得的迭代器全部失效
+      *
+      * * - `end()` 为空迭代器，不能对其自减；反向遍历请使用 `rbegin()` / `rend()`
+  */
+  template <typename btree_type_key, typename btree_type_value, typename container_imitate_function_visit,
+            typename container_imitate_function = standard_con::less<btree_type_key>,
+            typename btree_allocator = std::allocator<btree_type_value>>
+  class b_plus_tree
+  {
+  public:
+    static constexpr uint64_t node_key_bytes = 256;
+    static constexpr uint32_t max_keys = node_key_bytes / sizeof(btree_type_key) < 4    ? 4
+                                         : node_key_bytes / sizeof(btree_type_key) > 64 ? 64
+                                                                                         : static_cast<uint32_t>(node_key_bytes / sizeof(btree_type_key));
+    static constexpr uint32_t min_keys = max_keys / 2;
+
+  private:
+    // 多留一个槽位：插入时先放入再分裂；再按 8 对齐，SIMD 整块读取不会越界
+    static constexpr uint32_t key_slots = (max_keys + 1 + 7) / 8 * 8;
+    static constexpr uint32_t max_depth = 48;
+    static constexpr bool simd_searchable = std::is_same_v<container_imitate_function, standard_con::less<btree_type_key>> &&
+                                            std::is_integral_v<btree_type_key> && std::is_signed_v<btree_type_key> &&
+                                            (sizeof(btree_type_key) == 4 || sizeof(btree_type_key) == 8);
+
+    struct node_header
+    {
+      bool _is_leaf;
+      uint32_t _count = 0;
+      explicit node_header(const bool is_leaf) noexcept : _is_leaf(is_leaf) {}
+    };
+    struct leaf_node : node_header
+    {
+      alignas(64) btree_type_key _keys[key_slots];
+      btree_type_value _values[max_keys + 1];
+      leaf_node *_prev = nullptr;
+      leaf_node *_next = nullptr;
+      leaf_node() : node_header(true), _keys(), _values() {}
+    };
+    struct inner_node : node_header
+    {
+      alignas(64) btree_type_key _keys[key_slots];
+      node_header *_children[max_keys + 2];
+      inner_node() : node_header(false), _keys(), _children() {}
+    };
+    struct path_entry
+    {
+      inner_node *_node;
+      uint32_t _index;
+    };
+
+    template <typename Ref, typename Ptr>
+    class btree_iterator
+    {
+      using self = btree_iterator<Ref, Ptr>;
+      friend class b_plus_tree;
+      leaf_node *_leaf;
+      uint32_t _index;
+
+    public:
+      using reference = Ref;
+      using pointer = Ptr;
+      btree_iterator(leaf_node *leaf = nullptr, const uint32_t index = 0) noexcept
+          : _leaf(leaf), _index(index)
+      {
+        ;
+      }
+      Ref &operator*() const
+      {
+        return _leaf->_values[_index];
+      }
+      Ptr operator->() const
+      {
+        return &(_leaf->_values[_index]);
+      }
+      self &operator++() noexcept
+      {
+        // 叶内顺序前进，走完当前叶沿链表进入下一叶
+        if (_leaf != nullptr && ++_index >= _leaf->_count)
+        {
+          _leaf = _leaf->_next;
+          _index = 0;
+        }
+        return *this;
+      }
+      self operator++(int) noexcept
+      {
+        self previously_iterator = *this;
+        ++(*this);
+        return previously_iterator;
+      }
+      self &operator--() noexcept
+      {
+        if (_index > 0)
+        {
+          --_index;
+        }
+        else
+        {
+          _leaf = _leaf->_prev;
+          _index = _leaf == nullptr ? 0 : _leaf->_count - 1;
+        }
+        return *this;
+      }
+      self operator--(int) noexcept
+      {
+        self previously_iterator = *this;
+        --(*this);
+        return previously_iterator;
+      }
+      bool operator==(const self &it_data) const noexcept
+      {
+        return _leaf == it_data._leaf && _index == it_data._index;
+      }
+      bool operator!=(const self &it_data) const noexcept
+      {
+        return !(*this == it_data);
+      }
+    };
+    template <typename iterator>
+    class btree_reverse_iterator
+    {
+      using self = btree_reverse_iterator<iterator>;
+      using Ref = typename iterator::reference;
+      using Ptr = typename iterator::pointer;
+      iterator _it;
+
+    public:
+      btree_reverse_iterator(iterator it_data) noexcept
+          : _it(it_data)
+      {
+        ;
+      }
+      Ref &operator*() const
+      {
+        return *_it;
+      }
+      Ptr operator->() const
+      {
+        return _it.operator->();
+      }
+      // 前置自增：对应正向迭代器的自减，越过首元素后与 rend() 相等
+      self &operator++() noexcept
+      {
+        --_it;
+        return *this;
+      }
+      self operator++(int) noexcept
+      {
+        self previously_iterator = *this;
+        --_it;
+        return previously_iterator;
+      }
+      self &operator--() noexcept
+      {
+        ++_it;
+        return *this;
+      }
+      self operator--(int) noexcept
+      {
+        self previously_iterator = *this;
+        ++_it;
+        return previously_iterator;
+      }
+      bool operator==(const self &other) const noexcept
+      {
+        return _it == other._it;
+      }
+      bool operator!=(const self &other) const noexcept
+      {
+        return _it != other._it;
+      }
+    };
+
+    node_header *_root = nullptr;
+    leaf_node *_first_leaf = nullptr;
+    leaf_node *_last_leaf = nullptr;
+    uint64_t _size = 0;
+    mutable container_imitate_function_visit element;
+    mutable container_imitate_function function_policy;
+    using leaf_pool_type = standard_con::node_pool<leaf_node, typename std::allocator_traits<btree_allocator>::template rebind_alloc<leaf_node>>;
+    using inner_pool_type = standard_con::node_pool<inner_node, typename std::allocator_traits<btree_allocator>::template rebind_alloc<inner_node>>;
+    leaf_pool_type _leaf_pool;
+    inner_pool_type _inner_pool;
+
+    // 统计节点内满足 key < target（inclusive 时为 key <= target）的键个数
+    template <bool inclusive>
+    [[nodiscard]] static uint32_t simd_count(const btree_type_key *keys, const uint32_t count, const btree_type_key &target) noexcept
+    {
+      uint32_t result = 0;
+      uint32_t position = 0;
+#if defined(B_PLUS_TREE_AVX2)
+      if constexpr (sizeof(btree_type_key) == 4)
+      {
+        const __m256i needle = _mm256_set1_epi32(static_cast<int32_t>(target));
+        for (; position < count; position += 8)
+        {
+          const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(keys + position));
+          const __m256i compare = inclusive ? _mm256_cmpgt_epi32(block, needle) : _mm256_cmpgt_epi32(needle, block);
+          const uint32_t valid = count - position < 8 ? count - position : 8;
+          const uint32_t mask = static_cast<uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(compare))) & ((1u << valid) - 1);
+          result += inclusive ? valid - std::popcount(mask) : std::popcount(mask);
+        }
+      }
+      else
+      {
+        const __m256i needle = _mm256_set1_epi64x(static_cast<int64_t>(target));
+        for (; position < count; position += 4)
+        {
+          const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(keys + position));
+          const __m256i compare = inclusive ? _mm256_cmpgt_epi64(block, needle) : _mm256_cmpgt_epi64(needle, block);
+          const uint32_t valid = count - position < 4 ? count - position : 4;
+          const uint32_t mask = static_cast<uint32_t>(_mm256_movemask_pd(_mm256_castsi256_pd(compare))) & ((1u << valid) - 1);
+          result += inclusive ? valid - std::popcount(mask) : std::popcount(mask);
+        }
+      }
+      return result;
+#elif defined(B_PLUS_TREE_SSE2)
+      if constexpr (sizeof(btree_type_key) == 4)
+      {
+        const __m128i needle = _mm_set1_epi32(static_cast<int32_t>(target));
+        for (; position < count; position += 4)
+        {
+          const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(keys + position));
+          const __m128i compare = inclusive ? _mm_cmpgt_epi32(block, needle) : _mm_cmpgt_epi32(needle, block);
+          const uint32_t valid = count - position < 4 ? count - position : 4;
+          const uint32_t mask = static_cast<uint32_t>(_mm_movemask_ps(_mm_castsi128_ps(compare))) & ((1u << valid) - 1);
+          result += inclusive ? valid - std::popcount(mask) : std::popcount(mask);
+        }
+        return result;
+      }
+#if defined(B_PLUS_TREE_SSE42)
+      else
+      {
+        const __m128i needle = _mm_set1_epi64x(static_cast<int64_t>(target));
+        for (; position < count; position += 2)
+        {
+          const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(keys + position));
+          const __m128i compare = inclusive ? _mm_cmpgt_epi64(block, needle) : _mm_cmpgt_epi64(needle, block);
+          const uint32_t valid = count - position < 2 ? count - position : 2;
+          const uint32_t mask = static_cast<uint32_t>(_mm_movemask_pd(_mm_castsi128_pd(compare))) & ((1u << valid) - 1);
+          result += inclusive ? valid - std::popcount(mask) : std::popcount(mask);
+        }
+        return result;
+      }
+#endif
+#endif
+      // 无可用指令集时退化为无分支计数，编译器可自动向量化
+      for (; position < count; ++position)
+      {
+        result += inclusive ? static_cast<uint32_t>(!(target < keys[position])) : static_cast<uint32_t>(keys[position] < target);
+      }
+      return result;
+    }
+    [[nodiscard]] uint32_t lower_index(const btree_type_key *keys, const uint32_t count, const btree_type_key &target) const
+    {
+      // 第一个不小于 target 的位置
+      if constexpr (simd_searchable)
+      {
+        return simd_count<false>(keys, count, target);
+      }
+      else
+      {
+        uint32_t low = 0;
+        uint32_t high = count;
+        while (low < high)
+        {
+          const uint32_t middle = (low + high) / 2;
+          if (function_policy(keys[middle], target))
+          {
+            low = middle + 1;
+          }
+          else
+          {
+            high = middle;
+          }
+        }
+        return low;
+      }
+    }
+    [[nodiscard]] uint32_t upper_index(const btree_type_key *keys, const uint32_t count, const btree_type_key &target) const
+    {
+      // 第一个大于 target 的位置，用于在内部节点选择子树
+      if constexpr (simd_searchable)
+      {
+        return simd_count<true>(keys, count, target);
+      }
+      else
+      {
+        uint32_t low = 0;
+        uint32_t high = count;
+        while (low < high)
+        {
+          const uint32_t middle = (low + high) / 2;
+          if (function_policy(target, keys[middle]))
+          {
+            high = middle;
+          }
+          else
+          {
+            low = middle + 1;
+          }
+        }
+        return low;
+      }
+    }
+    leaf_node *descend(const btree_type_key &target, path_entry *path, uint32_t &depth) const
+    {
+      node_header *current_node = _root;
+      depth = 0;
+      while (!current_node->_is_leaf)
+      {
+        auto *inner = static_cast<inner_node *>(current_node);
+        const uint32_t child_index = upper_index(inner->_keys, inner->_count, target);
+        if (path != nullptr)
+        {
+          path[depth] = path_entry{inner, child_index};
+        }
+        ++depth;
+        current_node = inner->_children[child_index];
+      }
+      return static_cast<leaf_node *>(current_node);
+    }
+    void insert_into_parent(path_entry *path, uint32_t depth, node_header *left_child, btree_type_key separator, node_header *right_child)
+    {
+      while (true)
+      {
+        if (depth == 0)
+        {
+          // 根节点分裂，树长高一层
+          inner_node *new_root = _inner_pool.create();
+          new_root->_keys[0] = std::move(separator);
+          new_root->_children[0] = left_child;
+          new_root->_children[1] = right_child;
+          new_root->_count = 1;
+          _root = new_root;
+          return;
+        }
+        --depth;
+        inner_node *parent_node = path[depth]._node;
+        const uint32_t insert_index = path[depth]._index;
+        for (uint32_t move_index = parent_node->_count; move_index > insert_index; --move_index)
+        {
+          parent_node->_keys[move_index] = std::move(parent_node->_keys[move_index - 1]);
+          parent_node->_children[move_index + 1] = parent_node->_children[move_index];
+        }
+        parent_node->_keys[insert_index] = std::move(separator);
+        parent_node->_children[insert_index + 1] = right_child;
+        if (++parent_node->_count <= max_keys)
+        {
+          return;
+        }
+        // 内部节点溢出：中间键上移，右半部分移入新节点
+        inner_node *sibling_node = _inner_pool.create();
+        const uint32_t middle_index = parent_node->_count / 2;
+        separator = std::move(parent_node->_keys[middle_index]);
+        sibling_node->_count = parent_node->_count - middle_index - 1;
+        for (uint32_t copy_index = 0; copy_index < sibling_node->_count; ++copy_index)
+        {
+          sibling_node->_keys[copy_index] = std::move(parent_node->_keys[middle_index + 1 + copy_index]);
+        }
+        for (uint32_t copy_index = 0; copy_index <= sibling_node->_count; ++copy_index)
+        {
+          sibling_node->_children[copy_index] = parent_node->_children[middle_index + 1 + copy_index];
+        }
+        parent_node->_count = middle_index;
+        left_child = parent_node;
+        right_child = sibling_node;
+      }
+    }
+    template <typename value_argument>
+    standard_con::pair<btree_iterator<btree_type_value, btree_type_value *>, bool> insert_value(value_argument &&value_data)
+    {
+      using result_type = standard_con::pair<btree_iterator<btree_type_value, btree_type_value *>, bool>;
+      using iterator_type = btree_iterator<btree_type_value, btree_type_value *>;
+      btree_type_key key_data = element(value_data);
+      if (_root == nullptr)
+      {
+        leaf_node *leaf = _leaf_pool.create();
+        leaf->_keys[0] = std::move(key_data);
+        leaf->_values[0] = std::forward<value_argument>(value_data);
+        leaf->_count = 1;
+        _root = _first_leaf = _last_leaf = leaf;
+        _size = 1;
+        return result_type(iterator_type(leaf, 0), true);
+      }
+      path_entry path[max_depth];
+      uint32_t depth = 0;
+      leaf_node *leaf = descend(key_data, path, depth);
+      const uint32_t position = lower_index(leaf->_keys, leaf->_count, key_data);
+      if (position < leaf->_count && !function_policy(key_data, leaf->_keys[position]))
+      {
+        // 键已存在
+        return result_type(iterator_type(leaf, position), false);
+      }
+      for (uint32_t move_index = leaf->_count; move_index > position; --move_index)
+      {
+        leaf->_keys[move_index] = std::move(leaf->_keys[move_index - 1]);
+        leaf->_values[move_index] = std::move(leaf->_values[move_index - 1]);
+      }
+      leaf->_keys[position] = std::move(key_data);
+      leaf->_values[position] = std::forward<value_argument>(value_data);
+      ++_size;
+      if (++leaf->_count <= max_keys)
+      {
+        return result_type(iterator_type(leaf, position), true);
+      }
+      // 叶节点溢出：后一半移入新叶，新叶首键复制到父节点作为分隔键
+      leaf_node *right_leaf = _leaf_pool.create();
+      const uint32_t left_count = leaf->_count / 2;
+      right_leaf->_count = leaf->_count - left_count;
+      for (uint32_t copy_index = 0; copy_index < right_leaf->_count; ++copy_index)
+      {
+        right_leaf->_keys[copy_index] = std::move(leaf->_keys[left_count + copy_index]);
+        right_leaf->_values[copy_index] = std::move(leaf->_values[left_count + copy_index]);
+      }
+      leaf->_count = left_count;
+      right_leaf->_next = leaf->_next;
+      right_leaf->_prev = leaf;
+      if (leaf->_next != nullptr)
+      {
+        leaf->_next->_prev = right_leaf;
+      }
+      else
+      {
+        _last_leaf = right_leaf;
+      }
+      leaf->_next = right_leaf;
+      const iterator_type result = position < left_count ? iterator_type(leaf, position) : iterator_type(right_leaf, position - left_count);
+      insert_into_parent(path, depth, leaf, right_leaf->_keys[0], right_leaf);
+      return result_type(result, true);
+    }
+    void remove_from_inner(inner_node *inner, const uint32_t key_index, const uint32_t child_index) noexcept
+    {
+      for (uint32_t move_index = key_index; move_index + 1 < inner->_count; ++move_index)
+      {
+        inner->_keys[move_index] = std::move(inner->_keys[move_index + 1]);
+      }
+      for (uint32_t move_index = child_index; move_index < inner->_count; ++move_index)
+      {
+        inner->_children[move_index] = inner->_children[move_index + 1];
+      }
+      --inner->_count;
+    }
+    void rebalance_inner(inner_node *inner, const uint32_t depth, path_entry *path)
+    {
+      if (depth == 0)
+      {
+        // 根节点只剩一个子节点时，树降低一层
+        if (inner->_count == 0)
+        {
+          _root = inner->_children[0];
+          _inner_pool.destroy(inner);
+        }
+        return;
+      }
+      if (inner->_count >= min_keys)
+      {
+        return;
+      }
+      inner_node *parent_node = path[depth - 1]._node;
+      const uint32_t child_index = path[depth - 1]._index;
+      auto *left_sibling = child_index > 0 ? static_cast<inner_node *>(parent_node->_children[child_index - 1]) : nullptr;
+      auto *right_sibling = child_index < parent_node->_count ? static_cast<inner_node *>(parent_node->_children[child_index + 1]) : nullptr;
+      if (left_sibling != nullptr && left_sibling->_count > min_keys)
+      {
+        // 向左兄弟借：父分隔键下移到本节点首位，左兄弟末键上移
+        for (uint32_t move_index = inner->_count; move_index > 0; --move_index)
+        {
+          inner->_keys[move_index] = std::move(inner->_keys[move_index - 1]);
+        }
+        for (uint32_t move_index = inner->_count + 1; move_index > 0; --move_index)
+        {
+          inner->_children[move_index] = inner->_children[move_index - 1];
+        }
+        inner->_keys[0] = std::move(parent_node->_keys[child_index - 1]);
+        inner->_children[0] = left_sibling->_children[left_sibling->_count];
+        parent_node->_keys[child_index - 1] = std::move(left_sibling->_keys[left_sibling->_count - 1]);
+        --left_sibling->_count;
+        ++inner->_count;
+        return;
+      }
+      if (right_sibling != nullptr && right_sibling->_count > min_keys)
+      {
+        // 向右兄弟借：父分隔键下移到本节点末位，右兄弟首键上移
+        inner->_keys[inner->_count] = std::move(parent_node->_keys[child_index]);
+        inner->_children[inner->_count + 1] = right_sibling->_children[0];
+        ++inner->_count;
+        parent_node->_keys[child_index] = std::move(right_sibling->_keys[0]);
+        remove_from_inner(right_sibling, 0, 0);
+        return;
+      }
+      // 借不到则与兄弟合并，父分隔键一并下移
+      inner_node *left_node = left_sibling != nullptr ? left_sibling : inner;
+      inner_node *right_node = left_sibling != nullptr ? inner : right_sibling;
+      const uint32_t separator_index = left_sibling != nullptr ? child_index - 1 : child_index;
+      left_node->_keys[left_node->_count] = std::move(parent_node->_keys[separator_index]);
+      for (uint32_t copy_index = 0; copy_index < right_node->_count; ++copy_index)
+      {
+        left_node->_keys[left_node->_count + 1 + copy_index] = std::move(right_node->_keys[copy_index]);
+      }
+      for (uint32_t copy_index = 0; copy_index <= right_node->_count; ++copy_index)
+      {
+        left_node->_children[left_node->_count + 1 + copy_index] = right_node->_children[copy_index];
+      }
+      left_node->_count += right_node->_count + 1;
+      _inner_pool.destroy(right_node);
+      remove_from_inner(parent_node, separator_index, separator_index + 1);
+      rebalance_inner(parent_node, depth - 1, path);
+    }
+    void rebalance_leaf(leaf_node *leaf, const uint32_t depth, path_entry *path)
+    {
+      if (depth == 0)
+      {
+        if (leaf->_count == 0)
+        {
+          _leaf_pool.destroy(leaf);
+          _root = nullptr;
+          _first_leaf = _last_leaf = nullptr;
+        }
+        return;
+      }
+      if (leaf->_count >= min_keys)
+      {
+        return;
+      }
+      inner_node *parent_node = path[depth - 1]._node;
+      const uint32_t child_index = path[depth - 1]._index;
+      auto *left_sibling = child_index > 0 ? static_cast<leaf_node *>(parent_node->_children[child_index - 1]) : nullptr;
+      auto *right_sibling = child_index < parent_node->_count ? static_cast<leaf_node *>(parent_node->_children[child_index + 1]) : nullptr;
+      if (left_sibling != nullptr && left_sibling->_count > min_keys)
+      {
+        // 向左兄弟借末元素，本叶新首键成为分隔键
+        for (uint32_t move_index = leaf->_count; move_index > 0; --move_index)
+        {
+          leaf->_keys[move_index] = std::move(leaf->_keys[move_index - 1]);
+          leaf->_values[move_index] = std::move(leaf->_values[move_index - 1]);
+        }
+        --left_sibling->_count;
+        leaf->_keys[0] = std::move(left_sibling->_keys[left_sibling->_count]);
+        leaf->_values[0] = std::move(left_sibling->_values[left_sibling->_count]);
+        ++leaf->_count;
+        parent_node->_keys[child_index - 1] = leaf->_keys[0];
+        return;
+      }
+      if (right_sibling != nullptr && right_sibling->_count > min_keys)
+      {
+        // 向右兄弟借首元素，右兄弟新首键成为分隔键
+        leaf->_keys[leaf->_count] = std::move(right_sibling->_keys[0]);
+        leaf->_values[leaf->_count] = std::move(right_sibling->_values[0]);
+        ++leaf->_count;
+        for (uint32_t move_index = 0; move_index + 1 < right_sibling->_count; ++move_index)
+        {
+          right_sibling->_keys[move_index] = std::move(right_sibling->_keys[move_index + 1]);
+          right_sibling->_values[move_index] = std::move(right_sibling->_values[move_index + 1]);
+        }
+        --right_sibling->_count;
+        parent_node->_keys[child_index] = right_sibling->_keys[0];
+        return;
+      }
+      // 与兄弟合并，右叶并入左叶并从叶链表中摘除
+      leaf_node *left_leaf = left_sibling != nullptr ? left_sibling : leaf;
+      leaf_node *right_leaf = left_sibling != nullptr ? leaf : right_sibling;
+      const uint32_t separator_index = left_sibling != nullptr ? child_index - 1 : child_index;
+      for (uint32_t copy_index = 0; copy_index < right_leaf->_count; ++copy_index)
+      {
+        left_leaf->_keys[left_leaf->_count + copy_index] = std::move(right_leaf->_keys[copy_index]);
+        left_leaf->_values[left_leaf->_count + copy_index] = std::move(right_leaf->_values[copy_index]);
+      }
+      left_leaf->_count += right_leaf->_count;
+      left_leaf->_next = right_leaf->_next;
+      if (right_leaf->_next != nullptr)
+      {
+        right_leaf->_next->_prev = left_leaf;
+      }
+      else
+      {
+        _last_leaf = left_leaf;
+      }
+      _leaf_pool.destroy(right_leaf);
+      remove_from_inner(parent_node, separator_index, separator_index + 1);
+      rebalance_inner(parent_node, depth - 1, path);
+    }
+    node_header *clone_node(const node_header *source_node, leaf_node *&previous_leaf)
+    {
+      // 按中序复制，同时重建叶链表
+      if (source_node->_is_leaf)
+      {
+        const auto *source_leaf = static_cast<const leaf_node *>(source_node);
+        leaf_node *new_leaf = _leaf_pool.create();
+        new_leaf->_count = source_leaf->_count;
+        for (uint32_t copy_index = 0; copy_index < source_leaf->_count; ++copy_index)
+        {
+          new_leaf->_keys[copy_index] = source_leaf->_keys[copy_index];
+          new_leaf->_values[copy_index] = source_leaf->_values[copy_index];
+        }
+        new_leaf->_prev = previous_leaf;
+        if (previous_leaf != nullptr)
+        {
+          previous_leaf->_next = new_leaf;
+        }
+        else
+        {
+          _first_leaf = new_leaf;
+        }
+        previous_leaf = new_leaf;
+        return new_leaf;
+      }
+      const auto *source_inner = static_cast<const inner_node *>(source_node);
+      inner_node *new_inner = _inner_pool.create();
+      new_inner->_count = source_inner->_count;
+      for (uint32_t copy_index = 0; copy_index < source_inner->_count; ++copy_index)
+      {
+        new_inner->_keys[copy_index] = source_inner->_keys[copy_index];
+      }
+      for (uint32_t copy_index = 0; copy_index <= source_inner->_count; ++copy_index)
+      {
+        new_inner->_children[copy_index] = clone_node(source_inner->_children[copy_index], previous_leaf);
+      }
+      return new_inner;
+    }
+    void destroy_node(node_header *target_node) noexcept
+    {
+      if (target_node->_is_leaf)
+      {
+        std::destroy_at(static_cast<leaf_node *>(target_node));
+        return;
+      }
+      auto *inner = static_cast<inner_node *>(target_node);
+      for (uint32_t child_index = 0; child_index <= inner->_count; ++child_index)
+      {
+        destroy_node(inner->_children[child_index]);
+      }
+      std::destroy_at(inner);
+    }
+    // 交换除节点池以外的全部状态，节点池的交换或转移由调用方决定
+    void swap_nodes(b_plus_tree &btree_data) noexcept
+    {
+      std::swap(_root, btree_data._root);
+      std::swap(_first_leaf, btree_data._first_leaf);
+      std::swap(_last_leaf, btree_data._last_leaf);
+      std::swap(_size, btree_data._size);
+      std::swap(element, btree_data.element);
+      std::swap(function_policy, btree_data.function_policy);
+    }
+
+  public:
+    using iterator = btree_iterator<btree_type_value, btree_type_value *>;
+    using const_iterator = btree_iterator<const btree_type_value, const btree_type_value *>;
+    using reverse_iterator = btree_reverse_iterator<iterator>;
+    using const_reverse_iterator = btree_reverse_iterator<const_iterator>;
+
+    using return_pair_value = standard_con::pair<iterator, bool>;
+    using allocator_type = btree_allocator;
+    [[nodiscard]] allocator_type get_allocator() const noexcept
+    {
+      return allocator_type(_leaf_pool.get_allocator());
+    }
+    b_plus_tree() noexcept = default;
+    explicit b_plus_tree(const btree_allocator &allocator_data)
+        : _leaf_pool(typename leaf_pool_type::allocator_type(allocator_data)),
+          _inner_pool(typename inner_pool_type::allocator_type(allocator_data)) {}
+    explicit b_plus_tree(const btree_type_value &btree_data)
+    {
+      insert_value(btree_data);
+    }
+    explicit b_plus_tree(btree_type_value &&btree_data)
+    {
+      insert_value(std::move(btree_data));
+    }
+    b_plus_tree(const b_plus_tree &btree_data)
+        : b_plus_tree(btree_data, std::allocator_traits<btree_allocator>::select_on_container_copy_construction(btree_data.get_allocator())) {}
+    b_plus_tree(const b_plus_tree &btree_data, const btree_allocator &allocator_data)
+        : element(btree_data.element), function_policy(btree_data.function_policy),
+          _leaf_pool(typename leaf_pool_type::allocator_type(allocator_data)),
+          _inner_pool(typename inner_pool_type::allocator_type(allocator_data))
+    {
+      if (btree_data._root != nullptr)
+      {
+        leaf_node *previous_leaf = nullptr;
+        _root = clone_node(btree_data._root, previous_leaf);
+        _last_leaf = previous_leaf;
+        _size = btree_data._size;
+      }
+    }
+    b_plus_tree(b_plus_tree &&btree_data) noexcept
+        : element(btree_data.element), function_policy(btree_data.function_policy),
+          _leaf_pool(std::move(btree_data._leaf_pool)), _inner_pool(std::move(btree_data._inner_pool))
+    {
+      swap_nodes(btree_data);
+    }
+    b_plus_tree &operator=(const b_plus_tree &btree_data)
+    {
+      if (this != &btree_data)
+      {
+        b_plus_tree copy_tree(btree_data, get_allocator()); // 副本沿用本树的分配器
+        swap(copy_tree);
+      }
+      return *this;
+    }
+    b_plus_tree &operator=(b_plus_tree &&btree_data) noexcept
+    {
+      if (this != &btree_data)
+      {
+        clear();
+        swap_nodes(btree_data);
+        _leaf_pool = std::move(btree_data._leaf_pool);
+        _inner_pool = std::move(btree_data._inner_pool);
+      }
+      return *this;
+    }
+    ~b_plus_tree() noexcept
+    {
+      clear();
+    }
+    void swap(b_plus_tree &btree_data) noexcept
+    {
+      swap_nodes(btree_data);
+      _leaf_pool.swap(btree_data._leaf_pool);
+      _inner_pool.swap(btree_data._inner_pool);
+    }
+    void clear() noexcept
+    {
+      // 逐个析构节点后整块归还节点池
+      if (_root == nullptr)
+      {
+        return;
+      }
+      destroy_node(_root);
+      _leaf_pool.release();
+      _inner_pool.release();
+      _root = nullptr;
+      _first_leaf = _last_leaf = nullptr;
+      _size = 0;
+    }
+    return_pair_value push(const btree_type_value &value_data)
+    {
+      return insert_value(value_data);
+    }
+    return_pair_value push(btree_type_value &&value_data)
+    {
+      return insert_value(std::move(value_data));
+    }
+    return_pair_value pop(const btree_type_value &value_data)
+    {
+      if (_root == nullptr)
+      {
+        return return_pair_value(iterator(), false);
+      }
+      const btree_type_key &key_data = element(value_data);
+      path_entry path[max_depth];
+      uint32_t depth = 0;
+      leaf_node *leaf = descend(key_data, path, depth);
+      const uint32_t position = lower_index(leaf->_keys, leaf->_count, key_data);
+      if (position >= leaf->_count || function_policy(key_data, leaf->_keys[position]))
+      {
+        return return_pair_value(iterator(), false);
+      }
+      for (uint32_t move_index = position; move_index + 1 < leaf->_count; ++move_index)
+      {
+        leaf->_keys[move_index] = std::move(leaf->_keys[move_index + 1]);
+        leaf->_values[move_index] = std::move(leaf->_values[move_index + 1]);
+      }
+      --leaf->_count;
+      // 腾出的槽位重置，及时释放元素持有的资源
+      leaf->_keys[leaf->_count] = btree_type_key();
+      leaf->_values[leaf->_count] = btree_type_value();
+      --_size;
+      rebalance_leaf(leaf, depth, path);
+      return return_pair_value(iterator(), true);
+    }
+    iterator find(const btree_type_value &value_data)
+    {
+      if (_root == nullptr)
+      {
+        return iterator();
+      }
+      const btree_type_key &key_data = element(value_data);
+      uint32_t depth = 0;
+      leaf_node *leaf = descend(key_data, nullptr, depth);
+      const uint32_t position = lower_index(leaf->_keys, leaf->_count, key_data);
+      if (position < leaf->_count && !function_policy(key_data, leaf->_keys[position]))
+      {
+        return iterator(leaf, position);
+      }
+      return iterator();
+    }
+    iterator lower_bound(const btree_type_key &key_data)
+    {
+      // 第一个不小于 key_data 的元素
+      if (_root == nullptr)
+      {
+        return iterator();
+      }
+      uint32_t depth = 0;
+      leaf_node *leaf = descend(key_data, nullptr, depth);
+      const uint32_t position = lower_index(leaf->_keys, leaf->_count, key_data);
+      return position < leaf->_count ? iterator(leaf, position) : iterator(leaf->_next, 0);
+    }
+    iterator upper_bound(const btree_type_key &key_data)
+    {
+      // 第一个大于 key_data 的元素
+      if (_root == nullptr)
+      {
+        return iterator();
+      }
+      uint32_t depth = 0;
+      leaf_node *leaf = descend(key_data, nullptr, depth);
+      const uint32_t position = upper_index(leaf->_keys, leaf->_count, key_data);
+      return position < leaf->_count ? iterator(leaf, position) : iterator(leaf->_next, 0);
+    }
+    [[nodiscard]] uint64_t size() const noexcept
+    {
+      return _size;
+    }
+    [[nodiscard]] bool empty() const noexcept
+    {
+      return _size == 0;
+    }
+    void middle_order_traversal() const
+    {
+      // 顺序走叶链表
+      for (const leaf_node *leaf = _first_leaf; leaf != nullptr; leaf = leaf->_next)
+      {
+        for (uint32_t value_index = 0; value_index < leaf->_count; ++value_index)
+        {
+          std::cout << leaf->_values[value_index] << " ";
+        }
+      }
+    }
+    void pre_order_traversal() const
+    {
+      // 前序打印各节点的键，每个节点用方括号括起
+      if (_root == nullptr)
+      {
+        return;
+      }
+      const node_header *node_stack[max_depth * (max_keys + 2)];
+      uint64_t stack_size = 0;
+      node_stack[stack_size++] = _root;
+      while (stack_size != 0)
+      {
+        const node_header *current_node = node_stack[--stack_size];
+        const btree_type_key *keys = current_node->_is_leaf ? static_cast<const leaf_node *>(current_node)->_keys
+                                                             : static_cast<const inner_node *>(current_node)->_keys;
+        std::cout << "[";
+        for (uint32_t key_index = 0; key_index < current_node->_count; ++key_index)
+        {
+          std::cout << (key_index == 0 ? "" : " ") << keys[key_index];
+        }
+        std::cout << "] ";
+        if (!current_node->_is_leaf)
+        {
+          const auto *inner = static_cast<const inner_node *>(current_node);
+          for (uint32_t child_index = inner->_count + 1; child_index > 0; --child_index)
+          {
+            node_stack[stack_size++] = inner->_children[child_index - 1];
+          }
+        }
+      }
+    }
+    iterator begin() noexcept
+    {
+      return iterator(_first_leaf, 0);
+    }
+    static iterator end() noexcept
+    {
+      return iterator();
+    }
+    const_iterator cbegin() const noexcept
+    {
+      return const_iterator(_first_leaf, 0);
+    }
+    static const_iterator cend() noexcept
+    {
+      return const_iterator();
+    }
+    reverse_iterator rbegin() noexcept
+    {
+      return reverse_iterator(iterator(_last_leaf, _last_leaf == nullptr ? 0 : _last_leaf->_count - 1));
+    }
+    static reverse_iterator rend() noexcept
+    {
+      return reverse_iterator(iterator());
+    }
+    const_reverse_iterator crbegin() const noexcept
+    {
+      return const_reverse_iterator(const_iterator(_last_leaf, _last_leaf == nullptr ? 0 : _last_leaf->_count - 1));
+    }
+    static const_reverse_iterator crend() noexcept
+    {
+      return const_reverse_iterator(const_iterator());
+    }
+    iterator operator[](const btree_type_value &btree_data)
+    {
+      return find(btree_data);
+    }
+  };
+}
+namespace standard_con
+{
+  using btree_container::b_plus_tree;
+}
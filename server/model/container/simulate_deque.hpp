@@ -0,0 +1,498 @@
+#pragma once
+#include <memory>
+#include <cstring>
+#include <utility>
+#include <type_traits>
+#include <initializer_list>
+#include "simulate_exception.hpp"
+namespace deque_container
+{
+  /*
+   * @brief  #### `deque` 类模板
+
+      *   - 基于环形缓冲区的双端队列，元素存放在一块连续内存中，首尾插入删除均摊 O(1)
+
+      *   - 容量始终为 2 的幂，逻辑下标 i 对应物理位置 `(head + i) & (capacity - 1)`，回绕只需一次按位与
+
+      *   - 作为 `standard_con::queue` 的默认底层容器，入队出队不再逐个申请释放节点
+
+      * 模板参数:
+
+      * * - `deque_type`: 元素类型
+      *
+      * * - `deque_allocator`: 分配器类型，默认为 `std::allocator<deque_type>`，只负责原始内存，元素由容器按需原地构造
+
+      * 成员变量:
+
+      * * - `_buffer`: 环形缓冲区首地址
+      *
+      * * - `_capacity`: 缓冲区容量（0 或 2 的幂）
+      *
+      * * - `_head`: 首元素的物理位置
+      *
+      * * - `_size`: 元素个数
+
+      * 元素操作方法:
+
+      * * - `push_back()` / `push_front()` / `emplace_back()` / `emplace_front()`: 尾部 / 头部插入
+      *
+      * * - `pop_back()` / `pop_front()`: 尾部 / 头部删除，空容器时不做任何操作
+      *
+      * * - `front()` / `back()` / `operator[]`: 元素访问，`operator[]` 越界抛出异常
+      *
+      * * - `reserve()` / `clear()` / `swap()`: 容量与整体操作
+
+      * 扩容策略:
+
+      * * - 首次分配 8 个槽位，之后每次翻倍
+      *
+      * * - 扩容时按逻辑顺序迁移到新缓冲区并把首元素放回位置 0：可平凡复制类型按两段 memcpy，其余类型 move_if_noexcept
+
+      * 注意事项:
+
+      * * - 扩容后原有迭代器与引用全部失效
+      *
+      * * - 空容器调用 `front()` / `back()` 为未定义行为
+
+      * 详细请参考 https://github.com/Hatedatastructures/Custom-libraries/blob/main/template_container.md
+  */
+  template <typename deque_type, typename deque_allocator = std::allocator<deque_type>>
+  class deque
+  {
+    template <typename Ref, typename Ptr>
+    class deque_iterator
+    {
+      using self = deque_iterator<Ref, Ptr>;
+      deque_type *_buffer;
+      uint64_t _mask;
+      uint64_t _head;
+      uint64_t _index; // 逻辑下标
+
+    public:
+      using reference = Ref;
+      using pointer = Ptr;
+      deque_iterator(deque_type *buffer = nullptr, const uint64_t mask = 0, const uint64_t head = 0, const uint64_t index = 0) noexcept
+          : _buffer(buffer), _mask(mask), _head(head), _index(index)
+      {
+        ;
+      }
+      Ref &operator*() const noexcept
+      {
+        return _buffer[(_head + _index) & _mask];
+      }
+      Ptr operator->() const noexcept
+      {
+        return &_buffer[(_head + _index) & _mask];
+      }
+      Ref &operator[](const int64_t offset) const noexcept
+      {
+        return _buffer[(_head + _index + static_cast<uint64_t>(offset)) & _mask];
+      }
+      self &operator++() noexcept
+      {
+        ++_index;
+        return *this;
+      }
+      self operator++(int) noexcept
+      {
+        self previously_iterator = *this;
+        ++_index;
+        return previously_iterator;
+      }
+      self &operator--() noexcept
+      {
+        --_index;
+        return *this;
+      }
+      self operator--(int) noexcept
+      {
+        self previously_iterator = *this;
+        --_index;
+        return previously_iterator;
+      }
+      self &operator+=(const int64_t offset) noexcept
+      {
+        _index += static_cast<uint64_t>(offset);
+        return *this;
+      }
+      self &operator-=(const int64_t offset) noexcept
+      {
+        _index -= static_cast<uint64_t>(offset);
+        return *this;
+      }
+      self operator+(const int64_t offset) const noexcept
+      {
+        self result = *this;
+        return result += offset;
+      }
+      self operator-(const int64_t offset) const noexcept
+      {
+        self result = *this;
+        return result -= offset;
+      }
+      int64_t operator-(const self &other) const noexcept
+      {
+        return static_cast<int64_t>(_index - other._index);
+      }
+      bool operator==(const self &other) const noexcept
+      {
+        return _index == other._index && _buffer == other._buffer;
+      }
+      bool operator!=(const self &other) const noexcept
+      {
+        return !(*this == other);
+      }
+      bool operator<(const self &other) const noexcept
+      {
+        return _index < other._index;
+      }
+    };
+
+  public:
+    using iterator = deque_iterator<deque_type, deque_type *>;
+    using const_iterator = deque_iterator<const deque_type, const deque_type *>;
+    using allocator_type = deque_allocator;
+
+  private:
+    using allocator_traits = std::allocator_traits<deque_allocator>;
+    static constexpr bool bitwise_relocatable = std::is_trivially_copyable_v<deque_type>;
+    static constexpr uint64_t initial_capacity = 8;
+
+    deque_type *_buffer = nullptr;
+    uint64_t _capacity = 0;
+    uint64_t _head = 0;
+    uint64_t _size = 0;
+    [[no_unique_address]] deque_allocator _allocator;
+
+    [[nodiscard]] uint64_t physical(const uint64_t logical_index) const noexcept
+    {
+      return (_head + logical_index) & (_capacity - 1);
+    }
+    void destroy_all() noexcept
+    {
+      if constexpr (!std::is_trivially_destructible_v<deque_type>)
+      {
+        for (uint64_t logical_index = 0; logical_index < _size; ++logical_index)
+        {
+          allocator_traits::destroy(_allocator, _buffer + physical(logical_index));
+        }
+      }
+      _size = 0;
+      _head = 0;
+    }
+    void deallocate_storage() noexcept
+    {
+      if (_buffer != nullptr)
+      {
+        allocator_traits::deallocate(_allocator, _buffer, _capacity);
+      }
+      _buffer = nullptr;
+      _capacity = 0;
+    }
+    // 按逻辑顺序把元素迁移到 destination[0, size)，失败时析构已构造部分，原元素保持不变
+    void relocate_into(deque_type *destination)
+    {
+      if (_size == 0)
+      {
+        return;
+      }
+      if constexpr (bitwise_relocatable)
+      {
+        const uint64_t first_segment = _capacity - _head < _size ? _capacity - _head : _size;
+        std::memcpy(static_cast<void *>(destination), static_cast<const void *>(_buffer + _head), first_segment * sizeof(deque_type));
+        std::memcpy(static_cast<void *>(destination + first_segment), static_cast<const void *>(_buffer), (_size - first_segment) * sizeof(deque_type));
+      }
+      else
+      {
+        uint64_t constructed_count = 0;
+        try
+        {
+          for (; constructed_count < _size; ++constructed_count)
+          {
+            allocator_traits::construct(_allocator, destination + constructed_count, std::move_if_noexcept(_buffer[physical(constructed_count)]));
+          }
+        }
+        catch (...)
+        {
+          for (uint64_t destroy_index = 0; destroy_index < constructed_count; ++destroy_index)
+          {
+            allocator_traits::destroy(_allocator, destination + destroy_index);
+          }
+          throw;
+        }
+        for (uint64_t logical_index = 0; logical_index < _size; ++logical_index)
+        {
+          allocator_traits::destroy(_allocator, _buffer + physical(logical_index));
+        }
+      }
+    }
+    // 扩容：先在新缓冲区 new_element_slot 处构造新元素（参数可能引用旧缓冲区中的元素），再迁移旧元素
+    template <typename... Args>
+    deque_type &grow_and_emplace(const bool at_front, Args &&...args)
+    {
+      const uint64_t new_capacity = _capacity == 0 ? initial_capacity : _capacity * 2;
+      deque_type *new_buffer = allocator_traits::allocate(_allocator, new_capacity);
+      const uint64_t new_element_slot = at_front ? new_capacity - 1 : _size;
+      try
+      {
+        allocator_traits::construct(_allocator, new_buffer + new_element_slot, std::forward<Args>(args)...);
+        try
+        {
+          relocate_into(new_buffer);
+        }
+        catch (...)
+        {
+          allocator_traits::destroy(_allocator, new_buffer + new_element_slot);
+          throw;
+        }
+      }
+      catch (...)
+      {
+        allocator_traits::deallocate(_allocator, new_buffer, new_capacity);
+        throw;
+      }
+      deallocate_storage();
+      _buffer = new_buffer;
+      _capacity = new_capacity;
+      _head = at_front ? new_element_slot : 0;
+      ++_size;
+      return _buffer[new_element_slot];
+    }
+    void check_index(const uint64_t &access_location) const
+    {
+      try
+      {
+        if (access_location >= _size)
+        {
+          throw custom_exception::fault("传入参数越界", "deque::operator[]", __LINE__);
+        }
+      }
+      catch (const custom_exception::fault &process)
+      {
+        std::cerr << process.what() << " " << process.function_name_get() << " " << process.line_number_get() << std::endl;
+        throw;
+      }
+    }
+
+  public:
+    deque() noexcept = default;
+    deque(std::initializer_list<deque_type> lightweight_container)
+    {
+      reserve(lightweight_container.size());
+      for (auto &chained_values : lightweight_container)
+      {
+        emplace_back(chained_values);
+      }
+    }
+    deque(const deque &deque_data)
+        : _allocator(allocator_traits::select_on_container_copy_construction(deque_data._allocator))
+    {
+      reserve(deque_data._size);
+      for (uint64_t logical_index = 0; logical_index < deque_data._size; ++logical_index)
+      {
+        emplace_back(deque_data[logical_index]);
+      }
+    }
+    deque(deque &&deque_data) noexcept
+        : _buffer(deque_data._buffer), _capacity(deque_data._capacity), _head(deque_data._head), _size(deque_data._size),
+          _allocator(std::move(deque_data._allocator))
+    {
+      deque_data._buffer = nullptr;
+      deque_data._capacity = deque_data._head = deque_data._size = 0;
+    }
+    ~deque() noexcept
+    {
+      destroy_all();
+      deallocate_storage();
+    }
+    deque &operator=(const deque &deque_data)
+    {
+      if (this != &deque_data)
+      {
+        deque copy_deque(deque_data);
+        swap(copy_deque);
+      }
+      return *this;
+    }
+    deque &operator=(deque &&deque_data) noexcept
+    {
+      if (this != &deque_data)
+      {
+        destroy_all();
+        deallocate_storage();
+        swap(deque_data);
+      }
+      return *this;
+    }
+    void swap(deque &deque_data) noexcept
+    {
+      std::swap(_buffer, deque_data._buffer);
+      std::swap(_capacity, deque_data._capacity);
+      std::swap(_head, deque_data._head);
+      std::swap(_size, deque_data._size);
+      std::swap(_allocator, deque_data._allocator);
+    }
+    template <typename... Args>
+    deque_type &emplace_back(Args &&...args)
+    {
+      if (_size == _capacity)
+      {
+        return grow_and_emplace(false, std::forward<Args>(args)...);
+      }
+      deque_type *slot = _buffer + physical(_size);
+      allocator_traits::construct(_allocator, slot, std::forward<Args>(args)...);
+      ++_size;
+      return *slot;
+    }
+    template <typename... Args>
+    deque_type &emplace_front(Args &&...args)
+    {
+      if (_size == _capacity)
+      {
+        return grow_and_emplace(true, std::forward<Args>(args)...);
+      }
+      const uint64_t new_head = (_head - 1) & (_capacity - 1);
+      allocator_traits::construct(_allocator, _buffer + new_head, std::forward<Args>(args)...);
+      _head = new_head;
+      ++_size;
+      return _buffer[new_head];
+    }
+    deque &push_back(const deque_type &deque_type_data)
+    {
+      emplace_back(deque_type_data);
+      return *this;
+    }
+    deque &push_back(deque_type &&deque_type_data)
+    {
+      emplace_back(std::move(deque_type_data));
+      return *this;
+    }
+    deque &push_front(const deque_type &deque_type_data)
+    {
+      emplace_front(deque_type_data);
+      return *this;
+    }
+    deque &push_front(deque_type &&deque_type_data)
+    {
+      emplace_front(std::move(deque_type_data));
+      return *this;
+    }
+    deque &pop_back() noexcept
+    {
+      if (_size != 0)
+      {
+        --_size;
+        allocator_traits::destroy(_allocator, _buffer + physical(_size));
+      }
+      return *this;
+    }
+    deque &pop_front() noexcept
+    {
+      if (_size != 0)
+      {
+        allocator_traits::destroy(_allocator, _buffer + _head);
+        _head = (_head + 1) & (_capacity - 1);
+        --_size;
+      }
+      return *this;
+    }
+    [[nodiscard]] deque_type &front() noexcept
+    {
+      return _buffer[_head];
+    }
+    [[nodiscard]] const deque_type &front() const noexcept
+    {
+      return _buffer[_head];
+    }
+    [[nodiscard]] deque_type &back() noexcept
+    {
+      return _buffer[physical(_size - 1)];
+    }
+    [[nodiscard]] const deque_type &back() const noexcept
+    {
+      return _buffer[physical(_size - 1)];
+    }
+    deque_type &operator[](const uint64_t &access_location)
+    {
+      check_index(access_location);
+      return _buffer[physical(access_location)];
+    }
+    const deque_type &operator[](const uint64_t &access_location) const
+    {
+      check_index(access_location);
+      return _buffer[physical(access_location)];
+    }
+    deque &reserve(const uint64_t &new_container_capacity)
+    {
+      if (new_container_capacity <= _capacity)
+      {
+        return *this;
+      }
+      uint64_t new_capacity = _capacity == 0 ? initial_capacity : _capacity;
+      while (new_capacity < new_container_capacity)
+      {
+        new_capacity *= 2;
+      }
+      deque_type *new_buffer = allocator_traits::allocate(_allocator, new_capacity);
+      try
+      {
+        relocate_into(new_buffer);
+      }
+      catch (...)
+      {
+        allocator_traits::deallocate(_allocator, new_buffer, new_capacity);
+        throw;
+      }
+      deallocate_storage();
+      _buffer = new_buffer;
+      _capacity = new_capacity;
+      _head = 0;
+      return *this;
+    }
+    void clear() noexcept
+    {
+      // 只析构元素，保留缓冲区
+      destroy_all();
+    }
+    [[nodiscard]] uint64_t size() const noexcept
+    {
+      return _size;
+    }
+    [[nodiscard]] uint64_t capacity() const noexcept
+    {
+      return _capacity;
+    }
+    [[nodiscard]] bool empty() const noexcept
+    {
+      return _size == 0;
+    }
+    [[nodiscard]] iterator begin() noexcept
+    {
+      return iterator(_buffer, _capacity - 1, _head, 0);
+    }
+    [[nodiscard]] iterator end() noexcept
+    {
+      return iterator(_buffer, _capacity - 1, _head, _size);
+    }
+    [[nodiscard]] const_iterator begin() const noexcept
+    {
+      return const_iterator(_buffer, _capacity - 1, _head, 0);
+    }
+    [[nodiscard]] const_iterator end() const noexcept
+    {
+      return const_iterator(_buffer, _capacity - 1, _head, _size);
+    }
+    [[nodiscard]] const_iterator cbegin() const noexcept
+    {
+      return begin();
+    }
+    [[nodiscard]] const_iterator cend() const noexcept
+    {
+      return end();
+    }
+  };
+}
+namespace standard_con
+{
+  using deque_container::deque;
+}
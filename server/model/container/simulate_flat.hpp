@@ -0,0 +1,352 @@
+#pragma once
+#include <memory>
+#include <cstdint>
+#include <utility>
+#include <iterator>
+#include <iostream>
+#include <type_traits>
+#include <initializer_list>
+#include "simulate_imitate.hpp"
+#include "simulate_utility.hpp"
+#include "simulate_vector.hpp"
+#include "simulate_algorithm.hpp"
+namespace flat_container
+{
+  /*
+      * @brief  #### `flat_tree` 类模板
+
+      *   - 有序数组实现的关联容器内核，元素按键升序连续存放在 `standard_con::vector` 中，供 `flat_map` / `flat_set` 复用
+
+      *   - 没有节点与指针开销，查找只访问 log2(n) 个连续位置；小规模、读多写少的查表（扩展名、头部字段名、上游列表）比树和链式哈希更省内存、更少缓存未命中
+
+      *   - 查找使用 `algorithm::lower_bound` 的无分支二分，比较结果编译为条件传送，循环次数只取决于元素个数
+
+      * 模板参数:
+
+      * * - `flat_type_key`: 键的类型，用于排序
+      *
+      * * - `flat_type_value`: 数组中存储的值类型（键值对或键本身，需可移动赋值）
+      *
+      * * - `container_imitate_function_visit`: 访问器类型，用于从值中提取键
+      *
+      * * - `container_imitate_function`: 比较器类型，默认为 `standard_con::less<flat_type_key>`
+      *
+      * * - `flat_allocator`: 分配器类型，默认为 `std::allocator<flat_type_value>`，直接交给底层 `vector`
+
+      * 主要操作方法:
+
+      * * - `push()`: 插入单个值，二分定位后把其后的元素整体后移一位，O(n)；键已存在时返回已有位置和 `false`
+      *
+      * * - `push_bulk()`: 批量插入，先整批追加到尾部，排序、去重后与原有序区间从后向前原地归并，O(n + k log k)
+      *
+      * * - `pop()` / `erase()`: 删除指定值对应的键 / 指定位置的元素，后续元素前移
+      *
+      * * - `find()` / `find_key()`: 按值 / 按键查找，未找到返回 `end()`
+      *
+      * * - `lower_bound()` / `upper_bound()`: 按键定位第一个不小于 / 大于给定键的元素
+      *
+      * * - `reserve()` / `clear()`: 预留容量 / 清空元素并保留容量
+
+      * 批量插入说明:
+
+      * * - 整数键配合默认 `less` 比较器、且值可默认构造时，批次用 `radix_sort` 排序，其余情况用 `sort`
+      *
+      * * - 批内重复键只保留一个，保留哪一个不作保证；与已有键重复的元素被丢弃，已有元素不被覆盖（与 `push()` 一致）
+      *
+      * * - 归并只需要一个批次大小的临时缓冲，原有元素不整体搬迁
+
+      * 注意事项:
+
+      * * - 迭代器即元素指针，任何插入、删除之后之前取得的迭代器全部失效
+      *
+      * * - 通过迭代器修改键会破坏有序性，只应修改值部分
+      *
+      * * - 频繁单点插入、元素规模较大时应改用 `tree_map` / `btree_map` 或哈希容器
+  */
+  template <typename flat_type_key, typename flat_type_value, typename container_imitate_function_visit,
+            typename container_imitate_function = standard_con::less<flat_type_key>,
+            typename flat_allocator = std::allocator<flat_type_value>>
+  class flat_tree
+  {
+    using storage_type = standard_con::vector<flat_type_value, flat_allocator>;
+    static constexpr bool radix_sortable = std::is_same_v<container_imitate_function, standard_con::less<flat_type_key>> &&
+                                           std::is_integral_v<flat_type_key> && !std::is_same_v<flat_type_key, bool> &&
+                                           std::is_default_constructible_v<flat_type_value>;
+
+    storage_type _storage;
+    mutable container_imitate_function_visit element;
+    mutable container_imitate_function function_policy;
+
+  public:
+    using iterator = typename storage_type::iterator;
+    using const_iterator = typename storage_type::const_iterator;
+    using return_pair_value = standard_con::pair<iterator, bool>;
+    using allocator_type = flat_allocator;
+
+  private:
+    [[nodiscard]] bool key_less(const flat_type_value &left_value, const flat_type_value &right_value) const
+    {
+      return function_policy(element(left_value), element(right_value));
+    }
+    iterator key_lower_bound(iterator first_position, iterator last_position, const flat_type_key &key_data) const
+    {
+      return standard_con::algorithm::lower_bound(first_position, last_position, key_data,
+                                                  [this](const flat_type_value &value_data, const flat_type_key &target)
+                                                  { return function_policy(element(value_data), target); });
+    }
+    template <typename value_data_type>
+    return_pair_value insert_unique(value_data_type &&value_data)
+    {
+      iterator position = key_lower_bound(_storage.begin(), _storage.end(), element(value_data));
+      if (position != _storage.end() && !function_policy(element(value_data), element(*position)))
+      {
+        return return_pair_value(position, false);
+      }
+      // 先追加到尾部（可能扩容），再把 [position, 尾) 整体后移一位腾出插入位置
+      const uint64_t insert_index = position - _storage.begin();
+      _storage.emplace_back(std::forward<value_data_type>(value_data));
+      iterator first_position = _storage.begin() + insert_index;
+      iterator last_position = _storage.end() - 1;
+      if (first_position != last_position)
+      {
+        flat_type_value inserted_value(std::move(*last_position));
+        for (; last_position != first_position; --last_position)
+        {
+          *last_position = std::move(*(last_position - 1));
+        }
+        *first_position = std::move(inserted_value);
+      }
+      return return_pair_value(first_position, true);
+    }
+    iterator sort_unique(iterator first_position, iterator last_position)
+    {
+      // 排序后相邻去重，返回去重后的尾位置
+      if (first_position == last_position)
+      {
+        return last_position;
+      }
+      if constexpr (radix_sortable)
+      {
+        standard_con::algorithm::radix_sort(first_position, last_position,
+                                            [this](const flat_type_value &value_data)
+                                            { return element(value_data); });
+      }
+      else
+      {
+        standard_con::algorithm::sort(first_position, last_position,
+                                      [this](const flat_type_value &left_value, const flat_type_value &right_value)
+                                      { return key_less(left_value, right_value); });
+      }
+      iterator write_position = first_position;
+      for (iterator read_position = first_position + 1; read_position != last_position; ++read_position)
+      {
+        if (key_less(*write_position, *read_position))
+        {
+          ++write_position;
+          if (write_position != read_position)
+          {
+            *write_position = std::move(*read_position);
+          }
+        }
+      }
+      return write_position + 1;
+    }
+    void merge_tail(const uint64_t original_size)
+    {
+      // [0, original_size) 为原有序区间，其后为本批新元素
+      iterator batch_end = sort_unique(_storage.begin() + original_size, _storage.end());
+      _storage.erase(batch_end, _storage.end());
+      if (original_size == 0 || _storage.size() == original_size)
+      {
+        return;
+      }
+      iterator original_end = _storage.begin() + original_size;
+      if (key_less(*(original_end - 1), *original_end))
+      {
+        return; // 整批都大于已有元素，追加即有序
+      }
+      // 剔除与已有键重复的元素，剩余的移入临时缓冲；两侧都有序，已有区间的查找起点单调前进
+      storage_type batch_buffer(_storage.get_allocator());
+      batch_buffer.reserve(_storage.size() - original_size);
+      iterator search_position = _storage.begin();
+      for (iterator batch_position = original_end; batch_position != _storage.end(); ++batch_position)
+      {
+        search_position = key_lower_bound(search_position, original_end, element(*batch_position));
+        if (search_position == original_end || function_policy(element(*batch_position), element(*search_position)))
+        {
+          batch_buffer.push_back(std::move(*batch_position));
+        }
+      }
+      _storage.erase(original_end + batch_buffer.size(), _storage.end());
+      // 从后向前归并：写入位置总在两个读取位置之后，不会覆盖尚未读取的元素
+      iterator write_position = _storage.end();
+      iterator original_position = original_end;
+      iterator buffer_position = batch_buffer.end();
+      while (buffer_position != batch_buffer.begin())
+      {
+        if (original_position != _storage.begin() && key_less(*(buffer_position - 1), *(original_position - 1)))
+        {
+          *--write_position = std::move(*--original_position);
+        }
+        else
+        {
+          *--write_position = std::move(*--buffer_position);
+        }
+      }
+    }
+
+  public:
+    flat_tree() noexcept = default;
+    explicit flat_tree(const flat_allocator &allocator_data) noexcept : _storage(allocator_data) {}
+    flat_tree(std::initializer_list<flat_type_value> lightweight_container, const flat_allocator &allocator_data = flat_allocator())
+        : _storage(allocator_data)
+    {
+      push_bulk(lightweight_container.begin(), lightweight_container.end());
+    }
+    flat_tree(const flat_tree &flat_data) = default;
+    flat_tree(flat_tree &&flat_data) noexcept = default;
+    flat_tree &operator=(const flat_tree &flat_data) = default;
+    flat_tree &operator=(flat_tree &&flat_data) noexcept = default;
+    ~flat_tree() noexcept = default;
+
+    [[nodiscard]] allocator_type get_allocator() const noexcept
+    {
+      return _storage.get_allocator();
+    }
+    return_pair_value push(const flat_type_value &flat_data)
+    {
+      return insert_unique(flat_data);
+    }
+    return_pair_value push(flat_type_value &&flat_data)
+    {
+      return insert_unique(std::move(flat_data));
+    }
+    template <typename input_iterator>
+    void push_bulk(input_iterator first_position, input_iterator last_position)
+    {
+      const uint64_t original_size = _storage.size();
+      try
+      {
+        if constexpr (std::random_access_iterator<input_iterator>)
+        {
+          _storage.reserve(original_size + static_cast<uint64_t>(last_position - first_position));
+        }
+        for (; first_position != last_position; ++first_position)
+        {
+          _storage.push_back(*first_position);
+        }
+        merge_tail(original_size);
+      }
+      catch (...)
+      {
+        // 追加、排序或申请缓冲失败时撤回本批，这些步骤都发生在归并之前，已有元素不受影响
+        _storage.erase(_storage.begin() + original_size, _storage.end());
+        throw;
+      }
+    }
+    void push_bulk(std::initializer_list<flat_type_value> lightweight_container)
+    {
+      push_bulk(lightweight_container.begin(), lightweight_container.end());
+    }
+    return_pair_value pop(const flat_type_value &flat_data)
+    {
+      iterator position = find(flat_data);
+      if (position == _storage.end())
+      {
+        return return_pair_value(position, false);
+      }
+      return return_pair_value(_storage.erase(position), true);
+    }
+    iterator erase(iterator position) noexcept
+    {
+      return _storage.erase(position);
+    }
+    iterator find_key(const flat_type_key &key_data)
+    {
+      iterator position = lower_bound(key_data);
+      if (position != _storage.end() && !function_policy(key_data, element(*position)))
+      {
+        return position;
+      }
+      return _storage.end();
+    }
+    iterator find(const flat_type_value &flat_data)
+    {
+      return find_key(element(flat_data));
+    }
+    iterator lower_bound(const flat_type_key &key_data)
+    {
+      return key_lower_bound(_storage.begin(), _storage.end(), key_data);
+    }
+    iterator upper_bound(const flat_type_key &key_data)
+    {
+      return standard_con::algorithm::upper_bound(_storage.begin(), _storage.end(), key_data,
+                                                  [this](const flat_type_key &target, const flat_type_value &value_data)
+                                                  { return function_policy(target, element(value_data)); });
+    }
+    flat_tree &reserve(const uint64_t &new_capacity)
+    {
+      _storage.reserve(new_capacity);
+      return *this;
+    }
+    void clear() noexcept
+    {
+      _storage.clear();
+    }
+    void swap(flat_tree &flat_data) noexcept
+    {
+      _storage.swap(flat_data._storage);
+    }
+    [[nodiscard]] uint64_t size() const noexcept
+    {
+      return _storage.size();
+    }
+    [[nodiscard]] uint64_t capacity() const noexcept
+    {
+      return _storage.capacity();
+    }
+    [[nodiscard]] bool empty() const noexcept
+    {
+      return _storage.empty();
+    }
+    iterator begin() noexcept
+    {
+      return _storage.begin();
+    }
+    iterator end() noexcept
+    {
+      return _storage.end();
+    }
+    const_iterator begin() const noexcept
+    {
+      return _storage.begin();
+    }
+    const_iterator end() const noexcept
+    {
+      return _storage.end();
+    }
+    const_iterator cbegin() const noexcept
+    {
+      return _storage.begin();
+    }
+    const_iterator cend() const noexcept
+    {
+      return _storage.end();
+    }
+    void middle_order_traversal() const
+    {
+      for (const flat_type_value &value_data : _storage)
+      {
+        std::cout << value_data << " ";
+      }
+    }
+    iterator operator[](const flat_type_value &flat_data)
+    {
+      return find(flat_data);
+    }
+  };
+}
+namespace standard_con
+{
+  using flat_container::flat_tree;
+}
@@ -1,85 +1,451 @@
 #pragma once
+#include <bit>
+#include <chrono>
+#include <random>
+#include <string>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <type_traits>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#endif
 #include "simulate_string.hpp"
 namespace hash
 {
+  /*
+   * @brief  #### `hash_kernel` 哈希内核命名空间
+
+  *   - `hash_bytes(data, length, seed)`: 任意字节序列的 64 位哈希，短输入走 wyhash 结构（128 位乘法折叠），
+
+  *     512 字节以上的长输入走 xxh3 式条带累加（8 条 64 位累加通道，SSE2 / AVX2 并行，无指令集时退化为标量，三者结果一致）
+
+  *   - `hash_integer(value, seed)`: 整数的带种子哈希，一次 128 位乘法折叠
+
+  *   - `process_seed()`: 进程级随机种子，首次调用时由 `std::random_device` 与时钟生成，用于抵御针对请求数据的哈希洪水攻击
+
+   * 注意事项:
+
+   * * - 结构与 wyhash / xxh3 相同但常量与分块方式不同，结果不与官方实现兼容，不能用于持久化或跨进程比对
+   *
+   * * - 相同种子下结果确定；不同种子之间结果无关联
+  */
+  namespace hash_kernel
+  {
+    inline constexpr uint64_t secret[4] = {0x2d358dccaa6c78a5ULL, 0x8bb84b93962eacc9ULL, 0x4b33a62ed433d4a3ULL, 0x4d5a2da51de1aa47ULL};
+    inline constexpr uint64_t bulk_threshold = 512;  // 达到该长度才走条带累加
+    inline constexpr uint64_t stripe_bytes = 64;     // 每条带 8 个 64 位字
+    inline constexpr uint64_t stripes_per_block = 16; // 每块条带数，块尾打散一次累加器
+    inline constexpr uint64_t prime32 = 0x9e3779b1ULL;
+
+    // 条带累加使用的密钥：相邻条带错开一个字，共 8 + 15 + 8 个字（最后 8 个用于块尾打散）
+    inline constexpr auto stripe_secret = []
+    {
+      struct secret_table
+      {
+        uint64_t _words[31];
+      } table{};
+      uint64_t state = 0x243f6a8885a308d3ULL;
+      for (auto &word : table._words)
+      {
+        // splitmix64
+        state += 0x9e3779b97f4a7c15ULL;
+        uint64_t mixed = state;
+        mixed = (mixed ^ (mixed >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        mixed = (mixed ^ (mixed >> 27)) * 0x94d049bb133111ebULL;
+        word = mixed ^ (mixed >> 31);
+      }
+      return table;
+    }();
+
+    inline void multiply_fold(uint64_t &low_value, uint64_t &high_value) noexcept
+    {
+      // 64 x 64 -> 128 位乘法，低 64 位写回 low_value，高 64 位写回 high_value
+#if defined(__SIZEOF_INT128__)
+      const unsigned __int128 product = static_cast<unsigned __int128>(low_value) * high_value;
+      low_value = static_cast<uint64_t>(product);
+      high_value = static_cast<uint64_t>(product >> 64);
+#else
+      const uint64_t left_high = low_value >> 32, left_low = static_cast<uint32_t>(low_value);
+      const uint64_t right_high = high_value >> 32, right_low = static_cast<uint32_t>(high_value);
+      const uint64_t high_high = left_high * right_high, high_low = left_high * right_low;
+      const uint64_t low_high = left_low * right_high, low_low = left_low * right_low;
+      const uint64_t middle = (low_low >> 32) + static_cast<uint32_t>(high_low) + static_cast<uint32_t>(low_high);
+      low_value = (middle << 32) | static_cast<uint32_t>(low_low);
+      high_value = high_high + (high_low >> 32) + (low_high >> 32) + (middle >> 32);
+#endif
+    }
+    [[nodiscard]] inline uint64_t mix(uint64_t left_value, uint64_t right_value) noexcept
+    {
+      multiply_fold(left_value, right_value);
+      return left_value ^ right_value;
+    }
+    [[nodiscard]] inline uint64_t read64(const unsigned char *data) noexcept
+    {
+      uint64_t value;
+      std::memcpy(&value, data, sizeof(value));
+      if constexpr (std::endian::native == std::endian::big)
+      {
+        value = __builtin_bswap64(value);
+      }
+      return value;
+    }
+    [[nodiscard]] inline uint64_t read32(const unsigned char *data) noexcept
+    {
+      uint32_t value;
+      std::memcpy(&value, data, sizeof(value));
+      if constexpr (std::endian::native == std::endian::big)
+      {
+        value = __builtin_bswap32(value);
+      }
+      return value;
+    }
+    [[nodiscard]] inline uint64_t short_hash(const unsigned char *data, const uint64_t length, uint64_t seed) noexcept
+    {
+      // wyhash 结构：16 字节以内两次重叠读取，更长时每轮吞 16 / 48 字节
+      seed ^= mix(seed ^ secret[0], secret[1]);
+      uint64_t first_word;
+      uint64_t second_word;
+      if (length <= 16)
+      {
+        if (length >= 4)
+        {
+          const uint64_t shift = (length >> 3) << 2;
+          first_word = (read32(data) << 32) | read32(data + shift);
+          second_word = (read32(data + length - 4) << 32) | read32(data + length - 4 - shift);
+        }
+        else if (length > 0)
+        {
+          first_word = (static_cast<uint64_t>(data[0]) << 16) | (static_cast<uint64_t>(data[length >> 1]) << 8) | data[length - 1];
+          second_word = 0;
+        }
+        else
+        {
+          first_word = second_word = 0;
+        }
+      }
+      else
+      {
+        uint64_t remaining = length;
+        if (remaining > 48)
+        {
+          uint64_t second_seed = seed;
+          uint64_t third_seed = seed;
+          do
+          {
+            seed = mix(read64(data) ^ secret[1], read64(data + 8) ^ seed);
+            second_seed = mix(read64(data + 16) ^ secret[2], read64(data + 24) ^ second_seed);
+            third_seed = mix(read64(data + 32) ^ secret[3], read64(data + 40) ^ third_seed);
+            data += 48;
+            remaining -= 48;
+          } while (remaining > 48);
+          seed ^= second_seed ^ third_seed;
+        }
+        while (remaining > 16)
+        {
+          seed = mix(read64(data) ^ secret[1], read64(data + 8) ^ seed);
+          data += 16;
+          remaining -= 16;
+        }
+        first_word = read64(data + remaining - 16);
+        second_word = read64(data + remaining - 8);
+      }
+      first_word ^= secret[1];
+      second_word ^= seed;
+      multiply_fold(first_word, second_word);
+      return mix(first_word ^ secret[0] ^ length, second_word ^ secret[1]);
+    }
+    inline void accumulate_stripe_scalar(uint64_t (&accumulator)[8], const unsigned char *data, const uint64_t *key, const uint64_t seed) noexcept
+    {
+      for (uint64_t lane = 0; lane < 8; ++lane)
+      {
+        const uint64_t data_word = read64(data + lane * 8);
+        const uint64_t key_word = data_word ^ (key[lane] + seed);
+        accumulator[lane ^ 1] += data_word;
+        accumulator[lane] += (key_word & 0xffffffffULL) * (key_word >> 32);
+      }
+    }
+    inline void scramble_scalar(uint64_t (&accumulator)[8], const uint64_t *key, const uint64_t seed) noexcept
+    {
+      for (uint64_t lane = 0; lane < 8; ++lane)
+      {
+        uint64_t value = accumulator[lane];
+        value ^= value >> 47;
+        value ^= key[lane] + seed;
+        accumulator[lane] = value * prime32;
+      }
+    }
+    [[nodiscard]] inline uint64_t bulk_hash(const unsigned char *data, const uint64_t length, const uint64_t seed) noexcept
+    {
+      // xxh3 式条带累加：每条带 8 个字，字内高低 32 位相乘累加到本通道，原始数据累加到相邻通道
+      alignas(32) uint64_t accumulator[8] = {secret[0], secret[1], secret[2], secret[3], prime32, ~secret[0], ~secret[1], seed};
+      const uint64_t stripe_count = length / stripe_bytes;
+      const uint64_t *scramble_key = stripe_secret._words + 23;
+      uint64_t stripe_index = 0;
+#if defined(__AVX2__)
+      __m256i vector_accumulator[2] = {_mm256_load_si256(reinterpret_cast<const __m256i *>(accumulator)),
+                                       _mm256_load_si256(reinterpret_cast<const __m256i *>(accumulator + 4))};
+      const __m256i vector_seed = _mm256_set1_epi64x(static_cast<long long>(seed));
+      const __m256i vector_prime = _mm256_set1_epi64x(static_cast<long long>(prime32));
+      while (stripe_index < stripe_count)
+      {
+        const uint64_t block_end = stripe_index + stripes_per_block < stripe_count ? stripe_index + stripes_per_block : stripe_count;
+        for (; stripe_index < block_end; ++stripe_index)
+        {
+          const unsigned char *stripe = data + stripe_index * stripe_bytes;
+          const uint64_t *key = stripe_secret._words + stripe_index % stripes_per_block;
+          for (uint64_t half = 0; half < 2; ++half)
+          {
+            const __m256i data_vector = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(stripe + half * 32));
+            const __m256i key_vector = _mm256_add_epi64(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(key + half * 4)), vector_seed);
+            const __m256i data_key = _mm256_xor_si256(data_vector, key_vector);
+            const __m256i product = _mm256_mul_epu32(data_key, _mm256_srli_epi64(data_key, 32));
+            const __m256i swapped = _mm256_shuffle_epi32(data_vector, 0x4e); // 交换相邻 64 位通道
+            vector_accumulator[half] = _mm256_add_epi64(vector_accumulator[half], _mm256_add_epi64(product, swapped));
+          }
+        }
+        if (block_end % stripes_per_block == 0)
+        {
+          for (uint64_t half = 0; half < 2; ++half)
+          {
+            __m256i value = vector_accumulator[half];
+            value = _mm256_xor_si256(value, _mm256_srli_epi64(value, 47));
+            value = _mm256_xor_si256(value, _mm256_add_epi64(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(scramble_key + half * 4)), vector_seed));
+            const __m256i low_product = _mm256_mul_epu32(value, vector_prime);
+            const __m256i high_product = _mm256_mul_epu32(_mm256_srli_epi64(value, 32), vector_prime);
+            vector_accumulator[half] = _mm256_add_epi64(low_product, _mm256_slli_epi64(high_product, 32));
+          }
+        }
+      }
+      _mm256_store_si256(reinterpret_cast<__m256i *>(accumulator), vector_accumulator[0]);
+      _mm256_store_si256(reinterpret_cast<__m256i *>(accumulator + 4), vector_accumulator[1]);
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+      __m128i vector_accumulator[4];
+      for (uint64_t quarter = 0; quarter < 4; ++quarter)
+      {
+        vector_accumulator[quarter] = _mm_load_si128(reinterpret_cast<const __m128i *>(accumulator + quarter * 2));
+      }
+      const __m128i vector_seed = _mm_set1_epi64x(static_cast<long long>(seed));
+      const __m128i vector_prime = _mm_set1_epi64x(static_cast<long long>(prime32));
+      while (stripe_index < stripe_count)
+      {
+        const uint64_t block_end = stripe_index + stripes_per_block < stripe_count ? stripe_index + stripes_per_block : stripe_count;
+        for (; stripe_index < block_end; ++stripe_index)
+        {
+          const unsigned char *stripe = data + stripe_index * stripe_bytes;
+          const uint64_t *key = stripe_secret._words + stripe_index % stripes_per_block;
+          for (uint64_t quarter = 0; quarter < 4; ++quarter)
+          {
+            const __m128i data_vector = _mm_loadu_si128(reinterpret_cast<const __m128i *>(stripe + quarter * 16));
+            const __m128i key_vector = _mm_add_epi64(_mm_loadu_si128(reinterpret_cast<const __m128i *>(key + quarter * 2)), vector_seed);
+            const __m128i data_key = _mm_xor_si128(data_vector, key_vector);
+            const __m128i product = _mm_mul_epu32(data_key, _mm_srli_epi64(data_key, 32));
+            const __m128i swapped = _mm_shuffle_epi32(data_vector, 0x4e);
+            vector_accumulator[quarter] = _mm_add_epi64(vector_accumulator[quarter], _mm_add_epi64(product, swapped));
+          }
+        }
+        if (block_end % stripes_per_block == 0)
+        {
+          for (uint64_t quarter = 0; quarter < 4; ++quarter)
+          {
+            __m128i value = vector_accumulator[quarter];
+            value = _mm_xor_si128(value, _mm_srli_epi64(value, 47));
+            value = _mm_xor_si128(value, _mm_add_epi64(_mm_loadu_si128(reinterpret_cast<const __m128i *>(scramble_key + quarter * 2)), vector_seed));
+            const __m128i low_product = _mm_mul_epu32(value, vector_prime);
+            const __m128i high_product = _mm_mul_epu32(_mm_srli_epi64(value, 32), vector_prime);
+            vector_accumulator[quarter] = _mm_add_epi64(low_product, _mm_slli_epi64(high_product, 32));
+          }
+        }
+      }
+      for (uint64_t quarter = 0; quarter < 4; ++quarter)
+      {
+        _mm_store_si128(reinterpret_cast<__m128i *>(accumulator + quarter * 2), vector_accumulator[quarter]);
+      }
+#else
+      while (stripe_index < stripe_count)
+      {
+        const uint64_t block_end = stripe_index + stripes_per_block < stripe_count ? stripe_index + stripes_per_block : stripe_count;
+        for (; stripe_index < block_end; ++stripe_index)
+        {
+          accumulate_stripe_scalar(accumulator, data + stripe_index * stripe_bytes, stripe_secret._words + stripe_index % stripes_per_block, seed);
+        }
+        if (block_end % stripes_per_block == 0)
+        {
+          scramble_scalar(accumulator, scramble_key, seed);
+        }
+      }
+#endif
+      // 合并 8 条通道，不足一条带的尾部字节走短哈希
+      uint64_t result = length * 0x9e3779b97f4a7c15ULL;
+      for (uint64_t lane = 0; lane < 8; lane += 2)
+      {
+        result += mix(accumulator[lane] ^ stripe_secret._words[lane], accumulator[lane + 1] ^ stripe_secret._words[lane + 1]);
+      }
+      const uint64_t tail_offset = stripe_count * stripe_bytes;
+      return short_hash(data + tail_offset, length - tail_offset, result ^ seed);
+    }
+    /*
+     * @brief 任意字节序列的 64 位哈希
+     * @param data 数据首地址
+     * @param length 字节数
+     * @param seed 种子，默认 0
+     */
+    [[nodiscard]] inline uint64_t hash_bytes(const void *data, const uint64_t length, const uint64_t seed = 0) noexcept
+    {
+      const auto *byte_data = static_cast<const unsigned char *>(data);
+      return length < bulk_threshold ? short_hash(byte_data, length, seed) : bulk_hash(byte_data, length, seed);
+    }
+    [[nodiscard]] inline uint64_t hash_integer(const uint64_t value, const uint64_t seed = 0) noexcept
+    {
+      return mix(value ^ secret[0] ^ seed, mix(seed ^ secret[1], secret[2]));
+    }
+    [[nodiscard]] inline uint64_t process_seed() noexcept
+    {
+      static const uint64_t seed_value = []
+      {
+        uint64_t entropy = static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+        try
+        {
+          std::random_device device;
+          entropy ^= (static_cast<uint64_t>(device()) << 32) | device();
+        }
+        catch (...)
+        {
+          // 无随机设备时只用时钟与地址
+        }
+        static const char address_anchor = 0;
+        entropy ^= reinterpret_cast<uintptr_t>(&address_anchor);
+        return mix(entropy ^ secret[2], secret[3]);
+      }();
+      return seed_value;
+    }
+  }
   /*
    * @brief  #### `hash_imitation_functions` 类
 
-  *   - 哈希仿函数实现，为基础数据类型提供哈希值计算
+  *   - 哈希仿函数实现，为基础数据类型和字符串提供哈希值计算
 
   *   - 支持多种内置类型的哈希转换，可作为哈希容器的默认哈希函数
 
    * 核心操作符:
 
-   * * - 针对不同基础类型重载的 `operator()`，均返回 `uint64_t` 类型的哈希值
-   *
-   *     - `int`: 直接转换为 `uint64_t`
-   *
-   *     - `uint64_t`: 直接返回原值
-   *
-   *     - `char`: 转换为对应的 `uint64_t` 值
-   *
-   *     - `double`: 转换为 `uint64_t`（注意：可能丢失精度）
+   * * - 可转换为 `uint64_t` 的类型（整数、字符、枚举、浮点等）: 直接转换为 `uint64_t`，由容器内部再混合扩散
    *
-   *     - `float`: 转换为 `uint64_t`（注意：可能丢失精度）
+   * * - `standard_con::string` / `std::string` / `std::string_view` / `const char*`: 对全部字节调用 `hash_kernel::hash_bytes`，
    *
-   *     - `long`: 转换为 `uint64_t`
-   *
-   *     - `short`: 转换为 `uint64_t`
-   *
-   *     - `long long`: 转换为 `uint64_t`
-   *
-   *     - `unsigned int`: 转换为 `uint64_t`
-   *
-   *     - `unsigned short`: 转换为 `uint64_t`
+   *     与字符顺序相关（"ab" 与 "ba" 哈希不同），长字符串走 SIMD 条带累加
 
    * 特性:
 
-   * * - 针对基础类型的哈希计算为 O(1) 时间复杂度
+   * * - 针对基础类型的哈希计算为 O(1) 时间复杂度，字符串为 O(n)
+   *
+   * * - 无种子、结果确定，适合内部数据；键来自外部请求时请使用 `seeded_hash_functions`
 
    * 适用场景:
 
-   * * - 作为 `hash_map`、`hash_set` 等哈希容器的哈希函数
+   * * - 作为 `hash_map`、`hash_set`、`bloom_filter` 等容器的哈希函数
    *
    * * - 与 `hash_function` 类配合使用，扩展哈希算法
-   *
-   * * - 需要为基础类型快速生成哈希值的场景
 
    * 注意事项:
 
    * * - 浮点类型（`double`、`float`）的哈希可能丢失精度，不建议用于精确匹配场景
    *
-   * * - 未提供自定义类型（如字符串、容器）的哈希实现，需用户自行重载扩展
-   *
    * * - 对于指针类型或复杂结构，需额外实现重载版本
    *
    * * - 线程安全：无状态设计，可在多线程环境中安全使用
-
-   * 扩展说明:
-
-   * * - 注释中提供了字符串容器哈希计算的示例代码框架，可根据需求实现
-   *
-   * * - 支持为自定义类型添加 `operator()` 重载，扩展哈希能力
-   *
   */
   class hash_imitation_functions
   {
   public:
     template <typename hash_type>
+      requires requires(const hash_type &data) { static_cast<uint64_t>(data); }
     [[nodiscard]] uint64_t operator()(const hash_type &data) noexcept
     {
       return static_cast<uint64_t>(data);
     }
     [[nodiscard]] uint64_t operator()(const standard_con::string &data_string) noexcept
     {
-      uint64_t hash_value = 0;
-      for (auto &str : data_string)
-      {
-        hash_value += static_cast<uint64_t>(str) * 31;
-      }
-      return hash_value;
+      return hash_kernel::hash_bytes(data_string.c_str(), data_string.size());
+    }
+    [[nodiscard]] uint64_t operator()(const std::string &data_string) noexcept
+    {
+      return hash_kernel::hash_bytes(data_string.data(), data_string.size());
+    }
+    [[nodiscard]] uint64_t operator()(const std::string_view data_string) noexcept
+    {
+      return hash_kernel::hash_bytes(data_string.data(), data_string.size());
+    }
+    [[nodiscard]] uint64_t operator()(const char *data_string) noexcept
+    {
+      return hash_kernel::hash_bytes(data_string, std::strlen(data_string));
+    }
+  };
+  /*
+   * @brief  #### `seeded_hash_functions` 类
+
+  *   - 带种子的哈希仿函数，接口与 `hash_imitation_functions` 相同，可直接替换为容器的哈希函数模板参数
+
+  *   - 默认构造使用进程级随机种子 `hash_kernel::process_seed()`，外部无法预知哈希结果，用于会话 id、URL 等来自请求的数据，
+
+  *     防止攻击者构造大量同槽位键拖垮哈希表
+
+   * 核心操作符:
+
+   * * - 整数、字符、枚举: `hash_kernel::hash_integer(value, seed)`
+   *
+   * * - 浮点: 按位表示哈希（`+0.0` 与 `-0.0` 视为相同）
+   *
+   * * - 字符串: `hash_kernel::hash_bytes(data, length, seed)`
+
+   * 注意事项:
+
+   * * - 同一进程内种子固定，不同进程结果不同，不能用于持久化
+   *
+   * * - 需要可复现结果时用 `seeded_hash_functions(seed)` 显式指定种子
+  */
+  class seeded_hash_functions
+  {
+    uint64_t _seed;
+
+  public:
+    seeded_hash_functions() noexcept : _seed(hash_kernel::process_seed()) { ; }
+    explicit seeded_hash_functions(const uint64_t seed) noexcept : _seed(seed) { ; }
+    template <typename hash_type>
+      requires std::is_integral_v<hash_type> || std::is_enum_v<hash_type>
+    [[nodiscard]] uint64_t operator()(const hash_type &data) const noexcept
+    {
+      return hash_kernel::hash_integer(static_cast<uint64_t>(data), _seed);
+    }
+    template <typename hash_type>
+      requires std::is_floating_point_v<hash_type>
+    [[nodiscard]] uint64_t operator()(const hash_type &data) const noexcept
+    {
+      const hash_type normalized = data == hash_type(0) ? hash_type(0) : data;
+      return hash_kernel::hash_bytes(&normalized, sizeof(normalized), _seed);
+    }
+    [[nodiscard]] uint64_t operator()(const standard_con::string &data_string) const noexcept
+    {
+      return hash_kernel::hash_bytes(data_string.c_str(), data_string.size(), _seed);
+    }
+    [[nodiscard]] uint64_t operator()(const std::string &data_string) const noexcept
+    {
+      return hash_kernel::hash_bytes(data_string.data(), data_string.size(), _seed);
+    }
+    [[nodiscard]] uint64_t operator()(const std::string_view data_string) const noexcept
+    {
+      return hash_kernel::hash_bytes(data_string.data(), data_string.size(), _seed);
+    }
+    [[nodiscard]] uint64_t operator()(const char *data_string) const noexcept
+    {
+      return hash_kernel::hash_bytes(data_string, std::strlen(data_string), _seed);
+    }
+    [[nodiscard]] uint64_t seed() const noexcept
+    {
+      return _seed;
     }
-    // 有需要可以重载本文件的string容器和vector容器.list容器等计算哈希的函数, 这里就不重载了
   };
   /*
    * @brief  #### `hash_algorithm` 哈希算法命名空间
@@ -190,5 +556,7 @@ namespace hash
 namespace standard_con
 {
   using hash::hash_imitation_functions;
+  using hash::seeded_hash_functions;
+  namespace hash_kernel = hash::hash_kernel;
   using hash::hash_algorithm::hash_function;
 }
\ No newline at end of file
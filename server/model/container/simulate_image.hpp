@@ -0,0 +1,877 @@
+#pragma once
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+#include "simulate_exception.hpp"
+#include "simulate_vector.hpp"
+#include "simulate_algorithm.hpp"
+#include "simulate_perfect.hpp"
+namespace image_container
+{
+  /*
+   * @brief  #### 容器二进制镜像格式
+
+  *   - 把 `vector` / `hash_map` / `tree_map` 一次性写成可重定位的二进制镜像，之后直接 `mmap` 映射并原地查询，不做反序列化
+
+  *   - 镜像内所有引用都是相对镜像起始地址的字节偏移，映射到任意地址都能使用
+
+   * 布局:
+
+   * * - `image_header`（96 字节）: 魔数、格式版本、字节序标记、镜像种类、键 / 值存储宽度、各区域偏移、载荷校验值
+   *
+   * * - 数组区: 键数组、值数组（结构数组分离存放），按 `max(alignof, 8)` 对齐；哈希镜像另有控制字节数组
+   *
+   * * - 字符串池: 位于镜像末尾，字符串以 `image_string`（偏移 + 长度）引用
+
+   * 元素类型:
+
+   * * - 可转换为 `std::string_view` 的类型（`std::string`、`standard_con::string` 等）存为 `image_string`，读取时得到指向映射内存的 `std::string_view`
+   *
+   * * - 其余类型须可平凡复制，按字节原样存放，读取时按值拷贝出来
+
+   * 镜像种类:
+
+   * * - `vector`: 值数组，按下标访问
+   *
+   * * - `hash_map`: 线性探测开放寻址表，负载不超过 1/2；控制字节为 0 表示空槽，否则为 0x80 | 哈希高 7 位
+   *
+   * * - `tree_map`: 按键的自然顺序（`<`）排好的键数组与值数组，二分查找，可按序遍历
+
+   * 注意事项:
+
+   * * - 镜像与写入方的字节序、元素布局一致才能读取，打开时校验魔数、版本、字节序与存储宽度，不一致抛出 `fault`
+   *
+   * * - 哈希与校验使用 `perfect_hash_kernel::hash_key`，属于格式的一部分；哈希算法变动时必须提升 `image_version`
+   *
+   * * - 打开时校验头部、各区域边界与字符串引用范围，不计算校验值；来源不可信时再调用 `verify()` 校验载荷，查询时不做逐次越界检查
+  */
+  inline constexpr unsigned char image_magic[8] = {'S', 'C', 'L', 'I', 'M', 'A', 'G', 'E'};
+  inline constexpr uint32_t image_version = 1;
+  inline constexpr uint32_t image_byte_order = 0x01020304;
+  inline constexpr uint64_t image_hash_seed = 0x452821e638d01377ULL;
+
+  enum class image_kind : uint32_t
+  {
+    vector = 1,
+    hash_map = 2,
+    tree_map = 3
+  };
+
+  struct image_header
+  {
+    unsigned char _magic[8];
+    uint32_t _version;
+    uint32_t _byte_order;
+    uint32_t _kind;
+    uint32_t _key_size;   // 键的存储宽度，`vector` 镜像为 0
+    uint32_t _value_size; // 值的存储宽度
+    uint32_t _reserved;
+    uint64_t _image_size;
+    uint64_t _element_count;
+    uint64_t _slot_count; // 哈希镜像为槽位数，其余等于元素个数
+    uint64_t _control_offset;
+    uint64_t _key_offset;
+    uint64_t _value_offset;
+    uint64_t _checksum; // [sizeof(image_header), _image_size) 的哈希
+    uint64_t _padding;
+  };
+  static_assert(sizeof(image_header) == 96 && std::is_trivially_copyable_v<image_header>, "image_header 布局必须固定");
+
+  struct image_string
+  {
+    uint64_t _offset;
+    uint64_t _length;
+  };
+
+  template <typename image_type>
+  concept image_string_like = std::is_convertible_v<const image_type &, std::string_view>;
+
+  template <typename image_type>
+  concept image_storable = image_string_like<image_type> || std::is_trivially_copyable_v<image_type>;
+
+  [[nodiscard]] inline uint64_t image_checksum(const unsigned char *image_data, const uint64_t image_size) noexcept
+  {
+    return perfect_container::perfect_hash_kernel::hash_key(
+        std::string_view(reinterpret_cast<const char *>(image_data) + sizeof(image_header), image_size - sizeof(image_header)),
+        image_hash_seed);
+  }
+  /*
+   * @brief  #### `image_builder` 类
+
+  *   - 镜像写入缓冲：按对齐追加清零的区域、在指定偏移写入定长数据、向字符串池追加字符串，最后补写头部与校验值
+  */
+  class image_builder
+  {
+    standard_con::vector<unsigned char> _bytes;
+
+    void grow_to(const uint64_t new_size)
+    {
+      if (new_size > _bytes.capacity())
+      {
+        const uint64_t doubled_capacity = _bytes.capacity() * 2;
+        _bytes.reserve(doubled_capacity > new_size ? doubled_capacity : new_size);
+      }
+      _bytes.size_adjust(new_size, 0);
+    }
+
+  public:
+    image_builder()
+    {
+      grow_to(sizeof(image_header));
+    }
+    uint64_t reserve_region(const uint64_t region_bytes, const uint64_t alignment)
+    {
+      const uint64_t region_offset = (_bytes.size() + alignment - 1) / alignment * alignment;
+      grow_to(region_offset + region_bytes);
+      return region_offset;
+    }
+    template <typename stored_type>
+    void store(const uint64_t offset, const stored_type &stored_data) noexcept
+    {
+      std::memcpy(_bytes.begin() + offset, &stored_data, sizeof(stored_type));
+    }
+    image_string append_string(const std::string_view string_data)
+    {
+      const uint64_t string_offset = _bytes.size();
+      grow_to(string_offset + string_data.size());
+      if (!string_data.empty())
+      {
+        std::memcpy(_bytes.begin() + string_offset, string_data.data(), string_data.size());
+      }
+      return image_string{string_offset, string_data.size()};
+    }
+    standard_con::vector<unsigned char> finish(image_header header)
+    {
+      std::memcpy(header._magic, image_magic, sizeof(image_magic));
+      header._version = image_version;
+      header._byte_order = image_byte_order;
+      header._image_size = _bytes.size();
+      header._checksum = image_checksum(_bytes.begin(), _bytes.size());
+      std::memcpy(_bytes.begin(), &header, sizeof(header));
+      return std::move(_bytes);
+    }
+  };
+  /*
+   * @brief  #### `image_traits` 类模板
+
+  *   - 元素类型与镜像存储形式之间的转换：`stored_type` 为镜像中的存储类型，`loaded_type` 为读取时返回的类型
+  */
+  template <typename image_type>
+  struct image_traits
+  {
+    static_assert(std::is_trivially_copyable_v<image_type>, "镜像元素需可平凡复制或可转换为 std::string_view");
+    using stored_type = image_type;
+    using loaded_type = image_type;
+    static stored_type store(image_builder &, const image_type &element_data) noexcept
+    {
+      return element_data;
+    }
+    static loaded_type load(const unsigned char *, const unsigned char *stored_position) noexcept
+    {
+      loaded_type loaded_data;
+      std::memcpy(&loaded_data, stored_position, sizeof(stored_type));
+      return loaded_data;
+    }
+  };
+  template <image_string_like image_type>
+  struct image_traits<image_type>
+  {
+    using stored_type = image_string;
+    using loaded_type = std::string_view;
+    static stored_type store(image_builder &builder, const image_type &element_data)
+    {
+      return builder.append_string(std::string_view(element_data));
+    }
+    static loaded_type load(const unsigned char *image_data, const unsigned char *stored_position) noexcept
+    {
+      image_string stored_data;
+      std::memcpy(&stored_data, stored_position, sizeof(stored_data));
+      return std::string_view(reinterpret_cast<const char *>(image_data) + stored_data._offset, stored_data._length);
+    }
+  };
+
+  template <typename loaded_type>
+  [[nodiscard]] uint64_t image_hash(const loaded_type &key_data) noexcept
+  {
+    if constexpr (std::is_same_v<loaded_type, std::string_view> || std::is_integral_v<loaded_type> || std::is_enum_v<loaded_type>)
+    {
+      return perfect_container::perfect_hash_kernel::hash_key(key_data, image_hash_seed);
+    }
+    else
+    {
+      // 其余可平凡复制的键按对象字节哈希，键类型不应含填充字节
+      return perfect_container::perfect_hash_kernel::hash_key(
+          std::string_view(reinterpret_cast<const char *>(&key_data), sizeof(key_data)), image_hash_seed);
+    }
+  }
+  [[nodiscard]] constexpr uint64_t region_alignment(const uint64_t type_alignment) noexcept
+  {
+    return type_alignment > 8 ? type_alignment : 8;
+  }
+  /*
+   * @brief  #### `build_vector_image` / `build_hash_map_image` / `build_tree_map_image` 函数模板
+
+  *   - 把容器写成镜像字节，返回的缓冲可直接交给 `save_image` 写盘，也可直接构造视图在内存中使用
+
+   * 参数:
+
+   * * - `sequence_data`: 可范围遍历的序列（`standard_con::vector`、`std::vector` 等）
+   *
+   * * - `map_data`: 可范围遍历、元素带 `first` / `second` 的映射（`hash_map`、`tree_map`、`btree_map`、`flat_map` 等）
+
+   * 注意事项:
+
+   * * - `build_tree_map_image` 按键的自然顺序重新排序，源容器的比较器不写入镜像
+   *
+   * * - `build_hash_map_image` 遇到重复键时保留先出现的一个
+  */
+  template <typename sequence_type>
+  standard_con::vector<unsigned char> build_vector_image(sequence_type &sequence_data)
+  {
+    using value_type = std::remove_cvref_t<decltype(*sequence_data.begin())>;
+    using value_traits = image_traits<value_type>;
+    using stored_value = typename value_traits::stored_type;
+    uint64_t element_count = 0;
+    for (auto iterator_position = sequence_data.begin(); iterator_position != sequence_data.end(); ++iterator_position)
+    {
+      ++element_count;
+    }
+    image_builder builder;
+    const uint64_t value_offset = builder.reserve_region(element_count * sizeof(stored_value), region_alignment(alignof(stored_value)));
+    uint64_t element_index = 0;
+    for (auto &element_data : sequence_data)
+    {
+      builder.store(value_offset + element_index * sizeof(stored_value), value_traits::store(builder, element_data));
+      ++element_index;
+    }
+    image_header header{};
+    header._kind = static_cast<uint32_t>(image_kind::vector);
+    header._value_size = sizeof(stored_value);
+    header._element_count = header._slot_count = element_count;
+    header._value_offset = value_offset;
+    return builder.finish(header);
+  }
+  template <typename map_type>
+  standard_con::vector<unsigned char> build_hash_map_image(map_type &map_data)
+  {
+    using entry_type = std::remove_cvref_t<decltype(*map_data.begin())>;
+    using key_traits = image_traits<std::remove_cvref_t<decltype(std::declval<entry_type &>().first)>>;
+    using value_traits = image_traits<std::remove_cvref_t<decltype(std::declval<entry_type &>().second)>>;
+    using stored_key = typename key_traits::stored_type;
+    using stored_value = typename value_traits::stored_type;
+    uint64_t element_count = 0;
+    for (auto iterator_position = map_data.begin(); iterator_position != map_data.end(); ++iterator_position)
+    {
+      ++element_count;
+    }
+    uint64_t slot_count = 8;
+    while (slot_count < element_count * 2)
+    {
+      slot_count *= 2;
+    }
+    const uint64_t slot_mask = slot_count - 1;
+    image_builder builder;
+    const uint64_t control_offset = builder.reserve_region(slot_count, 8);
+    const uint64_t key_offset = builder.reserve_region(slot_count * sizeof(stored_key), region_alignment(alignof(stored_key)));
+    const uint64_t value_offset = builder.reserve_region(slot_count * sizeof(stored_value), region_alignment(alignof(stored_value)));
+    // 控制字节与已放入的键先记在本地，字符串池追加可能使缓冲扩容，不能持有指向缓冲内部的指针
+    standard_con::vector<unsigned char> control_bytes(slot_count, 0);
+    standard_con::vector<typename key_traits::loaded_type> placed_keys(slot_count);
+    uint64_t stored_count = 0;
+    for (auto &entry_data : map_data)
+    {
+      const stored_key key_stored = key_traits::store(builder, entry_data.first);
+      const typename key_traits::loaded_type key_loaded = entry_data.first;
+      const uint64_t hash_value = image_hash(key_loaded);
+      const unsigned char control_tag = static_cast<unsigned char>(0x80 | (hash_value >> 57));
+      uint64_t slot = hash_value & slot_mask;
+      bool duplicated = false;
+      // 负载不超过 1/2，至多探测 slot_count 次必遇空槽
+      for (uint64_t probe_count = 0; probe_count < slot_count && control_bytes[slot] != 0; ++probe_count)
+      {
+        if (control_bytes[slot] == control_tag && placed_keys[slot] == key_loaded)
+        {
+          duplicated = true;
+          break;
+        }
+        slot = (slot + 1) & slot_mask;
+      }
+      if (duplicated)
+      {
+        continue;
+      }
+      control_bytes[slot] = control_tag;
+      placed_keys[slot] = key_loaded;
+      builder.store(key_offset + slot * sizeof(stored_key), key_stored);
+      builder.store(value_offset + slot * sizeof(stored_value), value_traits::store(builder, entry_data.second));
+      ++stored_count;
+    }
+    for (uint64_t slot_index = 0; slot_index < slot_count; ++slot_index)
+    {
+      builder.store(control_offset + slot_index, control_bytes[slot_index]);
+    }
+    image_header header{};
+    header._kind = static_cast<uint32_t>(image_kind::hash_map);
+    header._key_size = sizeof(stored_key);
+    header._value_size = sizeof(stored_value);
+    header._element_count = stored_count;
+    header._slot_count = slot_count;
+    header._control_offset = control_offset;
+    header._key_offset = key_offset;
+    header._value_offset = value_offset;
+    return builder.finish(header);
+  }
+  template <typename map_type>
+  standard_con::vector<unsigned char> build_tree_map_image(map_type &map_data)
+  {
+    using entry_type = std::remove_cvref_t<decltype(*map_data.begin())>;
+    using key_traits = image_traits<std::remove_cvref_t<decltype(std::declval<entry_type &>().first)>>;
+    using value_traits = image_traits<std::remove_cvref_t<decltype(std::declval<entry_type &>().second)>>;
+    using stored_key = typename key_traits::stored_type;
+    using stored_value = typename value_traits::stored_type;
+    // 先收集条目指针按键排序，源容器的遍历顺序与比较器都不影响镜像
+    standard_con::vector<const entry_type *> ordered_entries;
+    for (auto &entry_data : map_data)
+    {
+      ordered_entries.push_back(&entry_data);
+    }
+    standard_con::algorithm::sort(ordered_entries.begin(), ordered_entries.end(),
+                                  [](const entry_type *left_entry, const entry_type *right_entry)
+                                  {
+                                    return static_cast<typename key_traits::loaded_type>(left_entry->first) <
+                                           static_cast<typename key_traits::loaded_type>(right_entry->first);
+                                  });
+    const uint64_t element_count = ordered_entries.size();
+    image_builder builder;
+    const uint64_t key_offset = builder.reserve_region(element_count * sizeof(stored_key), region_alignment(alignof(stored_key)));
+    const uint64_t value_offset = builder.reserve_region(element_count * sizeof(stored_value), region_alignment(alignof(stored_value)));
+    for (uint64_t element_index = 0; element_index < element_count; ++element_index)
+    {
+      builder.store(key_offset + element_index * sizeof(stored_key), key_traits::store(builder, ordered_entries[element_index]->first));
+      builder.store(value_offset + element_index * sizeof(stored_value), value_traits::store(builder, ordered_entries[element_index]->second));
+    }
+    image_header header{};
+    header._kind = static_cast<uint32_t>(image_kind::tree_map);
+    header._key_size = sizeof(stored_key);
+    header._value_size = sizeof(stored_value);
+    header._element_count = header._slot_count = element_count;
+    header._key_offset = key_offset;
+    header._value_offset = value_offset;
+    return builder.finish(header);
+  }
+  /*
+   * @brief  #### `save_image` 函数
+
+  *   - 把镜像字节写入文件，失败时抛出 `fault`
+  */
+  inline void save_image(const std::string &file_path, const standard_con::vector<unsigned char> &image_bytes)
+  {
+    try
+    {
+      std::ofstream image_file(file_path, std::ios::binary | std::ios::trunc);
+      if (!image_file.write(reinterpret_cast<const char *>(image_bytes.begin()), static_cast<std::streamsize>(image_bytes.size())))
+      {
+        throw custom_exception::fault("镜像文件写入失败", "image::save_image", __LINE__);
+      }
+    }
+    catch (const custom_exception::fault &process)
+    {
+      std::cerr << process.what() << " " << process.function_name_get() << " " << process.line_number_get() << std::endl;
+      throw;
+    }
+  }
+  /*
+   * @brief  #### `mapped_image` 类
+
+  *   - 以只读方式把镜像文件映射进内存（POSIX `mmap` / Windows `MapViewOfFile`），析构时解除映射
+
+  *   - 只可移动不可拷贝；由它构造的视图及视图返回的 `std::string_view` 在映射存活期间有效
+  */
+  class mapped_image
+  {
+    const unsigned char *_image_data = nullptr;
+    uint64_t _image_size = 0;
+
+    void unmap() noexcept
+    {
+      if (_image_data != nullptr)
+      {
+#if defined(_WIN32)
+        UnmapViewOfFile(_image_data);
+#else
+        munmap(const_cast<unsigned char *>(_image_data), _image_size);
+#endif
+      }
+      _image_data = nullptr;
+      _image_size = 0;
+    }
+
+  public:
+    explicit mapped_image(const std::string &file_path)
+    {
+      try
+      {
+#if defined(_WIN32)
+        HANDLE file_handle = CreateFileA(file_path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file_handle == INVALID_HANDLE_VALUE)
+        {
+          throw custom_exception::fault("镜像文件打开失败", "mapped_image::mapped_image", __LINE__);
+        }
+        LARGE_INTEGER file_size;
+        HANDLE mapping_handle = nullptr;
+        if (GetFileSizeEx(file_handle, &file_size) && file_size.QuadPart > 0)
+        {
+          mapping_handle = CreateFileMappingA(file_handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        }
+        CloseHandle(file_handle);
+        if (mapping_handle == nullptr)
+        {
+          throw custom_exception::fault("镜像文件映射失败", "mapped_image::mapped_image", __LINE__);
+        }
+        // 视图建立后映射对象由系统保持，句柄可以立即关闭
+        void *view_address = MapViewOfFile(mapping_handle, FILE_MAP_READ, 0, 0, 0);
+        CloseHandle(mapping_handle);
+        if (view_address == nullptr)
+        {
+          throw custom_exception::fault("镜像文件映射失败", "mapped_image::mapped_image", __LINE__);
+        }
+        _image_data = static_cast<const unsigned char *>(view_address);
+        _image_size = static_cast<uint64_t>(file_size.QuadPart);
+#else
+        const int file_descriptor = ::open(file_path.c_str(), O_RDONLY);
+        if (file_descriptor < 0)
+        {
+          throw custom_exception::fault("镜像文件打开失败", "mapped_image::mapped_image", __LINE__);
+        }
+        struct stat file_status;
+        void *view_address = MAP_FAILED;
+        if (::fstat(file_descriptor, &file_status) == 0 && file_status.st_size > 0)
+        {
+          view_address = ::mmap(nullptr, static_cast<size_t>(file_status.st_size), PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+        }
+        ::close(file_descriptor); // 映射建立后不再需要文件描述符
+        if (view_address == MAP_FAILED)
+        {
+          throw custom_exception::fault("镜像文件映射失败", "mapped_image::mapped_image", __LINE__);
+        }
+        _image_data = static_cast<const unsigned char *>(view_address);
+        _image_size = static_cast<uint64_t>(file_status.st_size);
+#endif
+      }
+      catch (const custom_exception::fault &process)
+      {
+        std::cerr << process.what() << " " << process.function_name_get() << " " << process.line_number_get() << std::endl;
+        throw;
+      }
+    }
+    mapped_image(const mapped_image &) = delete;
+    mapped_image &operator=(const mapped_image &) = delete;
+    mapped_image(mapped_image &&image_data) noexcept
+        : _image_data(image_data._image_data), _image_size(image_data._image_size)
+    {
+      image_data._image_data = nullptr;
+      image_data._image_size = 0;
+    }
+    mapped_image &operator=(mapped_image &&image_data) noexcept
+    {
+      if (this != &image_data)
+      {
+        unmap();
+        _image_data = image_data._image_data;
+        _image_size = image_data._image_size;
+        image_data._image_data = nullptr;
+        image_data._image_size = 0;
+      }
+      return *this;
+    }
+    ~mapped_image() noexcept
+    {
+      unmap();
+    }
+    [[nodiscard]] const unsigned char *data() const noexcept
+    {
+      return _image_data;
+    }
+    [[nodiscard]] uint64_t size() const noexcept
+    {
+      return _image_size;
+    }
+  };
+  /*
+   * @brief  #### `image_view` 类
+
+  *   - 各种镜像视图的公共部分：打开时校验头部，持有镜像起始地址与头部副本，不拥有内存
+
+   * 校验内容:
+
+   * * - 魔数、版本、字节序、镜像种类、键 / 值存储宽度
+   *
+   * * - 镜像长度不超过缓冲长度，各数组区域不越界且按存储类型对齐
+   *
+   * * - 哈希镜像的槽位数为 2 的幂且元素个数小于槽位数
+   *
+   * * - 字符串元素的（偏移, 长度）落在镜像之内，需扫描一遍键 / 值数组，耗时与槽位数成正比
+  */
+  class image_view
+  {
+  protected:
+    const unsigned char *_image_data = nullptr;
+    image_header _header{};
+
+    image_view(const unsigned char *image_data, const uint64_t image_size, const image_kind kind,
+               const uint64_t key_size, const uint64_t value_size, const uint64_t key_alignment, const uint64_t value_alignment,
+               const bool key_strings, const bool value_strings)
+        : _image_data(image_data)
+    {
+      try
+      {
+        if (image_data == nullptr || image_size < sizeof(image_header))
+        {
+          throw custom_exception::fault("镜像长度不足", "image_view::image_view", __LINE__);
+        }
+        std::memcpy(&_header, image_data, sizeof(image_header));
+        if (std::memcmp(_header._magic, image_magic, sizeof(image_magic)) != 0 || _header._byte_order != image_byte_order)
+        {
+          throw custom_exception::fault("镜像格式或字节序不匹配", "image_view::image_view", __LINE__);
+        }
+        if (_header._version != image_version)
+        {
+          throw custom_exception::fault("镜像版本不匹配", "image_view::image_view", __LINE__);
+        }
+        if (_header._kind != static_cast<uint32_t>(kind) || _header._key_size != key_size || _header._value_size != value_size)
+        {
+          throw custom_exception::fault("镜像种类或元素类型不匹配", "image_view::image_view", __LINE__);
+        }
+        if (_header._image_size > image_size || _header._image_size < sizeof(image_header) || _header._element_count > _header._slot_count)
+        {
+          throw custom_exception::fault("镜像长度不正确", "image_view::image_view", __LINE__);
+        }
+        const uint64_t slot_count = _header._slot_count;
+        if (kind == image_kind::hash_map && (!std::has_single_bit(slot_count) || _header._element_count >= slot_count))
+        {
+          throw custom_exception::fault("哈希镜像槽位数不正确", "image_view::image_view", __LINE__);
+        }
+        const bool regions_valid = region_valid(_header._control_offset, _header._kind == static_cast<uint32_t>(image_kind::hash_map) ? slot_count : 0, 1, 1) &&
+                                   region_valid(_header._key_offset, slot_count, key_size, key_alignment) &&
+                                   region_valid(_header._value_offset, slot_count, value_size, value_alignment);
+        if (!regions_valid)
+        {
+          throw custom_exception::fault("镜像区域越界或未对齐", "image_view::image_view", __LINE__);
+        }
+        if ((key_strings && !strings_valid(_header._key_offset, slot_count)) || (value_strings && !strings_valid(_header._value_offset, slot_count)))
+        {
+          throw custom_exception::fault("镜像字符串引用越界", "image_view::image_view", __LINE__);
+        }
+      }
+      catch (const custom_exception::fault &process)
+      {
+        std::cerr << process.what() << " " << process.function_name_get() << " " << process.line_number_get() << std::endl;
+        throw;
+      }
+    }
+    [[nodiscard]] bool region_valid(const uint64_t region_offset, const uint64_t element_count, const uint64_t element_size, const uint64_t alignment) const noexcept
+    {
+      if (element_size == 0 || element_count == 0)
+      {
+        return true;
+      }
+      if (element_count > _header._image_size / element_size || region_offset < sizeof(image_header) ||
+          region_offset > _header._image_size - element_count * element_size)
+      {
+        return false;
+      }
+      return reinterpret_cast<uintptr_t>(_image_data + region_offset) % alignment == 0;
+    }
+    [[nodiscard]] bool strings_valid(const uint64_t region_offset, const uint64_t element_count) const noexcept
+    {
+      // 区域已校验过边界与对齐；哈希镜像的空槽为全零引用，同样满足条件
+      const unsigned char *stored_position = _image_data + region_offset;
+      for (uint64_t element_index = 0; element_index < element_count; ++element_index, stored_position += sizeof(image_string))
+      {
+        image_string stored_data;
+        std::memcpy(&stored_data, stored_position, sizeof(stored_data));
+        if (stored_data._offset > _header._image_size || stored_data._length > _header._image_size - stored_data._offset)
+        {
+          return false;
+        }
+      }
+      return true;
+    }
+
+  public:
+    [[nodiscard]] uint64_t size() const noexcept
+    {
+      return _header._element_count;
+    }
+    [[nodiscard]] bool empty() const noexcept
+    {
+      return _header._element_count == 0;
+    }
+    [[nodiscard]] uint64_t image_size() const noexcept
+    {
+      return _header._image_size;
+    }
+    [[nodiscard]] bool verify() const noexcept
+    {
+      // 重新计算载荷校验值，用于检测截断或损坏的文件
+      return image_checksum(_image_data, _header._image_size) == _header._checksum;
+    }
+  };
+  /*
+   * @brief  #### `vector_image` 类模板
+
+  *   - `vector` 镜像的只读视图，`operator[]` / `at()` 返回 `loaded_type`（字符串元素为 `std::string_view`）
+  */
+  template <image_storable vector_type>
+  class vector_image : public image_view
+  {
+    using value_traits = image_traits<vector_type>;
+    using stored_value = typename value_traits::stored_type;
+
+  public:
+    using loaded_type = typename value_traits::loaded_type;
+
+    vector_image(const void *image_data, const uint64_t image_size)
+        : image_view(static_cast<const unsigned char *>(image_data), image_size, image_kind::vector,
+                     0, sizeof(stored_value), 1, alignof(stored_value), false, image_string_like<vector_type>) {}
+    explicit vector_image(const mapped_image &image_data) : vector_image(image_data.data(), image_data.size()) {}
+
+    [[nodiscard]] loaded_type operator[](const uint64_t element_index) const noexcept
+    {
+      return value_traits::load(_image_data, _image_data + _header._value_offset + element_index * sizeof(stored_value));
+    }
+    [[nodiscard]] loaded_type at(const uint64_t element_index) const
+    {
+      try
+      {
+        if (element_index >= size())
+        {
+          throw custom_exception::fault("传入参数越界", "vector_image::at", __LINE__);
+        }
+        return (*this)[element_index];
+      }
+      catch (const custom_exception::fault &process)
+      {
+        std::cerr << process.what() << " " << process.function_name_get() << " " << process.line_number_get() << std::endl;
+        throw;
+      }
+    }
+  };
+  /*
+   * @brief  #### `hash_map_image` 类模板
+
+  *   - `hash_map` 镜像的只读视图，按键原地查找，不构造任何节点
+
+   * 主要方法:
+
+   * * - `find(key)`: 返回槽位下标，不存在时返回 `npos`
+   *
+   * * - `contains(key)` / `value_or(key, fallback)` / `at(key)`（不存在时抛出 `fault`）
+  */
+  template <image_storable map_type_k, image_storable map_type_v>
+  class hash_map_image : public image_view
+  {
+    using key_traits = image_traits<map_type_k>;
+    using value_traits = image_traits<map_type_v>;
+    using stored_key = typename key_traits::stored_type;
+    using stored_value = typename value_traits::stored_type;
+
+  public:
+    using key_type = typename key_traits::loaded_type;
+    using loaded_type = typename value_traits::loaded_type;
+    static constexpr uint64_t npos = ~uint64_t{0};
+
+    hash_map_image(const void *image_data, const uint64_t image_size)
+        : image_view(static_cast<const unsigned char *>(image_data), image_size, image_kind::hash_map,
+                     sizeof(stored_key), sizeof(stored_value), alignof(stored_key), alignof(stored_value),
+                     image_string_like<map_type_k>, image_string_like<map_type_v>) {}
+    explicit hash_map_image(const mapped_image &image_data) : hash_map_image(image_data.data(), image_data.size()) {}
+
+    [[nodiscard]] uint64_t find(const key_type &key_data) const noexcept
+    {
+      if (_header._slot_count == 0)
+      {
+        return npos;
+      }
+      const uint64_t hash_value = image_hash(key_data);
+      const unsigned char control_tag = static_cast<unsigned char>(0x80 | (hash_value >> 57));
+      const unsigned char *control_bytes = _image_data + _header._control_offset;
+      const uint64_t slot_mask = _header._slot_count - 1;
+      // 正常镜像的探测序列必然遇到空槽；控制字节损坏时也至多探测 slot_count 次
+      uint64_t slot = hash_value & slot_mask;
+      for (uint64_t probe_count = 0; probe_count < _header._slot_count && control_bytes[slot] != 0; ++probe_count, slot = (slot + 1) & slot_mask)
+      {
+        if (control_bytes[slot] == control_tag &&
+            key_traits::load(_image_data, _image_data + _header._key_offset + slot * sizeof(stored_key)) == key_data)
+        {
+          return slot;
+        }
+      }
+      return npos;
+    }
+    [[nodiscard]] bool contains(const key_type &key_data) const noexcept
+    {
+      return find(key_data) != npos;
+    }
+    [[nodiscard]] loaded_type value_at(const uint64_t slot) const noexcept
+    {
+      return value_traits::load(_image_data, _image_data + _header._value_offset + slot * sizeof(stored_value));
+    }
+    [[nodiscard]] loaded_type value_or(const key_type &key_data, const loaded_type &fallback) const noexcept
+    {
+      const uint64_t slot = find(key_data);
+      return slot != npos ? value_at(slot) : fallback;
+    }
+    [[nodiscard]] loaded_type at(const key_type &key_data) const
+    {
+      try
+      {
+        const uint64_t slot = find(key_data);
+        if (slot == npos)
+        {
+          throw custom_exception::fault("镜像中不存在该键", "hash_map_image::at", __LINE__);
+        }
+        return value_at(slot);
+      }
+      catch (const custom_exception::fault &process)
+      {
+        std::cerr << process.what() << " " << process.function_name_get() << " " << process.line_number_get() << std::endl;
+        throw;
+      }
+    }
+  };
+  /*
+   * @brief  #### `tree_map_image` 类模板
+
+  *   - `tree_map` 镜像的只读视图，键按自然顺序排列，支持二分查找与按序遍历
+
+   * 主要方法:
+
+   * * - `lower_bound(key)` / `upper_bound(key)`: 返回第一个不小于 / 大于键的下标，不存在时返回 `size()`
+   *
+   * * - `find(key)`: 返回键的下标，不存在时返回 `npos`
+   *
+   * * - `key_at(index)` / `value_at(index)`: 按下标读取，配合 `lower_bound` 完成范围查询
+  */
+  template <image_storable map_type_k, image_storable map_type_v>
+  class tree_map_image : public image_view
+  {
+    using key_traits = image_traits<map_type_k>;
+    using value_traits = image_traits<map_type_v>;
+    using stored_key = typename key_traits::stored_type;
+    using stored_value = typename value_traits::stored_type;
+
+  public:
+    using key_type = typename key_traits::loaded_type;
+    using loaded_type = typename value_traits::loaded_type;
+    static constexpr uint64_t npos = ~uint64_t{0};
+
+    tree_map_image(const void *image_data, const uint64_t image_size)
+        : image_view(static_cast<const unsigned char *>(image_data), image_size, image_kind::tree_map,
+                     sizeof(stored_key), sizeof(stored_value), alignof(stored_key), alignof(stored_value),
+                     image_string_like<map_type_k>, image_string_like<map_type_v>) {}
+    explicit tree_map_image(const mapped_image &image_data) : tree_map_image(image_data.data(), image_data.size()) {}
+
+    [[nodiscard]] key_type key_at(const uint64_t element_index) const noexcept
+    {
+      return key_traits::load(_image_data, _image_data + _header._key_offset + element_index * sizeof(stored_key));
+    }
+    [[nodiscard]] loaded_type value_at(const uint64_t element_index) const noexcept
+    {
+      return value_traits::load(_image_data, _image_data + _header._value_offset + element_index * sizeof(stored_value));
+    }
+    [[nodiscard]] uint64_t lower_bound(const key_type &key_data) const noexcept
+    {
+      // 与 algorithm::lower_bound 相同的无分支二分，只是按下标读取镜像中的键
+      uint64_t base_index = 0;
+      uint64_t element_count = size();
+      if (element_count == 0)
+      {
+        return 0;
+      }
+      while (element_count > 1)
+      {
+        const uint64_t half_count = element_count / 2;
+        base_index = key_at(base_index + half_count - 1) < key_data ? base_index + half_count : base_index;
+        element_count -= half_count;
+      }
+      return key_at(base_index) < key_data ? base_index + 1 : base_index;
+    }
+    [[nodiscard]] uint64_t upper_bound(const key_type &key_data) const noexcept
+    {
+      uint64_t base_index = 0;
+      uint64_t element_count = size();
+      if (element_count == 0)
+      {
+        return 0;
+      }
+      while (element_count > 1)
+      {
+        const uint64_t half_count = element_count / 2;
+        base_index = key_data < key_at(base_index + half_count - 1) ? base_index : base_index + half_count;
+        element_count -= half_count;
+      }
+      return key_data < key_at(base_index) ? base_index : base_index + 1;
+    }
+    [[nodiscard]] uint64_t find(const key_type &key_data) const noexcept
+    {
+      const uint64_t element_index = lower_bound(key_data);
+      return element_index < size() && !(key_data < key_at(element_index)) ? element_index : npos;
+    }
+    [[nodiscard]] bool contains(const key_type &key_data) const noexcept
+    {
+      return find(key_data) != npos;
+    }
+    [[nodiscard]] loaded_type value_or(const key_type &key_data, const loaded_type &fallback) const noexcept
+    {
+      const uint64_t element_index = find(key_data);
+      return element_index != npos ? value_at(element_index) : fallback;
+    }
+    [[nodiscard]] loaded_type at(const key_type &key_data) const
+    {
+      try
+      {
+        const uint64_t element_index = find(key_data);
+        if (element_index == npos)
+        {
+          throw custom_exception::fault("镜像中不存在该键", "tree_map_image::at", __LINE__);
+        }
+        return value_at(element_index);
+      }
+      catch (const custom_exception::fault &process)
+      {
+        std::cerr << process.what() << " " << process.function_name_get() << " " << process.line_number_get() << std::endl;
+        throw;
+      }
+    }
+  };
+}
+namespace standard_con
+{
+  using image_container::build_hash_map_image;
+  using image_container::build_tree_map_image;
+  using image_container::build_vector_image;
+  using image_container::hash_map_image;
+  using image_container::image_header;
+  using image_container::image_kind;
+  using image_container::mapped_image;
+  using image_container::save_image;
+  using image_container::tree_map_image;
+  using image_container::vector_image;
+}
@@ -1,6 +1,7 @@
 #pragma once
 #include "simulate_exception.hpp"
 #include "simulate_algorithm.hpp"
+#include "simulate_pool.hpp"
 namespace list_container
 {
   /*
@@ -13,6 +14,8 @@ namespace list_container
       * 模板参数:
 
       * * - `list_type`: 链表中存储的元素类型
+      *
+      * * - `list_allocator`: 分配器类型，默认为 `std::allocator<list_type>`，为节点池与哨兵节点提供内存；传入 `polymorphic_allocator` 可使用竞技场等内存资源
 
       * 内部结构:
 
@@ -95,9 +98,9 @@ namespace list_container
       *
       * * - `erase()`: 删除指定迭代器位置的元素，返回下一个元素的迭代器
       *
-      * * - `clear()`: 清空链表所有元素，仅保留哨兵节点
+      * * - `clear()`: 清空链表所有元素，仅保留哨兵节点，节点内存整块归还
       *
-      * * - `swap()`: 与另一个链表交换内部资源（哨兵节点指针）
+      * * - `swap()`: 与另一个链表交换内部资源（哨兵节点指针与节点池）
 
       * 运算符重载:
 
@@ -120,6 +123,8 @@ namespace list_container
       * * - 异常处理: 空迭代器插入、内存分配失败等情况会抛出 `fault` 异常
       *
       * * - 支持移动语义: 减少不必要的元素拷贝，提高性能
+      *
+      * * - 节点池分配: 元素节点来自容器独占的 `node_pool`，按块连续分配，删除的节点优先复用
 
       * 注意事项:
 
@@ -135,7 +140,7 @@ namespace list_container
 
       * 详细请参考 https://github.com/Hatedatastructures/Custom-libraries/blob/main/template_container.md
   */
-  template <typename list_type>
+  template <typename list_type, typename list_allocator = std::allocator<list_type>>
   class list
   {
     template <typename list_type_function_node>
@@ -270,15 +275,19 @@ namespace list_container
     };
     using container_node = list_container_node<list_type>;
 
+    using node_allocator = typename std::allocator_traits<list_allocator>::template rebind_alloc<container_node>;
+    using node_traits = std::allocator_traits<node_allocator>;
+    using pool_type = standard_con::node_pool<container_node, node_allocator>;
+
     container_node *_head;
-    //_head为哨兵位
+    //_head为哨兵位，单独分配；元素节点来自本容器独占的节点池，两者使用同一个分配器
+    pool_type _pool;
     void create_head()
     {
+      node_allocator head_allocator(_pool.get_allocator());
       try
       {
-        _head = new container_node;
-        _head->_prev = _head;
-        _head->_next = _head;
+        _head = std::to_address(node_traits::allocate(head_allocator, 1));
       }
       catch (const std::bad_alloc &process)
       {
@@ -286,6 +295,28 @@ namespace list_container
         std::cerr << process.what() << std::endl;
         throw;
       }
+      try
+      {
+        ::new (static_cast<void *>(_head)) container_node;
+      }
+      catch (...)
+      {
+        node_traits::deallocate(head_allocator, _head, 1);
+        _head = nullptr;
+        throw;
+      }
+      _head->_prev = _head;
+      _head->_next = _head;
+    }
+    void destroy_head() noexcept
+    {
+      if (_head != nullptr)
+      {
+        node_allocator head_allocator(_pool.get_allocator());
+        std::destroy_at(_head);
+        node_traits::deallocate(head_allocator, _head, 1);
+        _head = nullptr;
+      }
     }
 
   public:
@@ -295,14 +326,24 @@ namespace list_container
     // 拿正向迭代器构造反向迭代器，可以直接调用 iterator 已经重载的运算符和函数，相当于在封装一层类
     using reverse_iterator = reverse_list_iterator<iterator>;
     using reverse_const_iterator = reverse_list_iterator<const_iterator>;
+    using allocator_type = list_allocator;
     list() { create_head(); }
+    explicit list(const list_allocator &allocator_data)
+        : _pool(node_allocator(allocator_data))
+    {
+      create_head();
+    }
     ~list() noexcept
     {
       clear();
-      delete _head;
-      _head = nullptr;
+      destroy_head();
+    }
+    [[nodiscard]] allocator_type get_allocator() const noexcept
+    {
+      return allocator_type(_pool.get_allocator());
     }
-    list(iterator first, iterator last)
+    list(iterator first, iterator last, const list_allocator &allocator_data = list_allocator())
+        : _pool(node_allocator(allocator_data))
     {
       try
       {
@@ -328,7 +369,8 @@ namespace list_container
         ++first;
       }
     }
-    list(std::initializer_list<list_type> lightweight_container)
+    list(std::initializer_list<list_type> lightweight_container, const list_allocator &allocator_data = list_allocator())
+        : _pool(node_allocator(allocator_data))
     {
       // 通过初始化列表构建一个list
       create_head();
@@ -337,7 +379,8 @@ namespace list_container
         push_back(std::move(chained_values));
       }
     }
-    list(const_iterator first, const_iterator last)
+    list(const_iterator first, const_iterator last, const list_allocator &allocator_data = list_allocator())
+        : _pool(node_allocator(allocator_data))
     {
       create_head();
       // 已经创建一个哨兵节点
@@ -347,21 +390,26 @@ namespace list_container
         ++first;
       }
     }
-    list(const list<list_type> &list_data)
+    list(const list &list_data)
+        : _pool(node_allocator(std::allocator_traits<list_allocator>::select_on_container_copy_construction(list_data.get_allocator())))
     {
       create_head();
-      list<list_type> Temp(list_data.cbegin(), list_data.cend());
-      swap(Temp);
+      for (const_iterator current = list_data.cbegin(); current != list_data.cend(); ++current)
+      {
+        push_back(*current);
+      }
     }
-    list(list<list_type> &&list_data) noexcept
+    list(list &&list_data) noexcept
+        : _pool(std::move(list_data._pool))
     {
-      create_head(); // 移动构造
-      _head = std::move(list_data._head);
-      list_data._head = nullptr;
+      // 移动构造，节点随节点池一起转移，原对象换上新的哨兵位
+      _head = list_data._head;
+      list_data.create_head();
     }
-    void swap(list_container::list<list_type> &swap_target) noexcept
+    void swap(list &swap_target) noexcept
     {
       standard_con::algorithm::swap(_head, swap_target._head);
+      _pool.swap(swap_target._pool);
     }
     [[nodiscard]] iterator begin() noexcept
     {
@@ -479,7 +527,7 @@ namespace list_container
         {
           throw custom_exception::fault("传入迭代器参数为空", "list::insert", __LINE__);
         }
-        auto *new_container_node(new container_node(list_type_data));
+        auto *new_container_node(_pool.create(list_type_data));
         // 开辟新节点
         container_node *iterator_current_node = iterator_position._node;
         // 保存pos位置的值
@@ -508,7 +556,7 @@ namespace list_container
         {
           throw custom_exception::fault("传入迭代器参数为空", "list::insert移动语义版本", __LINE__);
         }
-        auto *new_container_node = new container_node(std::forward<list_type>(list_type_data));
+        auto *new_container_node = _pool.create(std::forward<list_type>(list_type_data));
         container_node *iterator_current_node = iterator_position._node;
         new_container_node->_prev = iterator_current_node->_prev;
         new_container_node->_next = iterator_current_node;
@@ -540,7 +588,7 @@ namespace list_container
 
         iterator_delete_node->_prev->_next = iterator_delete_node->_next; // 将该节点从链表中拆下来并删除
         iterator_delete_node->_next->_prev = iterator_delete_node->_prev;
-        delete iterator_delete_node;
+        _pool.destroy(iterator_delete_node);
 
         return iterator(next_element_node);
       }
@@ -572,23 +620,26 @@ namespace list_container
     }
     void clear() noexcept
     {
-      // 循环释放资源
-      container_node *current_node = _head->_next;
-      // 采用头删除
-      while (current_node != _head)
+      // 逐个析构元素后整体归还节点池内存，元素可平凡析构时跳过遍历
+      if constexpr (!pool_type::trivially_releasable)
       {
-        _head->_next = current_node->_next;
-        delete current_node;
-        current_node = _head->_next;
+        container_node *current_node = _head->_next;
+        while (current_node != _head)
+        {
+          container_node *next_node = current_node->_next;
+          std::destroy_at(current_node);
+          current_node = next_node;
+        }
       }
+      _pool.release();
       _head->_next = _head->_prev = _head;
     }
-    list &operator=(const list<list_type> &list_data) noexcept
+    list &operator=(const list &list_data)
     {
-      // 拷贝赋值
+      // 拷贝赋值，副本沿用本容器的分配器
       if (this != &list_data)
       {
-        list<list_type> copy_list_object(list_data);
+        list copy_list_object(list_data.cbegin(), list_data.cend(), get_allocator());
         swap(copy_list_object);
       }
       return *this;
@@ -602,19 +653,22 @@ namespace list_container
       }
       return *this;
     }
-    list &operator=(list<list_type> &&list_data) noexcept
+    list &operator=(list &&list_data) noexcept
     {
       if (this != &list_data)
       {
-        _head = std::move(list_data._head);
+        clear();
+        destroy_head();
+        _head = list_data._head;
+        _pool = std::move(list_data._pool);
         list_data.create_head();
         // 防止移动之后类判空空指针
       }
       return *this;
     }
-    list operator+(const list<list_type> &list_data)
+    list operator+(const list &list_data)
     {
-      list<list_type> return_list_object(cbegin(), cend());
+      list return_list_object(cbegin(), cend(), get_allocator());
       const_iterator start_position_iterator = list_data.cbegin();
       const_iterator end_position_iterator = list_data.cend();
       while (start_position_iterator != end_position_iterator)
@@ -624,7 +678,7 @@ namespace list_container
       }
       return return_list_object;
     }
-    list &operator+=(const list<list_type> &list_data)
+    list &operator+=(const list &list_data)
     {
       const_iterator start_position_iterator = list_data.cbegin();
       const_iterator end_position_iterator = list_data.cend();
@@ -635,13 +689,13 @@ namespace list_container
       }
       return *this;
     }
-    template <typename const_list_output_templates>
-    friend std::ostream &operator<<(std::ostream &list_ostream, const list<const_list_output_templates> &dynamic_arrays_data);
+    template <typename const_list_output_templates, typename const_list_output_allocator>
+    friend std::ostream &operator<<(std::ostream &list_ostream, const list<const_list_output_templates, const_list_output_allocator> &dynamic_arrays_data);
   };
-  template <typename const_list_output_templates>
-  std::ostream &operator<<(std::ostream &list_ostream, const list<const_list_output_templates> &dynamic_arrays_data)
+  template <typename const_list_output_templates, typename const_list_output_allocator>
+  std::ostream &operator<<(std::ostream &list_ostream, const list<const_list_output_templates, const_list_output_allocator> &dynamic_arrays_data)
   {
-    typename list<const_list_output_templates>::const_iterator it = dynamic_arrays_data.cbegin();
+    typename list<const_list_output_templates, const_list_output_allocator>::const_iterator it = dynamic_arrays_data.cbegin();
     while (it != dynamic_arrays_data.cend())
     {
       list_ostream << *it << " ";
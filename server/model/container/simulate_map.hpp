@@ -1,5 +1,8 @@
 #pragma once
 #include "simulate_base.hpp"
+#include "simulate_btree.hpp"
+#include "simulate_swiss.hpp"
+#include "simulate_flat.hpp"
 namespace map_container
 {
   /**
@@ -21,6 +24,8 @@ namespace map_container
    *
    *   - 定义键的排序规则，返回 `true` 表示左操作数小于右操作数，决定键的排列顺序
    *
+   * * - `map_allocator`: 分配器类型，默认为 `std::allocator<standard_con::pair<map_type_k, map_type_v>>`，转交底层容器；传入 `polymorphic_allocator` 可使用竞技场等内存资源
+   *
    * 迭代器类型:
    * 继承自底层红黑树的迭代器，支持正向、反向遍历，以及常量版本：
    *
@@ -33,8 +38,15 @@ namespace map_container
    * * - `const_reverse_iterator`: 常量反向迭代器，按逆序遍历不可修改的键值对
    *
    * * - `map_iterator`: 插入操作返回类型，为 `standard_con::pair<iterator, bool>`，其中 `iterator` 指向插入位置（或已有键的位置），`bool` 表示是否插入成功
+   *
+   * 顺序统计:
+   *
+   * * - `select(index)`: 返回按序第 `index` 个（从 0 开始）键的迭代器，越界返回 `end()`，可直接用于分位数（如 p99 取 `select(size() * 99 / 100)`）
+   *
+   * * - `rank(key)`: 返回小于 `key` 的键个数
    */
-  template <typename map_type_k, typename map_type_v, typename comparators = standard_con::less<map_type_k>>
+  template <typename map_type_k, typename map_type_v, typename comparators = standard_con::less<map_type_k>,
+            typename map_allocator = std::allocator<standard_con::pair<map_type_k, map_type_v>>>
   class tree_map
   {
     using key_val_type = standard_con::pair<map_type_k, map_type_v>;
@@ -45,7 +57,7 @@ namespace map_container
         return key_value.first;
       }
     };
-    using instance_rb = standard_con::red_black_tree<map_type_k, key_val_type, key_val, comparators>;
+    using instance_rb = standard_con::red_black_tree<map_type_k, key_val_type, key_val, comparators, map_allocator>;
     instance_rb instance_tree_map;
 
   public:
@@ -97,9 +109,15 @@ namespace map_container
     }
     tree_map() { ; }
 
-    tree_map(const tree_map &tree_map_data) { instance_tree_map = tree_map_data.instance_tree_map; }
+    tree_map(const tree_map &tree_map_data) : instance_tree_map(tree_map_data.instance_tree_map) { ; }
+
+    tree_map(tree_map &&tree_map_data) noexcept : instance_tree_map(std::move(tree_map_data.instance_tree_map)) { ; }
+
+    using allocator_type = map_allocator;
 
-    tree_map(tree_map &&tree_map_data) noexcept { instance_tree_map = std::move(tree_map_data.instance_tree_map); }
+    explicit tree_map(const map_allocator &allocator_data) : instance_tree_map(allocator_data) { ; }
+
+    [[nodiscard]] allocator_type get_allocator() const noexcept { return instance_tree_map.get_allocator(); }
 
     explicit tree_map(const key_val_type &tree_map_data)
     {
@@ -112,6 +130,11 @@ namespace map_container
 
     iterator find(const key_val_type &tree_map_data) { return instance_tree_map.find(tree_map_data); }
 
+    iterator select(const uint64_t element_index) { return instance_tree_map.select(element_index); }
+    const_iterator select(const uint64_t element_index) const { return instance_tree_map.select(element_index); }
+
+    [[nodiscard]] uint64_t rank(const map_type_k &key_data) const { return instance_tree_map.rank(key_data); }
+
     void middle_order_traversal() { instance_tree_map.middle_order_traversal(); }
 
     void pre_order_traversal() { instance_tree_map.pre_order_traversal(); }
@@ -127,9 +150,9 @@ namespace map_container
 
     iterator end() { return instance_tree_map.end(); }
 
-    const_iterator cbegin() { return instance_tree_map.cbegin(); }
+    const_iterator cbegin() const { return instance_tree_map.cbegin(); }
 
-    const_iterator cend() { return instance_tree_map.cend(); }
+    const_iterator cend() const { return instance_tree_map.cend(); }
 
     reverse_iterator rbegin() { return instance_tree_map.rbegin(); }
 
@@ -141,14 +164,293 @@ namespace map_container
 
     iterator operator[](const key_val_type &tree_map_data) { return instance_tree_map[tree_map_data]; }
   };
+  /**
+   * @brief 基于 B+ 树实现的有序键值对映射容器
+   *
+   * 接口与 `tree_map` 一致，底层换成宽节点 B+ 树（b_plus_tree），查找、插入、删除同样为 O(log n)。
+   *
+   * 每个节点连续存放数十个键，树高远低于红黑树，查找时访问的缓存行更少；键值对全部存放在叶节点，
+   *
+   * 叶节点以链表串联，配合 `lower_bound` / `upper_bound` 做范围遍历时只需顺序扫描。
+   *
+   * 模板参数:
+   *
+   * * - `map_type_k`: 键（key）的类型，需可默认构造与赋值
+   *
+   * * - `map_type_v`: 值（value）的类型，需可默认构造与赋值
+   *
+   * * - `comparators`: 键的比较器类型，默认为 `standard_con::less<map_type_k>`
+   *
+   *   - 键为有符号 32/64 位整数且使用默认比较器时，节点内查找走 SIMD 批量比较
+   *
+   * * - `map_allocator`: 分配器类型，默认为 `std::allocator<standard_con::pair<map_type_k, map_type_v>>`，转交底层容器；传入 `polymorphic_allocator` 可使用竞技场等内存资源
+   *
+   * 注意事项:
+   *
+   * * - 插入、删除会在节点内移动元素，修改后之前取得的迭代器全部失效，这一点与 `tree_map` 不同
+   */
+  template <typename map_type_k, typename map_type_v, typename comparators = standard_con::less<map_type_k>,
+            typename map_allocator = std::allocator<standard_con::pair<map_type_k, map_type_v>>>
+  class btree_map
+  {
+    using key_val_type = standard_con::pair<map_type_k, map_type_v>;
+    struct key_val
+    {
+      const map_type_k &operator()(const key_val_type &key_value)
+      {
+        return key_value.first;
+      }
+    };
+    using instance_btree = standard_con::b_plus_tree<map_type_k, key_val_type, key_val, comparators, map_allocator>;
+    instance_btree instance_btree_map;
+
+  public:
+    using iterator = typename instance_btree::iterator;
+    using const_iterator = typename instance_btree::const_iterator;
+    using reverse_iterator = typename instance_btree::reverse_iterator;
+    using const_reverse_iterator = typename instance_btree::const_reverse_iterator;
+
+    using map_iterator = standard_con::pair<iterator, bool>;
+
+    btree_map() { ; }
+
+    ~btree_map() = default;
+
+    btree_map(const std::initializer_list<key_val_type> &lightweight_container)
+    {
+      for (auto &chained_values : lightweight_container)
+      {
+        instance_btree_map.push(chained_values);
+      }
+    }
+    btree_map(const btree_map &btree_map_data) : instance_btree_map(btree_map_data.instance_btree_map) { ; }
+
+    btree_map(btree_map &&btree_map_data) noexcept : instance_btree_map(std::move(btree_map_data.instance_btree_map)) { ; }
+
+    using allocator_type = map_allocator;
+
+    explicit btree_map(const map_allocator &allocator_data) : instance_btree_map(allocator_data) { ; }
+
+    [[nodiscard]] allocator_type get_allocator() const noexcept { return instance_btree_map.get_allocator(); }
+
+    explicit btree_map(const key_val_type &btree_map_data) { instance_btree_map.push(btree_map_data); }
+
+    explicit btree_map(key_val_type &&btree_map_data) { instance_btree_map.push(std::move(btree_map_data)); }
+
+    btree_map &operator=(const btree_map &btree_map_data)
+    {
+      if (this != &btree_map_data)
+      {
+        instance_btree_map = btree_map_data.instance_btree_map;
+      }
+      return *this;
+    }
+    btree_map &operator=(btree_map &&btree_map_data) noexcept
+    {
+      if (this != &btree_map_data)
+      {
+        instance_btree_map = std::move(btree_map_data.instance_btree_map);
+      }
+      return *this;
+    }
+    btree_map &operator=(std::initializer_list<key_val_type> lightweight_container)
+    {
+      for (auto &chained_values : lightweight_container)
+      {
+        instance_btree_map.push(chained_values);
+      }
+      return *this;
+    }
+    map_iterator push(const key_val_type &btree_map_data) { return instance_btree_map.push(btree_map_data); }
+
+    map_iterator push(key_val_type &&btree_map_data) { return instance_btree_map.push(std::move(btree_map_data)); }
+
+    map_iterator pop(const key_val_type &btree_map_data) { return instance_btree_map.pop(btree_map_data); }
+
+    iterator find(const key_val_type &btree_map_data) { return instance_btree_map.find(btree_map_data); }
+
+    iterator lower_bound(const map_type_k &key_data) { return instance_btree_map.lower_bound(key_data); }
+
+    iterator upper_bound(const map_type_k &key_data) { return instance_btree_map.upper_bound(key_data); }
+
+    void middle_order_traversal() { instance_btree_map.middle_order_traversal(); }
+
+    void pre_order_traversal() { instance_btree_map.pre_order_traversal(); }
+
+    [[nodiscard]] uint64_t size() const
+    {
+      return instance_btree_map.size();
+    }
+
+    bool empty() { return instance_btree_map.empty(); }
+
+    void clear() { instance_btree_map.clear(); }
+
+    iterator begin() { return instance_btree_map.begin(); }
+
+    iterator end() { return instance_btree_map.end(); }
+
+    const_iterator cbegin() { return instance_btree_map.cbegin(); }
+
+    const_iterator cend() { return instance_btree_map.cend(); }
+
+    reverse_iterator rbegin() { return instance_btree_map.rbegin(); }
+
+    reverse_iterator rend() { return instance_btree_map.rend(); }
+
+    const_reverse_iterator crbegin() { return instance_btree_map.crbegin(); }
+
+    const_reverse_iterator crend() { return instance_btree_map.crend(); }
+
+    iterator operator[](const key_val_type &btree_map_data) { return instance_btree_map[btree_map_data]; }
+  };
+  /**
+   * @brief 基于有序数组实现的键值对映射容器
+   *
+   * 键值对按键升序连续存放在 `standard_con::vector` 中（底层为 flat_tree），没有节点指针，内存占用约为元素本身。
+   *
+   * 查找为无分支二分 O(log n)，访问的都是同一块连续内存；单点插入、删除需要移动其后的元素，为 O(n)。
+   *
+   * 适合构建后很少修改的小型查表：先用初始化列表或 `push_bulk` 一次性装入，之后只做查找。
+   *
+   * 模板参数:
+   *
+   * * - `map_type_k`: 键（key）的类型，用于排序和唯一标识
+   *
+   * * - `map_type_v`: 值（value）的类型，与键关联的数据
+   *
+   * * - `comparators`: 键的比较器类型，默认为 `standard_con::less<map_type_k>`
+   *
+   * * - `map_allocator`: 分配器类型，默认为 `std::allocator<standard_con::pair<map_type_k, map_type_v>>`，直接为底层数组提供内存
+   *
+   * 批量插入:
+   *
+   * * - `push_bulk(first, last)`: 整批追加后排序、去重，再与原有元素原地归并；初始化列表构造同样走这条路径
+   *
+   * * - 与已有键重复的键值对被丢弃，批内重复键保留其中之一
+   *
+   * 注意事项:
+   *
+   * * - 迭代器为元素指针，任何插入、删除之后之前取得的迭代器全部失效
+   */
+  template <typename map_type_k, typename map_type_v, typename comparators = standard_con::less<map_type_k>,
+            typename map_allocator = std::allocator<standard_con::pair<map_type_k, map_type_v>>>
+  class flat_map
+  {
+    using key_val_type = standard_con::pair<map_type_k, map_type_v>;
+    struct key_val
+    {
+      const map_type_k &operator()(const key_val_type &key_value)
+      {
+        return key_value.first;
+      }
+    };
+    using instance_flat = standard_con::flat_tree<map_type_k, key_val_type, key_val, comparators, map_allocator>;
+    instance_flat instance_flat_map;
+
+  public:
+    using iterator = typename instance_flat::iterator;
+    using const_iterator = typename instance_flat::const_iterator;
+
+    using map_iterator = standard_con::pair<iterator, bool>;
+
+    flat_map() { ; }
+
+    ~flat_map() = default;
+
+    flat_map(const std::initializer_list<key_val_type> &lightweight_container) : instance_flat_map(lightweight_container) { ; }
+
+    flat_map(const flat_map &flat_map_data) : instance_flat_map(flat_map_data.instance_flat_map) { ; }
+
+    flat_map(flat_map &&flat_map_data) noexcept : instance_flat_map(std::move(flat_map_data.instance_flat_map)) { ; }
+
+    using allocator_type = map_allocator;
+
+    explicit flat_map(const map_allocator &allocator_data) : instance_flat_map(allocator_data) { ; }
+
+    [[nodiscard]] allocator_type get_allocator() const noexcept { return instance_flat_map.get_allocator(); }
+
+    explicit flat_map(const key_val_type &flat_map_data) { instance_flat_map.push(flat_map_data); }
+
+    explicit flat_map(key_val_type &&flat_map_data) { instance_flat_map.push(std::move(flat_map_data)); }
+
+    flat_map &operator=(const flat_map &flat_map_data)
+    {
+      if (this != &flat_map_data)
+      {
+        instance_flat_map = flat_map_data.instance_flat_map;
+      }
+      return *this;
+    }
+    flat_map &operator=(flat_map &&flat_map_data) noexcept
+    {
+      if (this != &flat_map_data)
+      {
+        instance_flat_map = std::move(flat_map_data.instance_flat_map);
+      }
+      return *this;
+    }
+    flat_map &operator=(std::initializer_list<key_val_type> lightweight_container)
+    {
+      instance_flat_map.push_bulk(lightweight_container);
+      return *this;
+    }
+    map_iterator push(const key_val_type &flat_map_data) { return instance_flat_map.push(flat_map_data); }
+
+    map_iterator push(key_val_type &&flat_map_data) { return instance_flat_map.push(std::move(flat_map_data)); }
+
+    template <typename input_iterator>
+    void push_bulk(input_iterator first_position, input_iterator last_position) { instance_flat_map.push_bulk(first_position, last_position); }
+
+    void push_bulk(std::initializer_list<key_val_type> lightweight_container) { instance_flat_map.push_bulk(lightweight_container); }
+
+    map_iterator pop(const key_val_type &flat_map_data) { return instance_flat_map.pop(flat_map_data); }
+
+    iterator erase(iterator position) noexcept { return instance_flat_map.erase(position); }
+
+    iterator find(const key_val_type &flat_map_data) { return instance_flat_map.find(flat_map_data); }
+
+    iterator find_key(const map_type_k &key_data) { return instance_flat_map.find_key(key_data); }
+
+    iterator lower_bound(const map_type_k &key_data) { return instance_flat_map.lower_bound(key_data); }
+
+    iterator upper_bound(const map_type_k &key_data) { return instance_flat_map.upper_bound(key_data); }
+
+    void middle_order_traversal() { instance_flat_map.middle_order_traversal(); }
+
+    flat_map &reserve(const uint64_t &new_capacity)
+    {
+      instance_flat_map.reserve(new_capacity);
+      return *this;
+    }
+
+    [[nodiscard]] uint64_t size() const
+    {
+      return instance_flat_map.size();
+    }
+
+    bool empty() { return instance_flat_map.empty(); }
+
+    void clear() { instance_flat_map.clear(); }
+
+    iterator begin() { return instance_flat_map.begin(); }
+
+    iterator end() { return instance_flat_map.end(); }
+
+    const_iterator cbegin() { return instance_flat_map.cbegin(); }
+
+    const_iterator cend() { return instance_flat_map.cend(); }
+
+    iterator operator[](const key_val_type &flat_map_data) { return instance_flat_map[flat_map_data]; }
+  };
   /**
    * @brief 基于哈希表实现的无序键值对映射容器
    *
    * 该容器是一个无序关联容器，存储键值对（key-value），通过哈希函数实现高效的插入、删除和查找操作。
    *
-   * 底层依赖哈希表（hash_table）实现，键具有唯一性，不允许重复键。
+   * 底层依赖开放寻址哈希表（swiss_table）实现，键具有唯一性，不允许重复键。
    *
-   * 哈希函数通过组合键和值的哈希结果减少冲突，平均时间复杂度为 O(1)，最坏情况为 O(n)（哈希冲突严重时）。
+   * 元素直接存放在连续槽位中，查找以 16 个控制字节为一组并行比较，平均时间复杂度为 O(1)。
    *
    * 模板参数:
    *
@@ -157,21 +459,27 @@ namespace map_container
    * * - `hash_map_type_value`: 值（value）的类型，与键关联的数据
    *
    * * - `first_external_hash_functions`: 键的哈希函数类型，默认为 `standard_con::imitation_functions::hash_imitation_functions`
-   *   - 用于计算键的哈希值，影响键在哈希表中的映射位置
+   *   - 用于计算键的哈希值，结果在表内再经过混合，影响键在哈希表中的映射位置
+   *
+   * * - `second_external_hash_functions`: 值的哈希函数类型，保留以兼容旧接口的参数位置，不参与计算
+   *   - 哈希只作用于键，按键查找时无需知道值
+   *
+   * * - `insertion_ordered`: 为 `true` 时按插入顺序遍历，默认 `false` 按槽位顺序遍历
    *
-   * * - `second_external_hash_functions`: 值的哈希函数类型，默认为 `standard_con::imitation_functions::hash_imitation_functions`
-   *   - 用于计算值的哈希值，与键的哈希值组合生成最终哈希结果，减少冲突
+   * * - `map_allocator`: 分配器类型，默认为 `std::allocator<standard_con::pair<hash_map_type_key, hash_map_type_value>>`，为槽位数组提供内存
    *
    * 迭代器类型:
-   * 继承自底层哈希表的迭代器，支持按插入顺序遍历，包含普通和常量版本：
+   * 继承自底层哈希表的迭代器，包含普通和常量版本：
    *
-   * * - `iterator`: 正向迭代器，指向键值对，支持按插入顺序遍历
+   * * - `iterator`: 正向迭代器，指向键值对
    *
    * * - `const_iterator`: 常量正向迭代器，指向不可修改的键值对
    */
   template <typename hash_map_type_key, typename hash_map_type_value,
             typename first_external_hash_functions = standard_con::hash_imitation_functions,
-            typename second_external_hash_functions = standard_con::hash_imitation_functions> // 两个对应的hash函数
+            typename second_external_hash_functions = standard_con::hash_imitation_functions, // 两个对应的hash函数
+            bool insertion_ordered = false,
+            typename map_allocator = std::allocator<standard_con::pair<hash_map_type_key, hash_map_type_value>>>
   class hash_map
   {
     using key_val_type = standard_con::pair<hash_map_type_key, hash_map_type_value>;
@@ -182,23 +490,7 @@ namespace map_container
         return key_value.first;
       }
     };
-    class inbuilt_map_hash_functor
-    {
-    private:
-      first_external_hash_functions first_hash_functions_object;
-      second_external_hash_functions second_hash_functions_object;
-
-    public:
-      uint64_t operator()(const key_val_type &key_value) noexcept
-      {
-        uint64_t first_hash_value = first_hash_functions_object(key_value.first);
-        first_hash_value = first_hash_value * 31;
-        uint64_t second_hash_value = second_hash_functions_object(key_value.second);
-        second_hash_value = second_hash_value * 31;
-        return (first_hash_value + second_hash_value);
-      }
-    };
-    using hash_table = standard_con::hash_table<hash_map_type_key, key_val_type, key_val, inbuilt_map_hash_functor>;
+    using hash_table = standard_con::swiss_table<hash_map_type_key, key_val_type, key_val, first_external_hash_functions, insertion_ordered, map_allocator>;
     hash_table instance_hash_map;
 
   public:
@@ -210,9 +502,15 @@ namespace map_container
 
     explicit hash_map(const key_val_type &key_value) { instance_hash_map.push(key_value); }
 
-    hash_map(const hash_map &hash_map_data) { instance_hash_map = hash_map_data.instance_hash_map; }
+    hash_map(const hash_map &hash_map_data) : instance_hash_map(hash_map_data.instance_hash_map) { ; }
 
-    hash_map(hash_map &&hash_map_data) noexcept { instance_hash_map = std::move(hash_map_data.instance_hash_map); }
+    hash_map(hash_map &&hash_map_data) noexcept : instance_hash_map(std::move(hash_map_data.instance_hash_map)) { ; }
+
+    using allocator_type = map_allocator;
+
+    explicit hash_map(const map_allocator &allocator_data) : instance_hash_map(allocator_data) { ; }
+
+    [[nodiscard]] allocator_type get_allocator() const noexcept { return instance_hash_map.get_allocator(); }
 
     bool push(const key_val_type &key_value) { return instance_hash_map.push(key_value); }
 
@@ -234,6 +532,10 @@ namespace map_container
 
     bool empty() { return instance_hash_map.empty(); }
 
+    void reserve(uint64_t element_count) { instance_hash_map.reserve(element_count); }
+
+    void clear() { instance_hash_map.clear(); }
+
     iterator begin() { return instance_hash_map.begin(); }
 
     iterator end() { return instance_hash_map.end(); }
@@ -289,4 +591,6 @@ namespace standard_con
 {
   using map_container::hash_map;
   using map_container::tree_map;
+  using map_container::btree_map;
+  using map_container::flat_map;
 }
\ No newline at end of file
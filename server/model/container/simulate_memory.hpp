@@ -0,0 +1,746 @@
+#pragma once
+#include <new>
+#include <bit>
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <cstdint>
+#include <cstddef>
+#include <utility>
+#include <type_traits>
+namespace memory_container
+{
+  /*
+   * @brief  #### `memory_resource` 抽象类
+
+  *   - 内存资源接口，容器通过 `polymorphic_allocator` 向其申请原始内存，不关心具体分配策略
+
+  *   - 同一容器类型可在运行期切换到不同资源（单调竞技场、分级池、线程缓存池等）
+
+   * 主要方法:
+
+   * * - `allocate(bytes, alignment)`: 申请至少 `bytes` 字节、按 `alignment` 对齐的内存，失败抛 `std::bad_alloc`
+   *
+   * * - `deallocate(memory, bytes, alignment)`: 归还内存，参数须与申请时一致
+   *
+   * * - `is_equal(other)`: 一方申请的内存能否由另一方归还
+
+   * 注意事项:
+
+   * * - 资源对象的生命周期必须长于所有使用它的容器
+  */
+  class memory_resource
+  {
+  public:
+    static constexpr uint64_t default_alignment = alignof(std::max_align_t);
+    virtual ~memory_resource() = default;
+    [[nodiscard]] void *allocate(const uint64_t bytes, const uint64_t alignment = default_alignment)
+    {
+      return do_allocate(bytes, alignment);
+    }
+    void deallocate(void *memory, const uint64_t bytes, const uint64_t alignment = default_alignment) noexcept
+    {
+      do_deallocate(memory, bytes, alignment);
+    }
+    [[nodiscard]] bool is_equal(const memory_resource &resource_data) const noexcept
+    {
+      return this == &resource_data || do_is_equal(resource_data);
+    }
+
+  protected:
+    virtual void *do_allocate(uint64_t bytes, uint64_t alignment) = 0;
+    virtual void do_deallocate(void *memory, uint64_t bytes, uint64_t alignment) noexcept = 0;
+    [[nodiscard]] virtual bool do_is_equal(const memory_resource &resource_data) const noexcept
+    {
+      return this == &resource_data;
+    }
+  };
+  inline bool operator==(const memory_resource &left_resource, const memory_resource &right_resource) noexcept
+  {
+    return left_resource.is_equal(right_resource);
+  }
+
+  namespace resource_detail
+  {
+    class new_delete_resource_type final : public memory_resource
+    {
+    protected:
+      void *do_allocate(const uint64_t bytes, const uint64_t alignment) override
+      {
+        return ::operator new(bytes, std::align_val_t{alignment});
+      }
+      void do_deallocate(void *memory, const uint64_t bytes, const uint64_t alignment) noexcept override
+      {
+        ::operator delete(memory, bytes, std::align_val_t{alignment});
+      }
+    };
+    class null_resource_type final : public memory_resource
+    {
+    protected:
+      void *do_allocate(uint64_t, uint64_t) override
+      {
+        throw std::bad_alloc();
+      }
+      void do_deallocate(void *, uint64_t, uint64_t) noexcept override {}
+    };
+    [[nodiscard]] inline std::atomic<memory_resource *> &default_resource_slot() noexcept;
+    [[nodiscard]] constexpr uint64_t align_up(const uint64_t value, const uint64_t alignment) noexcept
+    {
+      return (value + alignment - 1) & ~(alignment - 1);
+    }
+  }
+  /*
+   * @brief  #### `new_delete_resource` 函数
+
+   *   - 返回转发到全局 `operator new` / `operator delete` 的进程级资源，也是默认资源
+  */
+  [[nodiscard]] inline memory_resource *new_delete_resource() noexcept
+  {
+    static resource_detail::new_delete_resource_type resource_instance;
+    return &resource_instance;
+  }
+  /*
+   * @brief  #### `null_memory_resource` 函数
+
+   *   - 任何申请都抛 `std::bad_alloc` 的资源
+
+   *   - 作为竞技场的上游时，可断言热路径在预留缓冲区内完成、从不触及全局堆
+  */
+  [[nodiscard]] inline memory_resource *null_memory_resource() noexcept
+  {
+    static resource_detail::null_resource_type resource_instance;
+    return &resource_instance;
+  }
+  namespace resource_detail
+  {
+    inline std::atomic<memory_resource *> &default_resource_slot() noexcept
+    {
+      static std::atomic<memory_resource *> resource_slot{new_delete_resource()};
+      return resource_slot;
+    }
+  }
+  /*
+   * @brief  #### `default_resource` / `set_default_resource` 函数
+
+   *   - 默认构造的 `polymorphic_allocator` 使用的资源，初始为 `new_delete_resource()`
+
+   *   - `set_default_resource(nullptr)` 恢复为 `new_delete_resource()`，返回旧资源
+  */
+  [[nodiscard]] inline memory_resource *default_resource() noexcept
+  {
+    return resource_detail::default_resource_slot().load(std::memory_order_acquire);
+  }
+  inline memory_resource *set_default_resource(memory_resource *resource_data) noexcept
+  {
+    if (resource_data == nullptr)
+    {
+      resource_data = new_delete_resource();
+    }
+    return resource_detail::default_resource_slot().exchange(resource_data, std::memory_order_acq_rel);
+  }
+
+  /*
+   * @brief  #### `monotonic_arena` 类
+
+  *   - 单调竞技场：指针碰撞分配，`deallocate` 为空操作，内存只在 `reset()` / `release()` / 析构时整体回收
+
+  *   - 适合请求级的临时结构（解析出的请求头、路由查找结果、JSON 临时对象），请求结束时一次性复位
+
+   * 构造参数:
+
+   * * - `initial_buffer` / `buffer_size`: 可选的外部初始缓冲区（如栈上数组），用尽后才向上游申请
+   *
+   * * - `initial_chunk_size`: 首个上游块的大小，之后每块翻倍
+   *
+   * * - `upstream`: 上游资源，默认 `default_resource()`
+
+   * 主要方法:
+
+   * * - `reset()`: 回到初始缓冲区起点，保留最大的上游块供下次复用，其余块归还上游
+   *
+   * * - `release()`: 归还全部上游块
+   *
+   * * - `used_bytes()` / `chunk_count()`: 已分配字节数与持有的上游块数
+
+   * 注意事项:
+
+   * * - 复位后之前分配的内存全部失效，使用它的容器必须先销毁
+   *
+   * * - 非线程安全，每个线程 / 每个请求使用独立实例
+   *
+   * * - 热身后每个请求结束时 `reset()`，后续请求在保留块内完成，不再访问全局堆
+  */
+  class monotonic_arena : public memory_resource
+  {
+    struct chunk_header
+    {
+      chunk_header *_next;
+      uint64_t _chunk_size; // 含头部的总字节数
+    };
+    static constexpr uint64_t chunk_alignment = alignof(std::max_align_t);
+    static constexpr uint64_t header_size = resource_detail::align_up(sizeof(chunk_header), chunk_alignment);
+    static constexpr uint64_t minimum_chunk_size = 1024;
+
+    memory_resource *_upstream;
+    chunk_header *_chunks = nullptr;        // 当前块位于链表头
+    chunk_header *_spare_chunk = nullptr;   // reset() 保留下来待复用的块
+    unsigned char *_initial_buffer = nullptr;
+    uint64_t _initial_size = 0;
+    unsigned char *_cursor = nullptr;
+    unsigned char *_limit = nullptr;
+    uint64_t _next_chunk_size;
+    uint64_t _used_bytes = 0;
+
+    void acquire_chunk(const uint64_t bytes, const uint64_t alignment)
+    {
+      const uint64_t required_size = header_size + bytes + alignment;
+      chunk_header *chunk = nullptr;
+      if (_spare_chunk != nullptr && _spare_chunk->_chunk_size >= required_size)
+      {
+        chunk = _spare_chunk;
+        _spare_chunk = nullptr;
+      }
+      else
+      {
+        uint64_t chunk_size = _next_chunk_size;
+        while (chunk_size < required_size)
+        {
+          chunk_size *= 2;
+        }
+        chunk = static_cast<chunk_header *>(_upstream->allocate(chunk_size, chunk_alignment));
+        chunk->_chunk_size = chunk_size;
+        _next_chunk_size = chunk_size * 2;
+      }
+      chunk->_next = _chunks;
+      _chunks = chunk;
+      _cursor = reinterpret_cast<unsigned char *>(chunk) + header_size;
+      _limit = reinterpret_cast<unsigned char *>(chunk) + chunk->_chunk_size;
+    }
+    void release_chunks(chunk_header *chunk) noexcept
+    {
+      while (chunk != nullptr)
+      {
+        chunk_header *next_chunk = chunk->_next;
+        _upstream->deallocate(chunk, chunk->_chunk_size, chunk_alignment);
+        chunk = next_chunk;
+      }
+    }
+
+  protected:
+    void *do_allocate(const uint64_t bytes, const uint64_t alignment) override
+    {
+      const auto cursor_address = reinterpret_cast<uintptr_t>(_cursor);
+      uint64_t padding = resource_detail::align_up(cursor_address, alignment) - cursor_address;
+      if (_cursor == nullptr || static_cast<uint64_t>(_limit - _cursor) < padding + bytes)
+      {
+        acquire_chunk(bytes, alignment);
+        const auto chunk_address = reinterpret_cast<uintptr_t>(_cursor);
+        padding = resource_detail::align_up(chunk_address, alignment) - chunk_address;
+      }
+      unsigned char *result = _cursor + padding;
+      _cursor = result + bytes;
+      _used_bytes += bytes;
+      return result;
+    }
+    void do_deallocate(void *, uint64_t, uint64_t) noexcept override {}
+
+  public:
+    explicit monotonic_arena(memory_resource *upstream = default_resource(), const uint64_t initial_chunk_size = minimum_chunk_size) noexcept
+        : _upstream(upstream), _next_chunk_size(initial_chunk_size < minimum_chunk_size ? minimum_chunk_size : initial_chunk_size) {}
+    monotonic_arena(void *initial_buffer, const uint64_t buffer_size, memory_resource *upstream = default_resource()) noexcept
+        : _upstream(upstream), _initial_buffer(static_cast<unsigned char *>(initial_buffer)), _initial_size(buffer_size),
+          _cursor(static_cast<unsigned char *>(initial_buffer)), _limit(static_cast<unsigned char *>(initial_buffer) + buffer_size),
+          _next_chunk_size(buffer_size < minimum_chunk_size ? minimum_chunk_size : buffer_size * 2) {}
+    monotonic_arena(const monotonic_arena &) = delete;
+    monotonic_arena &operator=(const monotonic_arena &) = delete;
+    ~monotonic_arena() override
+    {
+      release();
+    }
+    void reset() noexcept
+    {
+      // 保留最大的块（备用块或最近申请的块），其余归还上游
+      chunk_header *kept_chunk = _spare_chunk;
+      for (chunk_header *chunk = _chunks; chunk != nullptr;)
+      {
+        chunk_header *next_chunk = chunk->_next;
+        if (kept_chunk == nullptr || chunk->_chunk_size > kept_chunk->_chunk_size)
+        {
+          std::swap(kept_chunk, chunk);
+        }
+        if (chunk != nullptr)
+        {
+          _upstream->deallocate(chunk, chunk->_chunk_size, chunk_alignment);
+        }
+        chunk = next_chunk;
+      }
+      if (kept_chunk != nullptr)
+      {
+        kept_chunk->_next = nullptr;
+      }
+      _chunks = nullptr;
+      _spare_chunk = kept_chunk;
+      _used_bytes = 0;
+      _cursor = _initial_buffer;
+      _limit = _initial_buffer == nullptr ? nullptr : _initial_buffer + _initial_size;
+    }
+    void release() noexcept
+    {
+      release_chunks(_chunks);
+      release_chunks(_spare_chunk);
+      _chunks = _spare_chunk = nullptr;
+      _used_bytes = 0;
+      _cursor = _initial_buffer;
+      _limit = _initial_buffer == nullptr ? nullptr : _initial_buffer + _initial_size;
+    }
+    [[nodiscard]] uint64_t used_bytes() const noexcept
+    {
+      return _used_bytes;
+    }
+    [[nodiscard]] uint64_t chunk_count() const noexcept
+    {
+      uint64_t count = _spare_chunk == nullptr ? 0 : 1;
+      for (const chunk_header *chunk = _chunks; chunk != nullptr; chunk = chunk->_next)
+      {
+        ++count;
+      }
+      return count;
+    }
+    [[nodiscard]] memory_resource *upstream_resource() const noexcept
+    {
+      return _upstream;
+    }
+  };
+
+  namespace resource_detail
+  {
+    // 分级池的尺寸级别：8、16、32 … 4096 字节，共 10 级
+    inline constexpr uint64_t smallest_class_shift = 3;
+    inline constexpr uint64_t size_class_count = 10;
+    inline constexpr uint64_t max_pooled_size = uint64_t{1} << (smallest_class_shift + size_class_count - 1);
+    [[nodiscard]] constexpr bool pooled(const uint64_t bytes, const uint64_t alignment) noexcept
+    {
+      return bytes <= max_pooled_size && alignment <= alignof(std::max_align_t);
+    }
+    [[nodiscard]] constexpr uint64_t size_class(const uint64_t bytes, const uint64_t alignment) noexcept
+    {
+      // 对齐要求不超过级别大小：块按级别大小排布在按 max_align_t 对齐的块内
+      uint64_t block_size = bytes > alignment ? bytes : alignment;
+      block_size = block_size < (uint64_t{1} << smallest_class_shift) ? (uint64_t{1} << smallest_class_shift) : block_size;
+      return static_cast<uint64_t>(std::bit_width(block_size - 1)) - smallest_class_shift;
+    }
+    [[nodiscard]] constexpr uint64_t class_block_size(const uint64_t class_index) noexcept
+    {
+      return uint64_t{1} << (class_index + smallest_class_shift);
+    }
+    struct free_block
+    {
+      free_block *_next;
+    };
+  }
+  /*
+   * @brief  #### `pool_resource` 类
+
+  *   - 分级内存池：按 8、16、32 … 4096 字节分为 10 个尺寸级别，每级维护独立的空闲链表
+
+  *   - 块从上游整批申请并切分，归还的块挂回所属级别的空闲链表，下次同级申请直接复用
+
+  *   - 超过 4096 字节或对齐要求超过 `max_align_t` 的申请直接转发上游
+
+   * 分配策略:
+
+   * * - 每级首批切分 16 个块，之后每批翻倍，单批上限 64 KiB
+   *
+   * * - `release()` 将全部批次归还上游，调用前所有经由本池申请的内存须已不再使用
+
+   * 注意事项:
+
+   * * - 非线程安全；多线程共享请使用 `thread_cached_resource()`
+  */
+  class pool_resource : public memory_resource
+  {
+    struct chunk_header
+    {
+      chunk_header *_next;
+      uint64_t _chunk_size;
+    };
+    static constexpr uint64_t chunk_alignment = alignof(std::max_align_t);
+    static constexpr uint64_t header_size = resource_detail::align_up(sizeof(chunk_header), chunk_alignment);
+    static constexpr uint64_t first_batch_blocks = 16;
+    static constexpr uint64_t max_batch_bytes = 64 * 1024;
+
+    memory_resource *_upstream;
+    chunk_header *_chunks = nullptr;
+    resource_detail::free_block *_free_lists[resource_detail::size_class_count] = {};
+    uint64_t _next_batch_blocks[resource_detail::size_class_count];
+
+    void refill(const uint64_t class_index)
+    {
+      const uint64_t block_size = resource_detail::class_block_size(class_index);
+      const uint64_t block_count = _next_batch_blocks[class_index];
+      const uint64_t chunk_size = header_size + block_size * block_count;
+      auto *chunk = static_cast<chunk_header *>(_upstream->allocate(chunk_size, chunk_alignment));
+      chunk->_next = _chunks;
+      chunk->_chunk_size = chunk_size;
+      _chunks = chunk;
+      // 逆序串接，使链表头为块内第一个块，顺序分配时地址递增
+      unsigned char *block_base = reinterpret_cast<unsigned char *>(chunk) + header_size;
+      resource_detail::free_block *list_head = _free_lists[class_index];
+      for (uint64_t block_index = block_count; block_index > 0; --block_index)
+      {
+        auto *block = reinterpret_cast<resource_detail::free_block *>(block_base + (block_index - 1) * block_size);
+        block->_next = list_head;
+        list_head = block;
+      }
+      _free_lists[class_index] = list_head;
+      if (block_size * block_count * 2 <= max_batch_bytes)
+      {
+        _next_batch_blocks[class_index] = block_count * 2;
+      }
+    }
+
+  protected:
+    void *do_allocate(const uint64_t bytes, const uint64_t alignment) override
+    {
+      if (!resource_detail::pooled(bytes, alignment))
+      {
+        return _upstream->allocate(bytes, alignment);
+      }
+      const uint64_t class_index = resource_detail::size_class(bytes, alignment);
+      if (_free_lists[class_index] == nullptr)
+      {
+        refill(class_index);
+      }
+      resource_detail::free_block *block = _free_lists[class_index];
+      _free_lists[class_index] = block->_next;
+      return block;
+    }
+    void do_deallocate(void *memory, const uint64_t bytes, const uint64_t alignment) noexcept override
+    {
+      if (!resource_detail::pooled(bytes, alignment))
+      {
+        _upstream->deallocate(memory, bytes, alignment);
+        return;
+      }
+      const uint64_t class_index = resource_detail::size_class(bytes, alignment);
+      auto *block = static_cast<resource_detail::free_block *>(memory);
+      block->_next = _free_lists[class_index];
+      _free_lists[class_index] = block;
+    }
+
+  public:
+    explicit pool_resource(memory_resource *upstream = default_resource()) noexcept
+        : _upstream(upstream)
+    {
+      for (uint64_t &batch_blocks : _next_batch_blocks)
+      {
+        batch_blocks = first_batch_blocks;
+      }
+    }
+    pool_resource(const pool_resource &) = delete;
+    pool_resource &operator=(const pool_resource &) = delete;
+    ~pool_resource() override
+    {
+      release();
+    }
+    void release() noexcept
+    {
+      while (_chunks != nullptr)
+      {
+        chunk_header *next_chunk = _chunks->_next;
+        _upstream->deallocate(_chunks, _chunks->_chunk_size, chunk_alignment);
+        _chunks = next_chunk;
+      }
+      for (uint64_t class_index = 0; class_index < resource_detail::size_class_count; ++class_index)
+      {
+        _free_lists[class_index] = nullptr;
+        _next_batch_blocks[class_index] = first_batch_blocks;
+      }
+    }
+    [[nodiscard]] memory_resource *upstream_resource() const noexcept
+    {
+      return _upstream;
+    }
+  };
+
+  /*
+   * @brief  #### `thread_cached_resource` 函数
+
+  *   - 返回进程级的线程缓存池：共享一个加锁的中央分级池，每个线程另有无锁的本地空闲链表
+
+  *   - 本地链表为空时一次加锁从中央池取一批（32 个块），本地链表超过两批时一次加锁归还一批
+
+  *   - 线程退出时本地缓存整体归还中央池，块可以在任意线程归还
+
+   * 注意事项:
+
+   * * - 中央池在进程生命周期内不析构，线程缓存在任何线程退出时都能安全归还
+   *
+   * * - 超过 4096 字节的申请直接转发 `new_delete_resource()`
+  */
+  class thread_cache_resource final : public memory_resource
+  {
+    static constexpr uint32_t batch_blocks = 32;
+    struct local_cache
+    {
+      resource_detail::free_block *_lists[resource_detail::size_class_count] = {};
+      uint32_t _counts[resource_detail::size_class_count] = {};
+      thread_cache_resource *_owner = nullptr;
+      ~local_cache()
+      {
+        if (_owner != nullptr)
+        {
+          for (uint64_t class_index = 0; class_index < resource_detail::size_class_count; ++class_index)
+          {
+            _owner->flush(*this, class_index, _counts[class_index]);
+          }
+        }
+      }
+    };
+    std::mutex _central_mutex;
+    pool_resource _central{new_delete_resource()};
+
+    [[nodiscard]] local_cache &cache() noexcept
+    {
+      thread_local local_cache cache_instance;
+      cache_instance._owner = this;
+      return cache_instance;
+    }
+    void refill(local_cache &cache_data, const uint64_t class_index)
+    {
+      const uint64_t block_size = resource_detail::class_block_size(class_index);
+      std::lock_guard<std::mutex> central_lock(_central_mutex);
+      for (uint32_t block_index = 0; block_index < batch_blocks; ++block_index)
+      {
+        auto *block = static_cast<resource_detail::free_block *>(_central.allocate(block_size));
+        block->_next = cache_data._lists[class_index];
+        cache_data._lists[class_index] = block;
+      }
+      cache_data._counts[class_index] += batch_blocks;
+    }
+    void flush(local_cache &cache_data, const uint64_t class_index, uint32_t flush_count) noexcept
+    {
+      const uint64_t block_size = resource_detail::class_block_size(class_index);
+      std::lock_guard<std::mutex> central_lock(_central_mutex);
+      cache_data._counts[class_index] -= flush_count;
+      while (flush_count-- > 0)
+      {
+        resource_detail::free_block *block = cache_data._lists[class_index];
+        cache_data._lists[class_index] = block->_next;
+        _central.deallocate(block, block_size);
+      }
+    }
+    thread_cache_resource() = default;
+    friend memory_resource *thread_cached_resource();
+
+  protected:
+    void *do_allocate(const uint64_t bytes, const uint64_t alignment) override
+    {
+      if (!resource_detail::pooled(bytes, alignment))
+      {
+        return new_delete_resource()->allocate(bytes, alignment);
+      }
+      const uint64_t class_index = resource_detail::size_class(bytes, alignment);
+      local_cache &cache_data = cache();
+      if (cache_data._lists[class_index] == nullptr)
+      {
+        refill(cache_data, class_index);
+      }
+      resource_detail::free_block *block = cache_data._lists[class_index];
+      cache_data._lists[class_index] = block->_next;
+      --cache_data._counts[class_index];
+      return block;
+    }
+    void do_deallocate(void *memory, const uint64_t bytes, const uint64_t alignment) noexcept override
+    {
+      if (!resource_detail::pooled(bytes, alignment))
+      {
+        new_delete_resource()->deallocate(memory, bytes, alignment);
+        return;
+      }
+      const uint64_t class_index = resource_detail::size_class(bytes, alignment);
+      local_cache &cache_data = cache();
+      auto *block = static_cast<resource_detail::free_block *>(memory);
+      block->_next = cache_data._lists[class_index];
+      cache_data._lists[class_index] = block;
+      if (++cache_data._counts[class_index] > batch_blocks * 2)
+      {
+        flush(cache_data, class_index, batch_blocks);
+      }
+    }
+  };
+  [[nodiscard]] inline memory_resource *thread_cached_resource()
+  {
+    // 有意不析构：线程局部缓存可能在静态对象析构之后才归还
+    static thread_cache_resource *resource_instance = new thread_cache_resource();
+    return resource_instance;
+  }
+
+  /*
+   * @brief  #### `counting_resource` 类
+
+  *   - 计数适配器：把申请转发给上游，同时统计次数与字节数，用于证明热路径没有分配
+
+   * 统计项（`statistics()` 返回快照）:
+
+   * * - `allocation_count` / `deallocation_count`: 申请与归还次数
+   *
+   * * - `bytes_in_use` / `peak_bytes`: 当前未归还字节数与其历史峰值
+   *
+   * * - `total_bytes`: 累计申请字节数
+
+   * 用法:
+
+   * * - 作为竞技场或池的上游，热身后 `reset_statistics()`，跑完热路径断言 `allocation_count == 0`
+   *
+   * * - `set_default_resource(&counter)` 后，默认构造的 `polymorphic_allocator` 也会被统计
+
+   * 注意事项:
+
+   * * - 计数使用原子变量，可被多个线程同时使用
+  */
+  class counting_resource : public memory_resource
+  {
+  public:
+    struct allocation_statistics
+    {
+      uint64_t allocation_count = 0;
+      uint64_t deallocation_count = 0;
+      uint64_t bytes_in_use = 0;
+      uint64_t peak_bytes = 0;
+      uint64_t total_bytes = 0;
+    };
+
+  private:
+    memory_resource *_upstream;
+    std::atomic<uint64_t> _allocation_count{0};
+    std::atomic<uint64_t> _deallocation_count{0};
+    std::atomic<uint64_t> _bytes_in_use{0};
+    std::atomic<uint64_t> _peak_bytes{0};
+    std::atomic<uint64_t> _total_bytes{0};
+
+  protected:
+    void *do_allocate(const uint64_t bytes, const uint64_t alignment) override
+    {
+      void *memory = _upstream->allocate(bytes, alignment);
+      _allocation_count.fetch_add(1, std::memory_order_relaxed);
+      _total_bytes.fetch_add(bytes, std::memory_order_relaxed);
+      const uint64_t bytes_in_use = _bytes_in_use.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+      uint64_t peak_bytes = _peak_bytes.load(std::memory_order_relaxed);
+      while (peak_bytes < bytes_in_use && !_peak_bytes.compare_exchange_weak(peak_bytes, bytes_in_use, std::memory_order_relaxed))
+      {
+      }
+      return memory;
+    }
+    void do_deallocate(void *memory, const uint64_t bytes, const uint64_t alignment) noexcept override
+    {
+      _upstream->deallocate(memory, bytes, alignment);
+      _deallocation_count.fetch_add(1, std::memory_order_relaxed);
+      _bytes_in_use.fetch_sub(bytes, std::memory_order_relaxed);
+    }
+
+  public:
+    explicit counting_resource(memory_resource *upstream = new_delete_resource()) noexcept
+        : _upstream(upstream) {}
+    counting_resource(const counting_resource &) = delete;
+    counting_resource &operator=(const counting_resource &) = delete;
+    [[nodiscard]] allocation_statistics statistics() const noexcept
+    {
+      allocation_statistics statistics_data;
+      statistics_data.allocation_count = _allocation_count.load(std::memory_order_relaxed);
+      statistics_data.deallocation_count = _deallocation_count.load(std::memory_order_relaxed);
+      statistics_data.bytes_in_use = _bytes_in_use.load(std::memory_order_relaxed);
+      statistics_data.peak_bytes = _peak_bytes.load(std::memory_order_relaxed);
+      statistics_data.total_bytes = _total_bytes.load(std::memory_order_relaxed);
+      return statistics_data;
+    }
+    [[nodiscard]] uint64_t allocation_count() const noexcept
+    {
+      return _allocation_count.load(std::memory_order_relaxed);
+    }
+    // 清零次数与累计量；未归还的字节数保持不变，峰值从当前用量重新计
+    void reset_statistics() noexcept
+    {
+      _allocation_count.store(0, std::memory_order_relaxed);
+      _deallocation_count.store(0, std::memory_order_relaxed);
+      _total_bytes.store(0, std::memory_order_relaxed);
+      _peak_bytes.store(_bytes_in_use.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+    [[nodiscard]] memory_resource *upstream_resource() const noexcept
+    {
+      return _upstream;
+    }
+  };
+
+  /*
+   * @brief  #### `polymorphic_allocator` 类模板
+
+  *   - 持有 `memory_resource *` 的分配器，满足标准分配器要求，可作为 `standard_con` 各容器的分配器参数
+
+  *   - 不同资源的分配器类型相同，同一容器类型可以在不同请求中使用不同资源
+
+   * 传播规则:
+
+   * * - 拷贝构造容器时副本使用 `default_resource()`，不继承源容器的资源（与 `std::pmr` 一致）
+   *
+   * * - 容器的拷贝 / 移动赋值与交换不传播分配器
+   *
+   * * - 节点池容器例外：节点池交换或移动时连同分配器一起转移，保证内存总由申请它的资源归还
+  */
+  template <typename value_type_allocator>
+  class polymorphic_allocator
+  {
+    memory_resource *_resource;
+
+  public:
+    using value_type = value_type_allocator;
+    polymorphic_allocator() noexcept
+        : _resource(default_resource()) {}
+    polymorphic_allocator(memory_resource *resource_data) noexcept
+        : _resource(resource_data) {}
+    template <typename other_type>
+    polymorphic_allocator(const polymorphic_allocator<other_type> &allocator_data) noexcept
+        : _resource(allocator_data.resource()) {}
+    polymorphic_allocator(const polymorphic_allocator &) noexcept = default;
+    polymorphic_allocator &operator=(const polymorphic_allocator &) noexcept = default;
+    [[nodiscard]] value_type *allocate(const std::size_t element_count)
+    {
+      if (element_count > UINT64_MAX / sizeof(value_type))
+      {
+        throw std::bad_array_new_length();
+      }
+      return static_cast<value_type *>(_resource->allocate(element_count * sizeof(value_type), alignof(value_type)));
+    }
+    void deallocate(value_type *memory, const std::size_t element_count) noexcept
+    {
+      _resource->deallocate(memory, element_count * sizeof(value_type), alignof(value_type));
+    }
+    [[nodiscard]] memory_resource *resource() const noexcept
+    {
+      return _resource;
+    }
+    [[nodiscard]] polymorphic_allocator select_on_container_copy_construction() const noexcept
+    {
+      return polymorphic_allocator();
+    }
+    template <typename other_type>
+    bool operator==(const polymorphic_allocator<other_type> &allocator_data) const noexcept
+    {
+      return *_resource == *allocator_data.resource();
+    }
+  };
+}
+namespace standard_con
+{
+  using memory_container::counting_resource;
+  using memory_container::default_resource;
+  using memory_container::memory_resource;
+  using memory_container::monotonic_arena;
+  using memory_container::new_delete_resource;
+  using memory_container::null_memory_resource;
+  using memory_container::polymorphic_allocator;
+  using memory_container::pool_resource;
+  using memory_container::set_default_resource;
+  using memory_container::thread_cache_resource;
+  using memory_container::thread_cached_resource;
+}
@@ -0,0 +1,299 @@
+#pragma once
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <type_traits>
+namespace perfect_container
+{
+  /*
+   * @brief  #### `perfect_hash_kernel` 命名空间
+
+  *   - `hash_key(key, seed)`: 编译期与运行期结果一致的带种子哈希，字符串按 8 字节分块折叠，整数一次折叠
+
+  *   - 编译期逐字节拼出 64 位字，运行期直接 `memcpy` 读取，两种路径按小端序拼接，结果相同
+
+   * 注意事项:
+
+   * * - 只为构建完美哈希表服务，不做抗碰撞保证，不能用于处理不可信输入的通用哈希表
+  */
+  namespace perfect_hash_kernel
+  {
+    [[nodiscard]] constexpr uint64_t fold(uint64_t value) noexcept
+    {
+      // splitmix64 终结函数：每一位输入都影响所有输出位
+      value ^= value >> 30;
+      value *= 0xbf58476d1ce4e5b9ULL;
+      value ^= value >> 27;
+      value *= 0x94d049bb133111ebULL;
+      return value ^ (value >> 31);
+    }
+    [[nodiscard]] constexpr uint64_t load_word(const char *data, const uint64_t length) noexcept
+    {
+      // 读取 length（不超过 8）个字节，按小端序拼成一个 64 位字
+      if !consteval
+      {
+        if (length == 8 && std::endian::native == std::endian::little)
+        {
+          uint64_t word;
+          std::memcpy(&word, data, sizeof(word));
+          return word;
+        }
+      }
+      uint64_t word = 0;
+      for (uint64_t byte_index = 0; byte_index < length; ++byte_index)
+      {
+        word |= static_cast<uint64_t>(static_cast<unsigned char>(data[byte_index])) << (byte_index * 8);
+      }
+      return word;
+    }
+    [[nodiscard]] constexpr uint64_t hash_key(const std::string_view key, const uint64_t seed) noexcept
+    {
+      uint64_t state = seed ^ (key.size() * 0x9e3779b97f4a7c15ULL);
+      uint64_t offset = 0;
+      for (; offset + 8 <= key.size(); offset += 8)
+      {
+        state = fold(state ^ load_word(key.data() + offset, 8));
+      }
+      // 尾部不足 8 字节时高位补入剩余长度，避免与补零后的较长键相同
+      const uint64_t rest = key.size() - offset;
+      return fold(state ^ load_word(key.data() + offset, rest) ^ (rest << 56));
+    }
+    template <typename integer_type>
+      requires std::is_integral_v<integer_type> || std::is_enum_v<integer_type>
+    [[nodiscard]] constexpr uint64_t hash_key(const integer_type key, const uint64_t seed) noexcept
+    {
+      return fold(seed ^ static_cast<uint64_t>(key));
+    }
+  }
+  /*
+   * @brief  #### `perfect_entry` 类模板
+
+  *   - 完美哈希表的一个键值条目，聚合类型，可直接用 `{键, 值}` 初始化
+  */
+  template <typename perfect_key, typename perfect_value>
+  struct perfect_entry
+  {
+    perfect_key key{};
+    perfect_value value{};
+  };
+  /*
+   * @brief  #### `perfect_hash_map` 类模板
+
+  *   - 键在编译期全部已知的只读映射，由 `make_perfect_hash_map` 在编译期构建，运行期没有任何构造或分配
+
+  *   - 每个键恰好映射到一个槽位，查找为一次哈希 + 一次位移量读取 + 一次键比较，不探测、不遍历链表
+
+   * 模板参数:
+
+   * * - `perfect_key`: 键类型，`std::string_view` 或整数 / 枚举类型
+   *
+   * * - `perfect_value`: 值类型，需为字面类型且可默认构造（如 `std::string_view`、整数、枚举）
+   *
+   * * - `entry_count`: 条目个数，由构建函数根据初始化列表推导
+
+   * 结构（hash-and-displace）:
+
+   * * - 槽位数与桶数均为不小于 `entry_count` 的 2 的幂
+   *
+   * * - 第一层以固定种子把键分到桶；`_displacement[桶]` 为正数时是第二层种子，槽位 = hash(键, 种子) & 掩码；
+   *
+   *     为负数时直接给出槽位 -(值 + 1)；为 0 表示空桶，其中的键必然不存在
+   *
+   * * - 命中槽位后仍比较一次键，不在表中的键返回空
+
+   * 主要方法:
+
+   * * - `find(key)`: 返回指向值的指针，不存在时返回 `nullptr`
+   *
+   * * - `value_or(key, fallback)`: 返回对应的值，不存在时返回 `fallback`
+   *
+   * * - `contains(key)` / `size()`
+
+   * 注意事项:
+
+   * * - 键重复或找不到可用种子时构建失败，表现为编译错误
+   *
+   * * - 适合几十到几百个条目的静态表，条目过多会拖慢编译
+  */
+  template <typename perfect_key, typename perfect_value, uint64_t entry_count>
+  class perfect_hash_map
+  {
+  public:
+    using entry_type = perfect_entry<perfect_key, perfect_value>;
+    static constexpr uint64_t slot_count = entry_count == 0 ? 1 : std::bit_ceil(entry_count);
+    static constexpr uint64_t slot_mask = slot_count - 1;
+    static constexpr uint64_t bucket_seed = 0x243f6a8885a308d3ULL;
+
+  private:
+    entry_type _slots[slot_count]{};
+    bool _occupied[slot_count]{};
+    int64_t _displacement[slot_count]{};
+
+    template <typename builder_key, typename builder_value, uint64_t builder_count>
+    friend consteval perfect_hash_map<builder_key, builder_value, builder_count>
+    make_perfect_hash_map(const perfect_entry<builder_key, builder_value> (&entries)[builder_count]);
+
+    [[nodiscard]] constexpr uint64_t slot_of(const perfect_key &key_data) const noexcept
+    {
+      const int64_t displacement = _displacement[perfect_hash_kernel::hash_key(key_data, bucket_seed) & slot_mask];
+      if (displacement < 0)
+      {
+        return static_cast<uint64_t>(-displacement - 1);
+      }
+      // 空桶（位移量为 0）同样落到某个槽位，由随后的键比较排除
+      return perfect_hash_kernel::hash_key(key_data, static_cast<uint64_t>(displacement)) & slot_mask;
+    }
+
+  public:
+    [[nodiscard]] constexpr const perfect_value *find(const perfect_key &key_data) const noexcept
+    {
+      const uint64_t slot = slot_of(key_data);
+      return _occupied[slot] && _slots[slot].key == key_data ? &_slots[slot].value : nullptr;
+    }
+    [[nodiscard]] constexpr perfect_value value_or(const perfect_key &key_data, const perfect_value &fallback) const noexcept
+    {
+      const perfect_value *value_pointer = find(key_data);
+      return value_pointer != nullptr ? *value_pointer : fallback;
+    }
+    [[nodiscard]] constexpr bool contains(const perfect_key &key_data) const noexcept
+    {
+      return find(key_data) != nullptr;
+    }
+    [[nodiscard]] static constexpr uint64_t size() noexcept
+    {
+      return entry_count;
+    }
+  };
+  /*
+   * @brief  #### `make_perfect_hash_map` 函数模板
+
+  *   - 编译期构建 `perfect_hash_map`：`constexpr auto table = make_perfect_hash_map<K, V>({{k1, v1}, {k2, v2}});`
+
+   * 构建步骤:
+
+   * * - 按第一层哈希分桶，桶按大小从大到小处理
+   *
+   * * - 多键桶从种子 1 开始逐个尝试，直到桶内所有键落在互不相同的空槽位
+   *
+   * * - 单键桶最后直接分配剩余空槽位，不再搜索种子
+  */
+  template <typename perfect_key, typename perfect_value, uint64_t entry_count>
+  consteval perfect_hash_map<perfect_key, perfect_value, entry_count>
+  make_perfect_hash_map(const perfect_entry<perfect_key, perfect_value> (&entries)[entry_count])
+  {
+    using map_type = perfect_hash_map<perfect_key, perfect_value, entry_count>;
+    constexpr uint64_t slot_count = map_type::slot_count;
+    constexpr uint64_t slot_mask = map_type::slot_mask;
+    map_type table;
+    for (uint64_t first_index = 0; first_index < entry_count; ++first_index)
+    {
+      for (uint64_t second_index = first_index + 1; second_index < entry_count; ++second_index)
+      {
+        if (entries[first_index].key == entries[second_index].key)
+        {
+          throw "make_perfect_hash_map: 键重复";
+        }
+      }
+    }
+    uint64_t bucket_of[entry_count == 0 ? 1 : entry_count]{};
+    uint64_t bucket_size[slot_count]{};
+    for (uint64_t entry_index = 0; entry_index < entry_count; ++entry_index)
+    {
+      bucket_of[entry_index] = perfect_hash_kernel::hash_key(entries[entry_index].key, map_type::bucket_seed) & slot_mask;
+      ++bucket_size[bucket_of[entry_index]];
+    }
+    // 桶按大小降序排列，大桶先在较空的表里找种子
+    uint64_t bucket_order[slot_count]{};
+    for (uint64_t bucket_index = 0; bucket_index < slot_count; ++bucket_index)
+    {
+      bucket_order[bucket_index] = bucket_index;
+    }
+    for (uint64_t order_index = 1; order_index < slot_count; ++order_index)
+    {
+      const uint64_t current_bucket = bucket_order[order_index];
+      uint64_t insert_index = order_index;
+      for (; insert_index > 0 && bucket_size[bucket_order[insert_index - 1]] < bucket_size[current_bucket]; --insert_index)
+      {
+        bucket_order[insert_index] = bucket_order[insert_index - 1];
+      }
+      bucket_order[insert_index] = current_bucket;
+    }
+    uint64_t free_slot = 0;
+    for (uint64_t order_index = 0; order_index < slot_count; ++order_index)
+    {
+      const uint64_t bucket = bucket_order[order_index];
+      if (bucket_size[bucket] == 0)
+      {
+        break;
+      }
+      if (bucket_size[bucket] == 1)
+      {
+        for (uint64_t entry_index = 0; entry_index < entry_count; ++entry_index)
+        {
+          if (bucket_of[entry_index] == bucket)
+          {
+            while (table._occupied[free_slot])
+            {
+              ++free_slot;
+            }
+            table._slots[free_slot] = entries[entry_index];
+            table._occupied[free_slot] = true;
+            table._displacement[bucket] = -static_cast<int64_t>(free_slot) - 1;
+            break;
+          }
+        }
+        continue;
+      }
+      bool placed = false;
+      for (uint64_t seed = 1; seed < (uint64_t{1} << 24) && !placed; ++seed)
+      {
+        uint64_t trial_slots[slot_count]{};
+        uint64_t trial_count = 0;
+        bool collided = false;
+        for (uint64_t entry_index = 0; entry_index < entry_count && !collided; ++entry_index)
+        {
+          if (bucket_of[entry_index] != bucket)
+          {
+            continue;
+          }
+          const uint64_t slot = perfect_hash_kernel::hash_key(entries[entry_index].key, seed) & slot_mask;
+          collided = table._occupied[slot];
+          for (uint64_t trial_index = 0; trial_index < trial_count && !collided; ++trial_index)
+          {
+            collided = trial_slots[trial_index] == slot;
+          }
+          trial_slots[trial_count++] = slot;
+        }
+        if (collided)
+        {
+          continue;
+        }
+        trial_count = 0;
+        for (uint64_t entry_index = 0; entry_index < entry_count; ++entry_index)
+        {
+          if (bucket_of[entry_index] == bucket)
+          {
+            table._slots[trial_slots[trial_count]] = entries[entry_index];
+            table._occupied[trial_slots[trial_count]] = true;
+            ++trial_count;
+          }
+        }
+        table._displacement[bucket] = static_cast<int64_t>(seed);
+        placed = true;
+      }
+      if (!placed)
+      {
+        throw "make_perfect_hash_map: 找不到可用的种子";
+      }
+    }
+    return table;
+  }
+}
+namespace standard_con
+{
+  using perfect_container::make_perfect_hash_map;
+  using perfect_container::perfect_entry;
+  using perfect_container::perfect_hash_map;
+  namespace perfect_hash_kernel = perfect_container::perfect_hash_kernel;
+}
@@ -1,5 +1,9 @@
 #pragma once
+#include <new>
 #include <memory>
+#include <atomic>
+#include <utility>
+#include <type_traits>
 #include "simulate_exception.hpp"
 namespace standard_con
 {
@@ -234,6 +238,128 @@ namespace standard_con::pointer
       unique_ptr_data._ptr = nullptr;
     }
   };
+  /*
+   * @brief  #### `control_block` 类
+
+  *   - `shared_ptr` / `weak_ptr` 共用的控制块，以原子变量保存强引用计数与弱引用计数
+
+  *   - 强引用计数归 0 时销毁被管理对象；弱引用计数归 0 时释放控制块本身
+
+  *   - 全部强引用合计持有一个弱引用，因此对象销毁后 `weak_ptr` 仍可安全观察控制块
+
+   * 派生类型:
+
+   * * - `pointer_control_block`: 管理外部传入的原始指针，保存删除器
+
+   * * - `inplace_control_block`: 由 `make_shared` 创建，对象与控制块位于同一块内存
+  */
+  class control_block
+  {
+  private:
+    std::atomic<long> _shared_count{1};
+    std::atomic<long> _weak_count{1};
+
+  protected:
+    virtual void destroy_object() noexcept = 0;
+    virtual void destroy_block() noexcept = 0;
+
+  public:
+    control_block() noexcept = default;
+    control_block(const control_block &) = delete;
+    control_block &operator=(const control_block &) = delete;
+    virtual ~control_block() = default;
+    void add_shared() noexcept
+    {
+      _shared_count.fetch_add(1, std::memory_order_relaxed);
+    }
+    void add_weak() noexcept
+    {
+      _weak_count.fetch_add(1, std::memory_order_relaxed);
+    }
+    bool try_add_shared() noexcept
+    {
+      // weak_ptr 提升：仅在对象尚未销毁时增加强引用
+      long count = _shared_count.load(std::memory_order_relaxed);
+      while (count != 0)
+      {
+        if (_shared_count.compare_exchange_weak(count, count + 1, std::memory_order_acq_rel, std::memory_order_relaxed))
+        {
+          return true;
+        }
+      }
+      return false;
+    }
+    void release_shared() noexcept
+    {
+      if (_shared_count.fetch_sub(1, std::memory_order_acq_rel) == 1)
+      {
+        destroy_object();
+        release_weak();
+      }
+    }
+    void release_weak() noexcept
+    {
+      if (_weak_count.fetch_sub(1, std::memory_order_acq_rel) == 1)
+      {
+        destroy_block();
+      }
+    }
+    [[nodiscard]] long shared_count() const noexcept
+    {
+      return _shared_count.load(std::memory_order_acquire);
+    }
+  };
+  template <typename object_type, typename deleter>
+  class pointer_control_block : public control_block
+  {
+  private:
+    object_type *_ptr;
+    deleter _deleter;
+    void destroy_object() noexcept override
+    {
+      _deleter(_ptr);
+      _ptr = nullptr;
+    }
+    void destroy_block() noexcept override
+    {
+      delete this;
+    }
+
+  public:
+    pointer_control_block(object_type *ptr, deleter deleter_data)
+        : _ptr(ptr), _deleter(std::move(deleter_data)) {}
+  };
+  template <typename object_type>
+  class inplace_control_block : public control_block
+  {
+  private:
+    alignas(object_type) unsigned char _storage[sizeof(object_type)];
+    void destroy_object() noexcept override
+    {
+      std::destroy_at(object());
+    }
+    void destroy_block() noexcept override
+    {
+      delete this;
+    }
+
+  public:
+    template <typename... Args>
+    explicit inplace_control_block(Args &&...args)
+    {
+      ::new (static_cast<void *>(_storage)) object_type(std::forward<Args>(args)...);
+    }
+    object_type *object() noexcept
+    {
+      return std::launder(reinterpret_cast<object_type *>(_storage));
+    }
+  };
+  template <typename shared_ptr_type, typename deleter = std::default_delete<shared_ptr_type>>
+  class shared_ptr;
+  template <typename weak_ptr_type>
+  class weak_ptr;
+  template <typename object_type, typename... Args>
+  shared_ptr<object_type> make_shared(Args &&...args);
   /*
    * @brief  #### `shared_ptr` 类
 
@@ -245,21 +371,23 @@ namespace standard_con::pointer
 
    * * - `shared_ptr_type`: 管理的对象类型
 
-   * * - `deleter`: 资源释放器类型，默认为 `std::default_delete<shared_ptr_type>`
+   * * - `deleter`: 资源释放器类型，默认为 `std::default_delete<shared_ptr_type>`，仅在从原始指针构造时使用，随后擦除类型保存在控制块中
 
    * 构造函数:
 
-   * * - `explicit shared_ptr(shared_ptr_type* ptr = nullptr)`: 从原始指针构造
+   * * - `explicit shared_ptr(shared_ptr_type* ptr = nullptr)`: 从原始指针构造，空指针不分配控制块
 
    * * - 拷贝构造函数: 增加引用计数并共享资源
 
-   * * - 移动构造函数: 转移资源所有权，原指针重置
+   * * - 移动构造函数: 转移资源所有权，原指针置空
+
+   * * - 别名构造函数: 与另一 `shared_ptr` 共享控制块，但指向其对象内部的成员或子对象
 
    * 核心机制:
 
-   * * - 引用计数(`shared_pcount`): 记录共享同一资源的指针数量
+   * * - 控制块(`control_block`): 原子强引用计数 + 原子弱引用计数，拷贝/析构无需加锁
 
-   * * - 线程安全: 使用互斥锁(`_pmutex`)保护引用计数操作
+   * * - `make_shared`: 对象与控制块一次分配，减少分配次数并提升局部性
 
    * 提供的操作符:
 
@@ -271,10 +399,12 @@ namespace standard_con::pointer
 
    * 关键方法:
 
-   * * - `get_count()`: 返回当前引用计数
+   * * - `get_count()`: 返回当前强引用计数，空指针返回 1（与旧实现一致）
 
    * * - `get_ptr()`: 返回原始指针（不释放所有权）
 
+   * * - `reset()`: 放弃所有权，必要时可接管新的原始指针
+
    * 资源管理:
 
    * * - 最后一个指针释放时调用删除器销毁资源
@@ -285,7 +415,9 @@ namespace standard_con::pointer
 
    * 线程安全性:
 
-   * * - 引用计数操作是线程安全的
+   * * - 引用计数操作是线程安全的（原子操作）
+
+   * * - 同一个 `shared_ptr` 实例的并发读写仍需外部同步
 
    * * - 但不保证被管理对象的线程安全，需用户自行同步
 
@@ -297,105 +429,125 @@ namespace standard_con::pointer
 
    * * - 管理数组时需使用自定义删除器
   */
-  template <typename shared_ptr_type, typename deleter = std::default_delete<shared_ptr_type>>
+  template <typename shared_ptr_type, typename deleter>
   class shared_ptr
   {
+    template <typename, typename>
+    friend class shared_ptr;
+    template <typename>
+    friend class weak_ptr;
+    template <typename object_type, typename... Args>
+    friend shared_ptr<object_type> make_shared(Args &&...args);
+
   private:
     shared_ptr_type *_ptr;
-    deleter _deleter;
-    int *_shared_count;
-    std::mutex *_pmutex;
+    control_block *_control;
     using Ref = shared_ptr_type &;
     using ptr = shared_ptr_type *;
-    void release() noexcept
+    // 接管一个已计入强引用的控制块
+    shared_ptr(shared_ptr_type *ptr, control_block *control) noexcept
+        : _ptr(ptr), _control(control) {}
+
+  public:
+    explicit shared_ptr(shared_ptr_type *ptr = nullptr)
+        : shared_ptr(ptr, deleter()) {}
+    shared_ptr(shared_ptr_type *ptr, deleter deleter_data)
+        : _ptr(ptr), _control(nullptr)
     {
-      _pmutex->lock();
-      bool flag = false;
-      if (--(*_shared_count) == 0 && _ptr != nullptr)
+      if (ptr == nullptr)
       {
-        _deleter(_ptr);
-        _ptr = nullptr;
-        delete _shared_count;
-        _shared_count = nullptr;
-        flag = true;
+        return;
       }
-      _pmutex->unlock();
-      if (flag == true)
+      try
       {
-        delete _pmutex;
-        _pmutex = nullptr;
+        _control = new pointer_control_block<shared_ptr_type, deleter>(ptr, deleter_data);
+      }
+      catch (...)
+      {
+        deleter_data(ptr); // 控制块分配失败时仍需释放接管的资源
+        throw;
       }
     }
-    void assignment(shared_ptr &deliver_value) noexcept
+    shared_ptr(const shared_ptr &shared_ptr_data) noexcept
+        : _ptr(shared_ptr_data._ptr), _control(shared_ptr_data._control)
     {
-      _ptr = deliver_value._ptr;
-      _shared_count = deliver_value._shared_count;
-      _pmutex = deliver_value._pmutex;
-      _deleter = deliver_value._deleter;
+      if (_control != nullptr)
+      {
+        _control->add_shared();
+      }
     }
-
-  public:
-    explicit shared_ptr(shared_ptr_type *ptr = nullptr)
-        : _deleter(deleter())
+    template <typename other_type, typename other_deleter>
+      requires std::is_convertible_v<other_type *, shared_ptr_type *>
+    shared_ptr(const shared_ptr<other_type, other_deleter> &shared_ptr_data) noexcept
+        : _ptr(shared_ptr_data._ptr), _control(shared_ptr_data._control)
     {
-      _ptr = ptr;
-      _shared_count = new int(1);
-      _pmutex = new std::mutex;
+      if (_control != nullptr)
+      {
+        _control->add_shared();
+      }
     }
-    shared_ptr(shared_ptr &shared_ptr_data) noexcept
+    template <typename other_type, typename other_deleter>
+    shared_ptr(const shared_ptr<other_type, other_deleter> &owner, shared_ptr_type *ptr) noexcept
+        : _ptr(ptr), _control(owner._control)
     {
-      assignment(shared_ptr_data);
-      _pmutex->lock();
-      (*_shared_count)++;
-      _pmutex->unlock();
+      if (_control != nullptr)
+      {
+        _control->add_shared();
+      }
     }
     shared_ptr(shared_ptr &&shared_ptr_data) noexcept
+        : _ptr(shared_ptr_data._ptr), _control(shared_ptr_data._control)
     {
-      assignment(shared_ptr_data);
       shared_ptr_data._ptr = nullptr;
-      shared_ptr_data._shared_count = new int(1);
-      shared_ptr_data._pmutex = new std::mutex;
+      shared_ptr_data._control = nullptr;
     }
-    ~shared_ptr() noexcept
+    template <typename other_type, typename other_deleter>
+      requires std::is_convertible_v<other_type *, shared_ptr_type *>
+    shared_ptr(shared_ptr<other_type, other_deleter> &&shared_ptr_data) noexcept
+        : _ptr(shared_ptr_data._ptr), _control(shared_ptr_data._control)
     {
-      release();
+      shared_ptr_data._ptr = nullptr;
+      shared_ptr_data._control = nullptr;
     }
-    shared_ptr<shared_ptr_type> &operator=(const shared_ptr &shared_ptr_data) noexcept
+    ~shared_ptr() noexcept
     {
-      if (&shared_ptr_data != this)
+      if (_control != nullptr)
       {
-        if (_ptr != shared_ptr_data._ptr)
-        {
-          release();
-          assignment(shared_ptr_data);
-          _pmutex->lock();
-          (*_shared_count)++;
-          _pmutex->unlock();
-        }
+        _control->release_shared();
       }
+    }
+    shared_ptr &operator=(const shared_ptr &shared_ptr_data) noexcept
+    {
+      shared_ptr(shared_ptr_data).swap(*this);
       return *this;
     }
-    shared_ptr<shared_ptr_type> &operator=(shared_ptr &&shared_ptr_data) noexcept
+    shared_ptr &operator=(shared_ptr &&shared_ptr_data) noexcept
     {
-      if (&shared_ptr_data != this)
-      {
-        release();
-        assignment(shared_ptr_data);
-        shared_ptr_data._ptr = nullptr;
-        shared_ptr_data._shared_count = new int(1);
-        shared_ptr_data._pmutex = new std::mutex;
-      }
+      shared_ptr(std::move(shared_ptr_data)).swap(*this);
       return *this;
     }
+    void swap(shared_ptr &shared_ptr_data) noexcept
+    {
+      std::swap(_ptr, shared_ptr_data._ptr);
+      std::swap(_control, shared_ptr_data._control);
+    }
+    void reset() noexcept
+    {
+      shared_ptr().swap(*this);
+    }
+    void reset(shared_ptr_type *ptr)
+    {
+      shared_ptr(ptr).swap(*this);
+    }
     [[nodiscard]] int get_count() const noexcept
     {
-      return _shared_count ? *_shared_count : -1;
+      return _control ? static_cast<int>(_control->shared_count()) : 1;
     }
-    Ref operator*() noexcept
+    Ref operator*() const noexcept
     {
       return *(_ptr);
     }
-    ptr operator->() noexcept
+    ptr operator->() const noexcept
     {
       return _ptr;
     }
@@ -403,11 +555,28 @@ namespace standard_con::pointer
     {
       return _ptr;
     }
+    explicit operator bool() const noexcept
+    {
+      return _ptr != nullptr;
+    }
   };
+  /*
+   * @brief  #### `make_shared` 函数
+
+  *   - 一次分配同时容纳控制块与对象，构造参数完美转发给对象构造函数
+
+  *   - 对象析构发生在最后一个 `shared_ptr` 释放时，内存在最后一个 `weak_ptr` 释放时归还
+  */
+  template <typename object_type, typename... Args>
+  shared_ptr<object_type> make_shared(Args &&...args)
+  {
+    auto *control = new inplace_control_block<object_type>(std::forward<Args>(args)...);
+    return shared_ptr<object_type>(control->object(), control);
+  }
   /*
       * @brief  #### `weak_ptr` 类
 
-      *   - 弱引用智能指针，用于观察 `shared_ptr` 管理的资源但不增加引用计数
+      *   - 弱引用智能指针，用于观察 `shared_ptr` 管理的资源但不增加强引用计数
 
       *   - 解决 `shared_ptr` 的循环引用问题，避免资源无法释放的内存泄漏
 
@@ -419,14 +588,12 @@ namespace standard_con::pointer
 
       * * - 默认构造函数: 初始化空弱指针，不关联任何资源
 
-      * * - `explicit weak_ptr(const shared_ptr<weak_ptr_type>& weak_ptr_data)`: 从 `shared_ptr` 构造，关联其管理的资源（不增加引用计数）
+      * * - `explicit weak_ptr(const shared_ptr<weak_ptr_type>& weak_ptr_data)`: 从 `shared_ptr` 构造，关联其控制块（仅增加弱引用计数）
 
       * * - 拷贝构造函数: 复制另一个弱指针的关联关系（共享观察同一资源）
 
       * * - 移动构造函数: 转移另一个弱指针的关联关系，原指针置空
 
-      * * - 禁用从 `shared_ptr` 右值构造: 避免关联临时 `shared_ptr` 导致的悬空引用
-
       * 赋值运算符:
 
       * * - 拷贝赋值: 复制另一个弱指针的关联关系
@@ -437,9 +604,11 @@ namespace standard_con::pointer
 
       * 核心方法:
 
-      * * - `expired() const noexcept`: 检查关联的资源是否已被释放（引用计数为 0 时返回 `true`）
+      * * - `expired() const noexcept`: 检查关联的资源是否已被释放（强引用计数为 0 或未关联时返回 `true`）
 
-      * * - `get_count() const noexcept`: 返回关联资源的当前引用计数（未关联时返回 -1）
+      * * - `get_count() const noexcept`: 返回关联资源的当前强引用计数（未关联时返回 -1）
+
+      * * - `lock() const noexcept`: 资源仍存活时返回共享其所有权的 `shared_ptr`，否则返回空指针
 
       * * - `operator*()`: 解引用观察的对象（需先通过 `expired()` 确认资源有效）
       *
@@ -447,83 +616,92 @@ namespace standard_con::pointer
 
       * 资源管理:
 
-      * * - 不拥有资源所有权，不影响 `shared_ptr` 的引用计数
+      * * - 不拥有资源所有权，不影响 `shared_ptr` 的强引用计数
       *
-      * * - 析构时仅重置内部指针，不涉及资源释放
+      * * - 持有控制块的弱引用，资源销毁后控制块仍然有效，`expired()` 始终可安全调用
       *
-      * * - 当关联的 `shared_ptr` 引用计数归 0 时，弱指针自动变为无效状态
+      * * - 当关联的 `shared_ptr` 强引用计数归 0 时，弱指针自动变为无效状态
 
       * 详细请参考 https://github.com/Hatedatastructures/Custom-libraries/blob/main/template_container.md
 
       * 注意事项:
 
-      * * - `weak_ptr` 创建的指针的生命周期要小于 `shared_ptr`，否则会出现悬空指针，导致资源提前释放
-      *
-      * * - 使用 `operator*()` 或 `operator->()` 前必须通过 `expired()` 检查资源有效性，否则可能访问已释放内存
+      * * - 多线程环境下应使用 `lock()` 获取所有权后再访问，`expired()` 与解引用之间资源可能被释放
       *
       * * - 不能直接通过 `weak_ptr` 管理资源生命周期，需配合 `shared_ptr` 使用
       *
       * * - 适用于观察者模式、缓存管理等需临时访问资源但不延长其生命周期的场景
       *
-      * * - 线程安全性：内部指针操作非线程安全，多线程环境下需外部同步
+      * * - 线程安全性：计数操作为原子操作，同一个 `weak_ptr` 实例的并发读写仍需外部同步
   */
   template <typename weak_ptr_type>
   class weak_ptr
   {
   private:
     weak_ptr_type *_ptr;
-    pointer::shared_ptr<weak_ptr_type> *_shared_ptr;
+    control_block *_control;
     using Ref = weak_ptr_type &;
     using ptr = weak_ptr_type *;
 
   public:
     weak_ptr() noexcept
-        : _ptr(nullptr), _shared_ptr(nullptr) {}
-    explicit weak_ptr(shared_ptr<weak_ptr_type> &weak_ptr_data) noexcept
-        : _ptr(weak_ptr_data.get_ptr()), _shared_ptr(&weak_ptr_data) {}
+        : _ptr(nullptr), _control(nullptr) {}
+    template <typename other_type, typename other_deleter>
+      requires std::is_convertible_v<other_type *, weak_ptr_type *>
+    explicit weak_ptr(const shared_ptr<other_type, other_deleter> &weak_ptr_data) noexcept
+        : _ptr(weak_ptr_data._ptr), _control(weak_ptr_data._control)
+    {
+      if (_control != nullptr)
+      {
+        _control->add_weak();
+      }
+    }
     weak_ptr(const weak_ptr &weak_ptr_data) noexcept
-        : _ptr(weak_ptr_data._ptr), _shared_ptr(weak_ptr_data._shared_ptr) {}
+        : _ptr(weak_ptr_data._ptr), _control(weak_ptr_data._control)
+    {
+      if (_control != nullptr)
+      {
+        _control->add_weak();
+      }
+    }
     weak_ptr(weak_ptr &&weak_ptr_data) noexcept
-        : _ptr(weak_ptr_data._ptr), _shared_ptr(weak_ptr_data._shared_ptr)
+        : _ptr(weak_ptr_data._ptr), _control(weak_ptr_data._control)
     {
       weak_ptr_data._ptr = nullptr;
-      weak_ptr_data._shared_ptr = nullptr;
+      weak_ptr_data._control = nullptr;
     }
-    weak_ptr(shared_ptr<weak_ptr_type> &&shared_ptr_data) = delete;
     weak_ptr &operator=(const weak_ptr &weak_ptr_data) noexcept
     {
-      if (&weak_ptr_data != this)
-      {
-        _ptr = weak_ptr_data._ptr;
-        _shared_ptr = weak_ptr_data._shared_ptr;
-      }
+      weak_ptr(weak_ptr_data).swap(*this);
       return *this;
     }
     weak_ptr &operator=(weak_ptr &&weak_ptr_data) noexcept
     {
-      if (&weak_ptr_data != this)
-      {
-        _ptr = weak_ptr_data._ptr;
-        _shared_ptr = weak_ptr_data._shared_ptr;
-        weak_ptr_data._ptr = nullptr;
-        weak_ptr_data._shared_ptr = nullptr;
-      }
+      weak_ptr(std::move(weak_ptr_data)).swap(*this);
       return *this;
     }
-    weak_ptr &operator=(const shared_ptr<weak_ptr_type> &shared_ptr_data) noexcept
+    template <typename other_type, typename other_deleter>
+      requires std::is_convertible_v<other_type *, weak_ptr_type *>
+    weak_ptr &operator=(const shared_ptr<other_type, other_deleter> &shared_ptr_data) noexcept
     {
-      _ptr = shared_ptr_data.get_ptr();
-      _shared_ptr = &shared_ptr_data;
+      weak_ptr(shared_ptr_data).swap(*this);
       return *this;
     }
     ~weak_ptr() noexcept
     {
-      if (_shared_ptr == nullptr)
+      if (_control != nullptr)
       {
-        delete _ptr;
+        _control->release_weak();
       }
-      _ptr = nullptr;
-      _shared_ptr = nullptr;
+    }
+    void swap(weak_ptr &weak_ptr_data) noexcept
+    {
+      std::swap(_ptr, weak_ptr_data._ptr);
+      std::swap(_control, weak_ptr_data._control);
+    }
+    void reset() noexcept
+    {
+      weak_ptr().swap(*this);
     }
 
     Ref operator*() noexcept
@@ -536,11 +714,19 @@ namespace standard_con::pointer
     }
     bool expired() const noexcept
     {
-      return _shared_ptr->get_count() == 0;
+      return _control == nullptr || _control->shared_count() == 0;
     }
     int get_count() const noexcept
     {
-      return _shared_ptr ? _shared_ptr->get_count() : -1;
+      return _control ? static_cast<int>(_control->shared_count()) : -1;
+    }
+    shared_ptr<weak_ptr_type> lock() const noexcept
+    {
+      if (_control != nullptr && _control->try_add_shared())
+      {
+        return shared_ptr<weak_ptr_type>(_ptr, _control);
+      }
+      return shared_ptr<weak_ptr_type>();
     }
   };
-}
\ No newline at end of file
+}
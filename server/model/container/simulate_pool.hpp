@@ -0,0 +1,224 @@
+#pragma once
+#include <new>
+#include <cassert>
+#include <memory>
+#include <cstdint>
+#include <cstddef>
+#include <utility>
+#include <type_traits>
+namespace pool_container
+{
+  /*
+   * @brief  #### `node_pool` 类模板
+
+  *   - 节点式容器（`list`、`red_black_tree`、`balance_tree`、`binary_tree`）专用的节点内存池，每个容器实例独占一个
+
+  *   - 以块为单位向全局分配器申请内存，块内节点连续存放，遍历时缓存局部性更好
+
+  *   - 释放的节点挂入空闲链表，后续插入优先复用；`release()` 一次性归还所有块
+
+   * 模板参数:
+
+   * * - `node_type`: 节点类型
+   *
+   * * - `pool_allocator`: 块内存的来源，默认 `std::allocator<node_type>`；内部重绑定为按块对齐的存储单元类型
+
+   * 主要方法:
+
+   * * - `create(args...)`: 取一个槽位并原地构造节点，构造抛异常时槽位归还空闲链表
+   *
+   * * - `destroy(node)`: 析构节点并把槽位挂回空闲链表，不归还全局分配器
+   *
+   * * - `release()`: 批量释放所有块，调用前需保证池内节点均已析构（平凡析构类型可直接调用）
+   *
+   * * - `swap()`: 交换两个池的全部内存，分配器仅在 `propagate_on_container_swap` 为真时随之交换，否则要求两者相等
+
+   * 分配策略:
+
+   * * - 首块容纳 16 个节点，之后每块翻倍，单块上限 4096 个节点
+   *
+   * * - 块内采用指针碰撞顺序分配，空闲链表非空时优先复用
+
+   * 注意事项:
+
+   * * - 不可拷贝：拷贝容器时新容器使用自己的空池逐个构造节点
+   *
+   * * - 节点只能由分配它的池销毁，不同容器之间不能直接转移单个节点
+   *
+   * * - 移动时分配器随块一起转移；交换遵循 `propagate_on_container_swap`，块总是由申请它的分配器归还
+  */
+  template <typename node_type, typename pool_allocator = std::allocator<node_type>>
+  class node_pool
+  {
+    union node_slot
+    {
+      node_slot *_next;
+      alignas(node_type) unsigned char _storage[sizeof(node_type)];
+    };
+    struct chunk_header
+    {
+      chunk_header *_next;
+      uint64_t _slot_count;
+    };
+    static constexpr uint64_t first_chunk_slots = 16;
+    static constexpr uint64_t max_chunk_slots = 4096;
+    static constexpr std::size_t chunk_alignment = alignof(node_slot) > alignof(chunk_header) ? alignof(node_slot) : alignof(chunk_header);
+    static constexpr std::size_t slot_offset = (sizeof(chunk_header) + alignof(node_slot) - 1) / alignof(node_slot) * alignof(node_slot);
+    struct alignas(chunk_alignment) chunk_unit
+    {
+      unsigned char _bytes[chunk_alignment];
+    };
+    using unit_allocator = typename std::allocator_traits<pool_allocator>::template rebind_alloc<chunk_unit>;
+    using unit_traits = std::allocator_traits<unit_allocator>;
+    static constexpr uint64_t chunk_units(const uint64_t slot_count) noexcept
+    {
+      return (slot_offset + slot_count * sizeof(node_slot) + sizeof(chunk_unit) - 1) / sizeof(chunk_unit);
+    }
+
+    chunk_header *_chunks = nullptr; // 已申请的块链表
+    node_slot *_free_list = nullptr;  // 已销毁节点的槽位
+    node_slot *_bump_cursor = nullptr;
+    node_slot *_bump_end = nullptr;
+    uint64_t _next_chunk_slots = first_chunk_slots;
+    [[no_unique_address]] unit_allocator _allocator;
+
+    void allocate_chunk()
+    {
+      const uint64_t slot_count = _next_chunk_slots;
+      void *raw_memory = std::to_address(unit_traits::allocate(_allocator, chunk_units(slot_count)));
+      auto *chunk = static_cast<chunk_header *>(raw_memory);
+      chunk->_next = _chunks;
+      chunk->_slot_count = slot_count;
+      _chunks = chunk;
+      _bump_cursor = reinterpret_cast<node_slot *>(static_cast<unsigned char *>(raw_memory) + slot_offset);
+      _bump_end = _bump_cursor + slot_count;
+      if (_next_chunk_slots < max_chunk_slots)
+      {
+        _next_chunk_slots *= 2;
+      }
+    }
+
+    void swap_chunks(node_pool &pool_data) noexcept
+    {
+      std::swap(_chunks, pool_data._chunks);
+      std::swap(_free_list, pool_data._free_list);
+      std::swap(_bump_cursor, pool_data._bump_cursor);
+      std::swap(_bump_end, pool_data._bump_end);
+      std::swap(_next_chunk_slots, pool_data._next_chunk_slots);
+    }
+
+  public:
+    using allocator_type = pool_allocator;
+    node_pool() noexcept(noexcept(unit_allocator())) = default;
+    explicit node_pool(const pool_allocator &allocator_data) noexcept
+        : _allocator(allocator_data) {}
+    node_pool(const node_pool &) = delete;
+    node_pool &operator=(const node_pool &) = delete;
+    node_pool(node_pool &&pool_data) noexcept
+        : _allocator(pool_data._allocator)
+    {
+      swap_chunks(pool_data);
+    }
+    node_pool &operator=(node_pool &&pool_data) noexcept
+    {
+      // 接管对方的块时一并接管分配器，块仍由申请它的分配器归还
+      if (this != &pool_data)
+      {
+        release();
+        swap_chunks(pool_data);
+        _allocator = pool_data._allocator;
+      }
+      return *this;
+    }
+    ~node_pool() noexcept
+    {
+      release();
+    }
+    [[nodiscard]] void *allocate()
+    {
+      if (_free_list != nullptr)
+      {
+        node_slot *slot = _free_list;
+        _free_list = slot->_next;
+        return slot;
+      }
+      if (_bump_cursor == _bump_end)
+      {
+        allocate_chunk();
+      }
+      return _bump_cursor++;
+    }
+    void deallocate(void *node_memory) noexcept
+    {
+      auto *slot = static_cast<node_slot *>(node_memory);
+      slot->_next = _free_list;
+      _free_list = slot;
+    }
+    template <typename... construct_args>
+    [[nodiscard]] node_type *create(construct_args &&...args)
+    {
+      void *node_memory = allocate();
+      try
+      {
+        return ::new (node_memory) node_type(std::forward<construct_args>(args)...);
+      }
+      catch (...)
+      {
+        deallocate(node_memory);
+        throw;
+      }
+    }
+    void destroy(node_type *node) noexcept
+    {
+      std::destroy_at(node);
+      deallocate(node);
+    }
+    void release() noexcept
+    {
+      while (_chunks != nullptr)
+      {
+        chunk_header *next_chunk = _chunks->_next;
+        unit_traits::deallocate(_allocator, reinterpret_cast<chunk_unit *>(_chunks), chunk_units(_chunks->_slot_count));
+        _chunks = next_chunk;
+      }
+      _free_list = nullptr;
+      _bump_cursor = _bump_end = nullptr;
+      _next_chunk_slots = first_chunk_slots;
+    }
+    // 前置条件：分配器会随交换传播（propagate_on_container_swap），或两者相等；否则双方的块将由错误的分配器归还
+    void swap(node_pool &pool_data) noexcept
+    {
+      swap_chunks(pool_data);
+      if constexpr (unit_traits::propagate_on_container_swap::value)
+      {
+        std::swap(_allocator, pool_data._allocator);
+      }
+      else
+      {
+        assert(_allocator == pool_data._allocator);
+      }
+    }
+    [[nodiscard]] pool_allocator get_allocator() const noexcept
+    {
+      return pool_allocator(_allocator);
+    }
+    [[nodiscard]] uint64_t chunk_count() const noexcept
+    {
+      uint64_t count = 0;
+      for (const chunk_header *chunk = _chunks; chunk != nullptr; chunk = chunk->_next)
+      {
+        ++count;
+      }
+      return count;
+    }
+    /*
+     * @brief  #### 节点析构是否可以省略
+     *   - 为真时容器 `clear` 无需逐个遍历节点，直接 `release()` 即可
+    */
+    static constexpr bool trivially_releasable = std::is_trivially_destructible_v<node_type>;
+  };
+}
+namespace standard_con
+{
+  using pool_container::node_pool;
+}
@@ -1,5 +1,6 @@
 #pragma once
 #include "simulate_list.hpp"
+#include "simulate_deque.hpp"
 #include "simulate_vector.hpp"
 #include "simulate_algorithm.hpp"
 #include "simulate_exception.hpp"
@@ -11,13 +12,15 @@ namespace queue_adapter
 
   *   - 自定义队列容器适配器，遵循 FIFO（先进先出）原则
 
-  *   - 基于底层容器实现（默认为 `standard_con::list`），提供队列的标准操作接口
+  *   - 基于底层容器实现（默认为 `standard_con::deque` 环形缓冲区），提供队列的标准操作接口
 
    * 模板参数:
 
    * * - `queue_type`: 队列中存储的元素类型
    *
-   * * - `list_based_queue`: 底层容器类型，默认为 `standard_con::list<queue_type>`
+   * * - `list_based_queue`: 底层容器类型，默认为 `standard_con::deque<queue_type>`，元素连续存放，入队出队无需逐个分配节点
+   *
+   *   - 仍可显式指定 `standard_con::list<queue_type>` 作为底层容器
    *
    *   - 需支持 `push_back()`、`pop_front()`、`front()`、`back()`、`size()`、`empty()` 等操作
 
@@ -73,7 +76,7 @@ namespace queue_adapter
 
    * 详细请参考 https://github.com/Hatedatastructures/Custom-libraries/blob/main/template_container.md
 */
-  template <typename queue_type, typename list_based_queue = standard_con::list<queue_type>>
+  template <typename queue_type, typename list_based_queue = standard_con::deque<queue_type>>
   class queue
   {
     list_based_queue list_object;
@@ -116,12 +119,12 @@ namespace queue_adapter
       return list_object.back();
     }
 
-    explicit queue(const queue<queue_type> &queue_data)
+    explicit queue(const queue &queue_data)
     {
       list_object = queue_data.list_object;
     }
 
-    queue(queue<queue_type> &&queue_type_data) noexcept
+    queue(queue &&queue_type_data) noexcept
     {
       // 移动构造
       list_object = std::forward<list_based_queue>(queue_type_data.list_object);
@@ -139,7 +142,7 @@ namespace queue_adapter
       list_object.push_back(queue_type_data);
     }
     queue() = default;
-    queue &operator=(const queue<queue_type> &queue_data)
+    queue &operator=(const queue &queue_data)
     {
       if (this != &queue_data)
       {
@@ -147,7 +150,7 @@ namespace queue_adapter
       }
       return *this;
     }
-    queue &operator=(queue<queue_type> &&queue_data) noexcept
+    queue &operator=(queue &&queue_data) noexcept
     {
       if (this != &queue_data)
       {
@@ -159,7 +162,7 @@ namespace queue_adapter
   /*
       * @brief  #### `priority_queue` 类模板
 
-      *   - 自定义优先队列容器适配器，基于堆结构实现
+      *   - 自定义优先队列容器适配器，基于 d 叉堆实现（默认 4 叉）
 
       *   - 元素按优先级排序，优先级最高的元素始终位于队首
 
@@ -175,6 +178,10 @@ namespace queue_adapter
       * * - `vector_based_priority_queue`: 底层容器类型，默认为 `standard_con::vector<priority_queue_type>`
       *
       * * *   - 需支持随机访问、尾部插入删除等操作
+      *
+      * * - `heap_arity`: 堆的叉数 d，默认为 4
+      *
+      * * *   - 4 叉堆的一组兄弟节点通常落在同一条缓存行，树高减半，下沉时比较次数略增但缓存未命中更少；取 2 即为二叉堆
 
       * 构造函数:
 
@@ -190,13 +197,13 @@ namespace queue_adapter
 
       * 析构函数:
 
-      * * - 显式调用底层容器的析构函数
+      * * - 默认行为，由底层容器析构释放资源
 
       * 元素操作方法:
 
-      * * - `push()`: 插入元素到优先队列，自动维护堆结构
+      * * - `push()`: 插入元素到优先队列，自动维护堆结构（支持拷贝和移动语义）
       *
-      * * - `pop()`: 删除堆顶元素（优先级最高的元素），自动维护堆结构
+      * * - `pop()`: 删除堆顶元素（优先级最高的元素），自动维护堆结构，空队列时不做任何操作
       *
       * * - `top()`: 返回堆顶元素的引用（优先级最高的元素）
 
@@ -212,11 +219,11 @@ namespace queue_adapter
 
       * 特性:
 
-      * * - 堆结构: 基于完全二叉树实现，确保 O(log n) 的插入和删除操作复杂度
+      * * - 堆结构: 基于完全 d 叉树实现，确保 O(log n) 的插入和删除操作复杂度，下标全程使用 64 位无符号整数
       *
-      * * - 可定制性: 通过自定义比较器实现不同的优先级规则
+      * * - 上浮与下沉采用“空穴”方式移动元素，每层一次移动而不是一次交换
       *
-      * * - 适配性: 可基于不同底层容器实现（如 vector、deque 等）
+      * * - 可定制性: 通过自定义比较器实现不同的优先级规则
       *
       * * - 移动语义: 支持高效的资源转移
 
@@ -224,7 +231,9 @@ namespace queue_adapter
 
       * * - `pop()` 不返回值: 如需获取堆顶元素，需先调用 `top()` 再调用 `pop()`
       *
-      * * - 空队列操作: 在队列为空时调用 `top()` 或 `pop()` 会导致未定义行为
+      * * - 空队列操作: 在队列为空时调用 `top()` 会导致未定义行为
+      *
+      * * - 需要修改或删除队列中任意元素（定时器、调度）时使用 `indexed_priority_queue`
       *
       * * - 元素优先级: 比较器的选择直接影响元素的优先级顺序
       *
@@ -235,88 +244,109 @@ namespace queue_adapter
       * 详细请参考 https://github.com/Hatedatastructures/Custom-libraries/blob/main/template_container.md
   */
   template <typename priority_queue_type, typename container_imitate_function = standard_con::less<priority_queue_type>,
-            typename vector_based_priority_queue = standard_con::vector<priority_queue_type>>
+            typename vector_based_priority_queue = standard_con::vector<priority_queue_type>, uint64_t heap_arity = 4>
   class priority_queue
   {
+    static_assert(heap_arity >= 2, "heap_arity must be at least 2");
     // 创建容器对象
     vector_based_priority_queue vector_container_object;
     container_imitate_function function_policy; // 仿函数：数据类型比较器，可自定义
     // 仿函数对象
 
-    void priority_queue_adjust_upwards(int adjust_upwards_child) noexcept
+    // 元素移动与比较都不抛异常时，堆调整才声明为 noexcept
+    static constexpr bool nothrow_adjust = std::is_nothrow_move_constructible_v<priority_queue_type> &&
+                                           std::is_nothrow_move_assignable_v<priority_queue_type> &&
+                                           std::is_nothrow_invocable_v<container_imitate_function &, const priority_queue_type &, const priority_queue_type &>;
+
+    void priority_queue_adjust_upwards(uint64_t adjust_upwards_child) noexcept(nothrow_adjust)
     {
-      // 向上调整算法
-      int adjust_upwards_parent = (adjust_upwards_child - 1) / 2;
+      // 向上调整算法：把新元素取出形成空穴，比它优先级低的父节点依次下移；下标由调用方保证有效，直接经 data() 访问
+      priority_queue_type *heap_data = vector_container_object.data();
+      priority_queue_type adjust_value = std::move(heap_data[adjust_upwards_child]);
       while (adjust_upwards_child > 0)
       {
-        if (function_policy(vector_container_object[adjust_upwards_parent], vector_container_object[adjust_upwards_child]))
-        {
-          standard_con::algorithm::swap(vector_container_object[adjust_upwards_parent], vector_container_object[adjust_upwards_child]);
-          adjust_upwards_child = adjust_upwards_parent;
-          adjust_upwards_parent = (adjust_upwards_child - 1) / 2;
-        }
-        else
+        const uint64_t adjust_upwards_parent = (adjust_upwards_child - 1) / heap_arity;
+        if (!function_policy(heap_data[adjust_upwards_parent], adjust_value))
         {
           break;
         }
+        heap_data[adjust_upwards_child] = std::move(heap_data[adjust_upwards_parent]);
+        adjust_upwards_child = adjust_upwards_parent;
       }
+      heap_data[adjust_upwards_child] = std::move(adjust_value);
     }
-    void priority_queue_adjust_downwards(int adjust_downwards_parent = 0) noexcept
+    void priority_queue_adjust_downwards(uint64_t adjust_downwards_parent = 0) noexcept(nothrow_adjust)
     {
-      int adjust_downwards_child = (adjust_downwards_parent * 2) + 1;
-      while (adjust_downwards_child < static_cast<int>(vector_container_object.size()))
+      // 向下调整算法：在 d 个孩子中找出优先级最高者，比空穴元素高则上移
+      const uint64_t element_count = vector_container_object.size();
+      priority_queue_type *heap_data = vector_container_object.data();
+      priority_queue_type adjust_value = std::move(heap_data[adjust_downwards_parent]);
+      while (true)
       {
-        int adjust_downwards_left = adjust_downwards_child;
-        int adjust_downwards_right = adjust_downwards_left + 1;
-        if (adjust_downwards_right < static_cast<int>(vector_container_object.size()) &&
-            function_policy(vector_container_object[adjust_downwards_left], vector_container_object[adjust_downwards_right]))
+        const uint64_t first_child = adjust_downwards_parent * heap_arity + 1;
+        if (first_child >= element_count)
         {
-          // 大堆找出左右节点哪个孩子大
-          adjust_downwards_child = adjust_downwards_right;
+          break;
         }
-        if (function_policy(vector_container_object[adjust_downwards_parent], vector_container_object[adjust_downwards_child]))
+        const uint64_t last_child = first_child + heap_arity < element_count ? first_child + heap_arity : element_count;
+        uint64_t best_child = first_child;
+        for (uint64_t child_index = first_child + 1; child_index < last_child; ++child_index)
         {
-          // 建大堆把小的换下去，建小堆把大的换下去
-          standard_con::algorithm::swap(vector_container_object[adjust_downwards_parent], vector_container_object[adjust_downwards_child]);
-
-          // 换完之后如果是大堆，则父亲节点是较大的值，需要更新孩子节点继续向下找比孩子节点大的值，如果有继续交换
-          adjust_downwards_parent = adjust_downwards_child;
-          adjust_downwards_child = (adjust_downwards_parent * 2) + 1;
+          if (function_policy(heap_data[best_child], heap_data[child_index]))
+          {
+            best_child = child_index;
+          }
         }
-        else
+        if (!function_policy(adjust_value, heap_data[best_child]))
         {
           break;
         }
+        heap_data[adjust_downwards_parent] = std::move(heap_data[best_child]);
+        adjust_downwards_parent = best_child;
       }
+      heap_data[adjust_downwards_parent] = std::move(adjust_value);
     }
 
   public:
-    ~priority_queue() noexcept
-    {
-      vector_container_object.~vector();
-    }
+    ~priority_queue() noexcept = default;
     void push(const priority_queue_type &prioity_queue_type_data)
     {
       vector_container_object.push_back(prioity_queue_type_data);
-      priority_queue_adjust_upwards(static_cast<int>(vector_container_object.size() - 1));
+      priority_queue_adjust_upwards(vector_container_object.size() - 1);
+    }
+    void push(priority_queue_type &&prioity_queue_type_data)
+    {
+      vector_container_object.push_back(std::move(prioity_queue_type_data));
+      priority_queue_adjust_upwards(vector_container_object.size() - 1);
     }
     priority_queue_type &top() noexcept
     {
       return vector_container_object.front();
     }
-    bool empty() noexcept
+    [[nodiscard]] bool empty() const noexcept
     {
       return vector_container_object.empty();
     }
-    uint64_t size() noexcept
+    [[nodiscard]] uint64_t size() const noexcept
     {
       return vector_container_object.size();
     }
     void pop()
     {
-      standard_con::algorithm::swap(vector_container_object[0], vector_container_object[vector_container_object.size() - static_cast<uint64_t>(1)]);
+      const uint64_t element_count = vector_container_object.size();
+      if (element_count == 0)
+      {
+        return;
+      }
+      if (element_count > 1)
+      {
+        vector_container_object[0] = std::move(vector_container_object[element_count - 1]);
+      }
       vector_container_object.pop_back();
-      priority_queue_adjust_downwards();
+      if (element_count > 2)
+      {
+        priority_queue_adjust_downwards();
+      }
     }
     priority_queue()
     {
@@ -327,24 +357,22 @@ namespace queue_adapter
       // 通过初始化列表构建一个list
       for (auto &chained_values : lightweight_container)
       {
-        push(std::move(chained_values));
+        push(chained_values);
       }
     }
     priority_queue(const priority_queue &priority_queue_data)
+        : vector_container_object(priority_queue_data.vector_container_object), function_policy(priority_queue_data.function_policy)
     {
       // 拷贝构造
-      vector_container_object = priority_queue_data.vector_container_object;
     }
     priority_queue(priority_queue &&priority_queue_data) noexcept
-        : function_policy(priority_queue_data.function_policy)
+        : vector_container_object(std::move(priority_queue_data.vector_container_object)), function_policy(priority_queue_data.function_policy)
     {
       // 移动构造
-      vector_container_object = std::move(priority_queue_data.vector_container_object);
     }
     explicit priority_queue(const priority_queue_type &priority_queue_type_data)
     {
-      vector_container_object.push_back(priority_queue_type_data);
-      priority_queue_adjust_upwards((static_cast<int>(vector_container_object.size() - 1)));
+      push(priority_queue_type_data);
     }
     priority_queue &operator=(priority_queue &&priority_queue_data) noexcept
     {
@@ -367,9 +395,243 @@ namespace queue_adapter
       return *this;
     }
   };
+  /*
+      * @brief  #### `indexed_priority_queue` 类模板
+
+      *   - 带句柄的 d 叉堆优先队列：`push()` 返回句柄，之后可按句柄 O(log n) 修改优先级或删除，适合定时器与调度
+
+      *   - 句柄与堆位置通过位置表双向映射，元素在堆中移动时同步更新位置表
+
+      * 模板参数:
+
+      * * - `priority_queue_type`: 元素类型
+      *
+      * * - `container_imitate_function`: 比较器类型，默认为 `standard_con::less<priority_queue_type>`（大顶堆）
+      *
+      * * - `heap_arity`: 堆的叉数 d，默认为 4
+
+      * 元素操作方法:
+
+      * * - `push()`: 插入元素，返回句柄（`handle_type`）
+      *
+      * * - `top()` / `top_handle()`: 堆顶元素及其句柄
+      *
+      * * - `pop()`: 删除堆顶元素，句柄随之失效
+      *
+      * * - `update(handle, value)`: 修改句柄对应元素的值，自动上浮或下沉
+      *
+      * * - `erase(handle)`: 删除句柄对应的元素
+      *
+      * * - `contains(handle)` / `value(handle)`: 查询句柄是否有效及其元素
+
+      * 注意事项:
+
+      * * - 失效的句柄会被后续 `push()` 复用，调用方删除元素后应丢弃旧句柄
+      *
+      * * - 对失效句柄调用 `update()` / `erase()` / `value()` 抛出异常
+  */
+  template <typename priority_queue_type, typename container_imitate_function = standard_con::less<priority_queue_type>,
+            uint64_t heap_arity = 4>
+  class indexed_priority_queue
+  {
+    static_assert(heap_arity >= 2, "heap_arity must be at least 2");
+
+  public:
+    using handle_type = uint64_t;
+    static constexpr uint64_t npos = UINT64_MAX;
+
+  private:
+    struct heap_entry
+    {
+      priority_queue_type _value;
+      handle_type _handle;
+    };
+    standard_con::vector<heap_entry> _heap;
+    standard_con::vector<uint64_t> _position;    // 句柄 -> 堆下标，失效句柄为 npos
+    standard_con::vector<handle_type> _free_handles; // 可复用的失效句柄
+    container_imitate_function function_policy;
+
+    // 元素移动与比较都不抛异常时，堆调整才声明为 noexcept
+    static constexpr bool nothrow_adjust = std::is_nothrow_move_constructible_v<priority_queue_type> &&
+                                           std::is_nothrow_move_assignable_v<priority_queue_type> &&
+                                           std::is_nothrow_invocable_v<container_imitate_function &, const priority_queue_type &, const priority_queue_type &>;
+
+    [[nodiscard]] bool higher_priority(const heap_entry &left_entry, const heap_entry &right_entry) noexcept(nothrow_adjust)
+    {
+      return function_policy(right_entry._value, left_entry._value);
+    }
+    // 以下调整函数的下标均由调用方保证有效，直接经 data() 访问，不走越界检查
+    void place(const uint64_t heap_index, heap_entry &&entry) noexcept(nothrow_adjust)
+    {
+      _position.data()[entry._handle] = heap_index;
+      _heap.data()[heap_index] = std::move(entry);
+    }
+    void sift_up(uint64_t child_index) noexcept(nothrow_adjust)
+    {
+      heap_entry *heap_data = _heap.data();
+      heap_entry adjust_entry = std::move(heap_data[child_index]);
+      while (child_index > 0)
+      {
+        const uint64_t parent_index = (child_index - 1) / heap_arity;
+        if (!higher_priority(adjust_entry, heap_data[parent_index]))
+        {
+          break;
+        }
+        place(child_index, std::move(heap_data[parent_index]));
+        child_index = parent_index;
+      }
+      place(child_index, std::move(adjust_entry));
+    }
+    void sift_down(uint64_t parent_index) noexcept(nothrow_adjust)
+    {
+      const uint64_t element_count = _heap.size();
+      heap_entry *heap_data = _heap.data();
+      heap_entry adjust_entry = std::move(heap_data[parent_index]);
+      while (true)
+      {
+        const uint64_t first_child = parent_index * heap_arity + 1;
+        if (first_child >= element_count)
+        {
+          break;
+        }
+        const uint64_t last_child = first_child + heap_arity < element_count ? first_child + heap_arity : element_count;
+        uint64_t best_child = first_child;
+        for (uint64_t child_index = first_child + 1; child_index < last_child; ++child_index)
+        {
+          if (higher_priority(heap_data[child_index], heap_data[best_child]))
+          {
+            best_child = child_index;
+          }
+        }
+        if (!higher_priority(heap_data[best_child], adjust_entry))
+        {
+          break;
+        }
+        place(parent_index, std::move(heap_data[best_child]));
+        parent_index = best_child;
+      }
+      place(parent_index, std::move(adjust_entry));
+    }
+    void restore(const uint64_t heap_index) noexcept(nothrow_adjust)
+    {
+      // 位置上的元素优先级可能变高也可能变低
+      const heap_entry *heap_data = _heap.data();
+      if (heap_index > 0 && higher_priority(heap_data[heap_index], heap_data[(heap_index - 1) / heap_arity]))
+      {
+        sift_up(heap_index);
+      }
+      else
+      {
+        sift_down(heap_index);
+      }
+    }
+    uint64_t checked_position(const handle_type handle, const char *function_name) const
+    {
+      try
+      {
+        if (handle >= _position.size() || _position[handle] == npos)
+        {
+          throw custom_exception::fault("句柄无效", function_name, __LINE__);
+        }
+        return _position[handle];
+      }
+      catch (const custom_exception::fault &process)
+      {
+        std::cerr << process.what() << " " << process.function_name_get() << " " << process.line_number_get() << std::endl;
+        throw;
+      }
+    }
+    void remove_at(const uint64_t heap_index)
+    {
+      const handle_type removed_handle = _heap[heap_index]._handle;
+      const uint64_t last_index = _heap.size() - 1;
+      if (heap_index != last_index)
+      {
+        place(heap_index, std::move(_heap[last_index]));
+      }
+      _heap.pop_back();
+      _position[removed_handle] = npos;
+      _free_handles.push_back(removed_handle);
+      if (heap_index < _heap.size())
+      {
+        restore(heap_index);
+      }
+    }
+
+  public:
+    indexed_priority_queue() = default;
+    template <typename value_argument>
+    handle_type push(value_argument &&value_data)
+    {
+      handle_type new_handle;
+      if (!_free_handles.empty())
+      {
+        new_handle = _free_handles.back();
+        _free_handles.pop_back();
+      }
+      else
+      {
+        new_handle = _position.size();
+        _position.push_back(npos);
+      }
+      _heap.push_back(heap_entry{priority_queue_type(std::forward<value_argument>(value_data)), new_handle});
+      sift_up(_heap.size() - 1);
+      return new_handle;
+    }
+    [[nodiscard]] priority_queue_type &top() noexcept
+    {
+      return _heap.front()._value;
+    }
+    [[nodiscard]] handle_type top_handle() const noexcept
+    {
+      return _heap.front()._handle;
+    }
+    void pop()
+    {
+      if (!_heap.empty())
+      {
+        remove_at(0);
+      }
+    }
+    template <typename value_argument>
+    void update(const handle_type handle, value_argument &&value_data)
+    {
+      const uint64_t heap_index = checked_position(handle, "indexed_priority_queue::update");
+      _heap[heap_index]._value = std::forward<value_argument>(value_data);
+      restore(heap_index);
+    }
+    void erase(const handle_type handle)
+    {
+      remove_at(checked_position(handle, "indexed_priority_queue::erase"));
+    }
+    [[nodiscard]] bool contains(const handle_type handle) const noexcept
+    {
+      return handle < _position.size() && _position.begin()[handle] != npos;
+    }
+    [[nodiscard]] const priority_queue_type &value(const handle_type handle) const
+    {
+      return _heap[checked_position(handle, "indexed_priority_queue::value")]._value;
+    }
+    [[nodiscard]] uint64_t size() const noexcept
+    {
+      return _heap.size();
+    }
+    [[nodiscard]] bool empty() const noexcept
+    {
+      return _heap.empty();
+    }
+    void clear()
+    {
+      while (!_heap.empty())
+      {
+        remove_at(_heap.size() - 1);
+      }
+    }
+  };
 }
 namespace standard_con
 {
+  using queue_adapter::indexed_priority_queue;
   using queue_adapter::priority_queue;
   using queue_adapter::queue;
 }
\ No newline at end of file
@@ -1,5 +1,8 @@
 #pragma once
 #include "simulate_base.hpp"
+#include "simulate_btree.hpp"
+#include "simulate_swiss.hpp"
+#include "simulate_flat.hpp"
 namespace set_container
 {
   /**
@@ -19,6 +22,8 @@ namespace set_container
    *
    *   - 定义元素的排序规则，返回 `true` 表示左操作数小于右操作数，决定元素的排列顺序
    *
+   * * - `set_allocator`: 分配器类型，默认为 `std::allocator<set_type>`，转交底层容器；传入 `polymorphic_allocator` 可使用竞技场等内存资源
+   *
    * 迭代器类型:
    * 继承自底层红黑树的迭代器，支持正向、反向遍历，以及常量版本：
    *
@@ -31,8 +36,14 @@ namespace set_container
    * * - `const_reverse_iterator`: 常量反向迭代器，按逆序遍历不可修改的元素
    *
    * * - `set_iterator`: 插入操作返回类型，为 `standard_con::pair<iterator, bool>`，其中 `iterator` 指向插入位置（或已有元素），`bool` 表示是否插入成功
+   *
+   * 顺序统计:
+   *
+   * * - `select(index)`: 返回按序第 `index` 个（从 0 开始）元素的迭代器，越界返回 `end()`，可直接用于分位数（如 p99 取 `select(size() * 99 / 100)`）
+   *
+   * * - `rank(key)`: 返回小于 `key` 的元素个数
    */
-  template <typename set_type, typename comparators = standard_con::less<set_type>>
+  template <typename set_type, typename comparators = standard_con::less<set_type>, typename set_allocator = std::allocator<set_type>>
   class tree_set
   {
     using key_val_type = set_type; // comparators 用户自定义比较器，用于比较两个元素的大小，方便存储
@@ -43,7 +54,7 @@ namespace set_container
         return key_value;
       }
     };
-    using instance_rb = standard_con::red_black_tree<set_type, key_val_type, key_val, comparators>;
+    using instance_rb = standard_con::red_black_tree<set_type, key_val_type, key_val, comparators, set_allocator>;
     instance_rb instance_tree_set;
 
   public:
@@ -97,9 +108,15 @@ namespace set_container
 
     ~tree_set() = default;
 
-    tree_set(const tree_set &set_data) { instance_tree_set = set_data.instance_tree_set; }
+    tree_set(const tree_set &set_data) : instance_tree_set(set_data.instance_tree_set) { ; }
+
+    tree_set(tree_set &&set_data) noexcept : instance_tree_set(std::move(set_data.instance_tree_set)) { ; }
+
+    using allocator_type = set_allocator;
 
-    tree_set(tree_set &&set_data) noexcept { instance_tree_set = std::move(set_data.instance_tree_set); }
+    explicit tree_set(const set_allocator &allocator_data) : instance_tree_set(allocator_data) { ; }
+
+    [[nodiscard]] allocator_type get_allocator() const noexcept { return instance_tree_set.get_allocator(); }
 
     explicit tree_set(const key_val_type &set_type_data) { instance_tree_set.push(set_type_data); }
 
@@ -109,6 +126,11 @@ namespace set_container
 
     iterator find(const key_val_type &set_type_data) { return instance_tree_set.find(set_type_data); }
 
+    iterator select(const uint64_t element_index) { return instance_tree_set.select(element_index); }
+    const_iterator select(const uint64_t element_index) const { return instance_tree_set.select(element_index); }
+
+    [[nodiscard]] uint64_t rank(const set_type &key_data) const { return instance_tree_set.rank(key_data); }
+
     void middle_order_traversal() { instance_tree_set.middle_order_traversal(); }
 
     void pre_order_traversal() { instance_tree_set.pre_order_traversal(); }
@@ -124,9 +146,9 @@ namespace set_container
 
     iterator end() { return instance_tree_set.end(); }
 
-    const_iterator cbegin() { return instance_tree_set.cbegin(); }
+    const_iterator cbegin() const { return instance_tree_set.cbegin(); }
 
-    const_iterator cend() { return instance_tree_set.cend(); }
+    const_iterator cend() const { return instance_tree_set.cend(); }
 
     reverse_iterator rbegin() { return instance_tree_set.rbegin(); }
 
@@ -138,12 +160,277 @@ namespace set_container
 
     iterator operator[](const key_val_type &set_type_data) { return instance_tree_set[set_type_data]; }
   };
+  /**
+   * @brief 基于 B+ 树实现的有序集合容器
+   *
+   * 接口与 `tree_set` 一致，底层换成宽节点 B+ 树（b_plus_tree），查找、插入、删除同样为 O(log n)。
+   *
+   * 元素连续存放在叶节点中，叶节点以链表串联，顺序遍历与 `lower_bound` / `upper_bound` 范围查询对缓存更友好。
+   *
+   * 模板参数:
+   *
+   * * - `set_type`: 集合中元素的类型，需可默认构造与赋值
+   *
+   * * - `comparators`: 元素的比较器类型，默认为 `standard_con::less<set_type>`
+   *
+   *   - 元素为有符号 32/64 位整数且使用默认比较器时，节点内查找走 SIMD 批量比较
+   *
+   * * - `set_allocator`: 分配器类型，默认为 `std::allocator<set_type>`，转交底层容器；传入 `polymorphic_allocator` 可使用竞技场等内存资源
+   *
+   * 注意事项:
+   *
+   * * - 插入、删除会在节点内移动元素，修改后之前取得的迭代器全部失效，这一点与 `tree_set` 不同
+   */
+  template <typename set_type, typename comparators = standard_con::less<set_type>, typename set_allocator = std::allocator<set_type>>
+  class btree_set
+  {
+    using key_val_type = set_type;
+    struct key_val
+    {
+      const set_type &operator()(const key_val_type &key_value)
+      {
+        return key_value;
+      }
+    };
+    using instance_btree = standard_con::b_plus_tree<set_type, key_val_type, key_val, comparators, set_allocator>;
+    instance_btree instance_btree_set;
+
+  public:
+    using iterator = typename instance_btree::iterator;
+    using const_iterator = typename instance_btree::const_iterator;
+    using reverse_iterator = typename instance_btree::reverse_iterator;
+    using const_reverse_iterator = typename instance_btree::const_reverse_iterator;
+
+    using set_iterator = standard_con::pair<iterator, bool>;
+
+    btree_set() { ; }
+
+    ~btree_set() = default;
+
+    btree_set(std::initializer_list<key_val_type> lightweight_container)
+    {
+      for (auto &chained_values : lightweight_container)
+      {
+        instance_btree_set.push(chained_values);
+      }
+    }
+    btree_set(const btree_set &set_data) : instance_btree_set(set_data.instance_btree_set) { ; }
+
+    btree_set(btree_set &&set_data) noexcept : instance_btree_set(std::move(set_data.instance_btree_set)) { ; }
+
+    using allocator_type = set_allocator;
+
+    explicit btree_set(const set_allocator &allocator_data) : instance_btree_set(allocator_data) { ; }
+
+    [[nodiscard]] allocator_type get_allocator() const noexcept { return instance_btree_set.get_allocator(); }
+
+    explicit btree_set(const key_val_type &set_type_data) { instance_btree_set.push(set_type_data); }
+
+    explicit btree_set(key_val_type &&set_type_data) { instance_btree_set.push(std::move(set_type_data)); }
+
+    btree_set &operator=(const btree_set &set_data)
+    {
+      if (this != &set_data)
+      {
+        instance_btree_set = set_data.instance_btree_set;
+      }
+      return *this;
+    }
+    btree_set &operator=(btree_set &&set_data) noexcept
+    {
+      if (this != &set_data)
+      {
+        instance_btree_set = std::move(set_data.instance_btree_set);
+      }
+      return *this;
+    }
+    btree_set &operator=(std::initializer_list<key_val_type> lightweight_container)
+    {
+      for (auto &chained_values : lightweight_container)
+      {
+        instance_btree_set.push(chained_values);
+      }
+      return *this;
+    }
+    set_iterator push(const key_val_type &set_type_data) { return instance_btree_set.push(set_type_data); }
+
+    set_iterator push(key_val_type &&set_type_data) { return instance_btree_set.push(std::move(set_type_data)); }
+
+    set_iterator pop(const key_val_type &set_type_data) { return instance_btree_set.pop(set_type_data); }
+
+    iterator find(const key_val_type &set_type_data) { return instance_btree_set.find(set_type_data); }
+
+    iterator lower_bound(const key_val_type &set_type_data) { return instance_btree_set.lower_bound(set_type_data); }
+
+    iterator upper_bound(const key_val_type &set_type_data) { return instance_btree_set.upper_bound(set_type_data); }
+
+    void middle_order_traversal() { instance_btree_set.middle_order_traversal(); }
+
+    void pre_order_traversal() { instance_btree_set.pre_order_traversal(); }
+
+    [[nodiscard]] uint64_t size() const
+    {
+      return instance_btree_set.size();
+    }
+
+    bool empty() { return instance_btree_set.empty(); }
+
+    void clear() { instance_btree_set.clear(); }
+
+    iterator begin() { return instance_btree_set.begin(); }
+
+    iterator end() { return instance_btree_set.end(); }
+
+    const_iterator cbegin() { return instance_btree_set.cbegin(); }
+
+    const_iterator cend() { return instance_btree_set.cend(); }
+
+    reverse_iterator rbegin() { return instance_btree_set.rbegin(); }
+
+    reverse_iterator rend() { return instance_btree_set.rend(); }
+
+    const_reverse_iterator crbegin() { return instance_btree_set.crbegin(); }
+
+    const_reverse_iterator crend() { return instance_btree_set.crend(); }
+
+    iterator operator[](const key_val_type &set_type_data) { return instance_btree_set[set_type_data]; }
+  };
+  /**
+   * @brief 基于有序数组实现的集合容器
+   *
+   * 元素按升序连续存放在 `standard_con::vector` 中（底层为 flat_tree），没有节点指针，内存占用约为元素本身。
+   *
+   * 查找为无分支二分 O(log n)；单点插入、删除需要移动其后的元素，为 O(n)，适合构建后以查找为主的小型集合。
+   *
+   * 模板参数:
+   *
+   * * - `set_type`: 集合中元素的类型，需可移动赋值
+   *
+   * * - `comparators`: 元素的比较器类型，默认为 `standard_con::less<set_type>`
+   *
+   *   - 元素为整数且使用默认比较器时，批量插入用 `radix_sort` 排序
+   *
+   * * - `set_allocator`: 分配器类型，默认为 `std::allocator<set_type>`，直接为底层数组提供内存
+   *
+   * 注意事项:
+   *
+   * * - `push_bulk(first, last)` 整批追加后排序、去重，再与原有元素原地归并；初始化列表构造同样走这条路径
+   *
+   * * - 迭代器为元素指针，任何插入、删除之后之前取得的迭代器全部失效；不要通过迭代器修改元素
+   */
+  template <typename set_type, typename comparators = standard_con::less<set_type>, typename set_allocator = std::allocator<set_type>>
+  class flat_set
+  {
+    using key_val_type = set_type;
+    struct key_val
+    {
+      const set_type &operator()(const key_val_type &key_value)
+      {
+        return key_value;
+      }
+    };
+    using instance_flat = standard_con::flat_tree<set_type, key_val_type, key_val, comparators, set_allocator>;
+    instance_flat instance_flat_set;
+
+  public:
+    using iterator = typename instance_flat::iterator;
+    using const_iterator = typename instance_flat::const_iterator;
+
+    using set_iterator = standard_con::pair<iterator, bool>;
+
+    flat_set() { ; }
+
+    ~flat_set() = default;
+
+    flat_set(std::initializer_list<key_val_type> lightweight_container) : instance_flat_set(lightweight_container) { ; }
+
+    flat_set(const flat_set &set_data) : instance_flat_set(set_data.instance_flat_set) { ; }
+
+    flat_set(flat_set &&set_data) noexcept : instance_flat_set(std::move(set_data.instance_flat_set)) { ; }
+
+    using allocator_type = set_allocator;
+
+    explicit flat_set(const set_allocator &allocator_data) : instance_flat_set(allocator_data) { ; }
+
+    [[nodiscard]] allocator_type get_allocator() const noexcept { return instance_flat_set.get_allocator(); }
+
+    explicit flat_set(const key_val_type &set_type_data) { instance_flat_set.push(set_type_data); }
+
+    explicit flat_set(key_val_type &&set_type_data) { instance_flat_set.push(std::move(set_type_data)); }
+
+    flat_set &operator=(const flat_set &set_data)
+    {
+      if (this != &set_data)
+      {
+        instance_flat_set = set_data.instance_flat_set;
+      }
+      return *this;
+    }
+    flat_set &operator=(flat_set &&set_data) noexcept
+    {
+      if (this != &set_data)
+      {
+        instance_flat_set = std::move(set_data.instance_flat_set);
+      }
+      return *this;
+    }
+    flat_set &operator=(std::initializer_list<key_val_type> lightweight_container)
+    {
+      instance_flat_set.push_bulk(lightweight_container);
+      return *this;
+    }
+    set_iterator push(const key_val_type &set_type_data) { return instance_flat_set.push(set_type_data); }
+
+    set_iterator push(key_val_type &&set_type_data) { return instance_flat_set.push(std::move(set_type_data)); }
+
+    template <typename input_iterator>
+    void push_bulk(input_iterator first_position, input_iterator last_position) { instance_flat_set.push_bulk(first_position, last_position); }
+
+    void push_bulk(std::initializer_list<key_val_type> lightweight_container) { instance_flat_set.push_bulk(lightweight_container); }
+
+    set_iterator pop(const key_val_type &set_type_data) { return instance_flat_set.pop(set_type_data); }
+
+    iterator erase(iterator position) noexcept { return instance_flat_set.erase(position); }
+
+    iterator find(const key_val_type &set_type_data) { return instance_flat_set.find(set_type_data); }
+
+    iterator lower_bound(const key_val_type &set_type_data) { return instance_flat_set.lower_bound(set_type_data); }
+
+    iterator upper_bound(const key_val_type &set_type_data) { return instance_flat_set.upper_bound(set_type_data); }
+
+    void middle_order_traversal() { instance_flat_set.middle_order_traversal(); }
+
+    flat_set &reserve(const uint64_t &new_capacity)
+    {
+      instance_flat_set.reserve(new_capacity);
+      return *this;
+    }
+
+    [[nodiscard]] uint64_t size() const
+    {
+      return instance_flat_set.size();
+    }
+
+    bool empty() { return instance_flat_set.empty(); }
+
+    void clear() { instance_flat_set.clear(); }
+
+    iterator begin() { return instance_flat_set.begin(); }
+
+    iterator end() { return instance_flat_set.end(); }
+
+    const_iterator cbegin() { return instance_flat_set.cbegin(); }
+
+    const_iterator cend() { return instance_flat_set.cend(); }
+
+    iterator operator[](const key_val_type &set_type_data) { return instance_flat_set[set_type_data]; }
+  };
   /**
    * @brief 基于哈希表实现的无序集合容器
    *
    * 该容器是一个无序关联容器，存储唯一的元素（无重复值），通过哈希函数实现高效的插入、删除和查找操作。
    *
-   * 底层依赖哈希表（hash_table）实现，元素的存储顺序与插入顺序一致（通过哈希表的全局链表维护），
+   * 底层依赖开放寻址哈希表（swiss_table）实现，默认按槽位顺序遍历，可选按插入顺序遍历，
    *
    * 平均时间复杂度为 O(1)，最坏情况为 O(n)（哈希冲突严重时）。
    *
@@ -153,30 +440,24 @@ namespace set_container
    *
    * * - `external_hash_functions`: 外部哈希函数类型，默认为 `standard_con::imitation_functions::hash_imitation_functions`
    *
-   *   - 用于计算元素的哈希值，影响元素在哈希表中的映射位置，可自定义以减少冲突
+   *   - 用于计算元素的哈希值，结果在表内再经过混合，影响元素在哈希表中的映射位置
+   *
+   * * - `insertion_ordered`: 为 `true` 时按插入顺序遍历，默认 `false` 按槽位顺序遍历
+   *
+   * * - `set_allocator`: 分配器类型，默认为 `std::allocator<set_type_val>`，为槽位数组提供内存
    *
    * 迭代器类型:
-   * 继承自底层哈希表的迭代器，支持按插入顺序遍历，包含普通和常量版本：
+   * 继承自底层哈希表的迭代器，包含普通和常量版本：
    *
-   * * - `iterator`: 正向迭代器，指向集合中的元素，支持按插入顺序遍历
+   * * - `iterator`: 正向迭代器，指向集合中的元素
    *
    * * - `const_iterator`: 常量正向迭代器，指向不可修改的元素
    */
-  template <typename set_type_val, typename external_hash_functions = standard_con::hash_imitation_functions>
+  template <typename set_type_val, typename external_hash_functions = standard_con::hash_imitation_functions,
+            bool insertion_ordered = false, typename set_allocator = std::allocator<set_type_val>>
   class hash_set
   {
     using key_val_type = set_type_val;
-    class inbuilt_set_hash_functor
-    {
-    private:
-      external_hash_functions hash_functions_object;
-
-    public:
-      uint64_t operator()(const key_val_type &key_value)
-      {
-        return hash_functions_object(key_value) * 131;
-      }
-    };
     class key_val
     {
     public:
@@ -185,7 +466,7 @@ namespace set_container
         return key_value;
       }
     };
-    using hash_table = standard_con::hash_table<set_type_val, key_val_type, key_val, inbuilt_set_hash_functor>;
+    using hash_table = standard_con::swiss_table<set_type_val, key_val_type, key_val, external_hash_functions, insertion_ordered, set_allocator>;
     hash_table instance_hash_set;
 
   public:
@@ -198,11 +479,17 @@ namespace set_container
       instance_hash_set.push(set_type_data);
     }
 
-    hash_set(const hash_set &hash_set_data) { instance_hash_set = hash_set_data.instance_hash_set; }
+    hash_set(const hash_set &hash_set_data) : instance_hash_set(hash_set_data.instance_hash_set) { ; }
 
     ~hash_set() = default;
 
-    hash_set(hash_set &&hash_set_data) noexcept { instance_hash_set = std::move(hash_set_data.instance_hash_set); }
+    hash_set(hash_set &&hash_set_data) noexcept : instance_hash_set(std::move(hash_set_data.instance_hash_set)) { ; }
+
+    using allocator_type = set_allocator;
+
+    explicit hash_set(const set_allocator &allocator_data) : instance_hash_set(allocator_data) { ; }
+
+    [[nodiscard]] allocator_type get_allocator() const noexcept { return instance_hash_set.get_allocator(); }
 
     bool push(const key_val_type &set_type_data) { return instance_hash_set.push(set_type_data); }
 
@@ -216,6 +503,10 @@ namespace set_container
 
     uint64_t capacity() { return instance_hash_set.capacity(); }
 
+    void reserve(uint64_t element_count) { instance_hash_set.reserve(element_count); }
+
+    void clear() { instance_hash_set.clear(); }
+
     [[nodiscard]] uint64_t size() const
     {
       return instance_hash_set.size();
@@ -271,4 +562,6 @@ namespace standard_con
 {
   using set_container::hash_set;
   using set_container::tree_set;
+  using set_container::btree_set;
+  using set_container::flat_set;
 }
\ No newline at end of file
@@ -1,10 +1,21 @@
 #pragma once
+#include <bit>
+#include <cassert>
+#include <cstdint>
+#include <memory>
+#include <cstring>
+#include <functional>
+#include <string_view>
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define STRING_CONTAINER_SSE2 1
+#endif
 #include "simulate_exception.hpp"
 #include "simulate_algorithm.hpp"
 namespace string_container
 {
 	/*
-			* @brief  #### `string` 类
+			* @brief  #### `basic_string` 类模板 / `string` 类型别名
 
 			*   - 自定义字符串容器类，用于存储和操作字符串数据
 
@@ -26,11 +37,19 @@ namespace string_container
 
 			* 成员变量:
 
-			* * - `_data`: 指向字符数组的指针，存储字符串数据
+			* * - `_storage`: 24 字节存储，按短字符串优化（SSO）布局复用：
 			*
-			* * - `_size`: 字符串当前长度（不包含终止符 '\0'）
+			*     - 短字符串：前 23 字节为内联字符（最多 22 个字符 + '\0'），末字节保存长度
 			*
-			* * - `_capacity`: 字符串当前容量（可容纳的最大字符数，含终止符）
+			*     - 长字符串：依次保存堆指针、长度、容量，容量最高位（与末字节重叠）作为堆标记
+			*
+			* * - 长度不超过 22 的字符串（包括空串）不会触发任何堆分配
+			*
+			* * - `_allocator`: 堆缓冲区的分配器，`std::allocator<char>` 等无状态分配器不占空间
+
+			* 模板参数:
+
+			* * - `string_allocator`: 分配器类型，默认 `std::allocator<char>`；`string` 即 `basic_string<>`，传入 `polymorphic_allocator<char>` 可使用竞技场等内存资源
 
 			* 迭代器相关方法:
 
@@ -56,11 +75,11 @@ namespace string_container
 			*
 			* * - `size()`: 返回字符串当前长度
 			*
-			* * - `capacity()`: 返回字符串当前容量
+			* * - `capacity()`: 返回字符串当前容量（不含终止符，内联状态下为 22）
 			*
 			* * - `resize()`: 调整字符串长度，不足部分用指定字符填充
 			*
-			* * - `reserve()`: 预分配指定容量的内存，不改变字符串长度
+			* * - `reserve()`: 预分配指定容量的内存，不改变字符串长度（按至少翻倍增长）
 
 			* 元素访问方法:
 
@@ -78,6 +97,8 @@ namespace string_container
 			*
 			* * - 从 C 风格字符串构造: 拷贝传入的常量字符串
 			*
+			* * - 从 `std::string_view` 构造（显式）: 拷贝视图内容，可包含 '\0'
+			*
 			* * - 移动构造函数（C 字符串）: 接管传入的临时字符数组所有权
 			*
 			* * - 拷贝构造函数: 深拷贝另一个字符串对象
@@ -98,6 +119,8 @@ namespace string_container
 			*
 			* * - `prepend()`: 在字符串开头插入子字符串
 			*
+			* * - `append()`: 追加 `std::string_view`，与 `push_back` 共用几何扩容策略
+			*
 			* * - `swap()`: 与另一个字符串交换内容
 			*
 			* * - `allocate_resources()`: 重新分配内存以扩展容量
@@ -112,6 +135,10 @@ namespace string_container
 			*
 			* * - `sub_string()`: 提取从指定位置开始或指定范围的子字符串
 			*
+			* * - `find()`: 查找字符或子串，返回下标，未找到返回 `nops`（SSE2 批量比较 16 字节）
+			*
+			* * - `compare()`: 与 `std::string_view` 按字典序比较，返回负数、0 或正数
+			*
 			* * - `reverse()`: 返回字符串的反转版本
 			*
 			* * - `reverse_sub_string()`: 返回指定范围子字符串的反转版本
@@ -134,6 +161,8 @@ namespace string_container
 			*
 			* * - `operator>`: 判断当前字符串是否大于另一个字符串（字典序）
 			*
+			* * - `operator std::string_view`: 零拷贝转换为只读视图，可直接传给网络层接口
+			*
 			* * - 友元 `operator<<`: 输出字符串到流
 			*
 			* * - 友元 `operator>>`: 从流读取字符串
@@ -144,7 +173,7 @@ namespace string_container
 			*
 			* * - 包含异常处理，对越界访问等情况抛出异常
 			*
-			* * - 自动扩容机制，容量不足时翻倍扩展（初始容量为 2）
+			* * - 自动扩容机制，容量不足时至少翻倍扩展，追加操作均摊 O(1)
 			*
 			* * - 所有字符串以 '\0' 结尾，兼容 C 风格字符串操作
 
@@ -156,41 +185,334 @@ namespace string_container
 			*
 			* * - 与标准库 `std::string` 接口类似，但实现细节可能不同
 			*
-			* * - 移动构造后原字符串对象会被重置（内部指针为 nullptr）
+			* * - 移动构造后原字符串对象会被重置为空字符串，仍可继续使用
+			*
+			* * - 内联状态下迭代器指向对象内部，移动或交换后失效
 
 			* 详细请参考 https://github.com/Hatedatastructures/Custom-libraries/blob/main/template_container.md
 	*/
-	class string
+	template <typename string_allocator = std::allocator<char>>
+	class basic_string
 	{
 	private:
-		char *_data;
-		uint64_t _size;
-		uint64_t _capacity;
+		static constexpr uint64_t inline_capacity = 22;	 // 内联可容纳的字符数（不含 '\0'）
+		static constexpr uint64_t tag_offset = 23;			 // 末字节：内联长度 / 堆标记
+		static constexpr uint64_t size_offset = 8;
+		static constexpr uint64_t capacity_offset = 16;
+		static constexpr unsigned char heap_flag = 0x80;
+		alignas(uint64_t) char _storage[24];
+		[[no_unique_address]] string_allocator _allocator; // 无状态时不占空间，默认 string 仍为 24 字节
+
+		using allocator_traits = std::allocator_traits<string_allocator>;
+		// 堆缓冲区总是多申请 1 字节存放 '\0'
+		[[nodiscard]] char *allocate_buffer(const uint64_t buffer_capacity)
+		{
+			return std::to_address(allocator_traits::allocate(_allocator, buffer_capacity + 1));
+		}
+
+		[[nodiscard]] bool is_inline() const noexcept
+		{
+			return (static_cast<unsigned char>(_storage[tag_offset]) & heap_flag) == 0;
+		}
+		template <typename field_type>
+		[[nodiscard]] field_type load_field(const uint64_t field_offset) const noexcept
+		{
+			field_type field_value;
+			std::memcpy(&field_value, _storage + field_offset, sizeof(field_type));
+			return field_value;
+		}
+		template <typename field_type>
+		void store_field(const uint64_t field_offset, const field_type field_value) noexcept
+		{
+			std::memcpy(_storage + field_offset, &field_value, sizeof(field_type));
+		}
+		// 容量字与末字节重叠，堆标记必须落在末字节上，故按字节序分别编码
+		static constexpr uint64_t encode_capacity(const uint64_t heap_capacity) noexcept
+		{
+			if constexpr (std::endian::native == std::endian::little)
+			{
+				return heap_capacity | (static_cast<uint64_t>(heap_flag) << 56);
+			}
+			else
+			{
+				return (heap_capacity << 8) | heap_flag;
+			}
+		}
+		static constexpr uint64_t decode_capacity(const uint64_t capacity_word) noexcept
+		{
+			if constexpr (std::endian::native == std::endian::little)
+			{
+				return capacity_word & ~(static_cast<uint64_t>(heap_flag) << 56);
+			}
+			else
+			{
+				return capacity_word >> 8;
+			}
+		}
+		[[nodiscard]] char *data_pointer() const noexcept
+		{
+			return is_inline() ? const_cast<char *>(_storage) : load_field<char *>(0);
+		}
+		void reset_inline() noexcept
+		{
+			// 整块清零（三次 8 字节写入），空串的各个字段都有确定值
+			std::memset(_storage, 0, sizeof(_storage));
+		}
+		void adopt_heap(char *heap_buffer, const uint64_t heap_size, const uint64_t heap_capacity) noexcept
+		{
+			store_field<char *>(0, heap_buffer);
+			store_field<uint64_t>(size_offset, heap_size);
+			store_field<uint64_t>(capacity_offset, encode_capacity(heap_capacity));
+		}
+		void release_heap() noexcept
+		{
+			if (!is_inline())
+			{
+				allocator_traits::deallocate(_allocator, load_field<char *>(0), decode_capacity(load_field<uint64_t>(capacity_offset)) + 1);
+			}
+		}
+		void set_length(const uint64_t new_size) noexcept
+		{
+			if (is_inline())
+			{
+				_storage[tag_offset] = static_cast<char>(new_size);
+			}
+			else
+			{
+				store_field<uint64_t>(size_offset, new_size);
+			}
+			data_pointer()[new_size] = '\0';
+		}
+		void initialize(const char *source_data, const uint64_t source_length)
+		{
+			if (source_length <= inline_capacity)
+			{
+				if (source_length != 0)
+				{
+					std::memcpy(_storage, source_data, source_length);
+				}
+				_storage[source_length] = '\0';
+				_storage[tag_offset] = static_cast<char>(source_length);
+				return;
+			}
+			char *heap_buffer = allocate_buffer(source_length);
+			std::memcpy(heap_buffer, source_data, source_length);
+			heap_buffer[source_length] = '\0';
+			adopt_heap(heap_buffer, source_length, source_length);
+		}
+		[[nodiscard]] uint64_t growth_capacity(const uint64_t required_capacity) const noexcept
+		{
+			// 至少翻倍，保证连续追加均摊 O(1)
+			const uint64_t doubled_capacity = capacity() * 2;
+			return required_capacity < doubled_capacity ? doubled_capacity : required_capacity;
+		}
+		[[nodiscard]] bool overlaps(const char *source_data) const noexcept
+		{
+			const char *current_data = data_pointer();
+			return std::greater_equal<const char *>()(source_data, current_data) &&
+						 std::less_equal<const char *>()(source_data, current_data + size());
+		}
+		void assign_raw(const char *source_data, const uint64_t source_length)
+		{
+			if (source_length <= capacity())
+			{
+				// 复用现有缓冲区，memmove 允许源与自身重叠
+				if (source_length != 0)
+				{
+					std::memmove(data_pointer(), source_data, source_length);
+				}
+				set_length(source_length);
+				return;
+			}
+			char *heap_buffer = allocate_buffer(source_length);
+			std::memcpy(heap_buffer, source_data, source_length);
+			heap_buffer[source_length] = '\0';
+			release_heap();
+			adopt_heap(heap_buffer, source_length, source_length);
+		}
+		basic_string &append_raw(const char *source_data, const uint64_t source_length)
+		{
+			if (source_length == 0)
+			{
+				return *this;
+			}
+			const uint64_t old_size = size();
+			const uint64_t new_size = old_size + source_length;
+			if (new_size > capacity())
+			{
+				// 先拷入新缓冲区再释放旧缓冲区，源指向自身时同样安全
+				const uint64_t new_capacity = growth_capacity(new_size);
+				char *heap_buffer = allocate_buffer(new_capacity);
+				std::memcpy(heap_buffer, data_pointer(), old_size);
+				std::memcpy(heap_buffer + old_size, source_data, source_length);
+				heap_buffer[new_size] = '\0';
+				release_heap();
+				adopt_heap(heap_buffer, new_size, new_capacity);
+				return *this;
+			}
+			std::memmove(data_pointer() + old_size, source_data, source_length);
+			set_length(new_size);
+			return *this;
+		}
+		basic_string &insert_raw(const uint64_t start_position, const char *source_data, const uint64_t source_length)
+		{
+			if (source_length == 0)
+			{
+				return *this;
+			}
+			const uint64_t old_size = size();
+			const uint64_t new_size = old_size + source_length;
+			char *current_data = data_pointer();
+			if (new_size > capacity())
+			{
+				const uint64_t new_capacity = growth_capacity(new_size);
+				char *heap_buffer = allocate_buffer(new_capacity);
+				std::memcpy(heap_buffer, current_data, start_position);
+				std::memcpy(heap_buffer + start_position, source_data, source_length);
+				std::memcpy(heap_buffer + start_position + source_length, current_data + start_position, old_size - start_position);
+				heap_buffer[new_size] = '\0';
+				release_heap();
+				adopt_heap(heap_buffer, new_size, new_capacity);
+				return *this;
+			}
+			if (overlaps(source_data))
+			{
+				// 原地后移会改写源数据，先复制一份
+				const basic_string source_copy(std::string_view(source_data, source_length), _allocator);
+				return insert_raw(start_position, source_copy.c_str(), source_length);
+			}
+			std::memmove(current_data + start_position + source_length, current_data + start_position, old_size - start_position);
+			std::memcpy(current_data + start_position, source_data, source_length);
+			set_length(new_size);
+			return *this;
+		}
+		// SIMD 查找单个字节，返回相对下标
+		[[nodiscard]] static uint64_t find_byte(const char *haystack, const uint64_t haystack_length, const char target) noexcept
+		{
+#ifdef STRING_CONTAINER_SSE2
+			const __m128i needle = _mm_set1_epi8(target);
+			uint64_t position = 0;
+			for (; position + 16 <= haystack_length; position += 16)
+			{
+				const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(haystack + position));
+				const auto mask = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(block, needle)));
+				if (mask != 0)
+				{
+					return position + std::countr_zero(mask);
+				}
+			}
+			for (; position < haystack_length; ++position)
+			{
+				if (haystack[position] == target)
+				{
+					return position;
+				}
+			}
+			return nops;
+#else
+			const void *hit = haystack_length == 0 ? nullptr : std::memchr(haystack, target, haystack_length);
+			return hit == nullptr ? nops : static_cast<uint64_t>(static_cast<const char *>(hit) - haystack);
+#endif
+		}
+		// SIMD 查找子串：同时比较首尾字符筛出候选位置，再逐个校验中间部分
+		[[nodiscard]] static uint64_t find_bytes(const char *haystack, const uint64_t haystack_length, const char *needle, const uint64_t needle_length) noexcept
+		{
+			if (needle_length == 0)
+			{
+				return 0;
+			}
+			if (needle_length > haystack_length)
+			{
+				return nops;
+			}
+			if (needle_length == 1)
+			{
+				return find_byte(haystack, haystack_length, needle[0]);
+			}
+			uint64_t position = 0;
+#ifdef STRING_CONTAINER_SSE2
+			const __m128i first_char = _mm_set1_epi8(needle[0]);
+			const __m128i last_char = _mm_set1_epi8(needle[needle_length - 1]);
+			for (; position + needle_length - 1 + 16 <= haystack_length; position += 16)
+			{
+				const __m128i first_block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(haystack + position));
+				const __m128i last_block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(haystack + position + needle_length - 1));
+				auto mask = static_cast<uint32_t>(_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(first_block, first_char), _mm_cmpeq_epi8(last_block, last_char))));
+				while (mask != 0)
+				{
+					const uint64_t candidate = position + std::countr_zero(mask);
+					if (std::memcmp(haystack + candidate + 1, needle + 1, needle_length - 2) == 0)
+					{
+						return candidate;
+					}
+					mask &= mask - 1;
+				}
+			}
+#endif
+			for (; position + needle_length <= haystack_length; ++position)
+			{
+				if (haystack[position] == needle[0] && std::memcmp(haystack + position, needle, needle_length) == 0)
+				{
+					return position;
+				}
+			}
+			return nops;
+		}
+		// SIMD 定位第一个不同字节，全部相同时返回 compare_length
+		[[nodiscard]] static uint64_t find_mismatch(const char *left_data, const char *right_data, const uint64_t compare_length) noexcept
+		{
+			uint64_t position = 0;
+#ifdef STRING_CONTAINER_SSE2
+			for (; position + 16 <= compare_length; position += 16)
+			{
+				const __m128i left_block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(left_data + position));
+				const __m128i right_block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(right_data + position));
+				const auto mask = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(left_block, right_block))) ^ 0xFFFFu;
+				if (mask != 0)
+				{
+					return position + std::countr_zero(mask);
+				}
+			}
+#endif
+			for (; position < compare_length; ++position)
+			{
+				if (left_data[position] != right_data[position])
+				{
+					return position;
+				}
+			}
+			return compare_length;
+		}
 
 	public:
 		using iterator = char *;
 		using const_iterator = const char *;
 		using reverse_iterator = iterator;
 		using const_reverse_iterator = const_iterator;
+		using allocator_type = string_allocator;
 		constexpr static const uint64_t nops = -1;
+		[[nodiscard]] allocator_type get_allocator() const noexcept
+		{
+			return _allocator;
+		}
 		[[nodiscard]] iterator begin() const noexcept
 		{
-			return _data;
+			return data_pointer();
 		}
 
 		[[nodiscard]] iterator end() const noexcept
 		{
-			return _data + _size;
+			return data_pointer() + size();
 		}
 
 		[[nodiscard]] const_iterator cbegin() const noexcept
 		{
-			return static_cast<const_iterator>(_data);
+			return static_cast<const_iterator>(begin());
 		}
 
 		[[nodiscard]] const_iterator cend() const noexcept
 		{
-			return static_cast<const_iterator>(_data + _size);
+			return static_cast<const_iterator>(end());
 		}
 
 		[[nodiscard]] reverse_iterator rbegin() const noexcept
@@ -215,103 +537,118 @@ namespace string_container
 
 		[[nodiscard]] bool empty() const noexcept
 		{
-			return _size == 0;
+			return size() == 0;
 		}
 
 		[[nodiscard]] uint64_t size() const noexcept
 		{
-			return _size;
+			return is_inline() ? static_cast<unsigned char>(_storage[tag_offset]) : load_field<uint64_t>(size_offset);
 		}
 
 		[[nodiscard]] uint64_t capacity() const noexcept
 		{
-			return _capacity;
+			return is_inline() ? inline_capacity : decode_capacity(load_field<uint64_t>(capacity_offset));
 		}
 
 		[[nodiscard]] const char *c_str() const noexcept
 		{
-			return static_cast<const char *>(_data);
+			return static_cast<const char *>(data_pointer());
 		} // 返回C风格字符串
 
 		[[nodiscard]] char back() const noexcept
 		{
-			return _size > 0 ? _data[_size - 1] : '\0';
+			const uint64_t current_size = size();
+			return current_size > 0 ? data_pointer()[current_size - 1] : '\0';
 		}
 
 		[[nodiscard]] char front() const noexcept
 		{
-			return _data[0];
+			return data_pointer()[0];
 		} // 返回头字符
 
-		string(const char *str_data = " ")
-				: _size(str_data == nullptr ? 0 : strlen(str_data)), _capacity(_size)
+		operator std::string_view() const noexcept
+		{
+			return std::string_view(data_pointer(), size());
+		} // 零拷贝视图
+
+		basic_string() noexcept
+		{
+			reset_inline();
+		}
+		basic_string(const char *str_data)
 		{
-			// 传进来的字符串是常量字符串，不能直接修改，需要拷贝一份，并且常量字符串在数据段(常量区)浅拷贝会导致程序崩溃
-			if (str_data != nullptr)
+			// 传进来的字符串是常量字符串，不能直接修改，需要拷贝一份；短串直接放入内联缓冲区
+			if (str_data == nullptr)
 			{
-				_data = new char[_capacity + 1];
-				std::strncpy(_data, str_data, std::strlen(str_data));
-				_data[_size] = '\0';
+				reset_inline();
 			}
 			else
 			{
-				_data = new char[1];
-				_data[0] = '\0';
+				initialize(str_data, std::strlen(str_data));
 			}
 		}
-		string(char *&&str_data) noexcept
-				: _data(nullptr), _size(str_data == nullptr ? 0 : strlen(str_data)), _capacity(_size)
+		basic_string(const char *str_data, const uint64_t str_length)
 		{
-			// 移动构造函数，拿传入对象的变量初始化本地变量，对于涉及开辟内存的都要深拷贝
-			if (str_data != nullptr)
-			{
-				_data = str_data;
-				str_data = nullptr;
-			}
-			else
+			initialize(str_data, str_length);
+		}
+		explicit basic_string(const std::string_view str_view)
+		{
+			initialize(str_view.data(), str_view.size());
+		}
+		basic_string(char *&&str_data)
+		{
+			// 接管 new[] 分配的字符数组：内容拷入本对象（内联或经分配器申请的缓冲区）后释放原数组
+			const std::unique_ptr<char[]> owned_data(str_data);
+			str_data = nullptr;
+			if (owned_data == nullptr)
 			{
-				_data = new char[1];
-				_data[0] = '\0';
+				reset_inline();
+				return;
 			}
+			initialize(owned_data.get(), std::strlen(owned_data.get()));
+		}
+		explicit basic_string(const string_allocator &allocator_data) noexcept
+				: _allocator(allocator_data)
+		{
+			reset_inline();
+		}
+		basic_string(const char *str_data, const uint64_t str_length, const string_allocator &allocator_data)
+				: _allocator(allocator_data)
+		{
+			initialize(str_data, str_length);
+		}
+		basic_string(const std::string_view str_view, const string_allocator &allocator_data)
+				: _allocator(allocator_data)
+		{
+			initialize(str_view.data(), str_view.size());
 		}
-		string(const string &str_data)
-				: _data(nullptr), _size(str_data._size), _capacity(str_data._capacity)
+		basic_string(const basic_string &str_data)
+				: _allocator(allocator_traits::select_on_container_copy_construction(str_data._allocator))
 		{
-			// 拷贝构造函数，拿传入对象的变量初始化本地变量，对于涉及开辟内存的都要深拷贝
-			uint64_t capacity = str_data._capacity;
-			_data = new char[capacity + 1];
-			// algorithm::copy(_data,_data+capacity,str_data._data); const对象出错
-			std::strcpy(_data, str_data._data);
+			// 拷贝构造函数，深拷贝；目标容量按实际长度分配
+			initialize(str_data.data_pointer(), str_data.size());
 		}
-		string(string &&str_data) noexcept
-				: _data(nullptr), _size(str_data._size), _capacity(str_data._capacity)
+		basic_string(basic_string &&str_data) noexcept
+				: _allocator(std::move(str_data._allocator))
 		{
-			// 移动构造函数，拿传入对象的变量初始化本地变量，对于涉及开辟内存的都要深拷贝
-			//  template_container::algorithm::swap(str_data._data,_data);
-			_data = str_data._data;
-			_size = str_data._size;
-			_capacity = str_data._capacity;
-			str_data._data = nullptr;
+			// 移动构造函数，整体搬移 24 字节，原对象重置为空串
+			std::memcpy(_storage, str_data._storage, sizeof(_storage));
+			str_data.reset_inline();
 		}
-		string(const std::initializer_list<char> str_data)
+		basic_string(const std::initializer_list<char> str_data)
 		{
 			// 初始化列表构造函数
-			_size = str_data.size();
-			_capacity = _size;
-			_data = new char[_capacity + 1];
-			standard_con::algorithm::copy(str_data.begin(), str_data.end(), _data);
-			_data[_size] = '\0';
+			initialize(str_data.begin(), str_data.size());
 		}
-		~string() noexcept
+		~basic_string() noexcept
 		{
-			delete[] _data;
-			_data = nullptr;
-			_capacity = _size = 0;
+			release_heap();
+			reset_inline();
 		}
-		string &uppercase() noexcept
+		basic_string &uppercase() noexcept
 		{
 			// 字符串转大写
-			for (string::iterator start_position = _data; start_position != _data + _size; start_position++)
+			for (basic_string::iterator start_position = begin(); start_position != end(); start_position++)
 			{
 				if (*start_position >= 'a' && *start_position <= 'z')
 				{
@@ -320,10 +657,10 @@ namespace string_container
 			}
 			return *this;
 		}
-		string &lowercase() noexcept
+		basic_string &lowercase() noexcept
 		{
 			// 字符串转小写
-			for (string::iterator start_position = _data; start_position != _data + _size; start_position++)
+			for (basic_string::iterator start_position = begin(); start_position != end(); start_position++)
 			{
 				if (*start_position >= 'A' && *start_position <= 'Z')
 				{
@@ -332,49 +669,21 @@ namespace string_container
 			}
 			return *this;
 		}
-		// uint64_t str_substring_kmp(const char*& sub_string)
-		// {
-		//     //查找子串
-		// }
-		string &prepend(const char *sub_string)
-		{
-			// 前duan插入子串
-			uint64_t len = strlen(sub_string);
-			uint64_t new_size = _size + len;
-			allocate_resources(new_size);
-			char *temporary_buffers = new char[_capacity + 1];
-			// 临时变量
-			memmove(temporary_buffers, _data, _size + 1);
-			memmove(_data, sub_string, len);
-			memmove(_data + len, temporary_buffers, _size + 1);
-			// 比memcpy更安全，memcpy会覆盖原有数据，memmove会先拷贝到临时变量再拷贝到目标地址
-			_size = new_size;
-			_data[_size] = '\0';
-			delete[] temporary_buffers;
-			return *this;
+		basic_string &prepend(const char *sub_string)
+		{
+			// 前端插入子串
+			return insert_raw(0, sub_string, strlen(sub_string));
 		}
-		string &insert_sub_string(const char *sub_string, const uint64_t &start_position)
+		basic_string &insert_sub_string(const char *sub_string, const uint64_t &start_position)
 		{
 			try
 			{
 				// 中间位置插入子串
-				if (start_position > _size)
+				if (start_position > size())
 				{
 					throw custom_exception::fault("传入参数位置越界", "insert_sub_string", __LINE__);
 				}
-				uint64_t len = strlen(sub_string);
-				uint64_t new_size = _size + len;
-				allocate_resources(new_size);
-				char *temporary_buffers = new char[new_size + 1];
-				// 临时变量
-				memmove(temporary_buffers, _data, _size + 1);
-				// 从oid_pos开始插入
-				memmove(_data + start_position + len, temporary_buffers + start_position, _size - start_position + 1);
-				memmove(_data + start_position, sub_string, len);
-				_size = new_size;
-				_data[_size] = '\0';
-				delete[] temporary_buffers;
-				return *this;
+				return insert_raw(start_position, sub_string, strlen(sub_string));
 			}
 			catch (const custom_exception::fault &process)
 			{
@@ -382,12 +691,12 @@ namespace string_container
 				throw;
 			}
 		}
-		[[nodiscard]] string sub_string(const uint64_t &start_position) const
+		[[nodiscard]] basic_string sub_string(const uint64_t &start_position) const
 		{
 			// 提取字串到'\0'
 			try
 			{
-				if (start_position > _size)
+				if (start_position > size())
 				{
 					throw custom_exception::fault("传入参数位置越界", "sub_string", __LINE__);
 				}
@@ -397,20 +706,14 @@ namespace string_container
 				std::cerr << process.what() << " " << process.function_name_get() << " " << process.line_number_get() << std::endl;
 				throw;
 			}
-			string result;
-			uint64_t sub_len = _size - start_position;
-			result.allocate_resources(sub_len);
-			std::strncpy(result._data, _data + start_position, sub_len);
-			result._size = sub_len;
-			result._data[result._size] = '\0';
-			return result;
+			return basic_string(data_pointer() + start_position, size() - start_position);
 		}
-		[[nodiscard]] string sub_string_from(const uint64_t &start_position) const
+		[[nodiscard]] basic_string sub_string_from(const uint64_t &start_position) const
 		{
 			// 提取字串到末尾
 			try
 			{
-				if (start_position > _size)
+				if (start_position > size())
 				{
 					throw custom_exception::fault("传入参数位置越界", "sub_string_from", __LINE__);
 				}
@@ -420,20 +723,14 @@ namespace string_container
 				std::cerr << process.what() << " " << process.function_name_get() << " " << process.line_number_get() << std::endl;
 				throw;
 			}
-			string result;
-			uint64_t sub_len = _size - start_position;
-			result.allocate_resources(sub_len);
-			std::strncpy(result._data, _data + start_position, sub_len);
-			result._size = sub_len;
-			result._data[result._size] = '\0';
-			return result;
+			return basic_string(data_pointer() + start_position, size() - start_position);
 		}
-		[[nodiscard]] string sub_string(const uint64_t &start_position, const uint64_t &terminate_position) const
+		[[nodiscard]] basic_string sub_string(const uint64_t &start_position, const uint64_t &terminate_position) const
 		{
 			// 提取字串到指定位置
 			try
 			{
-				if (start_position > _size || terminate_position > _size || start_position > terminate_position)
+				if (start_position > size() || terminate_position > size() || start_position > terminate_position)
 				{
 					throw custom_exception::fault("传入参数位置越界", "sub_string", __LINE__);
 				}
@@ -443,79 +740,94 @@ namespace string_container
 				std::cerr << process.what() << " " << process.function_name_get() << " " << process.line_number_get() << std::endl;
 				throw;
 			}
-			string result;
-			uint64_t sub_len = terminate_position - start_position;
-			result.allocate_resources(sub_len);
-			// strncpy更安全
-			std::strncpy(result._data, _data + start_position, sub_len);
-			result._size = sub_len;
-			result._data[result._size] = '\0';
-			return result;
+			return basic_string(data_pointer() + start_position, terminate_position - start_position);
+		}
+		[[nodiscard]] uint64_t find(const char target_char, const uint64_t &start_position = 0) const noexcept
+		{
+			// 查找字符，未找到返回nops
+			const uint64_t current_size = size();
+			if (start_position >= current_size)
+			{
+				return nops;
+			}
+			const uint64_t offset = find_byte(data_pointer() + start_position, current_size - start_position, target_char);
+			return offset == nops ? nops : start_position + offset;
+		}
+		[[nodiscard]] uint64_t find(const std::string_view target_view, const uint64_t &start_position = 0) const noexcept
+		{
+			// 查找子串，未找到返回nops
+			const uint64_t current_size = size();
+			if (start_position > current_size)
+			{
+				return nops;
+			}
+			const uint64_t offset = find_bytes(data_pointer() + start_position, current_size - start_position, target_view.data(), target_view.size());
+			return offset == nops ? nops : start_position + offset;
+		}
+		[[nodiscard]] int compare(const std::string_view target_view) const noexcept
+		{
+			// 字典序比较（按无符号字节），小于返回负数，等于返回0，大于返回正数
+			const uint64_t current_size = size();
+			const uint64_t min_len = current_size < target_view.size() ? current_size : target_view.size();
+			const char *current_data = data_pointer();
+			const uint64_t mismatch = find_mismatch(current_data, target_view.data(), min_len);
+			if (mismatch != min_len)
+			{
+				return static_cast<unsigned char>(current_data[mismatch]) < static_cast<unsigned char>(target_view[mismatch]) ? -1 : 1;
+			}
+			if (current_size == target_view.size())
+			{
+				return 0;
+			}
+			return current_size < target_view.size() ? -1 : 1;
 		}
 		void allocate_resources(const uint64_t &new_inaugurate_capacity)
 		{
 			// 检查string空间大小，来分配内存
-			if (new_inaugurate_capacity <= _capacity)
+			if (new_inaugurate_capacity <= capacity())
 			{
 				// 防止无意义频繁拷贝
 				return;
 			}
-			char *temporary_str_array = new char[new_inaugurate_capacity + 1];
-			std::memcpy(temporary_str_array, _data, _size + 1);
-
-			temporary_str_array[_size] = '\0';
-			delete[] _data;
-			_data = temporary_str_array;
-			_capacity = new_inaugurate_capacity;
+			const uint64_t current_size = size();
+			char *temporary_str_array = allocate_buffer(new_inaugurate_capacity);
+			std::memcpy(temporary_str_array, data_pointer(), current_size + 1);
+			release_heap();
+			adopt_heap(temporary_str_array, current_size, new_inaugurate_capacity);
 		}
-		string &push_back(const char &temporary_str_data)
+		basic_string &push_back(const char &temporary_str_data)
 		{
-			if (_size == _capacity)
+			const uint64_t current_size = size();
+			if (current_size == capacity())
 			{
-				uint64_t newcapacity = _capacity == 0 ? 2 : _capacity * 2;
-				allocate_resources(newcapacity);
+				allocate_resources(growth_capacity(current_size + 1));
 			}
-			_data[_size] = temporary_str_data;
-			++_size;
-			_data[_size] = '\0';
+			data_pointer()[current_size] = temporary_str_data;
+			set_length(current_size + 1);
 			return *this;
 		}
-		string &push_back(const string &temporary_string_data)
+		basic_string &push_back(const basic_string &temporary_string_data)
 		{
-			uint64_t len = _size + temporary_string_data._size;
-			if (len > _capacity)
-			{
-				uint64_t new_container_capacity = len;
-				allocate_resources(new_container_capacity);
-			}
-			std::strncpy(_data + _size, temporary_string_data._data, temporary_string_data.size());
-			_size = _size + temporary_string_data._size;
-			_data[_size] = '\0';
-			return *this;
+			return append_raw(temporary_string_data.data_pointer(), temporary_string_data.size());
 		}
-		string &push_back(const char *temporary_str_ptr_data)
+		basic_string &push_back(const char *temporary_str_ptr_data)
 		{
 			if (temporary_str_ptr_data == nullptr)
 			{
 				return *this;
 			}
-			const uint64_t len = strlen(temporary_str_ptr_data);
-			const uint64_t new_container_capacity = len + _size;
-			if (new_container_capacity > _capacity)
-			{
-				allocate_resources(new_container_capacity);
-			}
-			std::strncpy(_data + _size, temporary_str_ptr_data, len);
-			_size = _size + len;
-			_data[_size] = '\0';
-			return *this;
+			return append_raw(temporary_str_ptr_data, strlen(temporary_str_ptr_data));
+		}
+		basic_string &append(const std::string_view str_view)
+		{
+			return append_raw(str_view.data(), str_view.size());
 		}
-		string &resize(const uint64_t &inaugurate_size, const char &default_data = '\0')
+		basic_string &resize(const uint64_t &inaugurate_size, const char &default_data = '\0')
 		{
 			// 扩展字符串长度
-			if (inaugurate_size > _capacity)
+			const uint64_t current_size = size();
+			if (inaugurate_size > current_size)
 			{
-				// 长度大于容量，重新开辟内存
 				try
 				{
 					allocate_resources(inaugurate_size);
@@ -525,47 +837,51 @@ namespace string_container
 					std::cerr << new_charptr_abnormal.what() << std::endl;
 					throw;
 				}
-				for (string::iterator start_position = _data + _size; start_position != _data + inaugurate_size; start_position++)
-				{
-					*start_position = default_data;
-				}
-				_size = inaugurate_size;
-				_data[_size] = '\0';
-			}
-			else
-			{
-				// 如果新长度小于当前字符串长度，直接截断放'\0'
-				_size = inaugurate_size;
-				_data[_size] = '\0';
+				std::memset(data_pointer() + current_size, default_data, inaugurate_size - current_size);
 			}
+			// 如果新长度小于当前字符串长度，直接截断放'\0'
+			set_length(inaugurate_size);
 			return *this;
 		}
 		iterator reserve(const uint64_t &new_container_capacity)
 		{
 			try
 			{
-				allocate_resources(new_container_capacity);
+				if (new_container_capacity > capacity())
+				{
+					allocate_resources(growth_capacity(new_container_capacity));
+				}
 			}
 			catch (const std::bad_alloc &new_charptr_abnormal)
 			{
 				std::cerr << new_charptr_abnormal.what() << std::endl;
 				throw;
 			}
-			return _data;
+			return begin();
 			// 返回首地址迭代器
 		}
-		string &swap(string &str_data) noexcept
+		// 前置条件：分配器会随交换传播（propagate_on_container_swap），或两者相等；否则堆缓冲区将由错误的分配器释放
+		basic_string &swap(basic_string &str_data) noexcept
 		{
-			standard_con::algorithm::swap(_data, str_data._data);
-			standard_con::algorithm::swap(_size, str_data._size);
-			standard_con::algorithm::swap(_capacity, str_data._capacity);
+			char temporary_storage[sizeof(_storage)];
+			std::memcpy(temporary_storage, _storage, sizeof(_storage));
+			std::memcpy(_storage, str_data._storage, sizeof(_storage));
+			std::memcpy(str_data._storage, temporary_storage, sizeof(_storage));
+			if constexpr (allocator_traits::propagate_on_container_swap::value)
+			{
+				std::swap(_allocator, str_data._allocator);
+			}
+			else
+			{
+				assert(_allocator == str_data._allocator);
+			}
 			return *this;
 		}
-		[[nodiscard]] string reverse() const
+		[[nodiscard]] basic_string reverse() const
 		{
 			try
 			{
-				if (_size == 0)
+				if (empty())
 				{
 					throw custom_exception::fault("当前string为空", "reserve", __LINE__);
 				}
@@ -575,18 +891,13 @@ namespace string_container
 				std::cerr << process.what() << " " << process.function_name_get() << " " << process.line_number_get() << std::endl;
 				throw;
 			}
-			string reversed_string;
-			for (string::const_reverse_iterator reverse = rbegin(); reverse != rend(); reverse--)
-			{
-				reversed_string.push_back(*reverse);
-			}
-			return reversed_string;
+			return reverse_sub_string(0, size());
 		}
-		[[nodiscard]] string reverse_sub_string(const uint64_t &start_position, const uint64_t &terminate_position) const
+		[[nodiscard]] basic_string reverse_sub_string(const uint64_t &start_position, const uint64_t &terminate_position) const
 		{
 			try
 			{
-				if (start_position > _size || terminate_position > _size || start_position > terminate_position || _size == 0)
+				if (start_position > size() || terminate_position > size() || start_position > terminate_position || empty())
 				{
 					throw custom_exception::fault("string回滚位置异常", "reverse_sub_string", __LINE__);
 				}
@@ -596,40 +907,33 @@ namespace string_container
 				std::cerr << process.what() << " " << process.function_name_get() << " " << process.line_number_get() << std::endl;
 				throw;
 			}
-			string reversed_result;
-			for (string::const_reverse_iterator reverse = _data + terminate_position - 1; reverse != _data + start_position - 1; reverse--)
+			basic_string reversed_result(data_pointer() + start_position, terminate_position - start_position);
+			char *reversed_data = reversed_result.data_pointer();
+			for (uint64_t left = 0, right = reversed_result.size(); left + 1 < right; ++left, --right)
 			{
-				reversed_result.push_back(*reverse);
+				standard_con::algorithm::swap(reversed_data[left], reversed_data[right - 1]);
 			}
 			return reversed_result;
 		}
 		void string_print() const noexcept
 		{
-			std::cout << _data << std::endl;
+			std::cout << c_str() << std::endl;
 		}
 		void string_reverse_print() const noexcept
 		{
-			for (string::const_reverse_iterator start_position = crbegin(); start_position != crend(); start_position--)
+			for (basic_string::const_reverse_iterator start_position = crbegin(); start_position != crend(); start_position--)
 			{
 				std::cout << *start_position;
 			}
 			std::cout << std::endl;
 		}
-		friend std::ostream &operator<<(std::ostream &string_ostream, const string &str_data);
-		friend std::istream &operator>>(std::istream &string_istream, string &str_data);
-		string &operator=(const string &str_data)
+		basic_string &operator=(const basic_string &str_data)
 		{
 			try
 			{
 				if (this != &str_data) // 防止无意义拷贝
 				{
-					delete[] _data;
-					uint64_t capacity = str_data._capacity;
-					_data = new char[capacity + 1];
-					std::strncpy(_data, str_data._data, str_data.size());
-					_capacity = str_data._capacity;
-					_size = str_data._size;
-					_data[_size] = '\0';
+					assign_raw(str_data.data_pointer(), str_data.size());
 				}
 			}
 			catch (const std::bad_alloc &process)
@@ -639,17 +943,11 @@ namespace string_container
 			}
 			return *this;
 		}
-		string &operator=(const char *str_data)
+		basic_string &operator=(const char *str_data)
 		{
 			try
 			{
-				delete[] _data;
-				uint64_t capacity = strlen(str_data);
-				_data = new char[capacity + 1];
-				std::strncpy(_data, str_data, strlen(str_data));
-				_capacity = capacity;
-				_size = capacity;
-				_data[_size] = '\0';
+				assign_raw(str_data, str_data == nullptr ? 0 : strlen(str_data));
 			}
 			catch (const std::bad_alloc &process)
 			{
@@ -658,73 +956,74 @@ namespace string_container
 			}
 			return *this;
 		}
-		string &operator=(string &&str_data) noexcept
+		basic_string &operator=(const std::string_view str_view)
 		{
-			if (this != &str_data)
+			try
 			{
-				delete[] _data;
-				_size = str_data._size;
-				_capacity = str_data._capacity;
-				_data = str_data._data;
-				str_data._data = nullptr;
+				assign_raw(str_view.data(), str_view.size());
+			}
+			catch (const std::bad_alloc &process)
+			{
+				std::cerr << process.what() << std::endl;
+				throw;
 			}
 			return *this;
 		}
-		string &operator+=(const string &str_data)
-		{
-			uint64_t len = _size + str_data._size;
-			allocate_resources(len);
-			std::strncpy(_data + _size, str_data._data, str_data.size());
-			_size = _size + str_data._size;
-			_data[_size] = '\0';
-			return *this;
-		}
-		bool operator==(const string &str_data) const noexcept
+		basic_string &operator=(basic_string &&str_data) noexcept(allocator_traits::propagate_on_container_move_assignment::value ||
+																																allocator_traits::is_always_equal::value)
 		{
-			if (_size != str_data._size)
+			if constexpr (!allocator_traits::propagate_on_container_move_assignment::value && !allocator_traits::is_always_equal::value)
 			{
-				return false;
-			}
-			for (uint64_t compare_traversal = 0; compare_traversal < _size; compare_traversal++)
-			{
-				if (_data[compare_traversal] != str_data._data[compare_traversal])
+				if (!(_allocator == str_data._allocator))
 				{
-					return false;
+					// 分配器不同不能接管对方的缓冲区，退化为拷贝
+					assign_raw(str_data.data_pointer(), str_data.size());
+					return *this;
 				}
 			}
-			return true;
-		}
-		bool operator<(const string &str_data) const noexcept
-		{
-			uint64_t min_len = _size < str_data._size ? _size : str_data._size;
-			for (uint64_t compare_traversal = 0; compare_traversal < min_len; compare_traversal++)
+			if (this != &str_data)
 			{
-				if (_data[compare_traversal] != str_data._data[compare_traversal])
+				release_heap();
+				if constexpr (allocator_traits::propagate_on_container_move_assignment::value)
 				{
-					return _data[compare_traversal] < str_data._data[compare_traversal];
+					_allocator = std::move(str_data._allocator);
 				}
+				std::memcpy(_storage, str_data._storage, sizeof(_storage));
+				str_data.reset_inline();
 			}
-			return _size < str_data._size;
+			return *this;
 		}
-		bool operator>(const string &str_data) const noexcept
+		basic_string &operator+=(const basic_string &str_data)
 		{
-			uint64_t min_len = _size < str_data._size ? _size : str_data._size;
-			for (uint64_t compare_traversal = 0; compare_traversal < min_len; compare_traversal++)
-			{
-				if (_data[compare_traversal] != str_data._data[compare_traversal])
-				{
-					return _data[compare_traversal] > str_data._data[compare_traversal];
-				}
-			}
-			return _size > str_data._size;
+			return append_raw(str_data.data_pointer(), str_data.size());
+		}
+		basic_string &operator+=(const char *str_data)
+		{
+			return push_back(str_data);
+		}
+		basic_string &operator+=(const std::string_view str_view)
+		{
+			return append_raw(str_view.data(), str_view.size());
+		}
+		bool operator==(const basic_string &str_data) const noexcept
+		{
+			return size() == str_data.size() && find_mismatch(data_pointer(), str_data.data_pointer(), size()) == size();
+		}
+		bool operator<(const basic_string &str_data) const noexcept
+		{
+			return compare(str_data) < 0;
+		}
+		bool operator>(const basic_string &str_data) const noexcept
+		{
+			return compare(str_data) > 0;
 		}
 		char &operator[](const uint64_t &access_location)
 		{
 			try
 			{
-				if (access_location <= _size)
+				if (access_location <= size())
 				{
-					return _data[access_location]; // 返回第ergodic_value个元素的引用
+					return data_pointer()[access_location]; // 返回第ergodic_value个元素的引用
 				}
 				else
 				{
@@ -742,9 +1041,9 @@ namespace string_container
 		{
 			try
 			{
-				if (access_location <= _size)
+				if (access_location <= size())
 				{
-					return _data[access_location]; // 返回第ergodic_value个元素的引用
+					return data_pointer()[access_location]; // 返回第ergodic_value个元素的引用
 				}
 				else
 				{
@@ -757,44 +1056,42 @@ namespace string_container
 				throw;
 			}
 		}
-		[[nodiscard]] string operator+(const string &string_array) const
+		[[nodiscard]] basic_string operator+(const basic_string &string_array) const
 		{
-			string return_string_object;
-			const uint64_t object_len = _size + string_array._size;
-			return_string_object.allocate_resources(object_len);
-			std::strncpy(return_string_object._data, _data, size());
-			std::strncpy(return_string_object._data + _size, string_array._data, string_array.size());
-			return_string_object._size = _size + string_array._size;
-			return_string_object._data[return_string_object._size] = '\0';
+			basic_string return_string_object(_allocator);
+			return_string_object.allocate_resources(size() + string_array.size());
+			return_string_object.append_raw(data_pointer(), size());
+			return_string_object.append_raw(string_array.data_pointer(), string_array.size());
 			return return_string_object; // 不能转为右值，编译器会再做一次优化
 		}
 	};
-	std::istream &operator>>(std::istream &string_istream, string &str_data)
+	using string = basic_string<>;
+	static_assert(sizeof(string) == 24, "string 的 SSO 布局要求对象大小为 24 字节");
+	template <typename string_allocator>
+	std::istream &operator>>(std::istream &string_istream, basic_string<string_allocator> &str_data)
 	{
 		while (true)
 		{
-			char single_char = static_cast<char>(string_istream.get()); // gat函数只读取一个字符
+			const int single_char = string_istream.get(); // gat函数只读取一个字符
 			if (single_char == '\n' || single_char == EOF)
 			{
 				break;
 			}
 			else
 			{
-				str_data.push_back(single_char);
+				str_data.push_back(static_cast<char>(single_char));
 			}
 		}
 		return string_istream;
 	}
-	inline std::ostream &operator<<(std::ostream &string_ostream, const string &str_data)
+	template <typename string_allocator>
+	std::ostream &operator<<(std::ostream &string_ostream, const basic_string<string_allocator> &str_data)
 	{
-		for (const char start_position : str_data)
-		{
-			string_ostream << start_position;
-		}
-		return string_ostream;
+		return string_ostream.write(str_data.c_str(), static_cast<std::streamsize>(str_data.size()));
 	}
 }
 namespace standard_con
 {
+	using string_container::basic_string;
 	using string_container::string;
-}
\ No newline at end of file
+}
@@ -0,0 +1,726 @@
+#pragma once
+#include <new>
+#include <bit>
+#include <cassert>
+#include <memory>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <utility>
+#include <type_traits>
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define SWISS_TABLE_SSE2 1
+#endif
+#include "simulate_exception.hpp"
+#include "simulate_hash.hpp"
+namespace swiss_container
+{
+  /*
+   * @brief  #### `control_group` 类
+
+  *   - 一次读取 16 个控制字节，返回匹配位置的位掩码（第 i 位对应组内第 i 个槽位）
+
+  *   - 支持 `SSE2` 时使用 `_mm_cmpeq_epi8` + `_mm_movemask_epi8` 并行比较，否则逐字节比较
+
+   * 控制字节取值:
+
+   * * - `empty`(-128): 空槽位，探测到此即可停止
+
+   * * - `deleted`(-2): 墓碑，查找需越过，插入可复用
+
+   * * - `0 ~ 127`: 占用槽位，保存哈希值低 7 位（H2）
+  */
+  class control_group
+  {
+  public:
+    static constexpr uint64_t width = 16;
+    static constexpr int8_t empty = -128;
+    static constexpr int8_t deleted = -2;
+
+  private:
+#ifdef SWISS_TABLE_SSE2
+    __m128i _control;
+
+  public:
+    explicit control_group(const int8_t *position) noexcept
+        : _control(_mm_loadu_si128(reinterpret_cast<const __m128i *>(position))) {}
+    [[nodiscard]] uint32_t match(int8_t fingerprint) const noexcept
+    {
+      return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(fingerprint), _control)));
+    }
+    [[nodiscard]] uint32_t match_empty() const noexcept
+    {
+      return match(empty);
+    }
+    [[nodiscard]] uint32_t match_empty_or_deleted() const noexcept
+    {
+      return static_cast<uint32_t>(_mm_movemask_epi8(_control)); // 空与墓碑的最高位均为 1
+    }
+#else
+    int8_t _control[width];
+
+  public:
+    explicit control_group(const int8_t *position) noexcept
+    {
+      std::memcpy(_control, position, width);
+    }
+    [[nodiscard]] uint32_t match(int8_t fingerprint) const noexcept
+    {
+      uint32_t mask = 0;
+      for (uint64_t index = 0; index < width; ++index)
+      {
+        mask |= static_cast<uint32_t>(_control[index] == fingerprint) << index;
+      }
+      return mask;
+    }
+    [[nodiscard]] uint32_t match_empty() const noexcept
+    {
+      return match(empty);
+    }
+    [[nodiscard]] uint32_t match_empty_or_deleted() const noexcept
+    {
+      uint32_t mask = 0;
+      for (uint64_t index = 0; index < width; ++index)
+      {
+        mask |= static_cast<uint32_t>(_control[index] < 0) << index;
+      }
+      return mask;
+    }
+#endif
+    static uint32_t lowest_bit(uint32_t mask) noexcept
+    {
+      return static_cast<uint32_t>(std::countr_zero(mask));
+    }
+    static uint32_t highest_bit(uint32_t mask) noexcept
+    {
+      return 31u - static_cast<uint32_t>(std::countl_zero(mask));
+    }
+  };
+  /*
+      * @brief  #### `swiss_table` 类模板
+
+      *   - 开放寻址哈希表（Swiss Table 结构），元素直接存放在连续槽位数组中，无逐元素节点分配
+
+      *   - 每个槽位对应一个控制字节，查找时以 16 字节为一组并行比较哈希指纹，绝大多数查找只需一次组比较
+
+      *   - 容量恒为 2 的幂，以位与代替取模；用户哈希值经过 64 位混合后再拆分为 H1（探测起点）与 H2（指纹）
+
+      *   - 可选按插入顺序遍历模式，通过按槽位下标维护的双向链表实现
+
+      * 模板参数:
+
+      * * - `swiss_table_type_key`: 键的类型，用于哈希计算与相等比较
+      *
+      * * - `swiss_table_type_value`: 槽位存储的元素类型（通常为键值对）
+      *
+      * * - `container_imitate_function`: 仿函数类型，用于从元素中提取键
+      *
+      * * - `hash_function`: 作用于键的哈希函数类型，默认为 `standard_con::hash_imitation_functions`
+      *
+      * * - `insertion_ordered`: 为 `true` 时迭代器按插入顺序遍历，否则按槽位顺序遍历（默认）
+      *
+      * * - `swiss_allocator`: 分配器类型，默认为 `std::allocator<swiss_table_type_value>`，控制字节与槽位数组、插入顺序链表均经由它申请；交换与移动时随内存一起转移
+
+      * 主要操作方法:
+
+      * * - `push()`: 插入元素（拷贝/移动），键已存在返回 `false`
+      *
+      * * - `pop(const swiss_table_type_value&)`: 删除键相同的元素，槽位视情况标记为空或墓碑
+      *
+      * * - `find(const swiss_table_type_value&)`: 按元素中的键查找，返回迭代器或 `end()`
+      *
+      * * - `operator[](const swiss_table_type_key&)`: 直接按键查找
+      *
+      * * - `reserve(uint64_t)`: 预留至少能容纳指定元素数量的容量
+      *
+      * * - `clear()`: 析构全部元素，保留容量
+
+      * 特性:
+
+      * * - 最大负载率 7/8，墓碑过多时原容量重建，否则容量翻倍
+      *
+      * * - 控制字节数组尾部镜像前 16 个字节，任意位置起读取一组均无需回绕判断
+      *
+      * * - 探测以组为单位按三角数步进，保证遍历全部分组
+
+      * 注意事项:
+
+      * * - 扩容与重建会移动元素，所有迭代器、指针与引用失效
+      *
+      * * - 自定义哈希函数无需保证低位分布均匀，内部会再做混合，但相等的键必须产生相同哈希值
+      *
+      * * - 线程安全性：不保证，多线程访问需外部同步
+
+      * 详细请参考 https://github.com/Hatedatastructures/Custom-libraries/blob/main/template_container.md
+  */
+  template <typename swiss_table_type_key, typename swiss_table_type_value, typename container_imitate_function,
+            typename hash_function = standard_con::hash_imitation_functions, bool insertion_ordered = false,
+            typename swiss_allocator = std::allocator<swiss_table_type_value>>
+  class swiss_table
+  {
+    struct order_link
+    {
+      uint64_t _prev;
+      uint64_t _next;
+    };
+    using value_type = swiss_table_type_value;
+    static constexpr std::size_t storage_alignment_bytes = alignof(value_type) > alignof(std::max_align_t) ? alignof(value_type) : alignof(std::max_align_t);
+    // 控制字节与槽位数组放在同一块内存中，按该单元申请以保证槽位的对齐
+    struct alignas(storage_alignment_bytes) storage_unit
+    {
+      unsigned char _bytes[storage_alignment_bytes];
+    };
+    using storage_allocator = typename std::allocator_traits<swiss_allocator>::template rebind_alloc<storage_unit>;
+    using storage_traits = std::allocator_traits<storage_allocator>;
+    using link_allocator = typename std::allocator_traits<swiss_allocator>::template rebind_alloc<order_link>;
+    using link_traits = std::allocator_traits<link_allocator>;
+
+    mutable container_imitate_function value_imitation_functions; // 从元素中提取键
+
+    mutable hash_function hash_function_object; // 键的哈希函数
+
+    int8_t *_control = nullptr; // 控制字节，长度为容量 + 组宽
+
+    value_type *_slots = nullptr; // 槽位数组
+
+    order_link *_links = nullptr; // 插入顺序链表，仅在 insertion_ordered 模式下分配
+
+    uint64_t _capacity = 0; // 槽位数量（0 或 2 的幂）
+
+    uint64_t _size = 0; // 元素数量
+
+    uint64_t _growth_left = 0; // 触发扩容前还可占用的空槽数
+
+    uint64_t _order_head = 0; // 插入顺序链表头（空表时等于容量）
+
+    uint64_t _order_tail = 0; // 插入顺序链表尾
+
+    [[no_unique_address]] storage_allocator _allocator; // 无状态时不占空间
+
+    static constexpr uint64_t minimum_capacity = control_group::width;
+
+    static uint64_t mix(uint64_t hash_value) noexcept
+    {
+      // murmur3 fmix64：让恒等哈希（整数键）的高低位都充分扩散
+      hash_value ^= hash_value >> 33;
+      hash_value *= 0xff51afd7ed558ccdULL;
+      hash_value ^= hash_value >> 33;
+      hash_value *= 0xc4ceb9fe1a85ec53ULL;
+      hash_value ^= hash_value >> 33;
+      return hash_value;
+    }
+    uint64_t hash_key(const swiss_table_type_key &key_value) const
+    {
+      return mix(static_cast<uint64_t>(hash_function_object(key_value)));
+    }
+    static uint64_t probe_start(uint64_t hash_value) noexcept { return hash_value >> 7; }
+
+    static int8_t fingerprint(uint64_t hash_value) noexcept { return static_cast<int8_t>(hash_value & 0x7F); }
+
+    static uint64_t max_load(uint64_t capacity_value) noexcept { return capacity_value - capacity_value / 8; }
+
+    static bool is_full(int8_t control_byte) noexcept { return control_byte >= 0; }
+
+    void set_control(uint64_t index, int8_t control_byte) noexcept
+    {
+      _control[index] = control_byte;
+      if (index < control_group::width)
+      {
+        _control[_capacity + index] = control_byte; // 镜像字节
+      }
+    }
+    // 找到第一个可写入（空或墓碑）的槽位，调用方保证表中存在这样的槽位
+    uint64_t find_insert_slot(uint64_t hash_value) const noexcept
+    {
+      const uint64_t mask = _capacity - 1;
+      uint64_t position = probe_start(hash_value) & mask;
+      uint64_t step = 0;
+      while (true)
+      {
+        const uint32_t available = control_group(_control + position).match_empty_or_deleted();
+        if (available != 0)
+        {
+          return (position + control_group::lowest_bit(available)) & mask;
+        }
+        step += control_group::width;
+        position = (position + step) & mask;
+      }
+    }
+    uint64_t find_index(const swiss_table_type_key &key_value, uint64_t hash_value) const
+    {
+      if (_capacity == 0)
+      {
+        return _capacity;
+      }
+      const uint64_t mask = _capacity - 1;
+      const int8_t target = fingerprint(hash_value);
+      uint64_t position = probe_start(hash_value) & mask;
+      uint64_t step = 0;
+      while (true)
+      {
+        const control_group group(_control + position);
+        for (uint32_t candidates = group.match(target); candidates != 0; candidates &= candidates - 1)
+        {
+          const uint64_t index = (position + control_group::lowest_bit(candidates)) & mask;
+          if (value_imitation_functions(_slots[index]) == key_value)
+          {
+            return index;
+          }
+        }
+        if (group.match_empty() != 0)
+        {
+          return _capacity;
+        }
+        step += control_group::width;
+        position = (position + step) & mask;
+        if (step > _capacity)
+        {
+          return _capacity; // 全部分组均已探测（无空槽的满墓碑表）
+        }
+      }
+    }
+    void link_back(uint64_t index) noexcept
+    {
+      if constexpr (insertion_ordered)
+      {
+        _links[index]._next = _capacity;
+        _links[index]._prev = _order_tail;
+        if (_order_head == _capacity)
+        {
+          _order_head = index;
+        }
+        else
+        {
+          _links[_order_tail]._next = index;
+        }
+        _order_tail = index;
+      }
+    }
+    void unlink(uint64_t index) noexcept
+    {
+      if constexpr (insertion_ordered)
+      {
+        const order_link link = _links[index];
+        if (link._prev == _capacity)
+        {
+          _order_head = link._next;
+        }
+        else
+        {
+          _links[link._prev]._next = link._next;
+        }
+        if (link._next == _capacity)
+        {
+          _order_tail = link._prev;
+        }
+        else
+        {
+          _links[link._next]._prev = link._prev;
+        }
+      }
+    }
+    static uint64_t slot_offset(uint64_t capacity_value) noexcept
+    {
+      const uint64_t control_bytes = capacity_value + control_group::width;
+      return (control_bytes + alignof(value_type) - 1) / alignof(value_type) * alignof(value_type);
+    }
+    static uint64_t storage_units(uint64_t capacity_value) noexcept
+    {
+      return (slot_offset(capacity_value) + capacity_value * sizeof(value_type) + sizeof(storage_unit) - 1) / sizeof(storage_unit);
+    }
+    void allocate(uint64_t capacity_value)
+    {
+      const uint64_t offset = slot_offset(capacity_value);
+      auto *memory = reinterpret_cast<unsigned char *>(std::to_address(storage_traits::allocate(_allocator, storage_units(capacity_value))));
+      if constexpr (insertion_ordered)
+      {
+        try
+        {
+          link_allocator links_allocator(_allocator);
+          _links = std::to_address(link_traits::allocate(links_allocator, capacity_value));
+        }
+        catch (...)
+        {
+          storage_traits::deallocate(_allocator, reinterpret_cast<storage_unit *>(memory), storage_units(capacity_value));
+          throw;
+        }
+      }
+      _control = reinterpret_cast<int8_t *>(memory);
+      _slots = reinterpret_cast<value_type *>(memory + offset);
+      _capacity = capacity_value;
+      std::memset(_control, static_cast<unsigned char>(control_group::empty), capacity_value + control_group::width);
+      _growth_left = max_load(capacity_value);
+      _order_head = _order_tail = capacity_value;
+    }
+    void deallocate() noexcept
+    {
+      if (_control != nullptr)
+      {
+        storage_traits::deallocate(_allocator, reinterpret_cast<storage_unit *>(_control), storage_units(_capacity));
+        if constexpr (insertion_ordered)
+        {
+          link_allocator links_allocator(_allocator);
+          link_traits::deallocate(links_allocator, _links, _capacity);
+        }
+      }
+      _control = nullptr;
+      _slots = nullptr;
+      _links = nullptr;
+      _capacity = 0;
+      _growth_left = 0;
+      _order_head = _order_tail = 0;
+    }
+    void destroy_elements() noexcept
+    {
+      if constexpr (!std::is_trivially_destructible_v<value_type>)
+      {
+        for (uint64_t index = 0; index < _capacity; ++index)
+        {
+          if (is_full(_control[index]))
+          {
+            std::destroy_at(_slots + index);
+          }
+        }
+      }
+    }
+    uint64_t next_full(uint64_t index) const noexcept
+    {
+      while (index < _capacity && !is_full(_control[index]))
+      {
+        ++index;
+      }
+      return index;
+    }
+    uint64_t first_index() const noexcept
+    {
+      if constexpr (insertion_ordered)
+      {
+        return _capacity == 0 ? 0 : _order_head;
+      }
+      else
+      {
+        return next_full(0);
+      }
+    }
+    uint64_t following_index(uint64_t index) const noexcept
+    {
+      if constexpr (insertion_ordered)
+      {
+        return _links[index]._next;
+      }
+      else
+      {
+        return next_full(index + 1);
+      }
+    }
+    // 交换除分配器以外的全部状态
+    void swap_storage(swiss_table &swiss_table_data) noexcept
+    {
+      std::swap(value_imitation_functions, swiss_table_data.value_imitation_functions);
+      std::swap(hash_function_object, swiss_table_data.hash_function_object);
+      std::swap(_control, swiss_table_data._control);
+      std::swap(_slots, swiss_table_data._slots);
+      std::swap(_links, swiss_table_data._links);
+      std::swap(_capacity, swiss_table_data._capacity);
+      std::swap(_size, swiss_table_data._size);
+      std::swap(_growth_left, swiss_table_data._growth_left);
+      std::swap(_order_head, swiss_table_data._order_head);
+      std::swap(_order_tail, swiss_table_data._order_tail);
+    }
+    // 以新容量重建：按迭代顺序把元素移动到新槽位，同时清除全部墓碑
+    void rehash(uint64_t new_capacity)
+    {
+      swiss_table rebuilt(get_allocator());
+      rebuilt.allocate(new_capacity);
+      for (uint64_t index = first_index(); index < _capacity; index = following_index(index))
+      {
+        value_type &element = _slots[index];
+        const uint64_t hash_value = hash_key(value_imitation_functions(element));
+        const uint64_t target = rebuilt.find_insert_slot(hash_value);
+        ::new (static_cast<void *>(rebuilt._slots + target)) value_type(std::move_if_noexcept(element));
+        rebuilt.set_control(target, fingerprint(hash_value));
+        rebuilt.link_back(target);
+        --rebuilt._growth_left;
+        ++rebuilt._size;
+      }
+      swap(rebuilt);
+    }
+    void prepare_insert()
+    {
+      if (_capacity == 0)
+      {
+        allocate(minimum_capacity);
+      }
+      else if (_growth_left == 0)
+      {
+        // 墓碑占了超过一半的可用额度时原地清理，否则翻倍
+        rehash(_size * 2 <= max_load(_capacity) ? _capacity : _capacity * 2);
+      }
+    }
+    template <typename insert_type>
+    bool insert_value(insert_type &&swiss_table_value_data)
+    {
+      const swiss_table_type_key &key_value = value_imitation_functions(swiss_table_value_data);
+      uint64_t hash_value = hash_key(key_value);
+      if (find_index(key_value, hash_value) != _capacity)
+      {
+        return false;
+      }
+      prepare_insert();
+      const uint64_t index = find_insert_slot(hash_value);
+      ::new (static_cast<void *>(_slots + index)) value_type(std::forward<insert_type>(swiss_table_value_data));
+      if (_control[index] == control_group::empty)
+      {
+        --_growth_left; // 复用墓碑不消耗增长额度
+      }
+      set_control(index, fingerprint(hash_value));
+      link_back(index);
+      ++_size;
+      return true;
+    }
+    void erase_index(uint64_t index) noexcept
+    {
+      unlink(index);
+      std::destroy_at(_slots + index);
+      --_size;
+      // 若该槽位前后连续空槽覆盖不了一整组，说明曾有探测序列越过它，只能留下墓碑
+      const uint64_t mask = _capacity - 1;
+      const uint64_t index_before = (index - control_group::width) & mask;
+      const uint32_t empty_after = control_group(_control + index).match_empty();
+      const uint32_t empty_before = control_group(_control + index_before).match_empty();
+      const bool was_never_full = empty_after != 0 && empty_before != 0 &&
+                                  control_group::lowest_bit(empty_after) + (control_group::width - 1 - control_group::highest_bit(empty_before)) < control_group::width;
+      if (was_never_full)
+      {
+        set_control(index, control_group::empty);
+        ++_growth_left;
+      }
+      else
+      {
+        set_control(index, control_group::deleted);
+      }
+    }
+
+    template <typename iterator_type_val>
+    class swiss_iterator
+    {
+      using table_pointer = std::conditional_t<std::is_const_v<iterator_type_val>, const swiss_table *, swiss_table *>;
+      using Ref = iterator_type_val &;
+      using Ptr = iterator_type_val *;
+      using self = swiss_iterator<iterator_type_val>;
+      table_pointer _table;
+      uint64_t _index;
+
+    public:
+      swiss_iterator(table_pointer table_data, uint64_t index_data) : _table(table_data), _index(index_data) {}
+
+      Ref operator*() const { return _table->_slots[_index]; }
+
+      Ptr operator->() const { return _table->_slots + _index; }
+
+      bool operator!=(const self &iterator_data) const { return _index != iterator_data._index || _table != iterator_data._table; }
+
+      bool operator==(const self &iterator_data) const { return _index == iterator_data._index && _table == iterator_data._table; }
+
+      self operator++(int)
+      {
+        self iterator_data = *this;
+        _index = _table->following_index(_index);
+        return iterator_data;
+      }
+      self &operator++()
+      {
+        _index = _table->following_index(_index);
+        return *this;
+      }
+    };
+
+  public:
+    using iterator = swiss_iterator<value_type>;
+    using const_iterator = swiss_iterator<const value_type>;
+    using allocator_type = swiss_allocator;
+    swiss_table() = default;
+
+    explicit swiss_table(const swiss_allocator &allocator_data)
+        : _allocator(allocator_data) {}
+    explicit swiss_table(const uint64_t new_swiss_table_capacity, const swiss_allocator &allocator_data = swiss_allocator())
+        : _allocator(allocator_data)
+    {
+      reserve(new_swiss_table_capacity);
+    }
+    [[nodiscard]] allocator_type get_allocator() const noexcept
+    {
+      return allocator_type(_allocator);
+    }
+    swiss_table(const swiss_table &swiss_table_data)
+        : swiss_table(swiss_table_data, std::allocator_traits<swiss_allocator>::select_on_container_copy_construction(swiss_table_data.get_allocator())) {}
+    swiss_table(const swiss_table &swiss_table_data, const swiss_allocator &allocator_data)
+        : value_imitation_functions(swiss_table_data.value_imitation_functions),
+          hash_function_object(swiss_table_data.hash_function_object), _allocator(allocator_data)
+    {
+      if (swiss_table_data._size == 0)
+      {
+        return;
+      }
+      allocate(swiss_table_data._capacity);
+      try
+      {
+        // 容量与哈希函数一致，逐槽复制即可保持布局（含插入顺序链表）
+        for (uint64_t index = 0; index < _capacity; ++index)
+        {
+          if (is_full(swiss_table_data._control[index]))
+          {
+            ::new (static_cast<void *>(_slots + index)) value_type(swiss_table_data._slots[index]);
+            _control[index] = swiss_table_data._control[index];
+            ++_size;
+          }
+        }
+      }
+      catch (...)
+      {
+        destroy_elements();
+        deallocate();
+        throw;
+      }
+      std::memcpy(_control, swiss_table_data._control, _capacity + control_group::width);
+      if constexpr (insertion_ordered)
+      {
+        std::memcpy(_links, swiss_table_data._links, _capacity * sizeof(order_link));
+        _order_head = swiss_table_data._order_head;
+        _order_tail = swiss_table_data._order_tail;
+      }
+      _growth_left = swiss_table_data._growth_left;
+    }
+    swiss_table(swiss_table &&swiss_table_data) noexcept
+        : _allocator(swiss_table_data._allocator)
+    {
+      swap_storage(swiss_table_data);
+    }
+    swiss_table &operator=(const swiss_table &swiss_table_data)
+    {
+      if (this != &swiss_table_data)
+      {
+        swiss_table copy(swiss_table_data, get_allocator()); // 副本沿用本表的分配器
+        swap(copy);
+      }
+      return *this;
+    }
+    swiss_table &operator=(swiss_table &&swiss_table_data) noexcept
+    {
+      if (this != &swiss_table_data)
+      {
+        // 接管对方存储时一并接管分配器，旧存储随 moved 析构由原分配器归还
+        swiss_table moved(std::move(swiss_table_data));
+        swap_storage(moved);
+        std::swap(_allocator, moved._allocator);
+      }
+      return *this;
+    }
+    ~swiss_table() noexcept
+    {
+      destroy_elements();
+      deallocate();
+    }
+    // 前置条件：分配器会随交换传播（propagate_on_container_swap），或两者相等；否则双方的存储将由错误的分配器释放
+    void swap(swiss_table &swiss_table_data) noexcept
+    {
+      swap_storage(swiss_table_data);
+      if constexpr (storage_traits::propagate_on_container_swap::value)
+      {
+        std::swap(_allocator, swiss_table_data._allocator);
+      }
+      else
+      {
+        assert(_allocator == swiss_table_data._allocator);
+      }
+    }
+    void reserve(uint64_t element_count)
+    {
+      uint64_t new_capacity = minimum_capacity;
+      while (max_load(new_capacity) < element_count)
+      {
+        new_capacity *= 2;
+      }
+      if (new_capacity <= _capacity)
+      {
+        return;
+      }
+      if (_capacity == 0)
+      {
+        allocate(new_capacity);
+      }
+      else
+      {
+        rehash(new_capacity);
+      }
+    }
+    void clear() noexcept
+    {
+      if (_capacity == 0)
+      {
+        return;
+      }
+      destroy_elements();
+      std::memset(_control, static_cast<unsigned char>(control_group::empty), _capacity + control_group::width);
+      _size = 0;
+      _growth_left = max_load(_capacity);
+      _order_head = _order_tail = _capacity;
+    }
+    iterator operator[](const swiss_table_type_key &key_value)
+    {
+      return iterator(this, find_index(key_value, hash_key(key_value)));
+    }
+    iterator begin() { return iterator(this, first_index()); }
+
+    const_iterator cbegin() const { return const_iterator(this, first_index()); }
+
+    iterator end() { return iterator(this, _capacity); }
+
+    const_iterator cend() const { return const_iterator(this, _capacity); }
+
+    [[nodiscard]] uint64_t size() const
+    {
+      return _size;
+    }
+
+    [[nodiscard]] bool empty() const
+    {
+      return _size == 0;
+    }
+
+    [[nodiscard]] uint64_t capacity() const
+    {
+      return _capacity;
+    }
+
+    bool push(const swiss_table_type_value &swiss_table_value_data)
+    {
+      return insert_value(swiss_table_value_data);
+    }
+    bool push(swiss_table_type_value &&swiss_table_value_data)
+    {
+      return insert_value(std::move(swiss_table_value_data));
+    }
+    bool pop(const swiss_table_type_value &swiss_table_value_data)
+    {
+      const swiss_table_type_key &key_value = value_imitation_functions(swiss_table_value_data);
+      const uint64_t index = find_index(key_value, hash_key(key_value));
+      if (index == _capacity)
+      {
+        return false;
+      }
+      erase_index(index);
+      return true;
+    }
+    iterator find(const swiss_table_type_value &swiss_table_value_data)
+    {
+      const swiss_table_type_key &key_value = value_imitation_functions(swiss_table_value_data);
+      return iterator(this, find_index(key_value, hash_key(key_value)));
+    }
+  };
+}
+namespace standard_con
+{
+  using swiss_container::swiss_table;
+}
@@ -3,6 +3,7 @@
 #include "simulate_algorithm.hpp"
 #include "simulate_utility.hpp"
 #include "simulate_exception.hpp"
+#include "simulate_pool.hpp"
 namespace tree_container
 {
   /*
@@ -21,6 +22,8 @@ namespace tree_container
       * * - `container_imitate_function`: 比较器类型，默认为 `standard_con::imitation_functions::less<binary_search_tree_type>`
       *   - 用于定义元素间的大小关系，返回 `true`
       *   - 可自定义比较规则，改变树的排序逻辑（如改为大于则为右子树）
+      *
+      * * - `binary_tree_allocator`: 分配器类型，默认为 `std::allocator<binary_search_tree_type>`，重绑定到节点类型后为节点池提供块内存
 
 
       * 构造函数:
@@ -74,6 +77,8 @@ namespace tree_container
       *
       * * - 可定制性: 通过自定义比较器改变排序规则（如传入 `greater` 实现右小左大）
       *
+      * * - 节点池分配: 节点来自本树独占的 `node_pool`，按块连续分配，删除的节点优先复用，清空时整块归还
+      *
       * * - 异常安全: 关键操作（如拷贝构造、插入）包含异常处理，未找到元素时抛出 `fault`
 
       * 注意事项:
@@ -90,7 +95,8 @@ namespace tree_container
 
       * 详细请参考 https://github.com/Hatedatastructures/Custom-libraries/blob/main/template_container.md
   */
-  template <typename binary_search_tree_type, typename container_imitate_function = standard_con::less<binary_search_tree_type>>
+  template <typename binary_search_tree_type, typename container_imitate_function = standard_con::less<binary_search_tree_type>,
+            typename binary_tree_allocator = std::allocator<binary_search_tree_type>>
   class binary_tree
   {
   private:
@@ -113,8 +119,10 @@ namespace tree_container
       }
     };
     using container_node = binary_search_tree_type_node;
+    using pool_type = standard_con::node_pool<container_node, typename std::allocator_traits<binary_tree_allocator>::template rebind_alloc<container_node>>;
     container_node *_root;                      // 根节点
     container_imitate_function function_policy; // 仿函数对象
+    pool_type _pool;                            // 本树独占的节点池
     void interior_middle_order_traversal(container_node *root_subtree_node)
     {
       // 内调中序遍历函数
@@ -204,15 +212,22 @@ namespace tree_container
         {
           resource_release_stack.push(pending_deletion_node->_right);
         }
-        delete pending_deletion_node;
+        std::destroy_at(pending_deletion_node);
       }
       _root = nullptr;
+      _pool.release(); // 节点内存整块归还
     }
 
   public:
+    using allocator_type = binary_tree_allocator;
     ~binary_tree() noexcept { clear(); }
+    [[nodiscard]] allocator_type get_allocator() const noexcept
+    {
+      return allocator_type(_pool.get_allocator());
+    }
     // 构造函数，使用初始化列表来初始化二叉搜索树
-    binary_tree(std::initializer_list<binary_search_tree_type> lightweight_container)
+    binary_tree(std::initializer_list<binary_search_tree_type> lightweight_container, const binary_tree_allocator &allocator_data = binary_tree_allocator())
+        : _pool(typename pool_type::allocator_type(allocator_data))
     {
       _root = nullptr;
       for (auto &chained_values : lightweight_container)
@@ -220,19 +235,22 @@ namespace tree_container
         push(chained_values);
       }
     }
-    explicit binary_tree(const binary_search_tree_type &bstt_node = binary_search_tree_type())
-        : _root(nullptr)
+    explicit binary_tree(const binary_search_tree_type &bstt_node = binary_search_tree_type(), const binary_tree_allocator &allocator_data = binary_tree_allocator())
+        : _root(nullptr), _pool(typename pool_type::allocator_type(allocator_data))
     {
-      _root = new container_node(bstt_node);
+      _root = _pool.create(bstt_node);
     }
     binary_tree(binary_tree &&binary_search_tree_object) noexcept
-        : _root(nullptr), function_policy(binary_search_tree_object.function_policy)
+        : _root(nullptr), function_policy(binary_search_tree_object.function_policy), _pool(std::move(binary_search_tree_object._pool))
     {
       _root = std::move(binary_search_tree_object._root);
       binary_search_tree_object._root = nullptr;
     }
     binary_tree(const binary_tree &binary_search_tree_object)
-        : _root(nullptr), function_policy(binary_search_tree_object.function_policy)
+        : binary_tree(binary_search_tree_object,
+                      std::allocator_traits<binary_tree_allocator>::select_on_container_copy_construction(binary_search_tree_object.get_allocator())) {}
+    binary_tree(const binary_tree &binary_search_tree_object, const binary_tree_allocator &allocator_data)
+        : _root(nullptr), function_policy(binary_search_tree_object.function_policy), _pool(typename pool_type::allocator_type(allocator_data))
     // 这个拷贝构造不需要传模板参数，因为模板参数是在编译时确定的，而不是在运行时确定的，对于仿函数，直接拿传进来的引用初始化就可以了
     {
       // 拷贝构造，时间复杂度为O(n)
@@ -250,7 +268,7 @@ namespace tree_container
       {
         auto pair_node = interior_stack.top();
         interior_stack.pop();
-        *(pair_node.second) = new container_node(pair_node.first->_data);
+        *(pair_node.second) = _pool.create(pair_node.first->_data);
         // container_node* _staic_temp_pair_second = *(pair_node.second);
         // if(pair_node.first->_left!= nullptr)
         // { //远古版本
@@ -285,7 +303,7 @@ namespace tree_container
     {
       if (_root == nullptr)
       {
-        _root = new container_node(binary_search_tree_type_data);
+        _root = _pool.create(binary_search_tree_type_data);
         return true;
       }
       else
@@ -311,7 +329,7 @@ namespace tree_container
           }
         }
         // 新开节点链接
-        auto *new_element_node = new container_node(binary_search_tree_type_data);
+        auto *new_element_node = _pool.create(binary_search_tree_type_data);
         // 链接节点
         if (function_policy(binary_search_tree_type_data, subtree_node->_data))
         {
@@ -355,7 +373,7 @@ namespace tree_container
                 subtree_node->_right = reference_node->_right;
               }
             }
-            delete reference_node;
+            _pool.destroy(reference_node);
             reference_node = nullptr;
             return *this;
           }
@@ -377,7 +395,7 @@ namespace tree_container
                 subtree_node->_right = reference_node->_left;
               }
             }
-            delete reference_node;
+            _pool.destroy(reference_node);
             reference_node = nullptr;
             return *this;
           }
@@ -405,7 +423,7 @@ namespace tree_container
               // 情况2：说明要删除的数据的右子树的最左节点如果有数据，就把数据连接到右子树的最左节点的父亲节点的左子树指向最左子树的右子树
               subtree_parent_node->_left = right_subtree_least_node->_right;
             }
-            delete right_subtree_least_node;
+            _pool.destroy(right_subtree_least_node);
             right_subtree_least_node = nullptr;
             return *this;
           }
@@ -465,7 +483,7 @@ namespace tree_container
       }
       else
       {
-        auto *new_value_node = new container_node(new_value);
+        auto *new_value_node = _pool.create(new_value);
         new_value_node->_left = existing_value_node->_right;
         existing_value_node->_right = new_value_node;
       }
@@ -477,8 +495,9 @@ namespace tree_container
       {
         clear();
         function_policy = binary_search_tree_object.function_policy;
-        binary_tree reference_node = binary_search_tree_object;
+        binary_tree reference_node(binary_search_tree_object, get_allocator()); // 副本沿用本树的分配器
         standard_con::algorithm::swap(reference_node._root, _root);
+        _pool.swap(reference_node._pool);
       }
       return *this;
     }
@@ -491,6 +510,7 @@ namespace tree_container
         function_policy = binary_search_tree_object.function_policy;
         _root = std::move(binary_search_tree_object._root);
         binary_search_tree_object._root = nullptr;
+        _pool = std::move(binary_search_tree_object._pool);
       }
       return *this;
     }
@@ -516,6 +536,8 @@ namespace tree_container
       *
       * * - `avl_tree_node_pair`: 键值对类型，默认为 `standard_con::pair<avl_tree_type_k, avl_tree_type_v>`
       *   - 用于存储节点中的键值对数据
+      *
+      * * - `balance_tree_allocator`: 分配器类型，默认为 `std::allocator<avl_tree_node_pair>`，重绑定到节点类型后为节点池提供块内存
 
       * 迭代器相关方法:
 
@@ -584,6 +606,8 @@ namespace tree_container
       *
       * * - 迭代器支持: 提供正向和反向迭代器，支持范围for循环遍历，迭代器在旋转后仍保持有效
       *
+      * * - 节点池分配: 节点来自本树独占的 `node_pool`，按块连续分配，删除的节点优先复用，清空时整块归还
+      *
       * * - 异常安全: 关键操作（如旋转、插入）包含异常处理，空指针传入时抛出 `fault`
 
       * 注意事项:
@@ -601,7 +625,8 @@ namespace tree_container
       * 详细请参考 https://github.com/Hatedatastructures/Custom-libraries/blob/main/template_container.md
   */
   template <typename avl_tree_type_k, typename avl_tree_type_v, typename container_imitate_function = standard_con::less<avl_tree_type_k>,
-            typename avl_tree_node_pair = standard_con::pair<avl_tree_type_k, avl_tree_type_v>>
+            typename avl_tree_node_pair = standard_con::pair<avl_tree_type_k, avl_tree_type_v>,
+            typename balance_tree_allocator = std::allocator<avl_tree_node_pair>>
   class balance_tree
   {
   private:
@@ -743,9 +768,11 @@ namespace tree_container
       }
     };
     using container_node = avl_tree_type_node;
+    using pool_type = standard_con::node_pool<container_node, typename std::allocator_traits<balance_tree_allocator>::template rebind_alloc<container_node>>;
     container_node *_root;
 
     container_imitate_function function_policy;
+    pool_type _pool; // 本树独占的节点池
     void left_revolve(container_node *&subtree_node)
     {
       /*                                                                                                              左单旋情况：简化图
@@ -925,16 +952,17 @@ namespace tree_container
       // 左旋
       right_revolve(subtree_node);
       // 右旋
+      // 平衡因子为右高减左高：中间节点原先左高时旧根变为右高，原先右高时左孩子变为左高
       if (separate_balance_factor == -1)
       {
-        subtree_node->_balance_factor = 0;
-        sub_tree_left_node->_balance_factor = 1;
+        subtree_node->_balance_factor = 1;
+        sub_tree_left_node->_balance_factor = 0;
         sub_left_right_node->_balance_factor = 0;
       }
       else if (separate_balance_factor == 1)
       {
-        subtree_node->_balance_factor = -1;
-        sub_tree_left_node->_balance_factor = 0;
+        subtree_node->_balance_factor = 0;
+        sub_tree_left_node->_balance_factor = -1;
         sub_left_right_node->_balance_factor = 0;
       }
       else
@@ -946,11 +974,16 @@ namespace tree_container
     }
     void clear() noexcept
     {
-      // 清空所有资源
+      // 清空所有资源，节点可平凡析构时无需逐个遍历
       if (_root == nullptr)
       {
         return;
       }
+      else if constexpr (pool_type::trivially_releasable)
+      {
+        _root = nullptr;
+        _pool.release();
+      }
       else
       {
         standard_con::stack<container_node *> interior_stack;
@@ -968,10 +1001,10 @@ namespace tree_container
           {
             interior_stack.push(delete_data_node->_right);
           }
-          delete delete_data_node;
-          delete_data_node = nullptr;
+          std::destroy_at(delete_data_node);
         }
         _root = nullptr;
+        _pool.release(); // 节点内存整块归还
       }
     }
     // 测试函数
@@ -1126,24 +1159,33 @@ namespace tree_container
     {
       return _root == nullptr;
     }
+    using allocator_type = balance_tree_allocator;
+    [[nodiscard]] allocator_type get_allocator() const noexcept
+    {
+      return allocator_type(_pool.get_allocator());
+    }
     balance_tree()
     {
       _root = nullptr;
     }
+    explicit balance_tree(const balance_tree_allocator &allocator_data)
+        : _root(nullptr), _pool(typename pool_type::allocator_type(allocator_data)) {}
     explicit balance_tree(const avl_tree_type_k &key_data, const avl_tree_type_v &val_data = avl_tree_type_v(),
                                         container_imitate_function com_value = container_imitate_function())
         : _root(nullptr), function_policy(com_value)
     {
-      _root = new container_node(key_data, val_data);
+      _root = _pool.create(key_data, val_data);
     }
     explicit balance_tree(const avl_tree_node_pair &pair_type_data,
                                         container_imitate_function com_value = container_imitate_function())
         : _root(nullptr), function_policy(com_value)
     {
-      _root = new container_node(pair_type_data.first, pair_type_data.second);
+      _root = _pool.create(pair_type_data.first, pair_type_data.second);
     }
     balance_tree(const balance_tree &avl_tree_data)
-        : _root(nullptr), function_policy(avl_tree_data.function_policy)
+        : balance_tree(avl_tree_data, std::allocator_traits<balance_tree_allocator>::select_on_container_copy_construction(avl_tree_data.get_allocator())) {}
+    balance_tree(const balance_tree &avl_tree_data, const balance_tree_allocator &allocator_data)
+        : _root(nullptr), function_policy(avl_tree_data.function_policy), _pool(typename pool_type::allocator_type(allocator_data))
     {
       if (avl_tree_data._root == nullptr)
       {
@@ -1154,7 +1196,7 @@ namespace tree_container
       standard_con::stack<standard_con::pair<container_node *, container_node *>> stack;
 
       // 创建根节点
-      _root = new container_node(avl_tree_data._root->_data);
+      _root = _pool.create(avl_tree_data._root->_data);
       _root->_balance_factor = avl_tree_data._root->_balance_factor;
       _root->_parent = nullptr; // 根节点的父节点为nullptr
 
@@ -1175,7 +1217,7 @@ namespace tree_container
         stack.pop();
 
         // 创建新节点并复制数据
-        auto *new_structure_node = new container_node(first_node->_data);
+        auto *new_structure_node = _pool.create(first_node->_data);
         new_structure_node->_balance_factor = first_node->_balance_factor;
 
         // 设置父节点关系（注意：second_node 是一级指针）
@@ -1210,7 +1252,7 @@ namespace tree_container
       }
     }
     balance_tree(balance_tree &&avl_tree_data) noexcept
-        : _root(nullptr), function_policy(avl_tree_data.function_policy)
+        : _root(nullptr), function_policy(avl_tree_data.function_policy), _pool(std::move(avl_tree_data._pool))
     {
       _root = std::move(avl_tree_data._root);
       avl_tree_data._root = nullptr;
@@ -1223,22 +1265,25 @@ namespace tree_container
         _root = std::move(avl_tree_data._root);
         function_policy = std::move(avl_tree_data.function_policy);
         avl_tree_data._root = nullptr;
+        _pool = std::move(avl_tree_data._pool);
       }
       return *this;
     }
-    balance_tree &operator=(const balance_tree avl_tree_data)
+    balance_tree &operator=(const balance_tree &avl_tree_source)
     {
-      clear();
-      if (&avl_tree_data == this)
+      if (this == &avl_tree_source)
       {
         return *this;
       }
+      balance_tree avl_tree_data(avl_tree_source, get_allocator()); // 副本沿用本树的分配器
+      clear();
       if (avl_tree_data._root == nullptr)
       {
         return *this;
       }
       standard_con::algorithm::swap(function_policy, avl_tree_data.function_policy);
       standard_con::algorithm::swap(_root, avl_tree_data._root);
+      _pool.swap(avl_tree_data._pool);
       return *this;
     }
     ~balance_tree() noexcept
@@ -1271,7 +1316,7 @@ namespace tree_container
       // 插入
       if (_root == nullptr)
       {
-        _root = new container_node(key_data, val_data);
+        _root = _pool.create(key_data, val_data);
         return true;
       }
       else
@@ -1294,7 +1339,7 @@ namespace tree_container
             reference_node = reference_node->_right;
           }
         }
-        reference_node = new container_node(key_data, val_data);
+        reference_node = _pool.create(key_data, val_data);
         if (function_policy(key_data, parent_node->_data.first))
         {
           parent_node->_left = reference_node;
@@ -1341,7 +1386,7 @@ namespace tree_container
                 right_left_revolve(adjust_reference_parent_node);
               }
             }
-            if (adjust_reference_parent_node->_balance_factor == -2)
+            else
             {
               if (adjust_reference_node->_balance_factor == -1)
               {
@@ -1352,8 +1397,8 @@ namespace tree_container
                 left_right_revolve(adjust_reference_parent_node);
               }
             }
-            adjust_reference_node = adjust_reference_parent_node;
-            adjust_reference_parent_node = adjust_reference_parent_node->_parent;
+            // 插入后的旋转使子树恢复插入前的高度，祖先的平衡因子不变
+            break;
           }
         }
       }
@@ -1364,7 +1409,7 @@ namespace tree_container
       // AVL树左子树比右子树高，则他俩的根节点的平衡因子为1，反之为-1，也就是说左加一，右减一，如果根节点为2和-2就要需要调整了
       if (_root == nullptr)
       {
-        _root = new container_node(pair_type_data.first, pair_type_data.second);
+        _root = _pool.create(pair_type_data.first, pair_type_data.second);
         return true;
       }
       else
@@ -1389,7 +1434,7 @@ namespace tree_container
             reference_node = reference_node->_right;
           }
         }
-        reference_node = new container_node(pair_type_data);
+        reference_node = _pool.create(pair_type_data);
         if (function_policy(pair_type_data.first, parent_node->_data.first))
         {
           parent_node->_left = reference_node;
@@ -1455,10 +1500,8 @@ namespace tree_container
                 left_right_revolve(adjust_reference_parent_node);
               }
             }
-            // 旋转后继续向上调整，因为旋转后父节点的平衡因子可能发生变化，每个旋转的节点都可以当作一个子树，子树旋转后，父节点平衡因子可能发生变化
-            adjust_reference_node = adjust_reference_parent_node;
-            adjust_reference_parent_node = adjust_reference_parent_node->_parent;
-            // 对于双旋的情况，相同方向先调整该节点，再调整整体
+            // 插入后的旋转使子树恢复插入前的高度，祖先的平衡因子不变，无需继续向上调整
+            break;
           }
         }
       }
@@ -1543,7 +1586,7 @@ namespace tree_container
             parent_node->_right = child;
           }
         }
-        delete reference_node;
+        _pool.destroy(reference_node);
         reference_node = nullptr;
       }
       else if (reference_node->_right == nullptr)
@@ -1569,7 +1612,7 @@ namespace tree_container
             parent_node->_right = child;
           }
         }
-        delete reference_node;
+        _pool.destroy(reference_node);
         reference_node = nullptr;
       }
       else // 左右子树都不为空
@@ -1608,15 +1651,14 @@ namespace tree_container
           parent_node->_right = child;
         }
 
-        delete reference_node;
+        _pool.destroy(reference_node);
         reference_node = nullptr;
       }
 
-      // 更新平衡因子
+      // 更新平衡因子：删除使一侧变矮，平衡因子变为 0 说明子树整体变矮，需继续向上；变为 ±1 说明子树高度不变
       container_node *current = parent_node;
       while (current != nullptr)
       {
-        // 根据之前记录的子树关系更新平衡因子
         if (isleft_child)
         {
           ++current->_balance_factor;
@@ -1626,25 +1668,18 @@ namespace tree_container
           --current->_balance_factor;
         }
 
-        // 平衡因子调整逻辑
-        if (current->_balance_factor == 0)
+        if (current->_balance_factor == 1 || current->_balance_factor == -1)
         {
-          // 高度未变，不需要继续调整
           break;
         }
-        else if (current->_balance_factor == 1 || current->_balance_factor == -1)
-        {
-          // 高度变化，但不需要旋转，继续向上调整
-          isleft_child = (current->_parent != nullptr) && (current->_parent->_left == current);
-          current = current->_parent;
-        }
-        else if (current->_balance_factor == 2 || current->_balance_factor == -2)
+        container_node *subtree_root = current;
+        if (current->_balance_factor == 2 || current->_balance_factor == -2)
         {
-          // 需要旋转调整
+          container_node *child = current->_balance_factor == 2 ? current->_right : current->_left;
+          const int child_balance_factor = child->_balance_factor;
           if (current->_balance_factor == 2)
           {
-            container_node *child = current->_right;
-            if (child->_balance_factor == 1)
+            if (child_balance_factor >= 0)
             {
               left_revolve(current);
             }
@@ -1653,10 +1688,9 @@ namespace tree_container
               right_left_revolve(current);
             }
           }
-          else // current->_balance_factor == -2
+          else
           {
-            container_node *child = current->_left;
-            if (child->_balance_factor == -1)
+            if (child_balance_factor <= 0)
             {
               right_revolve(current);
             }
@@ -1665,11 +1699,18 @@ namespace tree_container
               left_right_revolve(current);
             }
           }
-
-          // 旋转后继续向上调整
-          isleft_child = (current->_parent != nullptr) && (current->_parent->_left == current);
-          current = current->_parent;
+          subtree_root = current->_parent; // 旋转后 current 下沉，其父节点为新的子树根
+          if (child_balance_factor == 0)
+          {
+            // 孩子原本平衡时单旋后子树高度不变，只需修正两者的平衡因子
+            current->_balance_factor = child->_left == current ? 1 : -1;
+            child->_balance_factor = -current->_balance_factor;
+            break;
+          }
         }
+        // 子树变矮，继续向上
+        isleft_child = (subtree_root->_parent != nullptr) && (subtree_root->_parent->_left == subtree_root);
+        current = subtree_root->_parent;
       }
       return *this;
     }
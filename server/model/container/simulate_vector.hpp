@@ -1,4 +1,8 @@
 #pragma once
+#include <memory>
+#include <cstring>
+#include <type_traits>
+#include <initializer_list>
 #include "simulate_exception.hpp"
 #include "simulate_algorithm.hpp"
 namespace vector_container
@@ -15,6 +19,8 @@ namespace vector_container
       * 模板参数:
 
       * * - `vector_type`: 容器中存储的元素类型
+      *
+      * * - `vector_allocator`: 分配器类型，默认为 `std::allocator<vector_type>`，只负责原始内存，元素由容器按需原地构造
 
       * 类型别名:
 
@@ -33,6 +39,8 @@ namespace vector_container
       * * - `_size_pointer`: 指向数组中最后一个元素的下一个位置（表示当前元素数量）
       *
       * * - `_capacity_pointer`: 指向数组容量的末尾位置（表示可容纳的最大元素数量）
+      *
+      * * - `_allocator`: 分配器实例，`[_size_pointer, _capacity_pointer)` 为未构造的原始内存
 
       * 迭代器相关方法:
 
@@ -48,7 +56,9 @@ namespace vector_container
       *
       * * - `empty()`: 判断容器是否为空（元素数量为 0）
       *
-      * * - `resize()`: 调整容器容量，不足时填充指定元素，超出时截断
+      * * - `resize()`: 容量不足时扩容，并用指定元素填充到目标大小，不截断已有元素
+      *
+      * * - `reserve()`: 仅预留原始内存，不构造元素
       *
       * * - `size_adjust()`: 调整容器大小，不足时填充指定元素
 
@@ -64,7 +74,9 @@ namespace vector_container
       *
       * * - `find()`: 根据索引查找元素，超出范围时抛出异常
       *
-      * * - `operator[]`: 通过索引访问元素（支持读写和只读版本）
+      * * - `operator[]`: 通过索引访问元素（支持读写和只读版本），索引需小于 `size()`
+      *
+      * * - `data()`: 返回指向首元素的指针，不做越界检查，供热路径按下标直接访问
 
       * 构造函数:
 
@@ -86,17 +98,23 @@ namespace vector_container
 
       * * - `push_back()`: 向容器末尾添加元素（支持拷贝和移动语义）
       *
+      * * - `emplace_back()`: 在容器末尾原地构造元素
+      *
       * * - `pop_back()`: 移除容器末尾的元素（尾指针前移）
       *
       * * - `push_front()`: 向容器头部插入元素（元素后移，效率较低）
       *
       * * - `erase()`: 删除指定位置的元素，后续元素前移，返回下一个元素的迭代器
       *
-      * * - `swap()`: 与另一个容器交换内部资源（指针和容量信息）
+      * * - `erase(first, last)`: 删除区间内的元素，后续元素整体前移，返回原 `first` 位置
+      *
+      * * - `clear()`: 析构全部元素，保留已分配的容量
+      *
+      * * - `swap()`: 与另一个容器交换内部资源（指针和容量信息），分配器不随交换传播时要求两者相等
 
       * 运算符重载:
 
-      * * - `operator=`: 赋值运算符（支持拷贝赋值和移动赋值）
+      * * - `operator=`: 赋值运算符（支持拷贝赋值和移动赋值），新存储总是取自本容器的分配器；分配器不同且不随移动传播时，移动赋值退化为逐个移动元素
       *
       * * - `operator+=`: 容器拼接，将另一个容器的元素添加到当前容器末尾
       *
@@ -106,6 +124,8 @@ namespace vector_container
 
       * * - 容量自动扩展: 当元素数量达到容量时，容量翻倍（初始容量为 10）
       *
+      * * - 未初始化存储: 空闲容量不构造元素，扩容时可平凡复制的类型直接 `memcpy`，其余类型按 `move_if_noexcept` 迁移
+      *
       * * - 支持移动语义: 减少不必要的元素拷贝，提高性能
       *
       * * - 异常处理: 越界访问等操作会抛出 `fault` 异常
@@ -124,7 +144,7 @@ namespace vector_container
 
       * 详细请参考 https://github.com/Hatedatastructures/Custom-libraries/blob/main/template_container.md
   */
-  template <typename vector_type>
+  template <typename vector_type, typename vector_allocator = std::allocator<vector_type>>
   class vector
   {
   public:
@@ -132,11 +152,158 @@ namespace vector_container
     using const_iterator = const vector_type *;
     using reverse_iterator = iterator;
     using const_reverse_iterator = const_iterator;
+    using allocator_type = vector_allocator;
 
   private:
-    iterator _data_pointer;     // 指向数据的头
-    iterator _size_pointer;     // 指向数据的尾
-    iterator _capacity_pointer; // 指向容量的尾
+    using allocator_traits = std::allocator_traits<vector_allocator>;
+    static constexpr bool bitwise_relocatable = std::is_trivially_copyable_v<vector_type>;
+    static constexpr uint64_t initial_capacity = 10;
+
+    iterator _data_pointer;                          // 指向数据的头
+    iterator _size_pointer;                          // 指向数据的尾
+    iterator _capacity_pointer;                      // 指向容量的尾
+    [[no_unique_address]] vector_allocator _allocator; // 分配器，无状态时不占空间
+
+    iterator allocate_storage(const uint64_t &container_capacity)
+    {
+      return container_capacity == 0 ? nullptr : allocator_traits::allocate(_allocator, container_capacity);
+    }
+    void deallocate_storage() noexcept
+    {
+      if (_data_pointer != nullptr)
+      {
+        allocator_traits::deallocate(_allocator, _data_pointer, static_cast<uint64_t>(_capacity_pointer - _data_pointer));
+      }
+      _data_pointer = _size_pointer = _capacity_pointer = nullptr;
+    }
+    void destroy_range(iterator first_position, iterator last_position) noexcept
+    {
+      if constexpr (!std::is_trivially_destructible_v<vector_type>)
+      {
+        for (; first_position != last_position; ++first_position)
+        {
+          allocator_traits::destroy(_allocator, first_position);
+        }
+      }
+    }
+    // 在未初始化的 destination 上拷贝构造 [first, last)，失败时析构已构造部分
+    template <typename source_iterator>
+    void construct_copies(source_iterator first_position, source_iterator last_position, iterator destination)
+    {
+      if constexpr (bitwise_relocatable && std::is_pointer_v<source_iterator>)
+      {
+        if (first_position != last_position)
+        {
+          std::memcpy(static_cast<void *>(destination), static_cast<const void *>(first_position),
+                      static_cast<uint64_t>(last_position - first_position) * sizeof(vector_type));
+        }
+      }
+      else
+      {
+        iterator constructed_end = destination;
+        try
+        {
+          for (; first_position != last_position; ++first_position, ++constructed_end)
+          {
+            allocator_traits::construct(_allocator, constructed_end, *first_position);
+          }
+        }
+        catch (...)
+        {
+          destroy_range(destination, constructed_end);
+          throw;
+        }
+      }
+    }
+    void construct_fill(iterator destination, const uint64_t &fill_count, const vector_type &fill_data)
+    {
+      iterator constructed_end = destination;
+      try
+      {
+        for (uint64_t fill_traversal = 0; fill_traversal < fill_count; ++fill_traversal, ++constructed_end)
+        {
+          allocator_traits::construct(_allocator, constructed_end, fill_data);
+        }
+      }
+      catch (...)
+      {
+        destroy_range(destination, constructed_end);
+        throw;
+      }
+    }
+    // 把现有元素迁移到新存储：可平凡复制时直接 memcpy，否则 move_if_noexcept 后析构原元素
+    void relocate_into(iterator destination)
+    {
+      if constexpr (bitwise_relocatable)
+      {
+        if (_data_pointer != nullptr)
+        {
+          std::memcpy(static_cast<void *>(destination), static_cast<const void *>(_data_pointer), size() * sizeof(vector_type));
+        }
+      }
+      else if constexpr (std::is_nothrow_move_constructible_v<vector_type>)
+      {
+        // 移动不会失败，移动后立即析构源元素，一趟遍历完成迁移
+        for (iterator source = _data_pointer; source != _size_pointer; ++source, ++destination)
+        {
+          allocator_traits::construct(_allocator, destination, std::move(*source));
+          allocator_traits::destroy(_allocator, source);
+        }
+      }
+      else
+      {
+        iterator constructed_end = destination;
+        try
+        {
+          for (iterator source = _data_pointer; source != _size_pointer; ++source, ++constructed_end)
+          {
+            allocator_traits::construct(_allocator, constructed_end, std::move_if_noexcept(*source));
+          }
+        }
+        catch (...)
+        {
+          destroy_range(destination, constructed_end);
+          throw;
+        }
+        destroy_range(_data_pointer, _size_pointer);
+      }
+    }
+    void adopt_storage(iterator new_data_pointer, const uint64_t &element_count, const uint64_t &new_container_capacity) noexcept
+    {
+      deallocate_storage();
+      _data_pointer = new_data_pointer;
+      _size_pointer = new_data_pointer + element_count;
+      _capacity_pointer = new_data_pointer + new_container_capacity;
+    }
+    void reallocate(const uint64_t &new_container_capacity)
+    {
+      try
+      {
+        const uint64_t original_size = size();
+        iterator new_data_pointer = allocate_storage(new_container_capacity);
+        try
+        {
+          relocate_into(new_data_pointer);
+        }
+        catch (...)
+        {
+          allocator_traits::deallocate(_allocator, new_data_pointer, new_container_capacity);
+          throw;
+        }
+        adopt_storage(new_data_pointer, original_size, new_container_capacity);
+      }
+      catch (const std::bad_alloc &process)
+      {
+        std::cerr << process.what() << std::endl;
+        throw;
+      }
+    }
+    [[nodiscard]] uint64_t growth_capacity(const uint64_t &required_size) const noexcept
+    {
+      const uint64_t doubled_capacity = _data_pointer == nullptr ? initial_capacity : capacity() * 2;
+      return doubled_capacity > required_size ? doubled_capacity : required_size;
+    }
+
   public:
     [[nodiscard]] iterator begin() noexcept
     {
@@ -147,6 +314,25 @@ namespace vector_container
     {
       return _size_pointer;
     }
+
+    [[nodiscard]] const_iterator begin() const noexcept
+    {
+      return _data_pointer;
+    }
+
+    [[nodiscard]] const_iterator end() const noexcept
+    {
+      return _size_pointer;
+    }
+    [[nodiscard]] vector_type *data() noexcept
+    {
+      return _data_pointer;
+    }
+
+    [[nodiscard]] const vector_type *data() const noexcept
+    {
+      return _data_pointer;
+    }
     [[nodiscard]] uint64_t size() const noexcept
     {
       return _data_pointer ? (_size_pointer - _data_pointer) : 0;
@@ -182,30 +368,54 @@ namespace vector_container
       return *(_size_pointer - 1);
     }
 
-    vector() noexcept
+    [[nodiscard]] allocator_type get_allocator() const noexcept
     {
-      _data_pointer = nullptr;
-      _size_pointer = nullptr;
-      _capacity_pointer = nullptr;
+      return _allocator;
     }
-    explicit vector(const uint64_t &container_capacity, const vector_type &vector_data = vector_type())
-        : _data_pointer(new vector_type[container_capacity]), _size_pointer(_data_pointer + container_capacity), _capacity_pointer(_data_pointer + container_capacity)
+
+    vector() noexcept(noexcept(vector_allocator()))
+        : _data_pointer(nullptr), _size_pointer(nullptr), _capacity_pointer(nullptr), _allocator() {}
+
+    explicit vector(const vector_allocator &allocator_data) noexcept
+        : _data_pointer(nullptr), _size_pointer(nullptr), _capacity_pointer(nullptr), _allocator(allocator_data) {}
+
+    explicit vector(const uint64_t &container_capacity, const vector_type &vector_data = vector_type(),
+                    const vector_allocator &allocator_data = vector_allocator())
+        : _data_pointer(nullptr), _size_pointer(nullptr), _capacity_pointer(nullptr), _allocator(allocator_data)
     {
-      for (uint64_t corresponding_location = 0; corresponding_location < container_capacity; corresponding_location++)
+      iterator new_data_pointer = allocate_storage(container_capacity);
+      try
+      {
+        construct_fill(new_data_pointer, container_capacity, vector_data);
+      }
+      catch (...)
       {
-        _data_pointer[corresponding_location] = vector_data;
+        if (new_data_pointer != nullptr)
+        {
+          allocator_traits::deallocate(_allocator, new_data_pointer, container_capacity);
+        }
+        throw;
       }
+      adopt_storage(new_data_pointer, container_capacity, container_capacity);
     }
-    vector(std::initializer_list<vector_type> lightweight_container)
-        : _data_pointer(new vector_type[lightweight_container.size()]), _size_pointer(_data_pointer + lightweight_container.size()), _capacity_pointer(_data_pointer + lightweight_container.size())
+    vector(std::initializer_list<vector_type> lightweight_container, const vector_allocator &allocator_data = vector_allocator())
+        : _data_pointer(nullptr), _size_pointer(nullptr), _capacity_pointer(nullptr), _allocator(allocator_data)
     {
-      // 链式拷贝
-      uint64_t corresponding_location = 0;
-      for (auto &chained_values : lightweight_container)
+      const uint64_t container_capacity = lightweight_container.size();
+      iterator new_data_pointer = allocate_storage(container_capacity);
+      try
+      {
+        construct_copies(lightweight_container.begin(), lightweight_container.end(), new_data_pointer);
+      }
+      catch (...)
       {
-        _data_pointer[corresponding_location] = std::move(chained_values);
-        corresponding_location++;
+        if (new_data_pointer != nullptr)
+        {
+          allocator_traits::deallocate(_allocator, new_data_pointer, container_capacity);
+        }
+        throw;
       }
+      adopt_storage(new_data_pointer, container_capacity, container_capacity);
     }
     vector_type &find(const uint64_t &find_size)
     {
@@ -226,164 +436,192 @@ namespace vector_container
         throw;
       }
     }
-    vector<vector_type> &size_adjust(const uint64_t &data_size, const vector_type &padding_temp_data = vector_type())
+    vector &size_adjust(const uint64_t &data_size, const vector_type &padding_temp_data = vector_type())
     {
-      uint64_t container_size = size();
-      uint64_t container_capacity = capacity();
-      if (data_size > container_capacity)
+      const uint64_t container_size = size();
+      if (data_size > container_size)
       {
-        resize(data_size);
-        for (uint64_t assignment_traversal = container_capacity; assignment_traversal < data_size; ++assignment_traversal)
+        if (data_size > capacity())
         {
-          _data_pointer[assignment_traversal] = padding_temp_data;
+          reallocate(data_size);
         }
+        construct_fill(_size_pointer, data_size - container_size, padding_temp_data);
+        _size_pointer = _data_pointer + data_size;
       }
-      else
+      else if (data_size < container_size)
       {
-        if (data_size > container_size)
-        {
-          for (uint64_t assignment_traversal = container_size; assignment_traversal < data_size; ++assignment_traversal)
-          {
-            _data_pointer[assignment_traversal] = padding_temp_data;
-          }
-        }
-        else if (data_size < container_size)
-        {
-          _size_pointer = _data_pointer + data_size;
-        }
+        destroy_range(_data_pointer + data_size, _size_pointer);
+        _size_pointer = _data_pointer + data_size;
       }
       return *this;
     }
-    vector(const vector<vector_type> &vector_data)
-        : _data_pointer(vector_data.capacity() ? new vector_type[vector_data.capacity()] : nullptr),
-          _size_pointer(_data_pointer + vector_data.size()), _capacity_pointer(_data_pointer + vector_data.capacity())
+    vector(const vector &vector_data)
+        : _data_pointer(nullptr), _size_pointer(nullptr), _capacity_pointer(nullptr),
+          _allocator(allocator_traits::select_on_container_copy_construction(vector_data._allocator))
     {
-      for (uint64_t copy_assignment_traversal = 0; copy_assignment_traversal < vector_data.size(); copy_assignment_traversal++)
+      const uint64_t container_size = vector_data.size();
+      iterator new_data_pointer = allocate_storage(container_size);
+      try
       {
-        _data_pointer[copy_assignment_traversal] = vector_data._data_pointer[copy_assignment_traversal];
+        construct_copies(vector_data._data_pointer, vector_data._size_pointer, new_data_pointer);
+      }
+      catch (...)
+      {
+        if (new_data_pointer != nullptr)
+        {
+          allocator_traits::deallocate(_allocator, new_data_pointer, container_size);
+        }
+        throw;
       }
+      adopt_storage(new_data_pointer, container_size, container_size);
     }
-    vector(vector<vector_type> &&vector_data) noexcept
+    vector(vector &&vector_data) noexcept
+        : _data_pointer(vector_data._data_pointer), _size_pointer(vector_data._size_pointer),
+          _capacity_pointer(vector_data._capacity_pointer), _allocator(std::move(vector_data._allocator))
     {
-      _data_pointer = std::move(vector_data._data_pointer);
-      _size_pointer = std::move(vector_data._size_pointer);
-      _capacity_pointer = std::move(vector_data._capacity_pointer);
       vector_data._data_pointer = vector_data._size_pointer = vector_data._capacity_pointer = nullptr;
     }
     ~vector() noexcept
     {
-      delete[] _data_pointer;
-      _data_pointer = _size_pointer = _capacity_pointer = nullptr;
+      destroy_range(_data_pointer, _size_pointer);
+      deallocate_storage();
     }
-    void swap(vector<vector_type> &vector_data) noexcept
+    // 前置条件：分配器会随交换传播（propagate_on_container_swap），或两者相等；否则双方的存储将由错误的分配器释放
+    void swap(vector &vector_data) noexcept
     {
       standard_con::algorithm::swap(_data_pointer, vector_data._data_pointer);
       standard_con::algorithm::swap(_size_pointer, vector_data._size_pointer);
       standard_con::algorithm::swap(_capacity_pointer, vector_data._capacity_pointer);
+      if constexpr (allocator_traits::propagate_on_container_swap::value)
+      {
+        standard_con::algorithm::swap(_allocator, vector_data._allocator);
+      }
     }
     iterator erase(iterator delete_position) noexcept
     {
-      // 删除元素
+      // 删除元素：后续元素依次前移，最后一个位置析构
       iterator next_position = delete_position + 1;
       while (next_position != _size_pointer)
       {
-        *(next_position - 1) = *next_position; //(temp-1)就是pos的位置，从pos位置开始覆盖，覆盖到倒数第1个结束，最后一个会被--屏蔽掉
+        *(next_position - 1) = std::move(*next_position);
         ++next_position;
       }
       --_size_pointer;
-      return next_position; // 返回下一个位置地址
+      allocator_traits::destroy(_allocator, _size_pointer);
+      return delete_position; // 原位置即为下一个元素
     }
-    vector<vector_type> &resize(const uint64_t &new_container_capacity, const vector_type &vector_data = vector_type())
+    iterator erase(iterator first_position, iterator last_position) noexcept
     {
-      try
+      // 区间删除：后续元素整体前移 last - first 位，尾部多出的元素析构
+      if (first_position == last_position)
       {
-        uint64_t original_size = size(); // 先保存原来的元素数量
-        if (static_cast<uint64_t>(_capacity_pointer - _data_pointer) < new_container_capacity)
-        {
-          // 涉及到迭代器失效问题，不能调用size()函数，会释放未知空间
-          auto new_vector_type_array = new vector_type[new_container_capacity];
-          // 复制原先的数据
-          for (uint64_t original_data_traversal = 0; original_data_traversal < original_size; original_data_traversal++)
-          {
-            new_vector_type_array[original_data_traversal] = std::move(_data_pointer[original_data_traversal]);
-          }
-          for (uint64_t assignment_traversal = original_size; assignment_traversal < new_container_capacity; ++assignment_traversal)
-          {
-            new_vector_type_array[assignment_traversal] = vector_data;
-          }
-          delete[] _data_pointer;
-          _data_pointer = new_vector_type_array;
-          _size_pointer = _data_pointer + original_size; // 使用 original_size 来重建 _size_pointer
-          _capacity_pointer = _data_pointer + new_container_capacity;
-        }
+        return first_position;
       }
-      catch (const std::bad_alloc &process)
+      iterator write_position = first_position;
+      for (iterator read_position = last_position; read_position != _size_pointer; ++read_position, ++write_position)
       {
-        delete[] _data_pointer;
-        _data_pointer = _size_pointer = _capacity_pointer = nullptr;
-        std::cerr << process.what() << std::endl;
-        throw;
+        *write_position = std::move(*read_position);
+      }
+      destroy_range(write_position, _size_pointer);
+      _size_pointer = write_position;
+      return first_position;
+    }
+    void clear() noexcept
+    {
+      destroy_range(_data_pointer, _size_pointer);
+      _size_pointer = _data_pointer;
+    }
+    vector &reserve(const uint64_t &new_container_capacity)
+    {
+      if (capacity() < new_container_capacity)
+      {
+        reallocate(new_container_capacity);
       }
       return *this;
     }
-    vector<vector_type> &push_back(const vector_type &vector_type_data)
+    vector &resize(const uint64_t &new_container_capacity, const vector_type &vector_data = vector_type())
     {
-      if (_size_pointer == _capacity_pointer)
+      // 容量不足时扩容，并用 vector_data 构造填满 [size, new_container_capacity)，不截断已有元素
+      if (new_container_capacity > size())
       {
-        const uint64_t new_container_capacity = _data_pointer == nullptr ? 10 : static_cast<uint64_t>((_capacity_pointer - _data_pointer) * 2);
-        resize(new_container_capacity);
+        size_adjust(new_container_capacity, vector_data);
       }
-      // 注意—_size_pointer是原生迭代器指针，需要解引用才能赋值
-      *_size_pointer = vector_type_data;
-      ++_size_pointer;
       return *this;
     }
-    vector<vector_type> &push_back(vector_type &&vector_type_data)
+    template <typename... Args>
+    vector_type &emplace_back(Args &&...args)
     {
-      if (_size_pointer == _capacity_pointer)
+      if (_size_pointer != _capacity_pointer)
+      {
+        allocator_traits::construct(_allocator, _size_pointer, std::forward<Args>(args)...);
+        return *_size_pointer++;
+      }
+      // 先在新存储上构造新元素，参数可能引用旧存储中的元素
+      const uint64_t original_size = size();
+      const uint64_t new_container_capacity = growth_capacity(original_size + 1);
+      iterator new_data_pointer = allocate_storage(new_container_capacity);
+      try
+      {
+        allocator_traits::construct(_allocator, new_data_pointer + original_size, std::forward<Args>(args)...);
+        try
+        {
+          relocate_into(new_data_pointer);
+        }
+        catch (...)
+        {
+          allocator_traits::destroy(_allocator, new_data_pointer + original_size);
+          throw;
+        }
+      }
+      catch (...)
       {
-        const uint64_t new_container_capacity = _data_pointer == nullptr ? 10 : static_cast<uint64_t>((_capacity_pointer - _data_pointer) * 2);
-        resize(new_container_capacity);
+        allocator_traits::deallocate(_allocator, new_data_pointer, new_container_capacity);
+        throw;
       }
-      // 注意_size_pointer是原生迭代器指针，需要解引用才能赋值
-      *_size_pointer = std::move(vector_type_data);
-      // new (_data_pointer) vector_type(std::forward<vector_type>(vector_type_data));
-      ++_size_pointer;
+      adopt_storage(new_data_pointer, original_size + 1, new_container_capacity);
+      return tail();
+    }
+    vector &push_back(const vector_type &vector_type_data)
+    {
+      emplace_back(vector_type_data);
+      return *this;
+    }
+    vector &push_back(vector_type &&vector_type_data)
+    {
+      emplace_back(std::move(vector_type_data));
       return *this;
     }
-    vector<vector_type> &pop_back()
+    vector &pop_back()
     {
       if (_size_pointer > _data_pointer)
-      {                  // 至少有一个元素
-        --_size_pointer; // 尾指针前移
+      { // 至少有一个元素
+        --_size_pointer;
+        allocator_traits::destroy(_allocator, _size_pointer);
       }
       return *this;
     }
-    vector<vector_type> &push_front(const vector_type &vector_type_data)
+    vector &push_front(const vector_type &vector_type_data)
     {
-      // 头插
-      if (_size_pointer == _capacity_pointer)
+      // 头插：先复制参数，扩容或移动后它可能失效
+      vector_type front_data(vector_type_data);
+      if (_size_pointer == _data_pointer)
       {
-        const uint64_t new_container_size = _data_pointer == nullptr ? 10 : static_cast<uint64_t>((_capacity_pointer - _data_pointer) * 2);
-        resize(new_container_size);
+        emplace_back(std::move(front_data));
+        return *this;
       }
-      for (uint64_t container_size = size(); container_size > 0; --container_size)
+      emplace_back(std::move(tail()));
+      for (iterator move_position = _size_pointer - 2; move_position != _data_pointer; --move_position)
       {
-        _data_pointer[container_size] = _data_pointer[container_size - 1];
+        *move_position = std::move(*(move_position - 1));
       }
-      *_data_pointer = vector_type_data;
-      ++_size_pointer;
+      *_data_pointer = std::move(front_data);
       return *this;
     }
-    vector<vector_type> &pop_front()
+    vector &pop_front()
     {
       if (size() > 0)
       {
-        for (uint64_t assignment_traversal = 1; assignment_traversal < size(); assignment_traversal++)
-        {
-          _data_pointer[assignment_traversal - 1] = _data_pointer[assignment_traversal];
-        }
-        --_size_pointer;
+        erase(_data_pointer);
       }
       return *this;
     }
@@ -391,7 +629,7 @@ namespace vector_container
     {
       try
       {
-        if (access_location >= capacity())
+        if (access_location >= size())
         {
           throw custom_exception::fault("传入参数越界", "vector::operatot[]", __LINE__);
         }
@@ -408,10 +646,9 @@ namespace vector_container
     }
     const vector_type &operator[](const uint64_t &access_location) const
     {
-      // return _data_pointer[access_location];
       try
       {
-        if (access_location >= capacity())
+        if (access_location >= size())
         {
           throw custom_exception::fault("传入参数越界", "vector::operatot[]", __LINE__);
         }
@@ -426,52 +663,737 @@ namespace vector_container
         throw;
       }
     }
-    vector<vector_type> &operator=(const vector<vector_type> &vector_data)
+    vector &operator=(const vector &vector_data)
     {
       if (this != &vector_data)
       {
-        vector<vector_type> return_vector_object(vector_data); // 拷贝构造
-        swap(return_vector_object);                            // 交换资源，temp析构时会释放原资源
+        if constexpr (allocator_traits::propagate_on_container_copy_assignment::value)
+        {
+          if (!allocator_traits::is_always_equal::value && !(_allocator == vector_data._allocator))
+          {
+            // 旧存储只能交还给分配它的分配器
+            destroy_range(_data_pointer, _size_pointer);
+            deallocate_storage();
+          }
+          _allocator = vector_data._allocator;
+        }
+        // 新存储始终取自本容器的分配器，拷贝失败时原内容不变
+        const uint64_t container_size = vector_data.size();
+        iterator new_data_pointer = allocate_storage(container_size);
+        try
+        {
+          construct_copies(vector_data._data_pointer, vector_data._size_pointer, new_data_pointer);
+        }
+        catch (...)
+        {
+          if (new_data_pointer != nullptr)
+          {
+            allocator_traits::deallocate(_allocator, new_data_pointer, container_size);
+          }
+          throw;
+        }
+        destroy_range(_data_pointer, _size_pointer);
+        adopt_storage(new_data_pointer, container_size, container_size);
       }
       return *this;
     }
-    vector<vector_type> &operator=(vector<vector_type> &&vector_mobile_data) noexcept
+    vector &operator=(vector &&vector_mobile_data) noexcept(allocator_traits::propagate_on_container_move_assignment::value ||
+                                                            allocator_traits::is_always_equal::value)
     {
-      if (this != &vector_mobile_data)
+      if (this == &vector_mobile_data)
+      {
+        return *this;
+      }
+      if constexpr (!allocator_traits::propagate_on_container_move_assignment::value && !allocator_traits::is_always_equal::value)
+      {
+        if (!(_allocator == vector_mobile_data._allocator))
+        {
+          // 分配器不同不能接管对方的存储，逐个移动到本容器分配器的新存储上，对方随后清空
+          const uint64_t container_size = vector_mobile_data.size();
+          iterator new_data_pointer = allocate_storage(container_size);
+          iterator constructed_end = new_data_pointer;
+          try
+          {
+            for (iterator source = vector_mobile_data._data_pointer; source != vector_mobile_data._size_pointer; ++source, ++constructed_end)
+            {
+              allocator_traits::construct(_allocator, constructed_end, std::move(*source));
+            }
+          }
+          catch (...)
+          {
+            destroy_range(new_data_pointer, constructed_end);
+            if (new_data_pointer != nullptr)
+            {
+              allocator_traits::deallocate(_allocator, new_data_pointer, container_size);
+            }
+            throw;
+          }
+          destroy_range(_data_pointer, _size_pointer);
+          adopt_storage(new_data_pointer, container_size, container_size);
+          vector_mobile_data.destroy_range(vector_mobile_data._data_pointer, vector_mobile_data._size_pointer);
+          vector_mobile_data.deallocate_storage();
+          return *this;
+        }
+      }
+      destroy_range(_data_pointer, _size_pointer);
+      deallocate_storage();
+      _data_pointer = vector_mobile_data._data_pointer;
+      _size_pointer = vector_mobile_data._size_pointer;
+      _capacity_pointer = vector_mobile_data._capacity_pointer;
+      if constexpr (allocator_traits::propagate_on_container_move_assignment::value)
       {
-        _data_pointer = std::move(vector_mobile_data._data_pointer);
-        _size_pointer = std::move(vector_mobile_data._size_pointer);
-        _capacity_pointer = std::move(vector_mobile_data._capacity_pointer);
-        vector_mobile_data._data_pointer = vector_mobile_data._size_pointer = vector_mobile_data._capacity_pointer = nullptr;
+        _allocator = std::move(vector_mobile_data._allocator);
       }
+      vector_mobile_data._data_pointer = vector_mobile_data._size_pointer = vector_mobile_data._capacity_pointer = nullptr;
       return *this;
     }
-    vector<vector_type> &operator+=(const vector<vector_type> &vector_data)
+    vector &operator+=(const vector &vector_data)
     {
-      if (vector_data.size() == 0 || vector_data._data_pointer == nullptr)
+      const uint64_t vector_data_size = vector_data.size();
+      if (vector_data_size == 0)
       {
         return *this;
       }
-      uint64_t vector_data_size = vector_data.size();
-      uint64_t container_size = size();
-      uint64_t container_capacity = capacity();
-      if (vector_data_size + container_size > container_capacity)
+      const uint64_t container_size = size();
+      reserve(container_size + vector_data_size); // 自拼接时扩容后 vector_data 指向的同样是新存储
+      construct_copies(vector_data._data_pointer, vector_data._data_pointer + vector_data_size, _size_pointer);
+      _size_pointer = _data_pointer + (vector_data_size + container_size);
+      return *this;
+    }
+    template <typename const_vector_output_templates, typename const_vector_output_allocator>
+    friend std::ostream &operator<<(std::ostream &vector_ostream, const vector<const_vector_output_templates, const_vector_output_allocator> &dynamic_arrays_data);
+  };
+  template <typename const_vector_output_templates, typename const_vector_output_allocator>
+  std::ostream &operator<<(std::ostream &vector_ostream, const vector<const_vector_output_templates, const_vector_output_allocator> &dynamic_arrays_data)
+  {
+    for (uint64_t input_traversal = 0; input_traversal < dynamic_arrays_data.size(); input_traversal++)
+    {
+      vector_ostream << dynamic_arrays_data[input_traversal] << " ";
+    }
+    return vector_ostream;
+  }
+  /*
+   * @brief  #### `small_vector` 类模板
+
+      *   - 带内联存储的动态数组，前 `inline_capacity` 个元素直接存放在对象内部，超出后才向分配器申请堆内存
+
+      *   - 接口与 `vector` 一致，适合热路径上生命周期短、元素通常很少的临时集合（协议字段切分、头部键排序、待清理会话列表）
+
+      * 模板参数:
+
+      * * - `vector_type`: 容器中存储的元素类型
+      *
+      * * - `inline_capacity`: 内联容量，默认为 8，元素个数不超过它时不发生堆分配
+      *
+      * * - `vector_allocator`: 分配器类型，默认为 `std::allocator<vector_type>`，只为溢出到堆上的存储提供内存
+
+      * 成员变量:
+
+      * * - `_data_pointer` / `_size_pointer` / `_capacity_pointer`: 含义与 `vector` 相同，内联时指向 `_inline_buffer`
+      *
+      * * - `_inline_buffer`: 对象内部的未初始化存储，容纳 `inline_capacity` 个元素
+
+      * 与 `vector` 的差异:
+
+      * * - 默认构造后容量即为 `inline_capacity`，`begin()` 不为空指针
+      *
+      * * - 溢出到堆后不会自动退回内联存储，`clear()` 保留堆容量
+      *
+      * * - 内联时移动构造 / 移动赋值 / 交换需要逐个移动元素，为 O(n)；堆上时与 `vector` 一样只交换指针
+      *
+      * * - `is_inline()`: 判断当前是否使用内联存储
+
+      * 注意事项:
+
+      * * - 对象大小随 `inline_capacity * sizeof(vector_type)` 增长，不宜作为长期存活容器的成员或设置过大的内联容量
+      *
+      * * - 内联时移动后源对象的元素地址全部改变，之前取得的迭代器失效
+  */
+  template <typename vector_type, uint64_t inline_capacity = 8, typename vector_allocator = std::allocator<vector_type>>
+  class small_vector
+  {
+    static_assert(inline_capacity > 0, "small_vector 的内联容量必须大于 0");
+
+  public:
+    using iterator = vector_type *;
+    using const_iterator = const vector_type *;
+    using reverse_iterator = iterator;
+    using const_reverse_iterator = const_iterator;
+    using allocator_type = vector_allocator;
+
+  private:
+    using allocator_traits = std::allocator_traits<vector_allocator>;
+    static constexpr bool bitwise_relocatable = std::is_trivially_copyable_v<vector_type>;
+    static constexpr bool nothrow_relocatable = std::is_nothrow_move_constructible_v<vector_type>;
+    // 移动赋值时分配器不传播且可能不等，元素只能逐个移入本容器的存储，需要分配内存，可能抛出 `bad_alloc`
+    static constexpr bool nothrow_move_assignable = nothrow_relocatable && (allocator_traits::propagate_on_container_move_assignment::value ||
+                                                                            allocator_traits::is_always_equal::value);
+
+    iterator _data_pointer;                            // 指向数据的头
+    iterator _size_pointer;                            // 指向数据的尾
+    iterator _capacity_pointer;                        // 指向容量的尾
+    [[no_unique_address]] vector_allocator _allocator; // 分配器，无状态时不占空间
+    alignas(vector_type) unsigned char _inline_buffer[sizeof(vector_type) * inline_capacity];
+
+    iterator inline_data() noexcept
+    {
+      return reinterpret_cast<iterator>(_inline_buffer);
+    }
+    void reset_inline() noexcept
+    {
+      _data_pointer = _size_pointer = inline_data();
+      _capacity_pointer = _data_pointer + inline_capacity;
+    }
+    void deallocate_storage() noexcept
+    {
+      if (!is_inline())
+      {
+        allocator_traits::deallocate(_allocator, _data_pointer, capacity());
+      }
+      reset_inline();
+    }
+    void destroy_range(iterator first_position, iterator last_position) noexcept
+    {
+      if constexpr (!std::is_trivially_destructible_v<vector_type>)
+      {
+        for (; first_position != last_position; ++first_position)
+        {
+          allocator_traits::destroy(_allocator, first_position);
+        }
+      }
+    }
+    // 在未初始化的 destination 上拷贝构造 [first, last)，失败时析构已构造部分
+    template <typename source_iterator>
+    void construct_copies(source_iterator first_position, source_iterator last_position, iterator destination)
+    {
+      if constexpr (bitwise_relocatable && std::is_pointer_v<source_iterator>)
       {
-        resize(vector_data_size + container_size);
+        if (first_position != last_position)
+        {
+          std::memcpy(static_cast<void *>(destination), static_cast<const void *>(first_position),
+                      static_cast<uint64_t>(last_position - first_position) * sizeof(vector_type));
+        }
       }
-      uint64_t array_counter = 0;
-      for (uint64_t slicing_traversal = container_size; slicing_traversal < (vector_data_size + container_size); ++slicing_traversal)
+      else
       {
-        _data_pointer[slicing_traversal] = vector_data._data_pointer[array_counter++];
+        iterator constructed_end = destination;
+        try
+        {
+          for (; first_position != last_position; ++first_position, ++constructed_end)
+          {
+            allocator_traits::construct(_allocator, constructed_end, *first_position);
+          }
+        }
+        catch (...)
+        {
+          destroy_range(destination, constructed_end);
+          throw;
+        }
+      }
+    }
+    void construct_fill(iterator destination, const uint64_t &fill_count, const vector_type &fill_data)
+    {
+      iterator constructed_end = destination;
+      try
+      {
+        for (uint64_t fill_traversal = 0; fill_traversal < fill_count; ++fill_traversal, ++constructed_end)
+        {
+          allocator_traits::construct(_allocator, constructed_end, fill_data);
+        }
+      }
+      catch (...)
+      {
+        destroy_range(destination, constructed_end);
+        throw;
+      }
+    }
+    // 把现有元素迁移到 destination 并析构原元素：可平凡复制时直接 memcpy，否则 move_if_noexcept
+    void relocate_into(iterator destination)
+    {
+      if constexpr (bitwise_relocatable)
+      {
+        std::memcpy(static_cast<void *>(destination), static_cast<const void *>(_data_pointer), size() * sizeof(vector_type));
+      }
+      else
+      {
+        iterator constructed_end = destination;
+        try
+        {
+          for (iterator source = _data_pointer; source != _size_pointer; ++source, ++constructed_end)
+          {
+            allocator_traits::construct(_allocator, constructed_end, std::move_if_noexcept(*source));
+          }
+        }
+        catch (...)
+        {
+          destroy_range(destination, constructed_end);
+          throw;
+        }
+        destroy_range(_data_pointer, _size_pointer);
+      }
+    }
+    void adopt_storage(iterator new_data_pointer, const uint64_t &element_count, const uint64_t &new_container_capacity) noexcept
+    {
+      deallocate_storage();
+      _data_pointer = new_data_pointer;
+      _size_pointer = new_data_pointer + element_count;
+      _capacity_pointer = new_data_pointer + new_container_capacity;
+    }
+    void reallocate(const uint64_t &new_container_capacity)
+    {
+      try
+      {
+        const uint64_t original_size = size();
+        iterator new_data_pointer = allocator_traits::allocate(_allocator, new_container_capacity);
+        try
+        {
+          relocate_into(new_data_pointer);
+        }
+        catch (...)
+        {
+          allocator_traits::deallocate(_allocator, new_data_pointer, new_container_capacity);
+          throw;
+        }
+        adopt_storage(new_data_pointer, original_size, new_container_capacity);
+      }
+      catch (const std::bad_alloc &process)
+      {
+        std::cerr << process.what() << std::endl;
+        throw;
+      }
+    }
+    [[nodiscard]] uint64_t growth_capacity(const uint64_t &required_size) const noexcept
+    {
+      const uint64_t doubled_capacity = capacity() * 2;
+      return doubled_capacity > required_size ? doubled_capacity : required_size;
+    }
+    // 接管另一个容器的元素：对方在堆上且分配器可互换时直接接管指针，否则逐个移动到本容器的存储
+    void steal_elements(small_vector &vector_data)
+    {
+      if (!vector_data.is_inline() && (allocator_traits::propagate_on_container_move_assignment::value ||
+                                       allocator_traits::is_always_equal::value || _allocator == vector_data._allocator))
+      {
+        _data_pointer = vector_data._data_pointer;
+        _size_pointer = vector_data._size_pointer;
+        _capacity_pointer = vector_data._capacity_pointer;
+        vector_data.reset_inline();
+        return;
+      }
+      reserve(vector_data.size());
+      vector_data.relocate_into(_data_pointer);
+      _size_pointer = _data_pointer + vector_data.size();
+      vector_data._size_pointer = vector_data._data_pointer;
+    }
+
+  public:
+    [[nodiscard]] iterator begin() noexcept
+    {
+      return _data_pointer;
+    }
+
+    [[nodiscard]] iterator end() noexcept
+    {
+      return _size_pointer;
+    }
+
+    [[nodiscard]] const_iterator begin() const noexcept
+    {
+      return _data_pointer;
+    }
+
+    [[nodiscard]] const_iterator end() const noexcept
+    {
+      return _size_pointer;
+    }
+    [[nodiscard]] vector_type *data() noexcept
+    {
+      return _data_pointer;
+    }
+
+    [[nodiscard]] const vector_type *data() const noexcept
+    {
+      return _data_pointer;
+    }
+    [[nodiscard]] uint64_t size() const noexcept
+    {
+      return _size_pointer - _data_pointer;
+    }
+
+    [[nodiscard]] uint64_t capacity() const noexcept
+    {
+      return _capacity_pointer - _data_pointer;
+    }
+
+    [[nodiscard]] bool is_inline() const noexcept
+    {
+      return _data_pointer == reinterpret_cast<const vector_type *>(_inline_buffer);
+    }
+
+    [[nodiscard]] vector_type &front() const noexcept
+    {
+      return head();
+    }
+
+    [[nodiscard]] vector_type &back() const noexcept
+    {
+      return tail();
+    }
+
+    [[nodiscard]] bool empty() const noexcept
+    {
+      return size() == 0;
+    }
+
+    [[nodiscard]] vector_type &head() const noexcept
+    {
+      return *_data_pointer;
+    }
+
+    [[nodiscard]] vector_type &tail() const noexcept
+    {
+      return *(_size_pointer - 1);
+    }
+
+    [[nodiscard]] allocator_type get_allocator() const noexcept
+    {
+      return _allocator;
+    }
+
+    small_vector() noexcept(noexcept(vector_allocator()))
+        : _allocator()
+    {
+      reset_inline();
+    }
+
+    explicit small_vector(const vector_allocator &allocator_data) noexcept
+        : _allocator(allocator_data)
+    {
+      reset_inline();
+    }
+
+    explicit small_vector(const uint64_t &container_capacity, const vector_type &vector_data = vector_type(),
+                          const vector_allocator &allocator_data = vector_allocator())
+        : _allocator(allocator_data)
+    {
+      reset_inline();
+      try
+      {
+        size_adjust(container_capacity, vector_data);
+      }
+      catch (...)
+      {
+        deallocate_storage(); // 构造函数抛出时析构函数不会执行，溢出的堆存储需在此归还
+        throw;
+      }
+    }
+    small_vector(std::initializer_list<vector_type> lightweight_container, const vector_allocator &allocator_data = vector_allocator())
+        : _allocator(allocator_data)
+    {
+      reset_inline();
+      reserve(lightweight_container.size());
+      try
+      {
+        construct_copies(lightweight_container.begin(), lightweight_container.end(), _data_pointer);
+      }
+      catch (...)
+      {
+        deallocate_storage();
+        throw;
+      }
+      _size_pointer = _data_pointer + lightweight_container.size();
+    }
+    small_vector(const small_vector &vector_data)
+        : _allocator(allocator_traits::select_on_container_copy_construction(vector_data._allocator))
+    {
+      reset_inline();
+      reserve(vector_data.size());
+      try
+      {
+        construct_copies(vector_data._data_pointer, vector_data._size_pointer, _data_pointer);
+      }
+      catch (...)
+      {
+        deallocate_storage();
+        throw;
+      }
+      _size_pointer = _data_pointer + vector_data.size();
+    }
+    small_vector(small_vector &&vector_data) noexcept(nothrow_relocatable)
+        : _allocator(std::move(vector_data._allocator))
+    {
+      reset_inline();
+      steal_elements(vector_data);
+    }
+    ~small_vector() noexcept
+    {
+      destroy_range(_data_pointer, _size_pointer);
+      deallocate_storage();
+    }
+    vector_type &find(const uint64_t &find_size)
+    {
+      try
+      {
+        if (find_size >= size())
+        {
+          throw custom_exception::fault("传入数据超出容器范围", "small_vector::find", __LINE__);
+        }
+        else
+        {
+          return _data_pointer[find_size];
+        }
+      }
+      catch (const custom_exception::fault &process)
+      {
+        std::cerr << process.what() << " " << process.function_name_get() << " " << process.line_number_get() << std::endl;
+        throw;
+      }
+    }
+    small_vector &size_adjust(const uint64_t &data_size, const vector_type &padding_temp_data = vector_type())
+    {
+      const uint64_t container_size = size();
+      if (data_size > container_size)
+      {
+        if (data_size > capacity())
+        {
+          reallocate(data_size);
+        }
+        construct_fill(_size_pointer, data_size - container_size, padding_temp_data);
+        _size_pointer = _data_pointer + data_size;
+      }
+      else if (data_size < container_size)
+      {
+        destroy_range(_data_pointer + data_size, _size_pointer);
+        _size_pointer = _data_pointer + data_size;
+      }
+      return *this;
+    }
+    void swap(small_vector &vector_data) noexcept(nothrow_relocatable)
+    {
+      if (this == &vector_data)
+      {
+        return;
+      }
+      if (!is_inline() && !vector_data.is_inline())
+      {
+        standard_con::algorithm::swap(_data_pointer, vector_data._data_pointer);
+        standard_con::algorithm::swap(_size_pointer, vector_data._size_pointer);
+        standard_con::algorithm::swap(_capacity_pointer, vector_data._capacity_pointer);
+        if constexpr (allocator_traits::propagate_on_container_swap::value)
+        {
+          standard_con::algorithm::swap(_allocator, vector_data._allocator);
+        }
+        return;
+      }
+      // 至少一方使用内联存储，元素地址随对象固定，只能经临时对象逐个移动
+      small_vector temporary_vector(std::move(vector_data));
+      vector_data = std::move(*this);
+      *this = std::move(temporary_vector);
+    }
+    iterator erase(iterator delete_position) noexcept
+    {
+      // 删除元素：后续元素依次前移，最后一个位置析构
+      iterator next_position = delete_position + 1;
+      while (next_position != _size_pointer)
+      {
+        *(next_position - 1) = std::move(*next_position);
+        ++next_position;
+      }
+      --_size_pointer;
+      allocator_traits::destroy(_allocator, _size_pointer);
+      return delete_position; // 原位置即为下一个元素
+    }
+    iterator erase(iterator first_position, iterator last_position) noexcept
+    {
+      // 区间删除：后续元素整体前移 last - first 位，尾部多出的元素析构
+      if (first_position == last_position)
+      {
+        return first_position;
+      }
+      iterator write_position = first_position;
+      for (iterator read_position = last_position; read_position != _size_pointer; ++read_position, ++write_position)
+      {
+        *write_position = std::move(*read_position);
+      }
+      destroy_range(write_position, _size_pointer);
+      _size_pointer = write_position;
+      return first_position;
+    }
+    void clear() noexcept
+    {
+      destroy_range(_data_pointer, _size_pointer);
+      _size_pointer = _data_pointer;
+    }
+    small_vector &reserve(const uint64_t &new_container_capacity)
+    {
+      if (capacity() < new_container_capacity)
+      {
+        reallocate(new_container_capacity);
+      }
+      return *this;
+    }
+    small_vector &resize(const uint64_t &new_container_capacity, const vector_type &vector_data = vector_type())
+    {
+      // 容量不足时扩容，并用 vector_data 构造填满 [size, new_container_capacity)，不截断已有元素
+      if (new_container_capacity > size())
+      {
+        size_adjust(new_container_capacity, vector_data);
+      }
+      return *this;
+    }
+    template <typename... Args>
+    vector_type &emplace_back(Args &&...args)
+    {
+      if (_size_pointer != _capacity_pointer)
+      {
+        allocator_traits::construct(_allocator, _size_pointer, std::forward<Args>(args)...);
+        return *_size_pointer++;
+      }
+      // 先在新存储上构造新元素，参数可能引用旧存储中的元素
+      const uint64_t original_size = size();
+      const uint64_t new_container_capacity = growth_capacity(original_size + 1);
+      iterator new_data_pointer = allocator_traits::allocate(_allocator, new_container_capacity);
+      try
+      {
+        allocator_traits::construct(_allocator, new_data_pointer + original_size, std::forward<Args>(args)...);
+        try
+        {
+          relocate_into(new_data_pointer);
+        }
+        catch (...)
+        {
+          allocator_traits::destroy(_allocator, new_data_pointer + original_size);
+          throw;
+        }
+      }
+      catch (...)
+      {
+        allocator_traits::deallocate(_allocator, new_data_pointer, new_container_capacity);
+        throw;
+      }
+      adopt_storage(new_data_pointer, original_size + 1, new_container_capacity);
+      return tail();
+    }
+    small_vector &push_back(const vector_type &vector_type_data)
+    {
+      emplace_back(vector_type_data);
+      return *this;
+    }
+    small_vector &push_back(vector_type &&vector_type_data)
+    {
+      emplace_back(std::move(vector_type_data));
+      return *this;
+    }
+    small_vector &pop_back()
+    {
+      if (_size_pointer > _data_pointer)
+      { // 至少有一个元素
+        --_size_pointer;
+        allocator_traits::destroy(_allocator, _size_pointer);
+      }
+      return *this;
+    }
+    small_vector &push_front(const vector_type &vector_type_data)
+    {
+      // 头插：先复制参数，扩容或移动后它可能失效
+      vector_type front_data(vector_type_data);
+      if (_size_pointer == _data_pointer)
+      {
+        emplace_back(std::move(front_data));
+        return *this;
+      }
+      emplace_back(std::move(tail()));
+      for (iterator move_position = _size_pointer - 2; move_position != _data_pointer; --move_position)
+      {
+        *move_position = std::move(*(move_position - 1));
+      }
+      *_data_pointer = std::move(front_data);
+      return *this;
+    }
+    small_vector &pop_front()
+    {
+      if (size() > 0)
+      {
+        erase(_data_pointer);
+      }
+      return *this;
+    }
+    vector_type &operator[](const uint64_t &access_location)
+    {
+      try
+      {
+        if (access_location >= size())
+        {
+          throw custom_exception::fault("传入参数越界", "small_vector::operator[]", __LINE__);
+        }
+        else
+        {
+          return _data_pointer[access_location];
+        }
+      }
+      catch (const custom_exception::fault &process)
+      {
+        std::cerr << process.what() << " " << process.function_name_get() << " " << process.line_number_get() << std::endl;
+        throw;
+      }
+    }
+    const vector_type &operator[](const uint64_t &access_location) const
+    {
+      try
+      {
+        if (access_location >= size())
+        {
+          throw custom_exception::fault("传入参数越界", "small_vector::operator[]", __LINE__);
+        }
+        else
+        {
+          return _data_pointer[access_location];
+        }
+      }
+      catch (const custom_exception::fault &process)
+      {
+        std::cerr << process.what() << " " << process.function_name_get() << " " << process.line_number_get() << std::endl;
+        throw;
+      }
+    }
+    small_vector &operator=(const small_vector &vector_data)
+    {
+      if (this != &vector_data)
+      {
+        small_vector return_vector_object(vector_data); // 拷贝构造
+        *this = std::move(return_vector_object);
+      }
+      return *this;
+    }
+    small_vector &operator=(small_vector &&vector_mobile_data) noexcept(nothrow_move_assignable)
+    {
+      if (this != &vector_mobile_data)
+      {
+        destroy_range(_data_pointer, _size_pointer);
+        deallocate_storage();
+        if constexpr (allocator_traits::propagate_on_container_move_assignment::value)
+        {
+          _allocator = std::move(vector_mobile_data._allocator);
+        }
+        steal_elements(vector_mobile_data);
+      }
+      return *this;
+    }
+    small_vector &operator+=(const small_vector &vector_data)
+    {
+      const uint64_t vector_data_size = vector_data.size();
+      if (vector_data_size == 0)
+      {
+        return *this;
       }
+      const uint64_t container_size = size();
+      reserve(container_size + vector_data_size); // 自拼接时扩容后 vector_data 指向的同样是新存储
+      construct_copies(vector_data._data_pointer, vector_data._data_pointer + vector_data_size, _size_pointer);
       _size_pointer = _data_pointer + (vector_data_size + container_size);
       return *this;
     }
-    template <typename const_vector_output_templates>
-    friend std::ostream &operator<<(std::ostream &vector_ostream, const vector<const_vector_output_templates> &dynamic_arrays_data);
   };
-  template <typename const_vector_output_templates>
-  std::ostream &operator<<(std::ostream &vector_ostream, const vector<const_vector_output_templates> &dynamic_arrays_data)
+  template <typename const_vector_output_templates, uint64_t const_vector_output_capacity, typename const_vector_output_allocator>
+  std::ostream &operator<<(std::ostream &vector_ostream, const small_vector<const_vector_output_templates, const_vector_output_capacity, const_vector_output_allocator> &dynamic_arrays_data)
   {
     for (uint64_t input_traversal = 0; input_traversal < dynamic_arrays_data.size(); input_traversal++)
     {
@@ -483,4 +1405,5 @@ namespace vector_container
 namespace standard_con
 {
   using vector_container::vector;
+  using vector_container::small_vector;
 }
\ No newline at end of file
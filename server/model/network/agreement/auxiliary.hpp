@@ -14,6 +14,7 @@
 #include <boost/json.hpp>
 #include "./json.hpp"
 #include "../crypt/encryption.hpp"
+#include "../../container/simulate_perfect.hpp"
 
 
 
@@ -49,6 +50,82 @@ namespace protocol::auxiliary
     CUSTOM
   }; // end enum class checksum_type
 
+  /**
+   * @brief 需要单独处理的头部字段
+   * @details 解析器按字段名查表得到枚举后分派，不再逐个比较字符串
+   */
+  enum class special_header : std::uint8_t
+  {
+    NONE,       // 普通头部字段
+    USER_AGENT, // `User-Agent`
+    SERVER,     // `Server`
+    TIMESTAMP   // `Timestamp`
+  }; // end enum class special_header
+
+  /**
+   * @brief 特殊头部字段名表，编译期构建的完美哈希表
+   */
+  inline constexpr auto special_header_map = standard_con::make_perfect_hash_map<std::string_view, special_header>({
+      {"User-Agent", special_header::USER_AGENT},
+      {"Server", special_header::SERVER},
+      {"Timestamp", special_header::TIMESTAMP},
+  });
+
+  /**
+   * @brief 查找头部字段名对应的特殊字段
+   * @param name 字段名（区分大小写）
+   * @return 特殊字段枚举，不在表中时返回 `special_header::NONE`
+   */
+  constexpr special_header classify_header(std::string_view name) noexcept
+  {
+    return special_header_map.value_or(name, special_header::NONE);
+  }
+
+  /**
+   * @brief 状态码到原因短语的映射，编译期构建的完美哈希表
+   */
+  inline constexpr auto status_reason_map = standard_con::make_perfect_hash_map<std::uint16_t, std::string_view>({
+      {100, "Continue"},
+      {101, "Switching Protocols"},
+      {200, "OK"},
+      {201, "Created"},
+      {202, "Accepted"},
+      {204, "No Content"},
+      {206, "Partial Content"},
+      {301, "Moved Permanently"},
+      {302, "Found"},
+      {304, "Not Modified"},
+      {307, "Temporary Redirect"},
+      {308, "Permanent Redirect"},
+      {400, "Bad Request"},
+      {401, "Unauthorized"},
+      {403, "Forbidden"},
+      {404, "Not Found"},
+      {405, "Method Not Allowed"},
+      {408, "Request Timeout"},
+      {409, "Conflict"},
+      {411, "Length Required"},
+      {413, "Payload Too Large"},
+      {414, "URI Too Long"},
+      {415, "Unsupported Media Type"},
+      {429, "Too Many Requests"},
+      {500, "Internal Server Error"},
+      {501, "Not Implemented"},
+      {502, "Bad Gateway"},
+      {503, "Service Unavailable"},
+      {504, "Gateway Timeout"},
+  });
+
+  /**
+   * @brief 获取状态码的标准原因短语
+   * @param status_code 状态码
+   * @return 原因短语，未收录的状态码返回 `"Unknown"`
+   */
+  constexpr std::string_view status_reason(std::uint16_t status_code) noexcept
+  {
+    return status_reason_map.value_or(status_code, "Unknown");
+  }
+
   /**
    * @brief 协议头基类
    * @details 提供协议头的基础接口，支持自定义协议类型
@@ -0,0 +1,1578 @@
+/**
+ * @file http2.hpp
+ * @brief `HTTP/2` 协议实现
+ * @details 提供帧编解码、`HPACK` 头部压缩与不依赖 `IO` 的服务端连接状态机，
+ *  连接状态机把收到的字节切成帧、按流组装成 `http::request<>`，再把 `http::response<>` 编码成帧
+ */
+#pragma once
+#include <array>
+#include <deque>
+#include <string>
+#include <vector>
+#include <cctype>
+#include <cstdint>
+#include <algorithm>
+#include <functional>
+#include <string_view>
+#include <unordered_map>
+#include "./http.hpp"
+#include "../../container/simulate_perfect.hpp"
+
+namespace protocol
+{
+  namespace http2 {}
+} // end namespace protocol
+
+namespace protocol::http2
+{
+  /**
+   * @brief 客户端连接前言，明文 `h2c` 以此识别 `HTTP/2` 连接
+   */
+  inline constexpr std::string_view connection_preface = "PRI * HTTP/2.0\r\n\r\nSM\r\n\r\n";
+  inline constexpr std::size_t frame_header_size = 9;            // 帧头固定长度
+  inline constexpr std::uint32_t default_window_size = 65535;     // 协议规定的初始窗口
+  inline constexpr std::uint32_t default_frame_size = 16384;      // 协议规定的初始最大帧长
+  inline constexpr std::int64_t max_window_size = 0x7fffffff;     // 流量控制窗口上限
+
+  /**
+   * @brief 帧类型
+   */
+  enum class frame_type : std::uint8_t
+  {
+    DATA = 0x0,
+    HEADERS = 0x1,
+    PRIORITY = 0x2,
+    RST_STREAM = 0x3,
+    SETTINGS = 0x4,
+    PUSH_PROMISE = 0x5,
+    PING = 0x6,
+    GOAWAY = 0x7,
+    WINDOW_UPDATE = 0x8,
+    CONTINUATION = 0x9,
+    PRIORITY_UPDATE = 0x10 // `RFC 9218` 可扩展优先级
+  }; // end enum class frame_type
+
+  /**
+   * @brief 帧标志位
+   */
+  struct frame_flag
+  {
+    static constexpr std::uint8_t END_STREAM = 0x01;
+    static constexpr std::uint8_t ACK = 0x01;
+    static constexpr std::uint8_t END_HEADERS = 0x04;
+    static constexpr std::uint8_t PADDED = 0x08;
+    static constexpr std::uint8_t PRIORITY = 0x20;
+  }; // end struct frame_flag
+
+  /**
+   * @brief 错误码，用于 `RST_STREAM` 与 `GOAWAY`
+   */
+  enum class error_type : std::uint32_t
+  {
+    NONE = 0x0, // 正常关闭
+    PROTOCOL_ERROR = 0x1,
+    INTERNAL_ERROR = 0x2,
+    FLOW_CONTROL_ERROR = 0x3,
+    SETTINGS_TIMEOUT = 0x4,
+    STREAM_CLOSED = 0x5,
+    FRAME_SIZE_ERROR = 0x6,
+    REFUSED_STREAM = 0x7,
+    CANCEL = 0x8,
+    COMPRESSION_ERROR = 0x9,
+    CONNECT_ERROR = 0xa,
+    ENHANCE_YOUR_CALM = 0xb,
+    INADEQUATE_SECURITY = 0xc,
+    HTTP_1_1_REQUIRED = 0xd
+  }; // end enum class error_type
+
+  /**
+   * @brief `SETTINGS` 参数标识
+   */
+  enum class settings_id : std::uint16_t
+  {
+    HEADER_TABLE_SIZE = 0x1,
+    ENABLE_PUSH = 0x2,
+    MAX_CONCURRENT_STREAMS = 0x3,
+    INITIAL_WINDOW_SIZE = 0x4,
+    MAX_FRAME_SIZE = 0x5,
+    MAX_HEADER_LIST_SIZE = 0x6
+  }; // end enum class settings_id
+
+  /**
+   * @brief 头部字段，名称均为小写
+   */
+  struct header_field
+  {
+    std::string _name;
+    std::string _value;
+  }; // end struct header_field
+
+  /**
+   * @brief 帧头
+   * @details 24 位长度、8 位类型、8 位标志、1 位保留位与 31 位流标识，均为网络字节序
+   */
+  struct frame_header
+  {
+    std::uint32_t _length{0};
+    frame_type _type{frame_type::DATA};
+    std::uint8_t _flags{0};
+    std::uint32_t _stream_id{0};
+
+    /**
+     * @brief 从至少 9 字节的数据中解析帧头
+     * @param bytes 帧数据起始位置
+     * @return 帧头
+     */
+    static frame_header parse(std::string_view bytes) noexcept
+    {
+      auto byte_at = [&bytes](std::size_t index) { return static_cast<std::uint32_t>(static_cast<unsigned char>(bytes[index])); };
+      frame_header header;
+      header._length = byte_at(0) << 16 | byte_at(1) << 8 | byte_at(2);
+      header._type = static_cast<frame_type>(byte_at(3));
+      header._flags = static_cast<std::uint8_t>(byte_at(4));
+      header._stream_id = (byte_at(5) << 24 | byte_at(6) << 16 | byte_at(7) << 8 | byte_at(8)) & 0x7fffffffu;
+      return header;
+    }
+    /**
+     * @brief 把帧头追加写入输出缓冲
+     * @param out 输出缓冲
+     */
+    void write(std::string &out) const
+    {
+      out.push_back(static_cast<char>(_length >> 16 & 0xff));
+      out.push_back(static_cast<char>(_length >> 8 & 0xff));
+      out.push_back(static_cast<char>(_length & 0xff));
+      out.push_back(static_cast<char>(_type));
+      out.push_back(static_cast<char>(_flags));
+      out.push_back(static_cast<char>(_stream_id >> 24 & 0x7f));
+      out.push_back(static_cast<char>(_stream_id >> 16 & 0xff));
+      out.push_back(static_cast<char>(_stream_id >> 8 & 0xff));
+      out.push_back(static_cast<char>(_stream_id & 0xff));
+    }
+  }; // end struct frame_header
+
+  /**
+   * @brief 读取网络字节序的 32 位整数
+   */
+  inline std::uint32_t read_uint32(std::string_view bytes) noexcept
+  {
+    return static_cast<std::uint32_t>(static_cast<unsigned char>(bytes[0])) << 24 |
+           static_cast<std::uint32_t>(static_cast<unsigned char>(bytes[1])) << 16 |
+           static_cast<std::uint32_t>(static_cast<unsigned char>(bytes[2])) << 8 |
+           static_cast<std::uint32_t>(static_cast<unsigned char>(bytes[3]));
+  }
+  /**
+   * @brief 追加网络字节序的 32 位整数
+   */
+  inline void write_uint32(std::string &out, std::uint32_t value)
+  {
+    out.push_back(static_cast<char>(value >> 24 & 0xff));
+    out.push_back(static_cast<char>(value >> 16 & 0xff));
+    out.push_back(static_cast<char>(value >> 8 & 0xff));
+    out.push_back(static_cast<char>(value & 0xff));
+  }
+  /**
+   * @brief 追加一个完整的帧
+   * @param out 输出缓冲
+   * @param type 帧类型
+   * @param flags 标志位
+   * @param stream_id 流标识
+   * @param payload 负载
+   */
+  inline void write_frame(std::string &out, frame_type type, std::uint8_t flags, std::uint32_t stream_id, std::string_view payload)
+  {
+    frame_header{static_cast<std::uint32_t>(payload.size()), type, flags, stream_id}.write(out);
+    out.append(payload);
+  }
+} // end namespace protocol::http2
+
+namespace protocol::http2::hpack
+{
+  inline constexpr std::size_t entry_overhead = 32; // 动态表条目的额外开销（`RFC 7541` 4.1）
+
+  /**
+   * @brief 静态表条目
+   */
+  struct static_entry
+  {
+    std::string_view _name;
+    std::string_view _value;
+  }; // end struct static_entry
+
+  /**
+   * @brief 静态表（`RFC 7541` 附录 A），下标 0 对应索引 1
+   */
+  inline constexpr static_entry static_table[] = {
+      {":authority", ""}, {":method", "GET"}, {":method", "POST"}, {":path", "/"},
+      {":path", "/index.html"}, {":scheme", "http"}, {":scheme", "https"}, {":status", "200"},
+      {":status", "204"}, {":status", "206"}, {":status", "304"}, {":status", "400"},
+      {":status", "404"}, {":status", "500"}, {"accept-charset", ""}, {"accept-encoding", "gzip, deflate"},
+      {"accept-language", ""}, {"accept-ranges", ""}, {"accept", ""}, {"access-control-allow-origin", ""},
+      {"age", ""}, {"allow", ""}, {"authorization", ""}, {"cache-control", ""},
+      {"content-disposition", ""}, {"content-encoding", ""}, {"content-language", ""}, {"content-length", ""},
+      {"content-location", ""}, {"content-range", ""}, {"content-type", ""}, {"cookie", ""},
+      {"date", ""}, {"etag", ""}, {"expect", ""}, {"expires", ""},
+      {"from", ""}, {"host", ""}, {"if-match", ""}, {"if-modified-since", ""},
+      {"if-none-match", ""}, {"if-range", ""}, {"if-unmodified-since", ""}, {"last-modified", ""},
+      {"link", ""}, {"location", ""}, {"max-forwards", ""}, {"proxy-authenticate", ""},
+      {"proxy-authorization", ""}, {"range", ""}, {"referer", ""}, {"refresh", ""},
+      {"retry-after", ""}, {"server", ""}, {"set-cookie", ""}, {"strict-transport-security", ""},
+      {"transfer-encoding", ""}, {"user-agent", ""}, {"vary", ""}, {"via", ""},
+      {"www-authenticate", ""},
+  };
+  inline constexpr std::size_t static_table_size = std::size(static_table);
+
+  /**
+   * @brief 字段名到静态表中首个同名条目索引的映射，编译期构建的完美哈希表
+   */
+  inline constexpr auto static_name_map = standard_con::make_perfect_hash_map<std::string_view, std::uint8_t>({
+      {":authority", 1}, {":method", 2}, {":path", 4}, {":scheme", 6}, {":status", 8},
+      {"accept-charset", 15}, {"accept-encoding", 16}, {"accept-language", 17}, {"accept-ranges", 18},
+      {"accept", 19}, {"access-control-allow-origin", 20}, {"age", 21}, {"allow", 22},
+      {"authorization", 23}, {"cache-control", 24}, {"content-disposition", 25}, {"content-encoding", 26},
+      {"content-language", 27}, {"content-length", 28}, {"content-location", 29}, {"content-range", 30},
+      {"content-type", 31}, {"cookie", 32}, {"date", 33}, {"etag", 34}, {"expect", 35}, {"expires", 36},
+      {"from", 37}, {"host", 38}, {"if-match", 39}, {"if-modified-since", 40}, {"if-none-match", 41},
+      {"if-range", 42}, {"if-unmodified-since", 43}, {"last-modified", 44}, {"link", 45}, {"location", 46},
+      {"max-forwards", 47}, {"proxy-authenticate", 48}, {"proxy-authorization", 49}, {"range", 50},
+      {"referer", 51}, {"refresh", 52}, {"retry-after", 53}, {"server", 54}, {"set-cookie", 55},
+      {"strict-transport-security", 56}, {"transfer-encoding", 57}, {"user-agent", 58}, {"vary", 59},
+      {"via", 60}, {"www-authenticate", 61},
+  });
+
+  /**
+   * @brief 哈夫曼码表条目，码字右对齐存放
+   */
+  struct huffman_code
+  {
+    std::uint32_t _code;
+    std::uint8_t _bits;
+  }; // end struct huffman_code
+
+  /**
+   * @brief 哈夫曼码表（`RFC 7541` 附录 B），下标为符号，256 为 `EOS`
+   */
+  inline constexpr huffman_code huffman_table[257] = {
+      {0x1ff8, 13}, {0x7fffd8, 23}, {0xfffffe2, 28}, {0xfffffe3, 28},
+      {0xfffffe4, 28}, {0xfffffe5, 28}, {0xfffffe6, 28}, {0xfffffe7, 28},
+      {0xfffffe8, 28}, {0xffffea, 24}, {0x3ffffffc, 30}, {0xfffffe9, 28},
+      {0xfffffea, 28}, {0x3ffffffd, 30}, {0xfffffeb, 28}, {0xfffffec, 28},
+      {0xfffffed, 28}, {0xfffffee, 28}, {0xfffffef, 28}, {0xffffff0, 28},
+      {0xffffff1, 28}, {0xffffff2, 28}, {0x3ffffffe, 30}, {0xffffff3, 28},
+      {0xffffff4, 28}, {0xffffff5, 28}, {0xffffff6, 28}, {0xffffff7, 28},
+      {0xffffff8, 28}, {0xffffff9, 28}, {0xffffffa, 28}, {0xffffffb, 28},
+      {0x14, 6}, {0x3f8, 10}, {0x3f9, 10}, {0xffa, 12},
+      {0x1ff9, 13}, {0x15, 6}, {0xf8, 8}, {0x7fa, 11},
+      {0x3fa, 10}, {0x3fb, 10}, {0xf9, 8}, {0x7fb, 11},
+      {0xfa, 8}, {0x16, 6}, {0x17, 6}, {0x18, 6},
+      {0x0, 5}, {0x1, 5}, {0x2, 5}, {0x19, 6},
+      {0x1a, 6}, {0x1b, 6}, {0x1c, 6}, {0x1d, 6},
+      {0x1e, 6}, {0x1f, 6}, {0x5c, 7}, {0xfb, 8},
+      {0x7ffc, 15}, {0x20, 6}, {0xffb, 12}, {0x3fc, 10},
+      {0x1ffa, 13}, {0x21, 6}, {0x5d, 7}, {0x5e, 7},
+      {0x5f, 7}, {0x60, 7}, {0x61, 7}, {0x62, 7},
+      {0x63, 7}, {0x64, 7}, {0x65, 7}, {0x66, 7},
+      {0x67, 7}, {0x68, 7}, {0x69, 7}, {0x6a, 7},
+      {0x6b, 7}, {0x6c, 7}, {0x6d, 7}, {0x6e, 7},
+      {0x6f, 7}, {0x70, 7}, {0x71, 7}, {0x72, 7},
+      {0xfc, 8}, {0x73, 7}, {0xfd, 8}, {0x1ffb, 13},
+      {0x7fff0, 19}, {0x1ffc, 13}, {0x3ffc, 14}, {0x22, 6},
+      {0x7ffd, 15}, {0x3, 5}, {0x23, 6}, {0x4, 5},
+      {0x24, 6}, {0x5, 5}, {0x25, 6}, {0x26, 6},
+      {0x27, 6}, {0x6, 5}, {0x74, 7}, {0x75, 7},
+      {0x28, 6}, {0x29, 6}, {0x2a, 6}, {0x7, 5},
+      {0x2b, 6}, {0x76, 7}, {0x2c, 6}, {0x8, 5},
+      {0x9, 5}, {0x2d, 6}, {0x77, 7}, {0x78, 7},
+      {0x79, 7}, {0x7a, 7}, {0x7b, 7}, {0x7ffe, 15},
+      {0x7fc, 11}, {0x3ffd, 14}, {0x1ffd, 13}, {0xffffffc, 28},
+      {0xfffe6, 20}, {0x3fffd2, 22}, {0xfffe7, 20}, {0xfffe8, 20},
+      {0x3fffd3, 22}, {0x3fffd4, 22}, {0x3fffd5, 22}, {0x7fffd9, 23},
+      {0x3fffd6, 22}, {0x7fffda, 23}, {0x7fffdb, 23}, {0x7fffdc, 23},
+      {0x7fffdd, 23}, {0x7fffde, 23}, {0xffffeb, 24}, {0x7fffdf, 23},
+      {0xffffec, 24}, {0xffffed, 24}, {0x3fffd7, 22}, {0x7fffe0, 23},
+      {0xffffee, 24}, {0x7fffe1, 23}, {0x7fffe2, 23}, {0x7fffe3, 23},
+      {0x7fffe4, 23}, {0x1fffdc, 21}, {0x3fffd8, 22}, {0x7fffe5, 23},
+      {0x3fffd9, 22}, {0x7fffe6, 23}, {0x7fffe7, 23}, {0xffffef, 24},
+      {0x3fffda, 22}, {0x1fffdd, 21}, {0xfffe9, 20}, {0x3fffdb, 22},
+      {0x3fffdc, 22}, {0x7fffe8, 23}, {0x7fffe9, 23}, {0x1fffde, 21},
+      {0x7fffea, 23}, {0x3fffdd, 22}, {0x3fffde, 22}, {0xfffff0, 24},
+      {0x1fffdf, 21}, {0x3fffdf, 22}, {0x7fffeb, 23}, {0x7fffec, 23},
+      {0x1fffe0, 21}, {0x1fffe1, 21}, {0x3fffe0, 22}, {0x1fffe2, 21},
+      {0x7fffed, 23}, {0x3fffe1, 22}, {0x7fffee, 23}, {0x7fffef, 23},
+      {0xfffea, 20}, {0x3fffe2, 22}, {0x3fffe3, 22}, {0x3fffe4, 22},
+      {0x7ffff0, 23}, {0x3fffe5, 22}, {0x3fffe6, 22}, {0x7ffff1, 23},
+      {0x3ffffe0, 26}, {0x3ffffe1, 26}, {0xfffeb, 20}, {0x7fff1, 19},
+      {0x3fffe7, 22}, {0x7ffff2, 23}, {0x3fffe8, 22}, {0x1ffffec, 25},
+      {0x3ffffe2, 26}, {0x3ffffe3, 26}, {0x3ffffe4, 26}, {0x7ffffde, 27},
+      {0x7ffffdf, 27}, {0x3ffffe5, 26}, {0xfffff1, 24}, {0x1ffffed, 25},
+      {0x7fff2, 19}, {0x1fffe3, 21}, {0x3ffffe6, 26}, {0x7ffffe0, 27},
+      {0x7ffffe1, 27}, {0x3ffffe7, 26}, {0x7ffffe2, 27}, {0xfffff2, 24},
+      {0x1fffe4, 21}, {0x1fffe5, 21}, {0x3ffffe8, 26}, {0x3ffffe9, 26},
+      {0xffffffd, 28}, {0x7ffffe3, 27}, {0x7ffffe4, 27}, {0x7ffffe5, 27},
+      {0xfffec, 20}, {0xfffff3, 24}, {0xfffed, 20}, {0x1fffe6, 21},
+      {0x3fffe9, 22}, {0x1fffe7, 21}, {0x1fffe8, 21}, {0x7ffff3, 23},
+      {0x3fffea, 22}, {0x3fffeb, 22}, {0x1ffffee, 25}, {0x1ffffef, 25},
+      {0xfffff4, 24}, {0xfffff5, 24}, {0x3ffffea, 26}, {0x7ffff4, 23},
+      {0x3ffffeb, 26}, {0x7ffffe6, 27}, {0x3ffffec, 26}, {0x3ffffed, 26},
+      {0x7ffffe7, 27}, {0x7ffffe8, 27}, {0x7ffffe9, 27}, {0x7ffffea, 27},
+      {0x7ffffeb, 27}, {0xffffffe, 28}, {0x7ffffec, 27}, {0x7ffffed, 27},
+      {0x7ffffee, 27}, {0x7ffffef, 27}, {0x7fffff0, 27}, {0x3ffffee, 26},
+      {0x3fffffff, 30},
+  };
+
+  /**
+   * @brief 哈夫曼解码树
+   * @details 由码表构建一次；子节点为正数时是内部节点下标，负数时是 -(符号 + 1)，0 表示不存在的分支
+   */
+  class huffman_tree
+  {
+  private:
+    std::vector<std::array<std::int16_t, 2>> _children;
+
+  public:
+    huffman_tree()
+    {
+      _children.reserve(256);
+      _children.push_back({0, 0});
+      for (std::size_t symbol = 0; symbol < std::size(huffman_table); ++symbol)
+      {
+        const auto [code, bits] = huffman_table[symbol];
+        std::size_t node = 0;
+        for (int bit_index = bits - 1; bit_index > 0; --bit_index)
+        {
+          const std::size_t branch = code >> bit_index & 1u;
+          if (_children[node][branch] == 0)
+          {
+            _children[node][branch] = static_cast<std::int16_t>(_children.size());
+            _children.push_back({0, 0});
+          }
+          node = static_cast<std::size_t>(_children[node][branch]);
+        }
+        _children[node][code & 1u] = static_cast<std::int16_t>(-static_cast<int>(symbol) - 1);
+      }
+    }
+    /**
+     * @brief 解码哈夫曼编码的字符串
+     * @param data 编码数据
+     * @param out 追加解码结果
+     * @return 数据合法返回 `true`；出现 `EOS`、填充超过 7 位或填充不全为 1 时返回 `false`
+     */
+    bool decode(std::string_view data, std::string &out) const
+    {
+      std::size_t node = 0;
+      std::size_t pending_bits = 0; // 自上一个完整符号以来读过的位数
+      bool all_ones = true;
+      for (const char byte : data)
+      {
+        for (int bit_index = 7; bit_index >= 0; --bit_index)
+        {
+          const std::size_t branch = static_cast<unsigned char>(byte) >> bit_index & 1u;
+          const std::int16_t next = _children[node][branch];
+          if (next == 0)
+            return false;
+          if (next < 0)
+          {
+            const int symbol = -next - 1;
+            if (symbol == 256)
+              return false;
+            out.push_back(static_cast<char>(symbol));
+            node = 0;
+            pending_bits = 0;
+            all_ones = true;
+          }
+          else
+          {
+            node = static_cast<std::size_t>(next);
+            ++pending_bits;
+            all_ones = all_ones && branch == 1;
+          }
+        }
+      }
+      return pending_bits <= 7 && all_ones;
+    }
+  }; // end class huffman_tree
+
+  /**
+   * @brief 获取全局共享的哈夫曼解码树
+   */
+  inline const huffman_tree &huffman_decoder()
+  {
+    static const huffman_tree tree;
+    return tree;
+  }
+  /**
+   * @brief 计算哈夫曼编码后的字节数
+   */
+  inline std::size_t huffman_length(std::string_view data) noexcept
+  {
+    std::size_t bits = 0;
+    for (const char byte : data)
+      bits += huffman_table[static_cast<unsigned char>(byte)]._bits;
+    return (bits + 7) / 8;
+  }
+  /**
+   * @brief 哈夫曼编码，末尾不足一字节的部分以 `EOS` 前缀（全 1）填充
+   * @param data 原始数据
+   * @param out 追加编码结果
+   */
+  inline void huffman_encode(std::string_view data, std::string &out)
+  {
+    std::uint64_t accumulator = 0;
+    std::uint32_t bit_count = 0;
+    for (const char byte : data)
+    {
+      const auto [code, bits] = huffman_table[static_cast<unsigned char>(byte)];
+      accumulator = accumulator << bits | code;
+      bit_count += bits;
+      while (bit_count >= 8)
+      {
+        bit_count -= 8;
+        out.push_back(static_cast<char>(accumulator >> bit_count & 0xff));
+      }
+      accumulator &= (std::uint64_t{1} << bit_count) - 1;
+    }
+    if (bit_count > 0)
+      out.push_back(static_cast<char>((accumulator << (8 - bit_count) | 0xffu >> bit_count) & 0xff));
+  }
+
+  /**
+   * @brief 按前缀整数格式编码（`RFC 7541` 5.1）
+   * @param out 输出缓冲
+   * @param pattern 首字节中前缀以外的高位
+   * @param prefix_bits 前缀位数
+   * @param value 整数值
+   */
+  inline void encode_integer(std::string &out, std::uint8_t pattern, std::uint8_t prefix_bits, std::uint64_t value)
+  {
+    const std::uint64_t prefix_max = (std::uint64_t{1} << prefix_bits) - 1;
+    if (value < prefix_max)
+    {
+      out.push_back(static_cast<char>(pattern | value));
+      return;
+    }
+    out.push_back(static_cast<char>(pattern | prefix_max));
+    value -= prefix_max;
+    while (value >= 0x80)
+    {
+      out.push_back(static_cast<char>((value & 0x7f) | 0x80));
+      value >>= 7;
+    }
+    out.push_back(static_cast<char>(value));
+  }
+  /**
+   * @brief 解码前缀整数
+   * @param data 头部块
+   * @param position 读取位置，成功后移动到整数之后
+   * @param prefix_bits 前缀位数
+   * @param value 解码结果
+   * @return 数据完整且不超过 32 位时返回 `true`
+   */
+  inline bool decode_integer(std::string_view data, std::size_t &position, std::uint8_t prefix_bits, std::uint64_t &value)
+  {
+    if (position >= data.size())
+      return false;
+    const std::uint64_t prefix_max = (std::uint64_t{1} << prefix_bits) - 1;
+    value = static_cast<unsigned char>(data[position++]) & prefix_max;
+    if (value < prefix_max)
+      return true;
+    for (std::uint32_t shift = 0; position < data.size(); shift += 7)
+    {
+      if (shift > 28)
+        return false;
+      const auto byte = static_cast<unsigned char>(data[position++]);
+      value += static_cast<std::uint64_t>(byte & 0x7f) << shift;
+      if ((byte & 0x80) == 0)
+        return value <= 0xffffffffu;
+    }
+    return false;
+  }
+  /**
+   * @brief 编码字符串字面量，哈夫曼编码更短时使用哈夫曼编码
+   */
+  inline void encode_string(std::string &out, std::string_view value)
+  {
+    const std::size_t compressed = huffman_length(value);
+    if (compressed < value.size())
+    {
+      encode_integer(out, 0x80, 7, compressed);
+      huffman_encode(value, out);
+    }
+    else
+    {
+      encode_integer(out, 0x00, 7, value.size());
+      out.append(value);
+    }
+  }
+  /**
+   * @brief 解码字符串字面量
+   * @param data 头部块
+   * @param position 读取位置
+   * @param out 解码结果
+   * @return 数据合法时返回 `true`
+   */
+  inline bool decode_string(std::string_view data, std::size_t &position, std::string &out)
+  {
+    if (position >= data.size())
+      return false;
+    const bool huffman = (static_cast<unsigned char>(data[position]) & 0x80) != 0;
+    std::uint64_t length = 0;
+    if (!decode_integer(data, position, 7, length) || length > data.size() - position)
+      return false;
+    const std::string_view raw = data.substr(position, static_cast<std::size_t>(length));
+    position += static_cast<std::size_t>(length);
+    out.clear();
+    if (!huffman)
+    {
+      out.assign(raw);
+      return true;
+    }
+    return huffman_decoder().decode(raw, out);
+  }
+
+  /**
+   * @brief 动态表
+   * @details 新条目插入表头，索引从 `static_table_size + 1` 开始；超出容量时从表尾淘汰
+   */
+  class dynamic_table
+  {
+  private:
+    std::deque<header_field> _entries;
+    std::size_t _size{0};
+    std::size_t _capacity{4096};
+
+    void _evict_to(std::size_t limit)
+    {
+      while (_size > limit && !_entries.empty())
+      {
+        _size -= _entries.back()._name.size() + _entries.back()._value.size() + entry_overhead;
+        _entries.pop_back();
+      }
+    }
+
+  public:
+    std::size_t size() const noexcept { return _size; }
+    std::size_t capacity() const noexcept { return _capacity; }
+    std::size_t count() const noexcept { return _entries.size(); }
+
+    /**
+     * @brief 调整容量，必要时淘汰旧条目
+     */
+    void resize(std::size_t capacity)
+    {
+      _capacity = capacity;
+      _evict_to(_capacity);
+    }
+    /**
+     * @brief 插入条目；条目本身大于容量时清空整张表（`RFC 7541` 4.4）
+     */
+    void insert(std::string_view name, std::string_view value)
+    {
+      const std::size_t entry_size = name.size() + value.size() + entry_overhead;
+      if (entry_size > _capacity)
+      {
+        _entries.clear();
+        _size = 0;
+        return;
+      }
+      _evict_to(_capacity - entry_size);
+      _entries.push_front(header_field{std::string(name), std::string(value)});
+      _size += entry_size;
+    }
+    /**
+     * @brief 按动态表内的相对位置取条目，0 为最新条目
+     */
+    const header_field &at(std::size_t offset) const { return _entries[offset]; }
+  }; // end class dynamic_table
+
+  /**
+   * @brief `HPACK` 解码器
+   * @details 每个连接一个，头部块必须按收到的顺序解码
+   */
+  class decoder
+  {
+  private:
+    dynamic_table _table;
+    std::size_t _max_capacity; // 本端在 `SETTINGS_HEADER_TABLE_SIZE` 中允许的上限
+
+    bool _lookup(std::uint64_t index, std::string &name, std::string *value) const
+    {
+      if (index == 0)
+        return false;
+      if (index <= static_table_size)
+      {
+        name.assign(static_table[index - 1]._name);
+        if (value)
+          value->assign(static_table[index - 1]._value);
+        return true;
+      }
+      const std::uint64_t offset = index - static_table_size - 1;
+      if (offset >= _table.count())
+        return false;
+      name = _table.at(static_cast<std::size_t>(offset))._name;
+      if (value)
+        *value = _table.at(static_cast<std::size_t>(offset))._value;
+      return true;
+    }
+
+  public:
+    explicit decoder(std::size_t max_capacity = 4096) : _max_capacity(max_capacity) { _table.resize(max_capacity); }
+
+    /**
+     * @brief 解码一个完整的头部块
+     * @param block 头部块（`HEADERS` 与后续 `CONTINUATION` 负载拼接而成）
+     * @param fields 追加解码出的字段
+     * @return 成功返回 `true`；失败时调用方应以 `COMPRESSION_ERROR` 关闭连接
+     */
+    bool decode(std::string_view block, std::vector<header_field> &fields)
+    {
+      std::size_t position = 0;
+      bool field_seen = false;
+      while (position < block.size())
+      {
+        const auto first = static_cast<unsigned char>(block[position]);
+        std::uint64_t index = 0;
+        header_field field;
+        if (first & 0x80) // 已索引字段
+        {
+          if (!decode_integer(block, position, 7, index) || !_lookup(index, field._name, &field._value))
+            return false;
+          fields.push_back(std::move(field));
+          field_seen = true;
+          continue;
+        }
+        if ((first & 0xe0) == 0x20) // 动态表容量更新，只能出现在块首
+        {
+          if (field_seen || !decode_integer(block, position, 5, index) || index > _max_capacity)
+            return false;
+          _table.resize(static_cast<std::size_t>(index));
+          continue;
+        }
+        const bool incremental = (first & 0xc0) == 0x40;
+        if (!decode_integer(block, position, incremental ? 6 : 4, index))
+          return false;
+        if (index != 0 ? !_lookup(index, field._name, nullptr) : !decode_string(block, position, field._name))
+          return false;
+        if (!decode_string(block, position, field._value))
+          return false;
+        if (incremental)
+          _table.insert(field._name, field._value);
+        fields.push_back(std::move(field));
+        field_seen = true;
+      }
+      return true;
+    }
+  }; // end class decoder
+
+  /**
+   * @brief `HPACK` 编码器
+   * @details 优先输出完整匹配的索引；可复用的字段以增量索引写入动态表，
+   *  每次响应都不同的字段（长度、日期、实体标签等）不入表，敏感字段标记为永不索引
+   */
+  class encoder
+  {
+  private:
+    dynamic_table _table;
+    std::size_t _pending_minimum{0};   // 两次头部块之间出现过的最小容量
+    bool _pending_update{false};       // 下一个头部块需要先输出容量更新
+
+    static bool _indexable(std::string_view name) noexcept
+    {
+      return name != "content-length" && name != "date" && name != "etag" && name != "last-modified" &&
+             name != "age" && name != "expires" && name != "location" && !_sensitive(name);
+    }
+    static bool _sensitive(std::string_view name) noexcept
+    {
+      return name == "set-cookie" || name == "authorization" || name == "proxy-authorization";
+    }
+
+    void _encode_field(std::string &out, std::string_view name, std::string_view value)
+    {
+      std::uint64_t name_index = 0;
+      if (const std::uint8_t *first = static_name_map.find(name))
+      {
+        name_index = *first;
+        for (std::size_t index = *first; index <= static_table_size && static_table[index - 1]._name == name; ++index)
+        {
+          if (static_table[index - 1]._value == value)
+          {
+            encode_integer(out, 0x80, 7, index);
+            return;
+          }
+        }
+      }
+      for (std::size_t offset = 0; offset < _table.count(); ++offset)
+      {
+        const header_field &entry = _table.at(offset);
+        if (entry._name != name)
+          continue;
+        if (entry._value == value)
+        {
+          encode_integer(out, 0x80, 7, static_table_size + 1 + offset);
+          return;
+        }
+        if (name_index == 0)
+          name_index = static_table_size + 1 + offset;
+      }
+      const bool incremental = _indexable(name) && name.size() + value.size() + entry_overhead <= _table.capacity() / 2;
+      if (incremental)
+        encode_integer(out, 0x40, 6, name_index);
+      else
+        encode_integer(out, _sensitive(name) ? 0x10 : 0x00, 4, name_index);
+      if (name_index == 0)
+        encode_string(out, name);
+      encode_string(out, value);
+      if (incremental)
+        _table.insert(name, value);
+    }
+
+  public:
+    /**
+     * @brief 设置动态表容量，对端 `SETTINGS_HEADER_TABLE_SIZE` 变化时调用
+     * @details 容量更新在下一个头部块开头告知对端；期间容量先缩小再增大时先发送最小值
+     */
+    void set_capacity(std::size_t capacity)
+    {
+      _pending_minimum = _pending_update ? std::min(_pending_minimum, capacity) : capacity;
+      _pending_update = true;
+      _table.resize(capacity);
+    }
+    /**
+     * @brief 编码一组字段为头部块
+     * @param fields 字段，名称须为小写
+     * @return 头部块
+     */
+    std::string encode(const std::vector<header_field> &fields)
+    {
+      std::string block;
+      block.reserve(fields.size() * 16);
+      if (_pending_update)
+      {
+        if (_pending_minimum < _table.capacity())
+          encode_integer(block, 0x20, 5, _pending_minimum);
+        encode_integer(block, 0x20, 5, _table.capacity());
+        _pending_update = false;
+      }
+      for (const auto &field : fields)
+        _encode_field(block, field._name, field._value);
+      return block;
+    }
+  }; // end class encoder
+} // end namespace protocol::http2::hpack
+
+namespace protocol::http2
+{
+  /**
+   * @brief 连接配置，由本端在 `SETTINGS` 中通告
+   */
+  struct connection_config
+  {
+    std::uint32_t _max_concurrent_streams{100};            // 最大并发流
+    std::uint32_t _initial_window_size{1048576};           // 每个流的接收窗口
+    std::uint32_t _connection_window_size{16777216};       // 整个连接的接收窗口
+    std::uint32_t _max_frame_size{default_frame_size};     // 允许对端发送的最大帧负载
+    std::uint32_t _header_table_size{4096};                // 解码动态表容量，在 `SETTINGS_HEADER_TABLE_SIZE` 中通告给对端
+    std::uint32_t _encoder_table_size{4096};               // 编码动态表容量上限，实际取与对端 `SETTINGS_HEADER_TABLE_SIZE` 的较小值
+    std::uint32_t _max_header_list_size{65536};            // 单个请求头部字段总长
+    std::uint64_t _max_body_size{64 * 1024 * 1024};        // 单个请求正文上限，与 `http::request<>::from_string` 一致
+    std::size_t _max_write_batch{1048576};                 // 单次 `take_output` 输出的数据帧字节上限
+  }; // end struct connection_config
+
+  /**
+   * @class connection
+   * @brief 服务端 `HTTP/2` 连接状态机（不做 `IO`）
+   *
+   * @note
+   * - `feed(bytes)` 处理收到的字节：校验连接前言、切帧、应答 `SETTINGS`/`PING`、维护流量控制窗口，
+   *   流上收齐请求（`END_STREAM`）后以 `http::request<>` 调用请求回调；
+   * - `submit_response(stream_id, response)` 把响应编码为 `HEADERS` 帧并挂起正文，可在回调内同步调用，也可稍后调用；
+   * - `take_output()` 取出待写出的字节：先是控制帧与头部帧，再按流量窗口与优先级调度 `DATA` 帧，
+   *   窗口耗尽的流等待对端 `WINDOW_UPDATE` 后在下一次 `take_output()` 继续；
+   * - 优先级：同时支持 `RFC 7540` 的依赖/权重与 `RFC 9218` 的 `priority` 请求头（`u=`、`i`）及 `PRIORITY_UPDATE` 帧。
+   *   先按紧急度，同一紧急度内可增量的流按权重加权轮转，不可增量的流按流标识依次发送；依赖的父流仍有数据时子流等待。
+   *
+   * @warning 非线程安全，须在同一个 `IO` 线程上调用；不支持服务端推送与 `HTTP/1.1 Upgrade: h2c`。
+   */
+  class connection
+  {
+  public:
+    using request_handler = std::function<void(std::uint32_t, http::request<> &&)>;
+
+  private:
+    /**
+     * @brief 流状态，响应发送完毕即从表中移除，不在表中且标识不大于 `_last_stream_id` 的流视为已关闭
+     */
+    struct stream_state
+    {
+      std::uint32_t _id{0};
+      bool _remote_closed{false};               // 对端已发送 `END_STREAM`
+      bool _response_started{false};            // 已提交响应
+      bool _head_request{false};                // `HEAD` 请求，响应不带正文
+      std::vector<header_field> _headers;       // 请求头部字段
+      std::string _body;                        // 请求正文
+      std::int64_t _send_window{0};             // 发送窗口
+      std::int64_t _receive_window{0};          // 接收窗口
+      std::uint64_t _consumed{0};               // 已消费未通告的接收字节
+      std::string _pending_data;                // 待发送的响应正文
+      std::size_t _data_offset{0};              // 已发送到的位置
+      std::uint32_t _dependency{0};             // `RFC 7540` 依赖的父流
+      std::uint16_t _weight{16};                // `RFC 7540` 权重，1 ~ 256
+      std::uint8_t _urgency{3};                 // `RFC 9218` 紧急度，0 最高
+      bool _incremental{true};                  // 是否与同紧急度的流交错发送
+      std::uint64_t _virtual_time{0};           // 加权轮转的虚拟完成时间
+    }; // end struct stream_state
+
+    connection_config _config;
+    request_handler _on_request;
+    hpack::decoder _decoder;
+    hpack::encoder _encoder;
+    std::unordered_map<std::uint32_t, stream_state> _streams;
+
+    std::string _inbound;           // 未凑成完整帧的输入
+    std::string _output;            // 待写出的控制帧与头部帧
+    std::string _header_block;      // 拼接中的头部块
+    std::uint32_t _continuation_stream{0}; // 等待 `CONTINUATION` 的流，0 表示没有
+    bool _block_end_stream{false};
+    bool _block_has_priority{false};
+    std::uint32_t _block_dependency{0};
+    std::uint16_t _block_weight{16};
+
+    std::uint32_t _last_stream_id{0};
+    std::int64_t _connection_send_window{default_window_size};
+    std::int64_t _connection_receive_window;
+    std::uint64_t _connection_consumed{0};
+    std::uint32_t _peer_initial_window{default_window_size};
+    std::uint32_t _peer_max_frame_size{default_frame_size};
+    std::uint64_t _virtual_clock{0};
+
+    bool _preface_received{false};
+    bool _settings_received{false};
+    bool _going_away{false};       // 本端已发送 `GOAWAY`
+    bool _peer_going_away{false};  // 对端已发送 `GOAWAY`
+
+  private:
+    void _write_settings()
+    {
+      std::string payload;
+      auto add = [&payload](settings_id id, std::uint32_t value)
+      {
+        payload.push_back(static_cast<char>(static_cast<std::uint16_t>(id) >> 8));
+        payload.push_back(static_cast<char>(static_cast<std::uint16_t>(id) & 0xff));
+        write_uint32(payload, value);
+      };
+      add(settings_id::HEADER_TABLE_SIZE, _config._header_table_size);
+      add(settings_id::ENABLE_PUSH, 0);
+      add(settings_id::MAX_CONCURRENT_STREAMS, _config._max_concurrent_streams);
+      add(settings_id::INITIAL_WINDOW_SIZE, _config._initial_window_size);
+      add(settings_id::MAX_FRAME_SIZE, _config._max_frame_size);
+      add(settings_id::MAX_HEADER_LIST_SIZE, _config._max_header_list_size);
+      write_frame(_output, frame_type::SETTINGS, 0, 0, payload);
+      if (_config._connection_window_size > default_window_size)
+        _write_window_update(0, _config._connection_window_size - default_window_size);
+    }
+    void _write_window_update(std::uint32_t stream_id, std::uint32_t increment)
+    {
+      std::string payload;
+      write_uint32(payload, increment & 0x7fffffffu);
+      write_frame(_output, frame_type::WINDOW_UPDATE, 0, stream_id, payload);
+    }
+    /**
+     * @brief 连接错误：发送 `GOAWAY` 并停止处理输入
+     * @return 总是 `false`，便于直接返回
+     */
+    bool _connection_error(error_type code)
+    {
+      if (!_going_away)
+      {
+        std::string payload;
+        write_uint32(payload, _last_stream_id);
+        write_uint32(payload, static_cast<std::uint32_t>(code));
+        write_frame(_output, frame_type::GOAWAY, 0, 0, payload);
+      }
+      _going_away = true;
+      _streams.clear();
+      return false;
+    }
+    /**
+     * @brief 流错误：发送 `RST_STREAM` 并丢弃流状态，连接继续
+     * @return 总是 `true`
+     */
+    bool _reset_stream(std::uint32_t stream_id, error_type code)
+    {
+      std::string payload;
+      write_uint32(payload, static_cast<std::uint32_t>(code));
+      write_frame(_output, frame_type::RST_STREAM, 0, stream_id, payload);
+      _streams.erase(stream_id);
+      return true;
+    }
+    /**
+     * @brief 解析 `RFC 9218` 的优先级字段值，如 `u=1, i`
+     */
+    static void _apply_priority_field(stream_state &stream, std::string_view value)
+    {
+      stream._incremental = false;
+      while (!value.empty())
+      {
+        const std::size_t comma = value.find(',');
+        std::string_view item = value.substr(0, comma);
+        value = comma == std::string_view::npos ? std::string_view{} : value.substr(comma + 1);
+        while (!item.empty() && (item.front() == ' ' || item.front() == '\t'))
+          item.remove_prefix(1);
+        while (!item.empty() && (item.back() == ' ' || item.back() == '\t'))
+          item.remove_suffix(1);
+        if (item.size() == 3 && item.starts_with("u=") && item[2] >= '0' && item[2] <= '7')
+          stream._urgency = static_cast<std::uint8_t>(item[2] - '0');
+        else if (item == "i" || item == "i=?1")
+          stream._incremental = true;
+        else if (item == "i=?0")
+          stream._incremental = false;
+      }
+    }
+    /**
+     * @brief 校验请求头部（`RFC 9113` 8.3）并提取调度相关字段
+     * @return 格式错误时返回 `false`，调用方以 `PROTOCOL_ERROR` 重置流
+     */
+    bool _validate_request(stream_state &stream) const
+    {
+      bool regular_seen = false;
+      bool has_method = false, has_scheme = false, has_path = false;
+      bool is_connect = false;
+      std::size_t list_size = 0;
+      for (const auto &field : stream._headers)
+      {
+        list_size += field._name.size() + field._value.size() + hpack::entry_overhead;
+        if (field._name.empty())
+          return false;
+        for (const char character : field._name)
+        {
+          if (character >= 'A' && character <= 'Z')
+            return false;
+        }
+        if (field._name.front() == ':')
+        {
+          if (regular_seen)
+            return false;
+          if (field._name == ":method")
+          {
+            if (has_method)
+              return false;
+            has_method = true;
+            is_connect = field._value == "CONNECT";
+            stream._head_request = field._value == "HEAD";
+          }
+          else if (field._name == ":scheme")
+            has_scheme = true;
+          else if (field._name == ":path")
+          {
+            if (field._value.empty())
+              return false;
+            has_path = true;
+          }
+          else if (field._name != ":authority")
+            return false;
+          continue;
+        }
+        regular_seen = true;
+        if (field._name == "connection" || field._name == "keep-alive" || field._name == "proxy-connection" ||
+            field._name == "transfer-encoding" || field._name == "upgrade")
+          return false;
+        if (field._name == "te" && field._value != "trailers")
+          return false;
+        if (field._name == "priority")
+          _apply_priority_field(stream, field._value);
+      }
+      if (list_size > _config._max_header_list_size)
+        return false;
+      return has_method && (is_connect || (has_scheme && has_path));
+    }
+    /**
+     * @brief 流上请求收齐后组装 `http::request<>` 并交给请求回调
+     */
+    bool _dispatch(std::uint32_t stream_id)
+    {
+      auto it = _streams.find(stream_id);
+      if (it == _streams.end() || !_on_request)
+        return true;
+      stream_state &stream = it->second;
+      http::request<> request;
+      request.version(20);
+      std::string cookie;
+      for (auto &field : stream._headers)
+      {
+        if (field._name == ":method")
+          request.base().method_string(field._value);
+        else if (field._name == ":path")
+          request.target(field._value);
+        else if (field._name == ":authority")
+        {
+          if (request.base().find(http::field::host) == request.base().end())
+            request.base().set(http::field::host, field._value);
+        }
+        else if (field._name == "cookie") // `HTTP/2` 允许拆分 `cookie`，交给处理函数前重新合并
+          cookie.append(cookie.empty() ? "" : "; ").append(field._value);
+        else if (field._name == "host")
+          request.base().set(http::field::host, field._value);
+        else if (field._name.front() != ':')
+          request.base().insert(field._name, field._value);
+      }
+      if (!cookie.empty())
+        request.base().set(http::field::cookie, cookie);
+      if (!stream._body.empty())
+        request.base().content_length(stream._body.size());
+      request.body() = std::move(stream._body);
+      stream._headers.clear();
+      stream._headers.shrink_to_fit();
+      _on_request(stream_id, std::move(request));
+      return true;
+    }
+
+    bool _finish_header_block(std::uint32_t stream_id)
+    {
+      std::vector<header_field> fields;
+      if (!_decoder.decode(_header_block, fields))
+        return _connection_error(error_type::COMPRESSION_ERROR);
+      _header_block.clear();
+      const bool end_stream = _block_end_stream;
+
+      auto it = _streams.find(stream_id);
+      if (it != _streams.end())
+      {
+        // 同一流上的第二个头部块只能是尾部字段，且必须结束流；尾部字段不转交处理函数
+        if (it->second._remote_closed)
+          return _reset_stream(stream_id, error_type::STREAM_CLOSED);
+        if (!end_stream)
+          return _reset_stream(stream_id, error_type::PROTOCOL_ERROR);
+        it->second._remote_closed = true;
+        return _dispatch(stream_id);
+      }
+      if (stream_id % 2 == 0 || stream_id <= _last_stream_id)
+        return _connection_error(error_type::PROTOCOL_ERROR);
+      _last_stream_id = stream_id;
+      if (_going_away || _peer_going_away)
+        return true;
+      if (_streams.size() >= _config._max_concurrent_streams)
+        return _reset_stream(stream_id, error_type::REFUSED_STREAM);
+
+      stream_state stream;
+      stream._id = stream_id;
+      stream._send_window = _peer_initial_window;
+      stream._receive_window = _config._initial_window_size;
+      if (_block_has_priority)
+      {
+        if (_block_dependency == stream_id)
+          return _reset_stream(stream_id, error_type::PROTOCOL_ERROR);
+        stream._dependency = _block_dependency;
+        stream._weight = _block_weight;
+      }
+      stream._headers = std::move(fields);
+      if (!_validate_request(stream))
+        return _reset_stream(stream_id, error_type::PROTOCOL_ERROR);
+      stream._remote_closed = end_stream;
+      _streams.emplace(stream_id, std::move(stream));
+      return end_stream ? _dispatch(stream_id) : true;
+    }
+
+    bool _on_headers(const frame_header &header, std::string_view payload)
+    {
+      if (header._stream_id == 0)
+        return _connection_error(error_type::PROTOCOL_ERROR);
+      if (header._flags & frame_flag::PADDED)
+      {
+        if (payload.empty())
+          return _connection_error(error_type::FRAME_SIZE_ERROR);
+        const std::size_t padding = static_cast<unsigned char>(payload.front());
+        payload.remove_prefix(1);
+        if (padding > payload.size())
+          return _connection_error(error_type::PROTOCOL_ERROR);
+        payload.remove_suffix(padding);
+      }
+      _block_has_priority = (header._flags & frame_flag::PRIORITY) != 0;
+      if (_block_has_priority)
+      {
+        if (payload.size() < 5)
+          return _connection_error(error_type::FRAME_SIZE_ERROR);
+        _block_dependency = read_uint32(payload) & 0x7fffffffu;
+        _block_weight = static_cast<std::uint16_t>(static_cast<unsigned char>(payload[4]) + 1);
+        payload.remove_prefix(5);
+      }
+      _block_end_stream = (header._flags & frame_flag::END_STREAM) != 0;
+      _header_block.assign(payload);
+      if (header._flags & frame_flag::END_HEADERS)
+        return _finish_header_block(header._stream_id);
+      _continuation_stream = header._stream_id;
+      return true;
+    }
+
+    bool _on_continuation(const frame_header &header, std::string_view payload)
+    {
+      if (_continuation_stream == 0)
+        return _connection_error(error_type::PROTOCOL_ERROR);
+      _header_block.append(payload);
+      if (_header_block.size() > _config._max_header_list_size * 2ull)
+        return _connection_error(error_type::ENHANCE_YOUR_CALM);
+      if (!(header._flags & frame_flag::END_HEADERS))
+        return true;
+      _continuation_stream = 0;
+      return _finish_header_block(header._stream_id);
+    }
+
+    bool _on_data(const frame_header &header, std::string_view payload)
+    {
+      if (header._stream_id == 0)
+        return _connection_error(error_type::PROTOCOL_ERROR);
+      // 流量控制按整个负载（含填充）计算，无论流是否仍然有效
+      if (header._length > _connection_receive_window)
+        return _connection_error(error_type::FLOW_CONTROL_ERROR);
+      _connection_receive_window -= header._length;
+      _connection_consumed += header._length;
+      if (_connection_consumed >= _config._connection_window_size / 2)
+      {
+        _write_window_update(0, static_cast<std::uint32_t>(_connection_consumed));
+        _connection_receive_window += static_cast<std::int64_t>(_connection_consumed);
+        _connection_consumed = 0;
+      }
+
+      auto it = _streams.find(header._stream_id);
+      if (it == _streams.end() || it->second._remote_closed)
+      {
+        if (header._stream_id > _last_stream_id)
+          return _connection_error(error_type::PROTOCOL_ERROR);
+        return _reset_stream(header._stream_id, error_type::STREAM_CLOSED);
+      }
+      stream_state &stream = it->second;
+      if (header._length > stream._receive_window)
+        return _reset_stream(header._stream_id, error_type::FLOW_CONTROL_ERROR);
+      stream._receive_window -= header._length;
+      stream._consumed += header._length;
+
+      if (header._flags & frame_flag::PADDED)
+      {
+        if (payload.empty())
+          return _connection_error(error_type::FRAME_SIZE_ERROR);
+        const std::size_t padding = static_cast<unsigned char>(payload.front());
+        payload.remove_prefix(1);
+        if (padding > payload.size())
+          return _connection_error(error_type::PROTOCOL_ERROR);
+        payload.remove_suffix(padding);
+      }
+      if (stream._body.size() + payload.size() > _config._max_body_size)
+        return _reset_stream(header._stream_id, error_type::CANCEL);
+      stream._body.append(payload);
+
+      if (header._flags & frame_flag::END_STREAM)
+      {
+        stream._remote_closed = true;
+        return _dispatch(header._stream_id);
+      }
+      if (stream._consumed >= _config._initial_window_size / 2)
+      {
+        _write_window_update(header._stream_id, static_cast<std::uint32_t>(stream._consumed));
+        stream._receive_window += static_cast<std::int64_t>(stream._consumed);
+        stream._consumed = 0;
+      }
+      return true;
+    }
+
+    bool _on_settings(const frame_header &header, std::string_view payload)
+    {
+      if (header._stream_id != 0)
+        return _connection_error(error_type::PROTOCOL_ERROR);
+      if (header._flags & frame_flag::ACK)
+        return payload.empty() ? true : _connection_error(error_type::FRAME_SIZE_ERROR);
+      if (payload.size() % 6 != 0)
+        return _connection_error(error_type::FRAME_SIZE_ERROR);
+      for (std::size_t offset = 0; offset < payload.size(); offset += 6)
+      {
+        const auto id = static_cast<std::uint16_t>(static_cast<unsigned char>(payload[offset]) << 8 |
+                                                   static_cast<unsigned char>(payload[offset + 1]));
+        const std::uint32_t value = read_uint32(payload.substr(offset + 2, 4));
+        switch (static_cast<settings_id>(id))
+        {
+        case settings_id::HEADER_TABLE_SIZE:
+          // 对端通告的是它的解码表容量，只约束本端编码器，与本端解码表容量无关
+          _encoder.set_capacity(std::min<std::size_t>(value, _config._encoder_table_size));
+          break;
+        case settings_id::ENABLE_PUSH:
+          if (value > 1)
+            return _connection_error(error_type::PROTOCOL_ERROR);
+          break;
+        case settings_id::INITIAL_WINDOW_SIZE:
+        {
+          if (value > max_window_size)
+            return _connection_error(error_type::FLOW_CONTROL_ERROR);
+          const std::int64_t delta = static_cast<std::int64_t>(value) - _peer_initial_window;
+          for (auto &[stream_id, stream] : _streams)
+          {
+            stream._send_window += delta;
+            if (stream._send_window > max_window_size)
+              return _connection_error(error_type::FLOW_CONTROL_ERROR);
+          }
+          _peer_initial_window = value;
+          break;
+        }
+        case settings_id::MAX_FRAME_SIZE:
+          if (value < default_frame_size || value > 0xffffff)
+            return _connection_error(error_type::PROTOCOL_ERROR);
+          _peer_max_frame_size = value;
+          break;
+        default: // 未知参数按规范忽略
+          break;
+        }
+      }
+      _settings_received = true;
+      write_frame(_output, frame_type::SETTINGS, frame_flag::ACK, 0, {});
+      return true;
+    }
+
+    bool _on_window_update(const frame_header &header, std::string_view payload)
+    {
+      if (payload.size() != 4)
+        return _connection_error(error_type::FRAME_SIZE_ERROR);
+      const std::uint32_t increment = read_uint32(payload) & 0x7fffffffu;
+      if (header._stream_id == 0)
+      {
+        if (increment == 0)
+          return _connection_error(error_type::PROTOCOL_ERROR);
+        _connection_send_window += increment;
+        return _connection_send_window > max_window_size ? _connection_error(error_type::FLOW_CONTROL_ERROR) : true;
+      }
+      auto it = _streams.find(header._stream_id);
+      if (it == _streams.end())
+        return header._stream_id > _last_stream_id ? _connection_error(error_type::PROTOCOL_ERROR) : true;
+      if (increment == 0)
+        return _reset_stream(header._stream_id, error_type::PROTOCOL_ERROR);
+      it->second._send_window += increment;
+      if (it->second._send_window > max_window_size)
+        return _reset_stream(header._stream_id, error_type::FLOW_CONTROL_ERROR);
+      return true;
+    }
+
+    bool _on_priority(const frame_header &header, std::string_view payload)
+    {
+      if (header._stream_id == 0)
+        return _connection_error(error_type::PROTOCOL_ERROR);
+      if (payload.size() != 5)
+        return _reset_stream(header._stream_id, error_type::FRAME_SIZE_ERROR);
+      const std::uint32_t dependency = read_uint32(payload) & 0x7fffffffu;
+      if (dependency == header._stream_id)
+        return _reset_stream(header._stream_id, error_type::PROTOCOL_ERROR);
+      auto it = _streams.find(header._stream_id);
+      if (it != _streams.end())
+      {
+        it->second._dependency = dependency;
+        it->second._weight = static_cast<std::uint16_t>(static_cast<unsigned char>(payload[4]) + 1);
+      }
+      return true;
+    }
+
+    bool _on_priority_update(const frame_header &header, std::string_view payload)
+    {
+      if (header._stream_id != 0)
+        return _connection_error(error_type::PROTOCOL_ERROR);
+      if (payload.size() < 4)
+        return _connection_error(error_type::FRAME_SIZE_ERROR);
+      auto it = _streams.find(read_uint32(payload) & 0x7fffffffu);
+      if (it != _streams.end())
+        _apply_priority_field(it->second, payload.substr(4));
+      return true;
+    }
+
+    bool _process_frame(const frame_header &header, std::string_view payload)
+    {
+      if (_continuation_stream != 0 &&
+          (header._type != frame_type::CONTINUATION || header._stream_id != _continuation_stream))
+        return _connection_error(error_type::PROTOCOL_ERROR);
+      if (!_settings_received && header._type != frame_type::SETTINGS)
+        return _connection_error(error_type::PROTOCOL_ERROR);
+      switch (header._type)
+      {
+      case frame_type::DATA:
+        return _on_data(header, payload);
+      case frame_type::HEADERS:
+        return _on_headers(header, payload);
+      case frame_type::CONTINUATION:
+        return _on_continuation(header, payload);
+      case frame_type::PRIORITY:
+        return _on_priority(header, payload);
+      case frame_type::PRIORITY_UPDATE:
+        return _on_priority_update(header, payload);
+      case frame_type::SETTINGS:
+        return _on_settings(header, payload);
+      case frame_type::WINDOW_UPDATE:
+        return _on_window_update(header, payload);
+      case frame_type::RST_STREAM:
+        if (header._stream_id == 0 || header._stream_id > _last_stream_id)
+          return _connection_error(error_type::PROTOCOL_ERROR);
+        if (payload.size() != 4)
+          return _connection_error(error_type::FRAME_SIZE_ERROR);
+        _streams.erase(header._stream_id);
+        return true;
+      case frame_type::PING:
+        if (header._stream_id != 0)
+          return _connection_error(error_type::PROTOCOL_ERROR);
+        if (payload.size() != 8)
+          return _connection_error(error_type::FRAME_SIZE_ERROR);
+        if (!(header._flags & frame_flag::ACK))
+          write_frame(_output, frame_type::PING, frame_flag::ACK, 0, payload);
+        return true;
+      case frame_type::GOAWAY:
+        if (header._stream_id != 0)
+          return _connection_error(error_type::PROTOCOL_ERROR);
+        if (payload.size() < 8)
+          return _connection_error(error_type::FRAME_SIZE_ERROR);
+        _peer_going_away = true;
+        return true;
+      case frame_type::PUSH_PROMISE: // 客户端不能推送
+        return _connection_error(error_type::PROTOCOL_ERROR);
+      default: // 未知帧类型按规范忽略
+        return true;
+      }
+    }
+
+    /**
+     * @brief 流是否有可在当前窗口内发送的数据
+     */
+    bool _sendable(const stream_state &stream) const noexcept
+    {
+      if (!stream._response_started)
+        return false;
+      const std::size_t remaining = stream._pending_data.size() - stream._data_offset;
+      return remaining > 0 && stream._send_window > 0 && _connection_send_window > 0;
+    }
+    /**
+     * @brief 依赖的父流仍有待发送数据时，子流让路
+     */
+    bool _blocked_by_parent(const stream_state &stream) const
+    {
+      if (stream._dependency == 0)
+        return false;
+      auto parent = _streams.find(stream._dependency);
+      return parent != _streams.end() && parent->second._response_started &&
+             parent->second._data_offset < parent->second._pending_data.size();
+    }
+    /**
+     * @brief 按优先级选出下一个发送数据的流
+     * @return 流标识，没有可发送的流时返回 0
+     */
+    std::uint32_t _select_stream() const
+    {
+      const stream_state *best = nullptr;
+      auto before = [](const stream_state &left, const stream_state &right)
+      {
+        if (left._urgency != right._urgency)
+          return left._urgency < right._urgency;
+        if (left._virtual_time != right._virtual_time)
+          return left._virtual_time < right._virtual_time;
+        return left._id < right._id;
+      };
+      for (const auto &[stream_id, stream] : _streams)
+      {
+        if (_sendable(stream) && !_blocked_by_parent(stream) && (best == nullptr || before(stream, *best)))
+          best = &stream;
+      }
+      // 依赖关系成环时全部被阻塞，此时忽略依赖避免饿死
+      if (best == nullptr)
+      {
+        for (const auto &[stream_id, stream] : _streams)
+        {
+          if (_sendable(stream) && (best == nullptr || before(stream, *best)))
+            best = &stream;
+        }
+      }
+      return best == nullptr ? 0 : best->_id;
+    }
+    /**
+     * @brief 在窗口与批量上限内调度 `DATA` 帧
+     */
+    void _schedule_data(std::string &out)
+    {
+      std::size_t batch = 0;
+      while (batch < _config._max_write_batch)
+      {
+        const std::uint32_t stream_id = _select_stream();
+        if (stream_id == 0)
+          break;
+        stream_state &stream = _streams.find(stream_id)->second;
+        const std::size_t remaining = stream._pending_data.size() - stream._data_offset;
+        const std::size_t chunk = static_cast<std::size_t>(std::min<std::int64_t>(
+            {static_cast<std::int64_t>(remaining), stream._send_window, _connection_send_window,
+             static_cast<std::int64_t>(_peer_max_frame_size)}));
+        const bool last = chunk == remaining;
+        write_frame(out, frame_type::DATA, last ? frame_flag::END_STREAM : 0, stream_id,
+                    std::string_view(stream._pending_data).substr(stream._data_offset, chunk));
+        stream._data_offset += chunk;
+        stream._send_window -= static_cast<std::int64_t>(chunk);
+        _connection_send_window -= static_cast<std::int64_t>(chunk);
+        batch += chunk + frame_header_size;
+        // 可增量的流按权重推进虚拟时间；不可增量的流保持不变，从而独占到发送完毕
+        if (stream._incremental)
+          stream._virtual_time += (chunk + 1) * 256 / stream._weight;
+        _virtual_clock = std::max(_virtual_clock, stream._virtual_time);
+        if (last)
+          _streams.erase(stream_id);
+      }
+    }
+
+  public:
+    explicit connection(const connection_config &config = connection_config{})
+        : _config(config), _decoder(config._header_table_size),
+          _connection_receive_window(std::max<std::int64_t>(config._connection_window_size, default_window_size))
+    {
+      _inbound.reserve(config._max_frame_size + frame_header_size);
+      if (config._encoder_table_size < 4096) // 对端的初始解码表容量为 4096，本端上限更小时在首个头部块中告知
+        _encoder.set_capacity(config._encoder_table_size);
+      _write_settings(); // 服务端连接前言
+    }
+
+    /**
+     * @brief 设置请求回调
+     * @param handler 参数为流标识与组装好的请求
+     */
+    void set_request_handler(request_handler handler)
+    {
+      _on_request = std::move(handler);
+    }
+    /**
+     * @brief 处理收到的字节
+     * @param bytes 任意长度的输入，可以只包含半个帧
+     * @return 连接仍然可用返回 `true`；出现连接错误时返回 `false`，此时 `GOAWAY` 已写入输出，调用方写完后关闭连接
+     */
+    bool feed(std::string_view bytes)
+    {
+      if (_going_away && _streams.empty())
+        return false;
+      _inbound.append(bytes);
+      std::size_t position = 0;
+      if (!_preface_received)
+      {
+        if (_inbound.size() < connection_preface.size())
+          return connection_preface.starts_with(_inbound) ? true : _connection_error(error_type::PROTOCOL_ERROR);
+        if (!_inbound.starts_with(connection_preface))
+          return _connection_error(error_type::PROTOCOL_ERROR);
+        _preface_received = true;
+        position = connection_preface.size();
+      }
+      bool healthy = true;
+      while (healthy && _inbound.size() - position >= frame_header_size)
+      {
+        const frame_header header = frame_header::parse(std::string_view(_inbound).substr(position));
+        if (header._length > _config._max_frame_size)
+        {
+          healthy = _connection_error(error_type::FRAME_SIZE_ERROR);
+          break;
+        }
+        if (_inbound.size() - position < frame_header_size + header._length)
+          break;
+        const std::string_view payload = std::string_view(_inbound).substr(position + frame_header_size, header._length);
+        position += frame_header_size + header._length;
+        healthy = _process_frame(header, payload);
+      }
+      if (healthy)
+        _inbound.erase(0, position);
+      else
+        _inbound.clear();
+      return healthy;
+    }
+    /**
+     * @brief 提交流上的响应
+     * @param stream_id 流标识
+     * @param response 响应，连接相关的头部（`Connection`、`Keep-Alive`、`Transfer-Encoding` 等）会被去掉
+     * @return 流已被重置或已提交过响应时返回 `false`
+     */
+    bool submit_response(std::uint32_t stream_id, const http::response<> &response)
+    {
+      auto it = _streams.find(stream_id);
+      if (it == _streams.end() || it->second._response_started)
+        return false;
+      stream_state &stream = it->second;
+
+      std::vector<header_field> fields;
+      fields.reserve(8);
+      fields.push_back({":status", std::to_string(response.result_int())});
+      for (const auto &field : response.base())
+      {
+        const auto name_view = field.name_string();
+        const auto value_view = field.value();
+        std::string name(name_view.data(), name_view.size());
+        std::ranges::transform(name, name.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+        if (name == "connection" || name == "keep-alive" || name == "proxy-connection" ||
+            name == "transfer-encoding" || name == "upgrade")
+          continue;
+        fields.push_back({std::move(name), std::string(value_view.data(), value_view.size())});
+      }
+      const std::string block = _encoder.encode(fields);
+      const bool has_body = !stream._head_request && !response.body().empty();
+
+      // 头部块超过对端最大帧长时拆成 `HEADERS` + `CONTINUATION`
+      const std::string_view block_view = block;
+      std::size_t offset = 0;
+      do
+      {
+        const std::size_t chunk = std::min<std::size_t>(block_view.size() - offset, _peer_max_frame_size);
+        const bool last = offset + chunk == block_view.size();
+        std::uint8_t flags = last ? frame_flag::END_HEADERS : 0;
+        if (offset == 0 && !has_body)
+          flags |= frame_flag::END_STREAM;
+        write_frame(_output, offset == 0 ? frame_type::HEADERS : frame_type::CONTINUATION, flags, stream_id,
+                    block_view.substr(offset, chunk));
+        offset += chunk;
+      } while (offset < block_view.size());
+
+      if (!has_body)
+      {
+        _streams.erase(it);
+        return true;
+      }
+      stream._response_started = true;
+      stream._pending_data = response.body();
+      stream._virtual_time = _virtual_clock;
+      return true;
+    }
+    /**
+     * @brief 是否有待写出的字节
+     */
+    bool has_output() const
+    {
+      if (!_output.empty())
+        return true;
+      return std::ranges::any_of(_streams, [this](const auto &entry) { return _sendable(entry.second); });
+    }
+    /**
+     * @brief 取出待写出的字节
+     * @return 控制帧、头部帧与按优先级调度的数据帧
+     */
+    std::string take_output()
+    {
+      std::string out = std::move(_output);
+      _output.clear();
+      _schedule_data(out);
+      return out;
+    }
+    /**
+     * @brief 发送 `GOAWAY(NO_ERROR)`，不再接受新流，已有的流继续完成
+     */
+    void shutdown()
+    {
+      if (_going_away)
+        return;
+      std::string payload;
+      write_uint32(payload, _last_stream_id);
+      write_uint32(payload, static_cast<std::uint32_t>(error_type::NONE));
+      write_frame(_output, frame_type::GOAWAY, 0, 0, payload);
+      _going_away = true;
+    }
+    /**
+     * @brief 连接是否可以关闭：任一方已发出 `GOAWAY` 且所有流都已完成、输出已取空
+     */
+    bool finished() const
+    {
+      return (_going_away || _peer_going_away) && _streams.empty() && _output.empty();
+    }
+    /**
+     * @brief 当前活跃的流数量
+     */
+    std::size_t active_streams() const noexcept
+    {
+      return _streams.size();
+    }
+  }; // end class connection
+} // end namespace protocol::http2
@@ -19,6 +19,7 @@
 #include <boost/json.hpp>
 #include "./json.hpp"
 #include "./auxiliary.hpp"
+#include "../../container/simulate_vector.hpp"
 #include "../crypt/encryption.hpp"
 
 namespace protocol
@@ -55,7 +56,7 @@ namespace protocol
      */
     void _serialize_headers_to_string(std::string &out) const
     {
-      std::vector<std::string> keys;
+      standard_con::small_vector<std::string, 16> keys; // 头部字段通常不超过 16 个，无需堆分配
       keys.reserve(_headers.size());
       for (const auto &[key, value] : _headers)
         keys.push_back(key);
@@ -180,7 +181,7 @@ namespace protocol
      */
     void _serialize_headers_to_string(std::string &out) const
     {
-      std::vector<std::string> keys;
+      standard_con::small_vector<std::string, 16> keys; // 头部字段通常不超过 16 个，无需堆分配
       keys.reserve(_headers.size());
       for (const auto &[key, value] : _headers)
         keys.push_back(key);
@@ -729,6 +730,16 @@ namespace protocol
       return response(code, message, body);
     }
 
+    /**
+     * @brief 按状态码创建响应，原因短语取标准短语
+     * @param code 状态码
+     * @param body 响应体
+     */
+    static response create_status(std::uint16_t code, const std::string &body = "")
+    {
+      return response(code, std::string(auxiliary::status_reason(code)), body);
+    }
+
     static response create_not_found(const std::string &body = "not found")
     {
       return response(404, "not found", body);
@@ -776,8 +787,7 @@ bool protocol::request_header::from_string(std::string_view data)
     return false;
     
   // 解析第一行（请求行）
-  std::vector<std::string_view> parts;
-  parts.reserve(8); // 预分配空间避免重复分配
+  standard_con::small_vector<std::string_view, 10> parts; // 最多 10 段，全部放在内联存储
   
   for (std::size_t i = pos, s = pos; i <= le; ++i)
   {
@@ -864,15 +874,15 @@ bool protocol::request_header::from_string(std::string_view data)
       if (k.empty() || k.size() > 256 || v.size() > 8192)
         return false;
 
-      std::string key(k), val(v);
-      
-      if (key == "User-Agent")
+      // 字段名查编译期完美哈希表分派，只有需要保存时才构造字符串
+      const auxiliary::special_header kind = auxiliary::classify_header(k);
+      if (kind == auxiliary::special_header::USER_AGENT)
       {
-        if (val.size() > 512) // 限制User-Agent长度
+        if (v.size() > 512) // 限制User-Agent长度
           return false;
-        temp_user_agent = val;
+        temp_user_agent = v;
       }
-      else if (key == "Timestamp")
+      else if (kind == auxiliary::special_header::TIMESTAMP)
       {
         std::int64_t ts;
         if (safe_parse(v, ts))
@@ -888,7 +898,7 @@ bool protocol::request_header::from_string(std::string_view data)
       {
         if (temp_headers.size() >= max_headers - 10) // 为特殊头部预留空间
           return false;
-        temp_headers[key] = val;
+        temp_headers[std::string(k)] = v;
       }
     }
     ++header_count;
@@ -939,8 +949,7 @@ bool protocol::response_header::from_string(std::string_view data)
     return false;
     
   // 解析状态行
-  std::vector<std::string_view> parts;
-  parts.reserve(8);
+  standard_con::small_vector<std::string_view, 10> parts;
   
   for (std::size_t i = pos, s = pos; i <= le; ++i)
   {
@@ -1032,15 +1041,14 @@ bool protocol::response_header::from_string(std::string_view data)
       if (k.empty() || k.size() > 256 || v.size() > 8192)
         return false;
 
-      std::string key(k), val(v);
-      
-      if (key == "Server")
+      const auxiliary::special_header kind = auxiliary::classify_header(k);
+      if (kind == auxiliary::special_header::SERVER)
       {
-        if (val.size() > 512)
+        if (v.size() > 512)
           return false;
-        temp_server = val;
+        temp_server = v;
       }
-      else if (key == "Timestamp")
+      else if (kind == auxiliary::special_header::TIMESTAMP)
       {
         std::int64_t ts;
         if (safe_parse(v, ts))
@@ -1056,7 +1064,7 @@ bool protocol::response_header::from_string(std::string_view data)
       {
         if (temp_headers.size() >= max_headers - 10)
           return false;
-        temp_headers[key] = val;
+        temp_headers[std::string(k)] = v;
       }
     }
     ++header_count;
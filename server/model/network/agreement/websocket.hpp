@@ -0,0 +1,754 @@
+/**
+ * @file websocket.hpp
+ * @brief `WebSocket` 协议实现（`RFC 6455`、`RFC 7692`）
+ * @details 提供升级握手、帧编解码、`permessage-deflate` 扩展协商与压缩，以及不依赖 `IO` 的服务端连接状态机，
+ *  实现 `auxiliary::protocol_type::WEBSOCKET`
+ */
+#pragma once
+#include <array>
+#include <cctype>
+#include <string>
+#include <algorithm>
+#include <vector>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <string_view>
+#include <boost/beast/zlib/deflate_stream.hpp>
+#include <boost/beast/zlib/inflate_stream.hpp>
+#include <openssl/sha.h>
+#include <openssl/evp.h>
+#include "./http.hpp"
+
+namespace protocol
+{
+  namespace websocket {}
+} // end namespace protocol
+
+namespace protocol::websocket
+{
+  /**
+   * @brief 计算 `Sec-WebSocket-Accept` 时拼接在客户端密钥之后的固定串
+   */
+  inline constexpr std::string_view accept_guid = "258EAFA5-E914-47DA-95CA-C5AB0DC85B11";
+  inline constexpr std::size_t max_control_payload = 125; // 控制帧负载上限
+
+  /**
+   * @brief 帧操作码
+   */
+  enum class opcode : std::uint8_t
+  {
+    CONTINUATION = 0x0,
+    TEXT = 0x1,
+    BINARY = 0x2,
+    CLOSE = 0x8,
+    PING = 0x9,
+    PONG = 0xa
+  }; // end enum class opcode
+
+  /**
+   * @brief 关闭状态码
+   */
+  enum class close_code : std::uint16_t
+  {
+    NORMAL = 1000,           // 正常关闭
+    GOING_AWAY = 1001,       // 服务端停止或页面离开
+    PROTOCOL_ERROR = 1002,   // 协议错误
+    UNSUPPORTED_DATA = 1003, // 不支持的数据类型
+    NO_STATUS = 1005,        // 关闭帧未携带状态码（只用于本地表示，不能发送）
+    INVALID_PAYLOAD = 1007,  // 文本不是合法 `UTF-8` 或压缩数据损坏
+    POLICY_VIOLATION = 1008, // 违反策略
+    MESSAGE_TOO_BIG = 1009,  // 消息过大
+    INTERNAL_ERROR = 1011    // 服务端内部错误
+  }; // end enum class close_code
+
+  /**
+   * @brief 校验 `UTF-8` 编码，拒绝过长编码、代理区码点与超出 `U+10FFFF` 的码点
+   * @param text 待校验文本
+   * @return 合法返回 `true`
+   */
+  inline bool valid_utf8(std::string_view text) noexcept
+  {
+    std::size_t index = 0;
+    const std::size_t size = text.size();
+    while (index < size)
+    {
+      // `ASCII` 快速路径：一次检查 8 字节的最高位
+      if (index + 8 <= size)
+      {
+        std::uint64_t word;
+        std::memcpy(&word, text.data() + index, sizeof(word));
+        if ((word & 0x8080808080808080ULL) == 0)
+        {
+          index += 8;
+          continue;
+        }
+      }
+      const auto lead = static_cast<unsigned char>(text[index]);
+      if (lead < 0x80)
+      {
+        ++index;
+        continue;
+      }
+      std::size_t length = 0;
+      std::uint32_t code_point = 0;
+      if ((lead & 0xe0) == 0xc0)
+      {
+        length = 2;
+        code_point = lead & 0x1f;
+      }
+      else if ((lead & 0xf0) == 0xe0)
+      {
+        length = 3;
+        code_point = lead & 0x0f;
+      }
+      else if ((lead & 0xf8) == 0xf0)
+      {
+        length = 4;
+        code_point = lead & 0x07;
+      }
+      else
+        return false;
+      if (index + length > size)
+        return false;
+      for (std::size_t offset = 1; offset < length; ++offset)
+      {
+        const auto follow = static_cast<unsigned char>(text[index + offset]);
+        if ((follow & 0xc0) != 0x80)
+          return false;
+        code_point = code_point << 6 | (follow & 0x3f);
+      }
+      if ((length == 2 && code_point < 0x80) || (length == 3 && code_point < 0x800) ||
+          (length == 4 && (code_point < 0x10000 || code_point > 0x10ffff)) ||
+          (code_point >= 0xd800 && code_point <= 0xdfff))
+        return false;
+      index += length;
+    }
+    return true;
+  }
+
+  /**
+   * @brief 以 4 字节掩码异或负载（掩码与去掩码是同一操作）
+   * @param data 负载，原地修改
+   * @param length 长度
+   * @param mask 掩码，`mask[0]` 对应负载第 0 字节
+   */
+  inline void apply_mask(char *data, std::size_t length, const std::array<unsigned char, 4> &mask) noexcept
+  {
+    std::uint64_t wide_mask;
+    unsigned char repeated[8];
+    for (std::size_t index = 0; index < 8; ++index)
+      repeated[index] = mask[index % 4];
+    std::memcpy(&wide_mask, repeated, sizeof(wide_mask));
+    std::size_t index = 0;
+    for (; index + 8 <= length; index += 8)
+    {
+      std::uint64_t word;
+      std::memcpy(&word, data + index, sizeof(word));
+      word ^= wide_mask;
+      std::memcpy(data + index, &word, sizeof(word));
+    }
+    for (; index < length; ++index)
+      data[index] = static_cast<char>(data[index] ^ mask[index % 4]);
+  }
+
+  /**
+   * @brief 追加一个服务端帧（不加掩码）
+   * @param out 输出缓冲
+   * @param code 操作码
+   * @param payload 负载
+   * @param compressed 是否置 `RSV1`（负载已按 `permessage-deflate` 压缩）
+   * @param fin 是否为消息的最后一帧
+   */
+  inline void write_frame(std::string &out, opcode code, std::string_view payload, bool compressed = false, bool fin = true)
+  {
+    out.push_back(static_cast<char>((fin ? 0x80 : 0x00) | (compressed ? 0x40 : 0x00) | static_cast<std::uint8_t>(code)));
+    const std::uint64_t length = payload.size();
+    if (length < 126)
+      out.push_back(static_cast<char>(length));
+    else if (length <= 0xffff)
+    {
+      out.push_back(static_cast<char>(126));
+      out.push_back(static_cast<char>(length >> 8 & 0xff));
+      out.push_back(static_cast<char>(length & 0xff));
+    }
+    else
+    {
+      out.push_back(static_cast<char>(127));
+      for (int shift = 56; shift >= 0; shift -= 8)
+        out.push_back(static_cast<char>(length >> shift & 0xff));
+    }
+    out.append(payload);
+  }
+
+  /**
+   * @brief `permessage-deflate` 协商结果
+   * @details 服务端总是声明 `server_no_context_takeover`：每条消息独立压缩，
+   *  同一条广播消息对所有启用压缩的客户端编码结果相同，只需压缩一次
+   */
+  struct deflate_options
+  {
+    bool _enabled{false};                     // 是否启用
+    int _server_window_bits{15};              // 服务端压缩窗口位数
+    bool _client_no_context_takeover{false};  // 客户端每条消息独立压缩
+  }; // end struct deflate_options
+
+  /**
+   * @brief 按 `Sec-WebSocket-Extensions` 请求头协商 `permessage-deflate`
+   * @param offers 请求头的值，可包含多个以逗号分隔的候选
+   * @return 接受的第一个候选；都无法接受时 `_enabled` 为 `false`
+   */
+  inline deflate_options negotiate_deflate(std::string_view offers)
+  {
+    auto trim = [](std::string_view text)
+    {
+      while (!text.empty() && (text.front() == ' ' || text.front() == '\t'))
+        text.remove_prefix(1);
+      while (!text.empty() && (text.back() == ' ' || text.back() == '\t'))
+        text.remove_suffix(1);
+      return text;
+    };
+    std::string lowered(offers);
+    for (char &character : lowered)
+      character = static_cast<char>(std::tolower(static_cast<unsigned char>(character)));
+    std::string_view rest = lowered;
+    while (!rest.empty())
+    {
+      const std::size_t comma = rest.find(',');
+      std::string_view offer = rest.substr(0, comma);
+      rest = comma == std::string_view::npos ? std::string_view{} : rest.substr(comma + 1);
+
+      deflate_options options;
+      bool acceptable = true;
+      bool first = true;
+      while (acceptable)
+      {
+        const std::size_t semicolon = offer.find(';');
+        const std::string_view item = trim(offer.substr(0, semicolon));
+        if (first)
+        {
+          acceptable = item == "permessage-deflate";
+          first = false;
+        }
+        else if (item == "server_no_context_takeover")
+          ; // 服务端总是不保留上下文
+        else if (item == "client_no_context_takeover")
+          options._client_no_context_takeover = true;
+        else if (item.starts_with("client_max_window_bits"))
+          ; // 只限制客户端的压缩窗口，按 15 位窗口解压总能兼容
+        else if (item.starts_with("server_max_window_bits"))
+        {
+          std::string_view value = trim(item.substr(std::string_view("server_max_window_bits").size()));
+          if (value.starts_with('='))
+            value = trim(value.substr(1));
+          if (value.size() >= 2 && value.front() == '"' && value.back() == '"')
+            value = value.substr(1, value.size() - 2);
+          int bits = 0;
+          for (const char digit : value)
+            bits = digit >= '0' && digit <= '9' && bits < 100 ? bits * 10 + (digit - '0') : 100;
+          // 压缩实现最小支持 9 位窗口，客户端要求 8 位时放弃这个候选
+          acceptable = bits >= 9 && bits <= 15;
+          options._server_window_bits = bits;
+        }
+        else
+          acceptable = false;
+        if (semicolon == std::string_view::npos)
+          break;
+        offer = offer.substr(semicolon + 1);
+      }
+      if (acceptable)
+      {
+        options._enabled = true;
+        return options;
+      }
+    }
+    return deflate_options{};
+  }
+
+  /**
+   * @brief 计算 `Sec-WebSocket-Accept`：`base64(SHA1(key + GUID))`
+   */
+  inline std::string accept_key(std::string_view key)
+  {
+    std::string source(key);
+    source.append(accept_guid);
+    unsigned char digest[SHA_DIGEST_LENGTH];
+    SHA1(reinterpret_cast<const unsigned char *>(source.data()), source.size(), digest);
+    unsigned char encoded[4 * ((SHA_DIGEST_LENGTH + 2) / 3) + 1];
+    const int length = EVP_EncodeBlock(encoded, digest, SHA_DIGEST_LENGTH);
+    return std::string(reinterpret_cast<const char *>(encoded), static_cast<std::size_t>(length));
+  }
+
+  /**
+   * @brief 判断头部值中是否包含某个以逗号分隔的记号（不区分大小写）
+   */
+  inline bool header_has_token(std::string_view value, std::string_view token)
+  {
+    while (!value.empty())
+    {
+      const std::size_t comma = value.find(',');
+      std::string_view item = value.substr(0, comma);
+      value = comma == std::string_view::npos ? std::string_view{} : value.substr(comma + 1);
+      while (!item.empty() && (item.front() == ' ' || item.front() == '\t'))
+        item.remove_prefix(1);
+      while (!item.empty() && (item.back() == ' ' || item.back() == '\t'))
+        item.remove_suffix(1);
+      if (item.size() == token.size() &&
+          std::equal(item.begin(), item.end(), token.begin(), [](char left, char right)
+                     { return std::tolower(static_cast<unsigned char>(left)) == std::tolower(static_cast<unsigned char>(right)); }))
+        return true;
+    }
+    return false;
+  }
+
+  /**
+   * @brief 判断请求是否为合法的 `WebSocket` 升级请求
+   * @details 要求 `GET`、`HTTP/1.1`、`Upgrade: websocket`、`Connection` 含 `upgrade`、
+   *  `Sec-WebSocket-Version: 13` 以及 16 字节随机数的 `base64` 形式 `Sec-WebSocket-Key`
+   */
+  inline bool is_upgrade_request(const http::request<> &request)
+  {
+    const auto &fields = request.base();
+    if (request.method() != boost::beast::http::verb::get || request.version() < 11)
+      return false;
+    auto field_value = [&fields](http::field name) -> std::string_view
+    {
+      auto it = fields.find(name);
+      if (it == fields.end())
+        return {};
+      return std::string_view(it->value().data(), it->value().size());
+    };
+    return header_has_token(field_value(http::field::upgrade), "websocket") &&
+           header_has_token(field_value(http::field::connection), "upgrade") &&
+           field_value(http::field::sec_websocket_version) == "13" &&
+           field_value(http::field::sec_websocket_key).size() == 24;
+  }
+
+  /**
+   * @brief 生成 `101 Switching Protocols` 握手响应
+   * @param request 升级请求
+   * @param deflate `permessage-deflate` 协商结果
+   * @return 握手响应
+   */
+  inline http::response<> make_handshake_response(const http::request<> &request, const deflate_options &deflate)
+  {
+    const auto key = request.base().find(http::field::sec_websocket_key)->value();
+    http::response<> response(boost::beast::http::status::switching_protocols, 11);
+    response.base().set(http::field::upgrade, "websocket");
+    response.base().set(http::field::connection, "Upgrade");
+    response.base().set(http::field::sec_websocket_accept, accept_key(std::string_view(key.data(), key.size())));
+    if (deflate._enabled)
+    {
+      std::string extension = "permessage-deflate; server_no_context_takeover";
+      if (deflate._server_window_bits != 15)
+        extension += "; server_max_window_bits=" + std::to_string(deflate._server_window_bits);
+      if (deflate._client_no_context_takeover)
+        extension += "; client_no_context_takeover";
+      response.base().set(http::field::sec_websocket_extensions, extension);
+    }
+    return response;
+  }
+
+  /**
+   * @brief 按 `permessage-deflate` 压缩一条消息
+   * @details 每条消息使用独立的压缩状态（`server_no_context_takeover`），以同步刷新结束并去掉末尾 `00 00 ff ff`
+   * @param payload 原始消息
+   * @param window_bits 压缩窗口位数
+   * @return 压缩后的负载
+   */
+  inline std::string deflate_message(std::string_view payload, int window_bits = 15)
+  {
+    boost::beast::zlib::deflate_stream stream;
+    stream.reset(6, window_bits, 8, boost::beast::zlib::Strategy::normal);
+    std::string out;
+    out.resize(payload.size() / 2 + 64);
+    boost::beast::zlib::z_params params;
+    params.next_in = payload.data();
+    params.avail_in = payload.size();
+    std::size_t produced = 0;
+    for (;;)
+    {
+      params.next_out = out.data() + produced;
+      params.avail_out = out.size() - produced;
+      boost::beast::error_code ec;
+      stream.write(params, boost::beast::zlib::Flush::sync, ec);
+      produced = out.size() - params.avail_out;
+      // 同步刷新完成的标志：输入耗尽且输出缓冲仍有剩余
+      if (params.avail_in == 0 && params.avail_out > 0)
+        break;
+      if (ec && ec != boost::beast::zlib::error::need_buffers)
+        break;
+      out.resize(out.size() * 2);
+    }
+    out.resize(produced);
+    if (out.size() >= 4 && out.compare(out.size() - 4, 4, std::string_view("\x00\x00\xff\xff", 4)) == 0)
+      out.resize(out.size() - 4);
+    return out;
+  }
+
+  /**
+   * @brief 生成一条完整的服务端消息帧，可直接写给任意连接
+   * @param payload 消息
+   * @param text 文本消息为 `true`，二进制消息为 `false`
+   * @param deflate 是否按 `permessage-deflate` 压缩
+   * @return 帧字节
+   */
+  inline std::string make_message_frame(std::string_view payload, bool text, bool deflate = false)
+  {
+    std::string frame;
+    if (deflate)
+    {
+      const std::string compressed = deflate_message(payload);
+      frame.reserve(compressed.size() + 10);
+      write_frame(frame, text ? opcode::TEXT : opcode::BINARY, compressed, true);
+    }
+    else
+    {
+      frame.reserve(payload.size() + 10);
+      write_frame(frame, text ? opcode::TEXT : opcode::BINARY, payload);
+    }
+    return frame;
+  }
+
+  /**
+   * @brief 连接配置
+   */
+  struct connection_config
+  {
+    std::size_t _max_message_size{1048576}; // 单条消息（解压后）上限，与会话的 `_max_message_size` 一致
+    std::size_t _compress_threshold{64};    // 小于该长度的消息不压缩
+    deflate_options _deflate;               // 握手时协商的压缩参数
+  }; // end struct connection_config
+
+  /**
+   * @class connection
+   * @brief 服务端 `WebSocket` 连接状态机（不做 `IO`）
+   *
+   * @note
+   * - `feed(bytes)` 解析客户端帧：校验掩码与保留位、去掩码、拼接分片、解压 `RSV1` 消息、校验文本的 `UTF-8`，
+   *   收齐一条消息后调用消息回调；`PING` 自动回复 `PONG`，`CLOSE` 回送关闭帧；
+   * - `send(payload, text)` 把消息编码为帧写入输出，启用压缩时超过阈值的消息会被压缩；
+   * - `take_output()` 取出待写出的字节；`closed()` 为 `true` 后写完输出即可关闭连接。
+   *
+   * @warning 非线程安全，须在同一个 `IO` 线程上调用。
+   */
+  class connection
+  {
+  public:
+    using message_handler = std::function<void(std::string_view, bool)>;
+
+  private:
+    connection_config _config;
+    message_handler _on_message;
+    boost::beast::zlib::inflate_stream _inflater;
+
+    std::string _inbound;            // 未凑成完整帧的输入
+    std::string _output;             // 待写出的帧
+    std::string _message;            // 拼接中的分片消息
+    bool _in_message{false};         // 是否正在接收分片消息
+    bool _message_text{false};       // 当前消息是否为文本
+    bool _message_compressed{false}; // 当前消息是否压缩
+    bool _close_sent{false};         // 已发送关闭帧
+    bool _failed{false};             // 因协议错误关闭
+
+  private:
+    /**
+     * @brief 以状态码关闭连接
+     * @return 总是 `false`，便于直接返回
+     */
+    bool _fail(close_code code)
+    {
+      close(code);
+      _failed = true;
+      return false;
+    }
+    /**
+     * @brief 解压一条完整消息
+     */
+    bool _inflate(std::string_view payload, std::string &out)
+    {
+      std::string input(payload);
+      input.append("\x00\x00\xff\xff", 4);
+      boost::beast::zlib::z_params params;
+      params.next_in = input.data();
+      params.avail_in = input.size();
+      out.clear();
+      out.resize(std::max<std::size_t>(payload.size() * 3, 256));
+      std::size_t produced = 0;
+      bool healthy = true;
+      for (;;)
+      {
+        params.next_out = out.data() + produced;
+        params.avail_out = out.size() - produced;
+        boost::beast::error_code ec;
+        _inflater.write(params, boost::beast::zlib::Flush::sync, ec);
+        produced = out.size() - params.avail_out;
+        if (ec == boost::beast::zlib::error::end_of_stream) // 客户端置了最终块标志，之后需要新的解压状态
+        {
+          _inflater.clear();
+          break;
+        }
+        if (ec && ec != boost::beast::zlib::error::need_buffers)
+        {
+          healthy = false;
+          break;
+        }
+        if (params.avail_in == 0 && params.avail_out > 0)
+          break;
+        if (produced > _config._max_message_size)
+          break;
+        out.resize(out.size() * 2);
+      }
+      out.resize(produced);
+      if (_config._deflate._client_no_context_takeover)
+        _inflater.clear();
+      return healthy;
+    }
+    bool _deliver()
+    {
+      std::string inflated;
+      if (_message_compressed)
+      {
+        if (!_inflate(_message, inflated))
+          return _fail(close_code::INVALID_PAYLOAD);
+        if (inflated.size() > _config._max_message_size)
+          return _fail(close_code::MESSAGE_TOO_BIG);
+        _message.swap(inflated);
+      }
+      if (_message_text && !valid_utf8(_message))
+        return _fail(close_code::INVALID_PAYLOAD);
+      _in_message = false;
+      if (_on_message)
+        _on_message(_message, _message_text);
+      _message.clear();
+      return true;
+    }
+    bool _on_control(opcode code, std::string_view payload)
+    {
+      switch (code)
+      {
+      case opcode::PING:
+        if (!_close_sent)
+          write_frame(_output, opcode::PONG, payload);
+        return true;
+      case opcode::PONG:
+        return true;
+      case opcode::CLOSE:
+      {
+        if (payload.size() == 1)
+          return _fail(close_code::PROTOCOL_ERROR);
+        if (payload.empty())
+        {
+          close(close_code::NORMAL);
+          return false;
+        }
+        const auto code_value = static_cast<std::uint16_t>(static_cast<unsigned char>(payload[0]) << 8 |
+                                                           static_cast<unsigned char>(payload[1]));
+        const bool valid_code = (code_value >= 1000 && code_value <= 1003) || (code_value >= 1007 && code_value <= 1011) ||
+                                (code_value >= 3000 && code_value <= 4999);
+        if (!valid_code || !valid_utf8(payload.substr(2)))
+          return _fail(close_code::PROTOCOL_ERROR);
+        close(static_cast<close_code>(code_value));
+        return false;
+      }
+      default:
+        return _fail(close_code::PROTOCOL_ERROR);
+      }
+    }
+
+  public:
+    explicit connection(const connection_config &config = connection_config{}) : _config(config)
+    {
+      _inflater.reset(15);
+    }
+
+    /**
+     * @brief 设置消息回调
+     * @param handler 参数为完整消息与是否为文本
+     */
+    void set_message_handler(message_handler handler)
+    {
+      _on_message = std::move(handler);
+    }
+    /**
+     * @brief 处理收到的字节
+     * @param bytes 任意长度的输入，可以只包含半个帧
+     * @return 连接仍然打开返回 `true`；收到关闭帧或出现协议错误时返回 `false`，关闭帧已写入输出
+     */
+    bool feed(std::string_view bytes)
+    {
+      if (_close_sent)
+        return false;
+      _inbound.append(bytes);
+      std::size_t position = 0;
+      bool open = true;
+      while (open)
+      {
+        const std::string_view rest = std::string_view(_inbound).substr(position);
+        if (rest.size() < 2)
+          break;
+        const auto first = static_cast<unsigned char>(rest[0]);
+        const auto second = static_cast<unsigned char>(rest[1]);
+        const bool fin = (first & 0x80) != 0;
+        const bool rsv1 = (first & 0x40) != 0;
+        const auto code = static_cast<opcode>(first & 0x0f);
+        const bool control = (first & 0x08) != 0;
+        if ((first & 0x30) != 0 || (rsv1 && (!_config._deflate._enabled || control || code == opcode::CONTINUATION)))
+        {
+          open = _fail(close_code::PROTOCOL_ERROR);
+          break;
+        }
+        if ((second & 0x80) == 0) // 客户端帧必须加掩码
+        {
+          open = _fail(close_code::PROTOCOL_ERROR);
+          break;
+        }
+        std::size_t header_size = 2;
+        std::uint64_t length = second & 0x7f;
+        if (length == 126)
+        {
+          if (rest.size() < 4)
+            break;
+          length = static_cast<std::uint64_t>(static_cast<unsigned char>(rest[2])) << 8 | static_cast<unsigned char>(rest[3]);
+          header_size = 4;
+        }
+        else if (length == 127)
+        {
+          if (rest.size() < 10)
+            break;
+          length = 0;
+          for (std::size_t index = 2; index < 10; ++index)
+            length = length << 8 | static_cast<unsigned char>(rest[index]);
+          header_size = 10;
+        }
+        if (control && (!fin || length > max_control_payload))
+        {
+          open = _fail(close_code::PROTOCOL_ERROR);
+          break;
+        }
+        if (length > _config._max_message_size || _message.size() + length > _config._max_message_size)
+        {
+          open = _fail(close_code::MESSAGE_TOO_BIG);
+          break;
+        }
+        if (rest.size() < header_size + 4 + length)
+          break;
+        std::array<unsigned char, 4> mask;
+        std::memcpy(mask.data(), rest.data() + header_size, 4);
+        char *payload = _inbound.data() + position + header_size + 4;
+        const auto payload_size = static_cast<std::size_t>(length);
+        apply_mask(payload, payload_size, mask);
+        position += header_size + 4 + payload_size;
+        const std::string_view payload_view(payload, payload_size);
+
+        if (control)
+        {
+          open = _on_control(code, payload_view);
+          continue;
+        }
+        if (code == opcode::CONTINUATION)
+        {
+          if (!_in_message)
+          {
+            open = _fail(close_code::PROTOCOL_ERROR);
+            break;
+          }
+        }
+        else if (code == opcode::TEXT || code == opcode::BINARY)
+        {
+          if (_in_message)
+          {
+            open = _fail(close_code::PROTOCOL_ERROR);
+            break;
+          }
+          _in_message = true;
+          _message_text = code == opcode::TEXT;
+          _message_compressed = rsv1;
+        }
+        else
+        {
+          open = _fail(close_code::PROTOCOL_ERROR);
+          break;
+        }
+        _message.append(payload_view);
+        if (fin)
+          open = _deliver();
+      }
+      if (open)
+        _inbound.erase(0, position);
+      else
+        _inbound.clear();
+      return open;
+    }
+    /**
+     * @brief 发送一条消息
+     * @param payload 消息
+     * @param text 文本消息为 `true`，二进制消息为 `false`
+     */
+    void send(std::string_view payload, bool text = true)
+    {
+      if (_close_sent)
+        return;
+      const opcode code = text ? opcode::TEXT : opcode::BINARY;
+      if (_config._deflate._enabled && payload.size() >= _config._compress_threshold)
+        write_frame(_output, code, deflate_message(payload, _config._deflate._server_window_bits), true);
+      else
+        write_frame(_output, code, payload);
+    }
+    /**
+     * @brief 发送 `PING`
+     * @param payload 负载，超过 125 字节时截断
+     */
+    void ping(std::string_view payload = {})
+    {
+      if (!_close_sent)
+        write_frame(_output, opcode::PING, payload.substr(0, max_control_payload));
+    }
+    /**
+     * @brief 发送关闭帧，之后不再接收也不再发送消息
+     * @param code 状态码
+     * @param reason 原因短语
+     */
+    void close(close_code code = close_code::NORMAL, std::string_view reason = {})
+    {
+      if (_close_sent)
+        return;
+      std::string payload;
+      payload.push_back(static_cast<char>(static_cast<std::uint16_t>(code) >> 8));
+      payload.push_back(static_cast<char>(static_cast<std::uint16_t>(code) & 0xff));
+      payload.append(reason.substr(0, max_control_payload - 2));
+      write_frame(_output, opcode::CLOSE, payload);
+      _close_sent = true;
+    }
+    /**
+     * @brief 是否有待写出的字节
+     */
+    bool has_output() const noexcept
+    {
+      return !_output.empty();
+    }
+    /**
+     * @brief 取出待写出的字节
+     */
+    std::string take_output()
+    {
+      std::string out = std::move(_output);
+      _output.clear();
+      return out;
+    }
+    /**
+     * @brief 是否已发送关闭帧
+     */
+    bool closed() const noexcept
+    {
+      return _close_sent;
+    }
+    /**
+     * @brief 是否启用了 `permessage-deflate`
+     */
+    bool deflate_enabled() const noexcept
+    {
+      return _config._deflate._enabled;
+    }
+  }; // end class connection
+} // end namespace protocol::websocket
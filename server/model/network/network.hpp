@@ -4,6 +4,8 @@
 
 
 #include "./agreement/http.hpp"  // http协议
+#include "./agreement/http2.hpp" // http/2协议（帧、HPACK、连接状态机）
+#include "./agreement/websocket.hpp" // websocket协议（握手、帧解析、permessage-deflate）
 #include "./agreement/json.hpp"  // json协议
 #include "./agreement/auxiliary.hpp" // tcp协议头基类
 #include "./agreement/protocol.hpp"  // tcp协议头和协议封装
@@ -49,6 +51,22 @@ namespace wan
     {
       using namespace protocol::http;
     } // end namespace http 
+    /**
+     * @brief http/2模块
+     * @note 提供http/2帧编解码、HPACK头部压缩与连接状态机
+     */
+    namespace http2
+    {
+      using namespace protocol::http2;
+    } // end namespace http2
+    /**
+     * @brief websocket模块
+     * @note 提供websocket握手、帧编解码与permessage-deflate压缩
+     */
+    namespace websocket
+    {
+      using namespace protocol::websocket;
+    } // end namespace websocket
     /**
      * @brief 加密模块
      * @note 提供加密、解密、哈希等功能
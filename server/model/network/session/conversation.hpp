@@ -22,6 +22,8 @@
 
 #include "../../sched/thread_pool.hpp"
 #include "./fundamental.hpp"
+#include "../agreement/websocket.hpp"
+#include "../../container/simulate_vector.hpp"
 
 namespace conversation
 {
@@ -161,7 +163,7 @@ namespace conversation
       if(!_running.load())
         return;
         
-      std::vector<std::string> inactive_sessions;
+      standard_con::small_vector<std::string, 8> inactive_sessions; // 每轮过期会话通常很少，避免每次清理都分配
       {
         std::shared_lock<std::shared_mutex> lock(_sessions_mutex);
         for (const auto& pair : _sessions_map)
@@ -313,10 +315,23 @@ namespace conversation
     }
     auto create_session(boost::asio::ip::tcp::socket&& socket)
     -> session_ptr
+    {
+      return create_session(std::move(socket), fundamental::session_type::TCP_SERVER, fundamental::session_config{});
+    }
+    /**
+     * @brief 以指定类型与配置创建会话
+     * @param socket 会话套接字
+     * @param type 会话类型
+     * @param config 会话配置（如`SSL`证书、`ALPN`候选协议）
+     * @return `std::shared_ptr<session<request,response>>` 会话指针，套接字未打开时为空
+     */
+    auto create_session(boost::asio::ip::tcp::socket&& socket, fundamental::session_type type,
+      const fundamental::session_config& config)
+    -> session_ptr
     {
       if(socket.is_open())
       {
-        session_ptr sess = std::make_shared<fundamental::session<request_t,response_t>>(std::move(socket));
+        session_ptr sess = std::make_shared<fundamental::session<request_t,response_t>>(std::move(socket), type, config);
         {
           std::lock_guard<std::shared_mutex> lock(_sessions_mutex);
           std::string session_string_id = sess->get_session_id();
@@ -355,6 +370,21 @@ namespace conversation
         return std::make_pair(sess->get_session_id(), sess);
       return std::make_pair(std::string{}, nullptr);
     }
+    /**
+     * @brief 按配置创建服务器会话
+     * @param socket 会话套接字
+     * @param config 会话配置，启用`SSL`时创建`SSL`服务端会话，握手在`start()`中进行
+     * @return `std::pair<string,std::shared_ptr<session<request,response>>>` 会话指针
+     */
+    auto create_server_session(boost::asio::ip::tcp::socket&& socket, const fundamental::session_config& config)
+    -> std::pair<std::string, session_ptr>
+    {
+      const auto type = config._enable_ssl ? fundamental::session_type::SSL_SERVER : fundamental::session_type::TCP_SERVER;
+      auto sess = create_session(std::move(socket), type, config);
+      if(sess)
+        return std::make_pair(sess->get_session_id(), sess);
+      return std::make_pair(std::string{}, nullptr);
+    }
     /**
      * @brief 获取会话
      * @param session_string_id 会话ID
@@ -681,20 +711,46 @@ namespace conversation
      * @param data 原始数据
      * @param priority 入口调度优先级
      * @param only_connected 仅对已连接会话执行
+     * @param only_protocol 仅向承载该协议的会话广播，缺省时不过滤
+     * @param text `WebSocket`帧是否为文本帧，缺省时合法`UTF-8`按文本发送，否则按二进制发送
      * @return `true` 有提交；`false` 无匹配会话
+     * @note 已升级为`WebSocket`的会话收到按帧封装后的数据：帧在线程池中只编码一次（压缩与非压缩各一份），
+     * 短于会话压缩阈值（连接的`connection_config::_compress_threshold`）的消息不压缩；帧交给会话的写入回调排队异步写出，
+     * 其余会话仍按原始字节发送
      */
-    bool broadcast_bytes(std::string_view data, weight priority = weight::normal, bool only_connected = true)
+    bool broadcast_bytes(std::string_view data, weight priority = weight::normal, bool only_connected = true,
+      std::optional<protocol::auxiliary::protocol_type> only_protocol = std::nullopt, std::optional<bool> text = std::nullopt)
     {
-      auto snapshot = _all_session(only_connected);
+      auto snapshot = only_protocol
+        ? _conditional_filtering([type = *only_protocol](const auto&, const session_ptr& sp)
+          { return sp->get_protocol_type() == type; }, only_connected)
+        : _all_session(only_connected);
       if(snapshot.empty()) return false;
       auto payload = std::make_shared<std::string>(data);
-      auto dispatch_function = [this, vec = std::move(snapshot), payload]() mutable
+      auto dispatch_function = [this, vec = std::move(snapshot), payload, text]() mutable
       {
+        std::shared_ptr<std::string> plain_frame, deflate_frame;
+        const bool text_frame = text ? *text : protocol::websocket::valid_utf8(*payload);
         for(auto& sp : vec)
         {
-          auto send_fn = [sp, payload]() mutable
+          if(sp->get_protocol_type() == protocol::auxiliary::protocol_type::WEBSOCKET)
+          {
+            // 每个会话按自己的压缩阈值决定是否压缩；帧内容只取决于这一决定，压缩与非压缩各编码一次
+            const bool deflate = sp->websocket_deflate() && payload->size() >= sp->websocket_compress_threshold();
+            auto& cached = deflate ? deflate_frame : plain_frame;
+            if(!cached)
+              cached = std::make_shared<std::string>(protocol::websocket::make_message_frame(*payload, text_frame, deflate));
+            // 写入回调在连接的写锁下入队，多个 IO 线程同时推送时帧仍按顺序写出
+            auto write_fn = [sp, frame = cached]() mutable
+            {
+              try { sp->write_websocket(*frame); } catch(...) { }
+            };
+            boost::asio::dispatch(_io_context, std::move(write_fn));
+            continue;
+          }
+          auto send_fn = [sp, frame = payload]() mutable
           {
-            try { sp->send_bytes(*payload); } catch(...) { }
+            try { sp->send_bytes(*frame); } catch(...) { }
           };
           boost::asio::dispatch(_io_context, std::move(send_fn));
         }
@@ -6,6 +6,8 @@
 #pragma once
 #include <memory>
 #include <string>
+#include <vector>
+#include <array>
 #include <mutex>
 #include <shared_mutex>
 #include <cstdlib>
@@ -129,6 +131,7 @@ namespace conversation::fundamental
     std::string _ssl_ca_file;                             // CA证书文件（仅此处加载）
     std::string _tls_server_name;                         // SNI与主机名验证的服务器名
     bool _ssl_insecure_skip_verify{false};                // 跳过证书校验（开发/测试用）
+    std::vector<std::string> _alpn_protocols;             // 服务端`ALPN`候选协议，按优先级排列（如`h2`、`http/1.1`）
 
     std::size_t _max_buffer_size{65536};    // 最大缓冲区大小
     std::size_t _max_message_size{1048576}; // 最大消息大小
@@ -165,6 +168,7 @@ namespace conversation::fundamental
   public:
     using session_ptr = std::shared_ptr<session<request_t, response_t>>; // 会话指针类型
     using reception_processing = std::function<void(session_ptr, std::string_view)>;
+    using frame_writer = std::function<void(std::string_view)>; // `WebSocket`帧写入回调（排入连接的输出队列）
   private:
 
     boost::asio::io_context& _io_context; // 引用IO上下文
@@ -188,6 +192,13 @@ namespace conversation::fundamental
 
     std::string _received_data; // 读取缓冲区
     reception_processing _on_data; // 读取数据回调（字节视图）
+    std::string _alpn_wire; // `ALPN`候选协议的线格式（长度前缀拼接）
+
+    std::atomic<protocol::auxiliary::protocol_type> _protocol{protocol::auxiliary::protocol_type::CUSTOM_TCP}; // 当前承载的应用层协议
+    std::atomic<bool> _websocket_deflate{false}; // `WebSocket`推送帧是否可使用共享的`permessage-deflate`压缩帧
+    std::atomic<std::size_t> _websocket_compress_threshold{0}; // 短于该长度的推送消息不压缩，取自连接协商出的配置
+    frame_writer _websocket_writer; // `WebSocket`帧写入回调，升级时由服务端设置
+    std::mutex _websocket_writer_mutex; // 保护`_websocket_writer`：广播可能在任意`IO`线程上写帧，关闭时清空回调
   private:
     /**
      * @brief 生成唯一会话`ID`
@@ -198,6 +209,21 @@ namespace conversation::fundamental
     {
       return encryption::umbrage_hash::SHA256(encryption::mix64());
     }
+    /**
+     * @brief `ALPN`协商回调，按服务端优先级选出双方都支持的协议
+     * @note 没有交集时不确认`ALPN`，握手继续，由上层按`HTTP/1.1`处理
+     */
+    static int _select_alpn(SSL *, const unsigned char **out, unsigned char *out_length,
+      const unsigned char *offered, unsigned int offered_length, void *argument)
+    {
+      const auto *wire = static_cast<const std::string *>(argument);
+      unsigned char *selected = nullptr;
+      if (SSL_select_next_proto(&selected, out_length, reinterpret_cast<const unsigned char *>(wire->data()),
+            static_cast<unsigned int>(wire->size()), offered, offered_length) != OPENSSL_NPN_NEGOTIATED)
+        return SSL_TLSEXT_ERR_NOACK;
+      *out = selected;
+      return SSL_TLSEXT_ERR_OK;
+    }
     /**
      * @brief 创建SSL上下文
      * @return SSL上下文
@@ -218,6 +244,16 @@ namespace conversation::fundamental
             ssl_context.use_certificate_chain_file(_config._ssl_cert_file);
           if(!_config._ssl_key_file.empty())
             ssl_context.use_private_key_file(_config._ssl_key_file, boost::asio::ssl::context::pem);
+          if(!_config._alpn_protocols.empty())
+          {
+            _alpn_wire.clear();
+            for(const auto& protocol_name : _config._alpn_protocols)
+            {
+              _alpn_wire.push_back(static_cast<char>(protocol_name.size()));
+              _alpn_wire.append(protocol_name);
+            }
+            SSL_CTX_set_alpn_select_cb(ssl_context.native_handle(), &session::_select_alpn, &_alpn_wire);
+          }
         }
         else if(_type == session_type::SSL_CLIENT)
         {
@@ -498,6 +534,75 @@ namespace conversation::fundamental
     {
       return _remote_port;
     }
+    /**
+     * @brief 获取`TLS`握手时`ALPN`协商出的协议
+     * @return 协议名（如`h2`），明文连接或未协商时为空
+     */
+    std::string get_alpn_protocol() const
+    {
+      if(!_ssl_socket)
+        return {};
+      const unsigned char *selected = nullptr;
+      unsigned int length = 0;
+      SSL_get0_alpn_selected(_ssl_socket->native_handle(), &selected, &length);
+      return selected ? std::string(reinterpret_cast<const char *>(selected), length) : std::string{};
+    }
+    /**
+     * @brief 将会话标记为`WebSocket`连接
+     * @param deflate 协商出的`permessage-deflate`是否允许直接发送共享压缩帧
+     * @param compress_threshold 连接配置的压缩阈值，短于该长度的推送消息发送非压缩帧
+     * @param writer 帧写入回调，把帧排入连接的输出队列，与握手响应、控制帧按顺序异步写出；须线程安全
+     * @note 由服务端在`101`握手响应排入输出队列后调用，之后广播会按`WebSocket`帧封装数据并交给`writer`
+     */
+    void upgrade_websocket(bool deflate, std::size_t compress_threshold, frame_writer writer)
+    {
+      {
+        std::scoped_lock lock(_websocket_writer_mutex);
+        _websocket_writer = std::move(writer);
+      }
+      _websocket_compress_threshold.store(compress_threshold, std::memory_order_relaxed);
+      _websocket_deflate.store(deflate, std::memory_order_relaxed);
+      _protocol.store(protocol::auxiliary::protocol_type::WEBSOCKET, std::memory_order_release);
+    }
+    /**
+     * @brief 写出一个`WebSocket`帧
+     * @param frame 已编码的帧
+     * @note 可在任意`IO`线程上调用，回调在锁外执行；未设置写入回调时（会话已关闭）丢弃
+     */
+    void write_websocket(std::string_view frame)
+    {
+      frame_writer writer;
+      {
+        std::scoped_lock lock(_websocket_writer_mutex);
+        writer = _websocket_writer;
+      }
+      if (writer)
+        writer(frame);
+    }
+    /**
+     * @brief 获取会话当前承载的应用层协议
+     * @return 协议类型，未升级的连接为`protocol_type::CUSTOM_TCP`
+     */
+    protocol::auxiliary::protocol_type get_protocol_type() const noexcept
+    {
+      return _protocol.load(std::memory_order_acquire);
+    }
+    /**
+     * @brief 检查`WebSocket`推送是否可使用压缩帧
+     * @return 是否可发送共享的`permessage-deflate`压缩帧
+     */
+    bool websocket_deflate() const noexcept
+    {
+      return _websocket_deflate.load(std::memory_order_relaxed);
+    }
+    /**
+     * @brief 获取`WebSocket`推送的压缩阈值
+     * @return 短于该长度的消息发送非压缩帧
+     */
+    std::size_t websocket_compress_threshold() const noexcept
+    {
+      return _websocket_compress_threshold.load(std::memory_order_relaxed);
+    }
     /**
      * @brief 获取统计信息
      * @return 统计信息
@@ -1051,6 +1156,45 @@ namespace conversation::fundamental
         boost::asio::async_write(_socket,boost::asio::buffer(*buffer_ptr),tcp_send_function);
       }
     }
+    /**
+     * @brief 异步聚集写出两段共享缓冲区
+     * @param head 首段字节（如预先渲染的响应头块）
+     * @param body 次段字节（如缓存中的文件内容）
+     * @param callback 发送完成回调
+     * @details
+     *   - 两段缓冲区以共享指针持有，异步写期间不复制，多个会话可同时引用同一份数据；
+     *   - 以一次 `async_write` 提交两段缓冲区，明文连接由内核聚集写出。
+     * @note 统计与错误处理同 `async_send_bytes`，一次调用计为一条消息。
+     */
+    void async_send_buffers(std::shared_ptr<const std::string> head, std::shared_ptr<const std::string> body,
+      std::function<void(const boost::system::error_code&)> callback = nullptr)
+    {
+      if (_state != session_state::CONNECTED)
+      {
+        if (callback)
+          callback(boost::asio::error::not_connected);
+        return;
+      }
+      const std::array<boost::asio::const_buffer, 2> buffers{boost::asio::buffer(*head), boost::asio::buffer(*body)};
+      auto self = this->shared_from_this();
+      auto send_function = [self,callback,head,body](const boost::system::error_code& ec,std::uint64_t bytes_transferred)
+      {
+        if(!ec)
+        {
+          self->_statistics._bytes_sent += bytes_transferred;
+          self->_statistics._messages_sent++;
+          self->_statistics.renewal_activity();
+        }
+        else
+          self->_handle_error(ec);
+        if (callback)
+          callback(ec);
+      };
+      if(_config._enable_ssl && _ssl_socket)
+        boost::asio::async_write(*_ssl_socket,buffers,send_function);
+      else
+        boost::asio::async_write(_socket,buffers,send_function);
+    }
     /**
      * @brief 关闭会话
      * @details 关闭会话，释放资源
@@ -1062,6 +1206,10 @@ namespace conversation::fundamental
       _set_state(session_state::DISCONNECTING);
       boost::system::error_code ec;
       _on_data = {};
+      {
+        std::scoped_lock lock(_websocket_writer_mutex);
+        _websocket_writer = {};
+      }
       _timer.cancel();
       if(_ssl_socket)
         _ssl_socket->lowest_layer().close(ec);
@@ -3,12 +3,18 @@
 #include <iostream>
 #include <thread>
 #include <filesystem>
+#include <cstdlib>
 
 int main()
 {
   boost::asio::io_context io_context;
   server server(io_context, 6779);
   server.set_web_root((std::filesystem::path(__FILE__).parent_path() / "webroot").string());
+  // 设置证书与私钥后以 TLS 提供服务，并通过 ALPN 协商 h2；未设置时为明文，可用 h2c 先验知识访问
+  const char *tls_cert = std::getenv("SERVER_TLS_CERT");
+  const char *tls_key = std::getenv("SERVER_TLS_KEY");
+  if (tls_cert && tls_key)
+    server.enable_tls(tls_cert, tls_key);
   server.start();
   auto io_function = [&io_context]()
   {
@@ -1,5 +1,6 @@
 #pragma once
 #include "model/network/network.hpp"
+#include "model/container/simulate_perfect.hpp"
 
 #include <iostream>
 #include <string>
@@ -8,10 +9,14 @@
 #include <format>
 #include <chrono>
 #include <functional>
+#include <mutex>
+#include <utility>
 #include <filesystem>
 #include <optional>
 #include <unordered_map>
 #include <list>
+#include <array>
+#include <ctime>
 #include <boost/asio.hpp>
 #include <atomic>
 
@@ -19,8 +24,10 @@
 using namespace wan::network;
 
 using request_processing_fn = std::function<http::response<>(const http::request<>&)>;
+using websocket_message_fn = std::function<void(const std::string &session_id, std::string_view message, bool text)>;
 
 static const std::string INDEX_HTML_PATH = "index.html";
+static const std::string WEBSOCKET_PATH = "/ws"; // `WebSocket`推送通道的升级路径
 
 struct format_time
 {
@@ -73,7 +80,10 @@ struct status_response
   asset html_500;
 };
 
-static const std::unordered_map<std::string, std::string> extension_map{
+/**
+ * @brief 扩展名到 MIME 类型的映射，编译期构建的完美哈希表，运行期零构造、按 `string_view` 查找
+ */
+static constexpr auto extension_map = standard_con::make_perfect_hash_map<std::string_view, std::string_view>({
     {"html", "text/html"},
     {"htm", "text/html"},
     {"css", "text/css"},
@@ -96,8 +106,8 @@ static const std::unordered_map<std::string, std::string> extension_map{
     {"mp3", "audio/mpeg"},
     {"wav", "audio/wav"},
     {"flac", "audio/flac"},
-    {"aac", "audio/aac"},
-};
+    {"aac", "audio/aac"}
+});
 
 /**
  * @brief 简单的http静态网页服务器
@@ -113,16 +123,28 @@ class server
     std::size_t capacity_bytes{64 * 1024 * 1024};
     std::size_t size_bytes{0};
     std::list<std::string> recency;
-    struct entry { std::string data; std::size_t bytes; std::list<std::string>::iterator it; };
+    struct entry
+    {
+      std::shared_ptr<const std::string> data;                   // 文件内容，发送期间由写操作共同持有
+      std::array<std::shared_ptr<const std::string>, 2> headers; // 预渲染的`200`响应头块，按是否`keep-alive`区分
+      std::size_t bytes;
+      std::list<std::string>::iterator it;
+    };
     std::unordered_map<std::string, entry> map;
 
-    std::string get(const std::string &key)
+    entry *find(const std::string &key)
     {
       auto it = map.find(key);
       if (it == map.end())
-        return {};
+        return nullptr;
       recency.splice(recency.begin(), recency, it->second.it);
-      return it->second.data;
+      return &it->second;
+    }
+
+    std::string get(const std::string &key)
+    {
+      auto *cached = find(key);
+      return cached ? *cached->data : std::string{};
     }
 
     void put(std::string key, std::string data)
@@ -132,7 +154,8 @@ class server
       if (it != map.end())
       {
         size_bytes -= it->second.bytes;
-        it->second.data = std::move(data);
+        it->second.data = std::make_shared<const std::string>(std::move(data));
+        it->second.headers = {};
         it->second.bytes = bytes;
         recency.splice(recency.begin(), recency, it->second.it);
         size_bytes += bytes;
@@ -140,7 +163,7 @@ class server
       else
       {
         recency.push_front(key);
-        map.emplace(key, entry{std::move(data), bytes, recency.begin()});
+        map.emplace(key, entry{std::make_shared<const std::string>(std::move(data)), {}, bytes, recency.begin()});
         size_bytes += bytes;
       }
       while (size_bytes > capacity_bytes && !recency.empty())
@@ -164,22 +187,91 @@ class server
   boost::asio::ip::tcp::acceptor acceptor;                                           // tcp监听器
   session::session_management<http::request<>, http::response<>> session_management; // 会话连接管理
   std::atomic<bool> server_running{false};
+  session::session_config tls_config;                                                // TLS会话配置
+  bool tls_enabled{false};                                                           // 是否启用TLS
+  websocket_message_fn websocket_handler;                                            // WebSocket客户端消息回调
 private:
+  using session_ptr = std::shared_ptr<session::session<http::request<>, http::response<>>>;
+
+  /**
+   * @brief 单个连接上的协议状态
+   * @details 收齐`HTTP/2`连接前言或`ALPN`协商出`h2`时创建状态机，`HTTP/1.1`请求升级到`WebSocket`后
+   * 创建帧状态机，之后该连接上的数据都交给对应状态机处理
+   */
+  struct connection_channel
+  {
+    std::unique_ptr<http2::connection> h2;     // HTTP/2 状态机，HTTP/1.1 连接为空
+    std::unique_ptr<websocket::connection> ws; // WebSocket 状态机，未升级的连接为空
+    std::string preface;                       // 已收到但不足以判定协议的字节：与连接前言一致且短于前言
+    std::string ws_output;                     // 待写出的 WebSocket 字节：握手响应、控制帧与广播帧按入队顺序排列
+    bool writing{false};                       // 是否有写操作在途，保证帧按顺序写出
+    std::mutex ws_mutex;                       // 保护 ws、ws_output 与 WebSocket 连接上的 writing：广播帧可能从其他 IO 线程入队
+  };
+
+  /**
+   * @brief 连接首部字节与`HTTP/2`连接前言的比较结果
+   */
+  enum class preface_match
+  {
+    http1,   // 与前言不一致，按`HTTP/1.1`处理
+    partial, // 目前一致但不足前言长度，继续缓存
+    http2    // 收齐前言或`ALPN`协商出`h2`
+  };
+
+  /**
+   * @brief 缓存命中时的响应：预渲染头块与文件内容，两段缓冲区交给一次聚集写
+   */
+  struct prebuilt_response
+  {
+    std::shared_ptr<const std::string> header; // 状态行与全部头部字段（含`Date`）
+    std::shared_ptr<const std::string> body;   // 缓存中的文件内容；无法缓存的文件整条响应都在头块中，此段为空
+  };
 
   /**
    * @brief 获取文件MIME类型
    * @param path 文件路径
    */
-  std::string mime_type(std::string path)
+  std::string_view mime_type(std::string_view path) const noexcept
   {
     auto dot = path.rfind('.');
-    if (dot == std::string::npos)
-      return "text/plain";
-    auto ext = std::string(path.substr(dot + 1));
-    auto it = extension_map.find(ext);
-    if (it == extension_map.end())
+    if (dot == std::string_view::npos)
       return "text/plain";
-    return it->second;
+    return extension_map.value_or(path.substr(dot + 1), "text/plain");
+  }
+
+  /**
+   * @brief 按MIME类型选择`Cache-Control`
+   * @param mt MIME类型
+   * @return 指令值，无需设置时为空
+   */
+  static std::string_view cache_control_for(std::string_view mt) noexcept
+  {
+    if (mt.starts_with("image/") || mt == "application/javascript" || mt == "text/css" || mt.starts_with("audio/") || mt.starts_with("video/"))
+      return "public, max-age=31536000, immutable";
+    if (mt == "text/html")
+      return "no-cache";
+    if (mt == "application/json")
+      return "no-store";
+    return {};
+  }
+
+  /**
+   * @brief 获取当前时间的`HTTP`日期（`IMF-fixdate`）
+   * @return 定长`29`字节的日期，如`Sun, 06 Nov 1994 08:49:37 GMT`
+   * @note 每个线程每秒只格式化一次，其余调用直接返回缓存
+   */
+  static std::string_view http_date()
+  {
+    thread_local std::time_t cached_second{-1};
+    thread_local std::string cached_value;
+    const auto now = std::chrono::system_clock::now();
+    const std::time_t second = std::chrono::system_clock::to_time_t(now);
+    if (second != cached_second)
+    {
+      cached_second = second;
+      cached_value = std::format("{:%a, %d %b %Y %H:%M:%S} GMT", std::chrono::floor<std::chrono::seconds>(now));
+    }
+    return cached_value;
   }
 
   /**
@@ -202,8 +294,10 @@ private:
     std::string data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
     {
       std::scoped_lock lk(asset_cache_mtx);
-      asset_cache.put(key, std::move(data));
-      return asset_cache.get(key);
+      // 超出缓存容量的文件放入后会被立即淘汰，直接返回读到的内容
+      if (!data.empty() && data.size() <= asset_cache.capacity_bytes)
+        asset_cache.put(key, data);
+      return data;
     }
   }
 
@@ -249,6 +343,170 @@ private:
     status_htmlresponses.html_500 = asset(path_500);
   }
 
+  /**
+   * @brief 渲染静态文件`200`响应的完整头块
+   * @param file_path 规范化后的绝对路径
+   * @param content_length 正文长度
+   * @param keep_alive 是否保持连接
+   * @return 以空行结尾的头块，`Date`固定为最后一个字段，便于每秒原地替换
+   */
+  std::string render_header_block(const std::string &file_path, std::size_t content_length, bool keep_alive)
+  {
+    const std::string_view mt = mime_type(file_path);
+    std::string block;
+    block.reserve(256);
+    block.append("HTTP/1.1 200 OK\r\nContent-Type: ").append(mt).append("\r\n");
+    if (const auto cache_control = cache_control_for(mt); !cache_control.empty())
+      block.append("Cache-Control: ").append(cache_control).append("\r\n");
+    if (const auto etag = build_etag_for_path(file_path); !etag.empty())
+      block.append("ETag: ").append(etag).append("\r\n");
+    block.append("Access-Control-Allow-Origin: *\r\n");
+    block.append("Content-Length: ").append(std::to_string(content_length)).append("\r\n");
+    block.append(keep_alive ? "Connection: keep-alive\r\n" : "Connection: close\r\n");
+    block.append("Date: ").append(http_date()).append("\r\n\r\n");
+    return block;
+  }
+
+  /**
+   * @brief 从缓存条目取出预渲染响应，必要时刷新头块中的`Date`
+   * @details 秒数变化后复制一份并改写末尾的`Date`，仍在写出的旧头块由发送操作持有，不会被原地修改
+   * @return 头块尚未渲染时返回空，由调用方在锁外渲染
+   * @warning 调用方需持有`asset_cache_mtx`
+   */
+  std::optional<prebuilt_response> prebuilt_from_entry(lru_cache::entry &cached, bool keep_alive)
+  {
+    static constexpr std::size_t date_size = 29; // `IMF-fixdate`定长
+    static constexpr std::size_t date_tail = 4;  // 日期之后的`\r\n\r\n`
+    auto &header = cached.headers[keep_alive ? 1 : 0];
+    if (!header)
+      return std::nullopt;
+    const std::string_view date = http_date();
+    if (std::string_view(*header).substr(header->size() - date_tail - date_size, date_size) != date)
+    {
+      auto refreshed = std::make_shared<std::string>(*header);
+      refreshed->replace(refreshed->size() - date_tail - date_size, date_size, date);
+      header = std::move(refreshed);
+    }
+    return prebuilt_response{header, cached.data};
+  }
+
+  /**
+   * @brief 获取静态文件的预渲染响应
+   * @param file_path 规范化后的绝对路径（与缓存键一致）
+   * @param keep_alive 是否保持连接
+   * @return 头块与正文两段共享缓冲区；不是普通文件或无法打开时返回空
+   * @details 未命中时读取一次文件：能放入缓存的写入缓存并取预渲染头块；为空或超出缓存容量的文件
+   * 用已读到的内容按常规流程渲染整条响应（空文件为`404`），不再交给`default_handle_request`重新读取。
+   * `asset_cache_mtx`只在查找与写入缓存时持有，读文件与渲染头块（生成`ETag`需要查询文件状态）都在锁外进行
+   */
+  std::optional<prebuilt_response> prebuilt_static_response(const std::string &file_path, bool keep_alive)
+  {
+    std::shared_ptr<const std::string> body;
+    {
+      std::scoped_lock lk(asset_cache_mtx);
+      if (auto *cached = asset_cache.find(file_path))
+      {
+        if (auto prebuilt = prebuilt_from_entry(*cached, keep_alive))
+          return prebuilt;
+        body = cached->data;
+      }
+    }
+    if (!body)
+    {
+      std::error_code ec;
+      if (!std::filesystem::is_regular_file(file_path, ec))
+        return std::nullopt;
+      std::ifstream file(file_path, std::ios::binary);
+      if (!file)
+        return std::nullopt;
+      std::string data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+      {
+        std::scoped_lock lk(asset_cache_mtx);
+        if (!data.empty() && data.size() <= asset_cache.capacity_bytes)
+        {
+          asset_cache.put(file_path, std::move(data));
+          body = asset_cache.find(file_path)->data;
+        }
+      }
+      if (!body)
+      {
+        static const auto empty_body = std::make_shared<const std::string>();
+        auto response = make_static_response(file_path, keep_alive, std::move(data));
+        response.base().set(http::field::access_control_allow_origin, "*");
+        return prebuilt_response{std::make_shared<const std::string>(response.to_string()), empty_body};
+      }
+    }
+    auto header = std::make_shared<const std::string>(render_header_block(file_path, body->size(), keep_alive));
+    {
+      // 条目在渲染期间可能被替换或淘汰，只把头块写回仍持有同一份内容的条目
+      std::scoped_lock lk(asset_cache_mtx);
+      if (auto *cached = asset_cache.find(file_path); cached && cached->data == body && !cached->headers[keep_alive ? 1 : 0])
+        cached->headers[keep_alive ? 1 : 0] = header;
+    }
+    return prebuilt_response{header, body};
+  }
+
+  /**
+   * @brief 把请求目标解析为静态文件路径
+   * @param target 请求目标
+   * @return 规范化后的绝对路径；越出`web`根目录（`/data/`目标为数据目录）时返回空
+   */
+  std::string resolve_static_path(const std::string &target)
+  {
+    auto root = std::filesystem::weakly_canonical(std::filesystem::path(web_root));
+    if (target.starts_with("/data/"))
+    {
+      auto data_root = std::filesystem::weakly_canonical(root / "data");
+      auto full = std::filesystem::weakly_canonical(data_root / target.substr(6));
+      std::string full_str = full.string();
+      if (full_str.rfind(data_root.string(), 0) != 0)
+        return {};
+      return full_str;
+    }
+    std::string rel;
+    if (target == "/" || target == "/index.html")
+      rel = INDEX_HTML_PATH;
+    else if (!target.empty() && target[0] == '/')
+      rel = target.substr(1);
+    else
+      rel = target;
+    auto full = std::filesystem::weakly_canonical(root / rel);
+    std::filesystem::path rel_path = std::filesystem::relative(full, root);
+    for (auto &part : rel_path)
+    {
+      if (part == "..")
+        return {};
+    }
+    return full.string();
+  }
+
+  /**
+   * @brief 尝试以预渲染响应回应静态文件请求
+   * @param request 请求
+   * @return 命中时返回头块与正文两段缓冲区；非`GET`、条件请求、接口请求或无法缓存的文件返回空，
+   * 由`default_handle_request`按常规流程处理
+   */
+  std::optional<prebuilt_response> find_prebuilt_response(const http::request<> &request)
+  {
+    if (request.method() != boost::beast::http::verb::get || request.base().count(http::field::if_none_match))
+      return std::nullopt;
+    auto target_sv = request.target();
+    std::string target{target_sv.data(), target_sv.size()};
+    if (target.starts_with("/api/"))
+      return std::nullopt;
+    try
+    {
+      const std::string full = resolve_static_path(target);
+      if (full.empty())
+        return std::nullopt;
+      return prebuilt_static_response(full, request.keep_alive());
+    }
+    catch (...)
+    {
+      return std::nullopt;
+    }
+  }
+
   /**
    * @brief 生成静态文件响应
    * @param file_path 文件路径
@@ -256,9 +514,20 @@ private:
    * @return http::response<> 响应
    */
   http::response<> make_static_response(const std::string &file_path, bool keep_alive)
+  {
+    return make_static_response(file_path, keep_alive, read_file_cached(std::filesystem::path(file_path)));
+  }
+
+  /**
+   * @brief 用已读取的文件内容生成静态文件响应
+   * @param file_path 文件路径
+   * @param keep_alive 是否保持连接
+   * @param body 文件内容，为空时返回`404`
+   * @return http::response<> 响应
+   */
+  http::response<> make_static_response(const std::string &file_path, bool keep_alive, std::string body)
   {
     http::response<> response;
-    auto body = read_file_cached(std::filesystem::path(file_path));
     if (body.empty())
     {
       response.result(boost::beast::http::status::not_found);
@@ -268,24 +537,16 @@ private:
     else
     {
       response.result(boost::beast::http::status::ok);
-      const std::string mt = mime_type(file_path);
-      response.base().set(http::field::content_type, mt);
-      if (mt.starts_with("image/") || mt == "application/javascript" || mt == "text/css" || mt.starts_with("audio/") || mt.starts_with("video/"))
-      {
-        response.base().set(http::field::cache_control, "public, max-age=31536000, immutable");
-      }
-      else if (mt == "text/html")
-      {
-        response.base().set(http::field::cache_control, "no-cache");
-      }
-      else if (mt == "application/json")
-      {
-        response.base().set(http::field::cache_control, "no-store");
-      }
+      const std::string_view mt = mime_type(file_path);
+      response.base().set(http::field::content_type, boost::beast::string_view(mt.data(), mt.size()));
+      if (const auto cache_control = cache_control_for(mt); !cache_control.empty())
+        response.base().set(http::field::cache_control, boost::beast::string_view(cache_control.data(), cache_control.size()));
       auto etag = build_etag_for_path(file_path);
       if (!etag.empty()) { response.base().set(http::field::etag, etag); }
       response.body() = std::move(body);
     }
+    const std::string_view date = http_date();
+    response.base().set(http::field::date, boost::beast::string_view(date.data(), date.size()));
     response.keep_alive(keep_alive);
     response.base().content_length(response.body().size());
     response.prepare_payload();
@@ -350,12 +611,8 @@ private:
 
     if (target.starts_with("/data/"))
     {
-      auto root = std::filesystem::weakly_canonical(std::filesystem::path(web_root));
-      auto data_root = std::filesystem::weakly_canonical(root / "data");
-      auto full = std::filesystem::weakly_canonical(data_root / target.substr(6));
-      std::string data_root_str = data_root.string();
-      std::string full_str = full.string();
-      if (full_str.rfind(data_root_str, 0) != 0)
+      const std::string full_str = resolve_static_path(target);
+      if (full_str.empty())
         return make_404_response(keep);
       auto inm_it = request.base().find(http::field::if_none_match);
       if (inm_it != request.base().end())
@@ -366,12 +623,10 @@ private:
           http::response<> res;
           res.result(boost::beast::http::status::not_modified);
           res.base().set(http::field::etag, etag);
-          auto mt = mime_type(full_str);
-          res.base().set(http::field::content_type, mt);
-          if (mt.starts_with("image/") || mt == "application/javascript" || mt == "text/css" || mt.starts_with("audio/") || mt.starts_with("video/"))
-            res.base().set(http::field::cache_control, "public, max-age=31536000, immutable");
-          else if (mt == "text/html") res.base().set(http::field::cache_control, "no-cache");
-          else if (mt == "application/json") res.base().set(http::field::cache_control, "no-store");
+          const std::string_view mt = mime_type(full_str);
+          res.base().set(http::field::content_type, boost::beast::string_view(mt.data(), mt.size()));
+          if (const auto cache_control = cache_control_for(mt); !cache_control.empty())
+            res.base().set(http::field::cache_control, boost::beast::string_view(cache_control.data(), cache_control.size()));
           res.keep_alive(keep);
           res.base().set(http::field::access_control_allow_origin, "*");
           res.base().content_length(0);
@@ -385,24 +640,11 @@ private:
     }
 
 
-    std::string rel;
-    if (target == "/" || target == "/index.html")
-      rel = INDEX_HTML_PATH;
-    else if (!target.empty() && target[0] == '/')
-      rel = target.substr(1);
-    else
-      rel = target;
-
     try
     {
-      auto root = std::filesystem::weakly_canonical(std::filesystem::path(web_root));
-      auto full = std::filesystem::weakly_canonical(root / rel);
-      std::filesystem::path rel_path = std::filesystem::relative(full, root);
-      for (auto &part : rel_path)
-      {
-        if (part == "..")
-          throw std::runtime_error("path out of root");
-      }
+      const std::filesystem::path full = resolve_static_path(target);
+      if (full.empty())
+        throw std::runtime_error("path out of root");
       if (std::filesystem::exists(full) && std::filesystem::is_regular_file(full))
       {
         auto res = make_static_response(full.string(), keep);
@@ -451,6 +693,188 @@ private:
     return response;
   }
 
+  /**
+   * @brief 判断连接是否使用`HTTP/2`
+   * @param ptr 会话
+   * @param data 连接上已收到、尚未判定协议的字节
+   * @return `ALPN`协商出`h2`或数据以完整连接前言（`h2c`先验知识）开头时为`http2`；
+   * 数据短于前言且与前言开头一致时为`partial`，调用方缓存后等待更多数据；否则为`http1`
+   */
+  static preface_match match_http2_start(const session_ptr &ptr, std::string_view data)
+  {
+    if (ptr->get_alpn_protocol() == "h2")
+      return preface_match::http2;
+    if (data.size() >= http2::connection_preface.size())
+      return data.starts_with(http2::connection_preface) ? preface_match::http2 : preface_match::http1;
+    if (!data.empty() && http2::connection_preface.starts_with(data))
+      return preface_match::partial;
+    return preface_match::http1;
+  }
+
+  /**
+   * @brief 在`HTTP/2`连接上处理收到的数据
+   * @details 每个流收齐请求后交给`default_handle_request`，响应由状态机按流量窗口与优先级拆成帧
+   */
+  void serve_http2(const session_ptr &ptr, const std::shared_ptr<connection_channel> &channel, std::string_view data)
+  {
+    if (!channel->h2)
+    {
+      channel->h2 = std::make_unique<http2::connection>();
+      std::cout << format_print("http2 connection,from ip:{},port:{}", ptr->get_remote_address(), ptr->get_remote_port()) << std::endl;
+      auto *connection = channel->h2.get();
+      auto handle_stream = [this, connection](std::uint32_t stream_id, http::request<> &&request)
+      {
+        try
+        {
+          connection->submit_response(stream_id, default_handle_request(request));
+        }
+        catch (const std::exception &e)
+        {
+          std::cout << format_print(" server error :stream {},{}", stream_id, e.what()) << std::endl;
+          connection->submit_response(stream_id, make_500_response(true));
+        }
+      }; // end Lambda handle_stream
+      channel->h2->set_request_handler(handle_stream);
+    }
+    if (!channel->h2->feed(data))
+      std::cout << format_print("http2 protocol error,from ip:{},port:{}", ptr->get_remote_address(), ptr->get_remote_port()) << std::endl;
+    flush_http2(ptr, channel);
+  }
+
+  /**
+   * @brief 写出`HTTP/2`状态机中待发送的帧
+   * @details 同一时刻只有一个写操作，写完后继续取新的输出；`GOAWAY`后全部流完成时关闭会话
+   */
+  void flush_http2(const session_ptr &ptr, const std::shared_ptr<connection_channel> &channel)
+  {
+    if (channel->writing)
+      return;
+    if (!channel->h2->has_output())
+    {
+      // 关闭会话会释放接收回调，当前可能正处于该回调中，因此投递到 io 上下文执行
+      if (channel->h2->finished())
+        boost::asio::post(io_context, [sess_ptr = ptr] { sess_ptr->close(); });
+      return;
+    }
+    channel->writing = true;
+    auto written = [this, sess_ptr = ptr, channel](const boost::system::error_code &ec)
+    {
+      channel->writing = false;
+      if (ec)
+      {
+        server::log_send_result(sess_ptr, ec);
+        sess_ptr->close();
+        return;
+      }
+      flush_http2(sess_ptr, channel);
+    }; // end Lambda written
+    ptr->async_send_bytes(channel->h2->take_output(), written);
+  }
+
+  /**
+   * @brief 把`HTTP/1.1`连接升级为`WebSocket`推送通道
+   * @param ptr 会话
+   * @param channel 连接状态
+   * @param request 升级请求
+   * @param rest 同一数据块中紧跟在请求头之后的字节（客户端可能已发送首帧）
+   * @details `101`响应先排入输出队列，之后的广播帧经会话的写入回调排在其后；仅当协商出完整窗口的压缩参数时，
+   * 会话才接收广播时共享的压缩帧
+   */
+  void upgrade_websocket(const session_ptr &ptr, const std::shared_ptr<connection_channel> &channel,
+                         const http::request<> &request, std::string_view rest)
+  {
+    websocket::deflate_options deflate;
+    if (auto it = request.base().find(http::field::sec_websocket_extensions); it != request.base().end())
+      deflate = websocket::negotiate_deflate(std::string_view(it->value().data(), it->value().size()));
+    channel->ws_output = websocket::make_handshake_response(request, deflate).to_string();
+    websocket::connection_config config;
+    config._deflate = deflate;
+    channel->ws = std::make_unique<websocket::connection>(config);
+    auto handle_message = [this, session_id = ptr->get_session_id()](std::string_view message, bool text)
+    {
+      if (websocket_handler)
+        websocket_handler(session_id, message, text);
+    }; // end Lambda handle_message
+    channel->ws->set_message_handler(handle_message);
+    // 会话持有写入回调，回调只弱引用会话，避免循环引用
+    auto write_frame = [this, channel, weak_session = std::weak_ptr(ptr)](std::string_view frame)
+    {
+      auto sess_ptr = weak_session.lock();
+      if (!sess_ptr)
+        return;
+      {
+        std::scoped_lock lk(channel->ws_mutex);
+        if (channel->ws->closed())
+          return;
+        channel->ws_output.append(frame);
+      }
+      flush_websocket(sess_ptr, channel);
+    }; // end Lambda write_frame
+    ptr->upgrade_websocket(deflate._enabled && deflate._server_window_bits == 15, config._compress_threshold, write_frame);
+    std::cout << format_print("websocket connection,from ip:{},port:{}", ptr->get_remote_address(), ptr->get_remote_port()) << std::endl;
+    if (!rest.empty())
+      serve_websocket(ptr, channel, rest);
+    else
+      flush_websocket(ptr, channel);
+  }
+
+  /**
+   * @brief 在`WebSocket`连接上处理收到的数据
+   * @details 控制帧的应答（`PONG`、`CLOSE`）与广播帧排入同一输出队列，按顺序异步写出
+   */
+  void serve_websocket(const session_ptr &ptr, const std::shared_ptr<connection_channel> &channel, std::string_view data)
+  {
+    bool open = false;
+    {
+      std::scoped_lock lk(channel->ws_mutex);
+      open = channel->ws->feed(data);
+    }
+    if (!open)
+      std::cout << format_print("websocket closed,from ip:{},port:{}", ptr->get_remote_address(), ptr->get_remote_port()) << std::endl;
+    flush_websocket(ptr, channel);
+  }
+
+  /**
+   * @brief 写出`WebSocket`连接输出队列中的字节
+   * @details 同一时刻只有一个写操作，在途期间入队的帧在写完后合并写出；关闭握手完成或协议错误后，
+   * 写完输出再关闭会话。队列状态在`ws_mutex`下读写，发起写操作时不持锁（未连接时回调会同步执行）
+   */
+  void flush_websocket(const session_ptr &ptr, const std::shared_ptr<connection_channel> &channel)
+  {
+    std::string output;
+    {
+      std::scoped_lock lk(channel->ws_mutex);
+      if (channel->writing)
+        return;
+      if (channel->ws->has_output())
+        channel->ws_output.append(channel->ws->take_output());
+      if (channel->ws_output.empty())
+      {
+        // 关闭会话会释放接收回调，当前可能正处于该回调中，因此投递到 io 上下文执行
+        if (channel->ws->closed())
+          boost::asio::post(io_context, [sess_ptr = ptr] { sess_ptr->close(); });
+        return;
+      }
+      channel->writing = true;
+      output = std::exchange(channel->ws_output, std::string{});
+    }
+    auto written = [this, sess_ptr = ptr, channel](const boost::system::error_code &ec)
+    {
+      {
+        std::scoped_lock lk(channel->ws_mutex);
+        channel->writing = false;
+      }
+      if (ec)
+      {
+        server::log_send_result(sess_ptr, ec);
+        sess_ptr->close();
+        return;
+      }
+      flush_websocket(sess_ptr, channel);
+    }; // end Lambda written
+    ptr->async_send_bytes(output, written);
+  }
+
   static void log_send_result(const std::shared_ptr<session::session<http::request<>, http::response<>>>& sess_ptr,
     const boost::system::error_code& ec)
   {
@@ -472,11 +896,42 @@ private:
     {
       if (!ec)
       {
-        using session_ptr = std::shared_ptr<session::session<http::request<>, http::response<>>>;
+        auto channel = std::make_shared<connection_channel>();
 
         // 接受数据的处理
-        auto func = [this](const session_ptr& ptr, std::string_view data)
+        auto func = [this, channel](const session_ptr& ptr, std::string_view data)
         {
+          if (channel->h2)
+          {
+            serve_http2(ptr, channel, data);
+            return;
+          }
+          if (channel->ws)
+          {
+            serve_websocket(ptr, channel, data);
+            return;
+          }
+
+          // 前言可能被拆成多个数据块：与前言一致的不完整开头先缓存，收齐或出现不一致时再判定
+          std::string joined;
+          if (!channel->preface.empty())
+          {
+            joined = std::move(channel->preface);
+            joined.append(data);
+            channel->preface.clear();
+            data = joined;
+          }
+          switch (match_http2_start(ptr, data))
+          {
+          case preface_match::http2:
+            serve_http2(ptr, channel, data);
+            return;
+          case preface_match::partial:
+            channel->preface.assign(data);
+            return;
+          case preface_match::http1:
+            break;
+          }
 
           // 处理响应发送回调
           auto call = [sess_ptr = ptr](boost::system::error_code ec)
@@ -499,6 +954,22 @@ private:
             return;
           }
 
+          const auto target = request.target();
+          if (websocket::is_upgrade_request(request) && std::string_view(target.data(), target.size()) == WEBSOCKET_PATH)
+          {
+            auto header_end = data.find("\r\n\r\n");
+            upgrade_websocket(ptr, channel, request, header_end == std::string_view::npos ? std::string_view{} : data.substr(header_end + 4));
+            return;
+          }
+
+          // 缓存命中的静态文件：预渲染头块与文件内容两段缓冲区直接聚集写出
+          if (auto prebuilt = find_prebuilt_response(request))
+          {
+            std::cout << format_print("request success,from ip:{},port:{}",ptr->get_remote_address(),ptr->get_remote_port()) << std::endl;
+            ptr->async_send_buffers(std::move(prebuilt->header), std::move(prebuilt->body), call);
+            return;
+          }
+
           try
           {
             http::response<> res = default_handle_request(request);
@@ -521,7 +992,8 @@ private:
 
         std::cout << format_print("connection successful,from ip {},port:{}",
               socket.remote_endpoint().address().to_string(), socket.remote_endpoint().port()) << std::endl;
-        const auto value = session_management.create_server_session(std::move(socket));
+        const auto value = tls_enabled ? session_management.create_server_session(std::move(socket), tls_config)
+                                       : session_management.create_server_session(std::move(socket));
         std::cout << format_print("{} create session success,id:{} ", value.second->get_remote_address(), 
               value.first) << std::endl;
 
@@ -557,6 +1029,42 @@ public:
   }
 
 
+  /**
+   * @brief 启用`TLS`，之后接受的连接先握手，并通过`ALPN`在`h2`与`http/1.1`间协商
+   * @param cert_file 证书链文件（`PEM`）
+   * @param key_file 私钥文件（`PEM`）
+   * @note 需在`start()`之前调用
+   */
+  void enable_tls(const std::string &cert_file, const std::string &key_file)
+  {
+    tls_config._enable_ssl = true;
+    tls_config._ssl_cert_file = cert_file;
+    tls_config._ssl_key_file = key_file;
+    tls_config._alpn_protocols = {"h2", "http/1.1"};
+    tls_enabled = true;
+  }
+
+  /**
+   * @brief 设置`WebSocket`客户端消息回调
+   * @param handler 收到完整消息（已解压、文本已校验`UTF-8`）时调用，参数为会话`ID`、消息和是否为文本
+   */
+  void set_websocket_handler(websocket_message_fn handler)
+  {
+    websocket_handler = std::move(handler);
+  }
+
+  /**
+   * @brief 向所有`WebSocket`客户端推送一条消息
+   * @param message 消息内容
+   * @param text 是否按文本帧发送，文本须为合法`UTF-8`；否则按二进制帧发送
+   * @return `true` 有提交；`false` 当前没有`WebSocket`客户端
+   * @note 帧只编码一次并在所有连接间共享，用于实时更新、存档同步等替代客户端轮询的场景
+   */
+  bool push(std::string_view message, bool text)
+  {
+    return session_management.broadcast_bytes(message, weight::normal, true, agreement::protocol_type::WEBSOCKET, text);
+  }
+
   void start()
   {
     server_running.store(true);